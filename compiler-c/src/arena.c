@@ -1,12 +1,21 @@
+#define _DEFAULT_SOURCE  // 用于 mmap 的 MAP_ANONYMOUS
 #include "arena.h"
+#include "intern.h"
 #include <stdint.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 
 // 内存对齐边界（字节）
 #define ARENA_ALIGNMENT 8
 
+// 后续块的默认映射大小（单次分配更大时按需加大）
+#define ARENA_CHUNK_SIZE (8 * 1024 * 1024)  // 8MB
+
+// 映射大小按页对齐
+#define ARENA_PAGE_SIZE 4096
+
 // 对齐到指定边界
 // 参数：size - 要对齐的大小，align - 对齐边界
 // 返回：对齐后的大小
@@ -16,52 +25,155 @@ static size_t align_size(size_t size, size_t align) {
 
 // 初始化 Arena 分配器
 void arena_init(Arena *arena, void *buffer, size_t size) {
-    if (arena == NULL || buffer == NULL) {
+    if (arena == NULL) {
         return;
     }
-    
+
+    if (buffer == NULL) {
+        size = 0;
+    }
     arena->buffer = (uint8_t *)buffer;
     arena->size = size;
     arena->offset = 0;
+    arena->chunk = NULL;
+    arena->base_buffer = (uint8_t *)buffer;
+    arena->base_size = size;
+    arena->retired = 0;
+    arena->peak_bytes = 0;
+    arena->reserved_bytes = size;
+    arena->alloc_count = 0;
+    arena->chunk_count = 0;
+    arena->interner = NULL;
+}
+
+// 映射一个新块并切换为当前块（能容纳至少 min_size 字节）
+static void arena_push_chunk(Arena *arena, size_t min_size) {
+    size_t header_size = align_size(sizeof(ArenaChunk), ARENA_ALIGNMENT);
+    size_t map_size = ARENA_CHUNK_SIZE;
+    if (min_size + header_size > map_size) {
+        map_size = align_size(min_size + header_size, ARENA_PAGE_SIZE);
+    }
+
+    void *mem = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        fprintf(stderr, "错误: Arena 分配失败（无法映射 %zu 字节的新块，已使用 %zu 字节）\n",
+                map_size, arena->retired + arena->offset);
+        exit(1);
+    }
+
+    ArenaChunk *chunk = (ArenaChunk *)mem;
+    chunk->prev = arena->chunk;
+    chunk->map_size = map_size;
+    chunk->prev_buffer = arena->buffer;
+    chunk->prev_size = arena->size;
+    chunk->prev_offset = arena->offset;
+    chunk->prev_retired = arena->retired;
+
+    arena->retired += arena->offset;
+    arena->chunk = chunk;
+    arena->buffer = (uint8_t *)mem + header_size;
+    arena->size = map_size - header_size;
+    arena->offset = 0;
+    arena->reserved_bytes += map_size;
+    arena->chunk_count++;
+}
+
+// 归还当前块并恢复前一块为当前块
+static void arena_pop_chunk(Arena *arena) {
+    ArenaChunk *chunk = arena->chunk;
+    arena->chunk = chunk->prev;
+    arena->buffer = chunk->prev_buffer;
+    arena->size = chunk->prev_size;
+    arena->offset = chunk->prev_offset;
+    arena->retired = chunk->prev_retired;
+    arena->reserved_bytes -= chunk->map_size;
+    arena->chunk_count--;
+    munmap((void *)chunk, chunk->map_size);
 }
 
 // 从 Arena 分配内存
 void *arena_alloc(Arena *arena, size_t size) {
-    if (arena == NULL || arena->buffer == NULL) {
-        fprintf(stderr, "错误: Arena 分配失败（Arena 或 buffer 未初始化）\n");
+    if (arena == NULL) {
+        fprintf(stderr, "错误: Arena 分配失败（Arena 未初始化）\n");
         exit(1);
     }
-    
+
     // 对齐当前的 offset，确保返回的地址是 8 字节对齐的
     size_t aligned_offset = align_size(arena->offset, ARENA_ALIGNMENT);
-    
+
     // 对齐请求的大小
     size_t aligned_size = align_size(size, ARENA_ALIGNMENT);
-    
-    // 检查是否有足够空间；不足则报错退出
-    if (aligned_offset + aligned_size > arena->size) {
-        size_t need = aligned_size;
-        size_t remaining = (arena->size > aligned_offset) ? (arena->size - aligned_offset) : 0;
-        fprintf(stderr, "错误: Arena 分配失败（内存不足，需要 %zu 字节，剩余 %zu 字节）\n", need, remaining);
-        fprintf(stderr, "提示: 请增加 ARENA_BUFFER_SIZE 后重新编译编译器\n");
-        exit(1);
+
+    // 当前块空间不足时追加新块（当前块剩余空间随之废弃）
+    if (arena->buffer == NULL || aligned_offset + aligned_size > arena->size) {
+        arena_push_chunk(arena, aligned_size);
+        aligned_offset = 0;
     }
-    
+
     // 计算返回的地址（buffer + 对齐后的 offset）
     void *result = (void *)(arena->buffer + aligned_offset);
-    
+
     // 更新 offset（移动到对齐后的位置 + 分配的大小）
     arena->offset = aligned_offset + aligned_size;
-    
+
+    // 更新统计
+    arena->alloc_count++;
+    if (arena->retired + arena->offset > arena->peak_bytes) {
+        arena->peak_bytes = arena->retired + arena->offset;
+    }
+
     return result;
 }
 
+// 获取当前分配位置
+ArenaMark arena_mark(const Arena *arena) {
+    ArenaMark mark;
+    mark.chunk = arena->chunk;
+    mark.offset = arena->offset;
+    mark.interner = arena->interner;
+    mark.interned_count = arena->interner != NULL ? arena->interner->count : 0;
+    return mark;
+}
+
+// 回退到 mark 时的位置
+void arena_rewind(Arena *arena, ArenaMark mark) {
+    if (arena == NULL) {
+        return;
+    }
+
+    while (arena->chunk != mark.chunk && arena->chunk != NULL) {
+        arena_pop_chunk(arena);
+    }
+    arena->offset = mark.offset;
+
+    // 驻留表无法删除单个条目：mark 之后新驻留的字符串已被释放，整表丢弃
+    if (arena->interner != mark.interner ||
+        (arena->interner != NULL && arena->interner->count != mark.interned_count)) {
+        arena->interner = NULL;
+    }
+}
+
 // 重置 Arena 分配器
 void arena_reset(Arena *arena) {
     if (arena == NULL) {
         return;
     }
-    
+
+    while (arena->chunk != NULL) {
+        arena_pop_chunk(arena);
+    }
+    arena->buffer = arena->base_buffer;
+    arena->size = arena->base_size;
     arena->offset = 0;
+    arena->retired = 0;
+    arena->interner = NULL;
 }
 
+// 获取 Arena 使用统计
+void arena_get_stats(const Arena *arena, ArenaStats *stats) {
+    stats->bytes_used = arena->retired + arena->offset;
+    stats->peak_bytes = arena->peak_bytes;
+    stats->reserved_bytes = arena->reserved_bytes;
+    stats->alloc_count = arena->alloc_count;
+    stats->chunk_count = arena->chunk_count;
+}
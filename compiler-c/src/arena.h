@@ -4,30 +4,78 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// Arena 块头（mmap 得到的后续块，位于块起始处，数据紧随其后）
+// 记录切换到本块之前“当前块”的状态，回退（rewind）时据此恢复
+typedef struct ArenaChunk {
+    struct ArenaChunk *prev;    // 前一个 mmap 块（NULL 表示前一块是初始缓冲区）
+    size_t map_size;            // 映射总大小（含块头，字节）
+    uint8_t *prev_buffer;       // 前一块的数据起始
+    size_t prev_size;           // 前一块的容量
+    size_t prev_offset;         // 前一块切换时已用的字节数
+    size_t prev_retired;        // 切换前已退役块的累计使用量
+} ArenaChunk;
+
 // Arena 分配器结构体
-// 使用静态缓冲区 + bump pointer 实现无堆分配的内存管理
+// 分块 bump pointer 分配器：可选的初始静态缓冲区 + 按需 mmap 的后续块，
+// 当前块用完时自动追加新块，不再因空间不足而退出
 typedef struct {
-    uint8_t *buffer;        // 静态缓冲区指针
-    size_t size;            // 缓冲区总大小（字节）
-    size_t offset;          // 当前分配位置（bump pointer）
+    uint8_t *buffer;            // 当前块数据起始
+    size_t size;                // 当前块容量（字节）
+    size_t offset;              // 当前块分配位置（bump pointer）
+    ArenaChunk *chunk;          // 当前 mmap 块（NULL 表示仍在初始缓冲区中）
+    uint8_t *base_buffer;       // 初始缓冲区（可为 NULL）
+    size_t base_size;           // 初始缓冲区大小
+    size_t retired;             // 已退役块（当前块之前的块）的使用量
+    size_t peak_bytes;          // 使用量峰值
+    size_t reserved_bytes;      // 当前占用的总容量（初始缓冲区 + 已映射块）
+    size_t alloc_count;         // 分配次数
+    int chunk_count;            // 当前已映射的块数量
+    struct StringInterner *interner;  // 字符串驻留表（见 intern.h，首次驻留时创建）
 } Arena;
 
+// Arena 回退点（arena_mark 获取，arena_rewind 恢复）
+typedef struct {
+    ArenaChunk *chunk;          // 标记时的当前块
+    size_t offset;              // 标记时当前块的分配位置
+    struct StringInterner *interner;  // 标记时的驻留表
+    int interned_count;         // 标记时驻留表中的字符串数量
+} ArenaMark;
+
+// Arena 使用统计
+typedef struct {
+    size_t bytes_used;          // 当前使用量（字节，含对齐填充）
+    size_t peak_bytes;          // 使用量峰值
+    size_t reserved_bytes;      // 当前占用的总容量
+    size_t alloc_count;         // 累计分配次数（回退与重置不清零）
+    int chunk_count;            // 已映射的块数量
+} ArenaStats;
+
 // 初始化 Arena 分配器
-// 参数：arena - Arena 结构体指针，buffer - 静态缓冲区，size - 缓冲区大小
-// 注意：buffer 必须是一个静态缓冲区（栈上或全局），不能是堆分配的内存
+// 参数：arena - Arena 结构体指针，buffer - 初始缓冲区（可为 NULL），size - 缓冲区大小
+// 注意：buffer 必须是一个静态缓冲区（栈上或全局），不能是堆分配的内存；
+//       buffer 为 NULL 时所有内存都来自按需映射的块
 void arena_init(Arena *arena, void *buffer, size_t size);
 
 // 从 Arena 分配内存
 // 参数：arena - Arena 分配器指针，size - 要分配的内存大小（字节）
-// 返回：分配的内存指针；空间不足时打印错误并 exit(1)，不会返回 NULL
+// 返回：分配的内存指针；映射新块失败时打印错误并 exit(1)，不会返回 NULL
 // 注意：分配的内存会自动对齐到 8 字节边界
 void *arena_alloc(Arena *arena, size_t size);
 
+// 获取当前分配位置，供 arena_rewind 回退使用
+ArenaMark arena_mark(const Arena *arena);
+
+// 回退到 mark 时的位置，释放其后分配的所有内存（归还其后映射的块）
+// 注意：若 mark 之后驻留过字符串，驻留表会被丢弃（之后驻留会重新建表）
+void arena_rewind(Arena *arena, ArenaMark mark);
+
 // 重置 Arena 分配器
 // 参数：arena - Arena 分配器指针
-// 将 bump pointer 重置到开始位置，释放所有已分配的内存
-// 注意：不会清除缓冲区内容，只是重置指针
+// 将 bump pointer 重置到初始缓冲区开始位置，归还所有映射块，释放所有已分配的内存（包括字符串驻留表）
+// 注意：不会清除缓冲区内容，只是重置指针；统计中的峰值与分配次数保留
 void arena_reset(Arena *arena);
 
-#endif // ARENA_H
+// 获取 Arena 使用统计
+void arena_get_stats(const Arena *arena, ArenaStats *stats);
 
+#endif // ARENA_H
@@ -1,4 +1,5 @@
 #include "ast.h"
+#include "intern.h"
 #include <stddef.h>
 #include <string.h>
 #include <stdio.h>
@@ -25,6 +26,7 @@ ASTNode *ast_new_node(ASTNodeType type, int line, int column, Arena *arena, cons
     node->line = line;
     node->column = column;
     node->filename = filename;  // 保存文件名用于错误报告
+    node->resolved_type = NULL;
     
     // 根据节点类型初始化 union 数据
     // 注意：所有指针字段初始化为 NULL，数组字段初始化为 NULL 和 0
@@ -32,6 +34,7 @@ ASTNode *ast_new_node(ASTNodeType type, int line, int column, Arena *arena, cons
         case AST_PROGRAM:
             node->data.program.decls = NULL;
             node->data.program.decl_count = 0;
+            node->data.program.decl_index = NULL;
             break;
         case AST_ENUM_DECL:
             node->data.enum_decl.name = NULL;
@@ -398,6 +401,522 @@ ASTNode *ast_merge_programs(ASTNode **programs, int count, Arena *arena) {
     merged->data.program.decls = decls;
     merged->data.program.decl_count = total_decl_count;
     
+    // 建立全局声明索引，供 checker 与 codegen 共用
+    if (ast_build_decl_index(merged, arena) != 0) {
+        return NULL;
+    }
+    
     return merged;
 }
 
+// 声明索引键哈希（djb2，依次混入 kind、owner、name）
+static unsigned int decl_key_hash(DeclKeyKind kind, const char *owner, const char *name) {
+    unsigned int hash = 5381u + (unsigned int)kind * 33u;
+    if (owner != NULL) {
+        for (const char *p = owner; *p; p++) {
+            hash = ((hash << 5) + hash) + (unsigned char)*p;
+        }
+        hash = ((hash << 5) + hash) + '.';
+    }
+    for (const char *p = name; *p; p++) {
+        hash = ((hash << 5) + hash) + (unsigned char)*p;
+    }
+    return hash;
+}
+
+static int decl_key_equals(const DeclIndexEntry *entry, DeclKeyKind kind, unsigned int hash,
+                           const char *owner, const char *name) {
+    if (entry->kind != kind || entry->hash != hash) return 0;
+    if ((entry->owner == NULL) != (owner == NULL)) return 0;
+    if (owner != NULL && !INTERN_STR_EQ(entry->owner, owner)) return 0;
+    return INTERN_STR_EQ(entry->name, name);
+}
+
+// 查找键对应的槽位（线性探测，遇到空槽位即停止）
+static DeclIndexEntry *decl_index_probe(DeclIndex *index, DeclKeyKind kind, unsigned int hash,
+                                        const char *owner, const char *name) {
+    unsigned int mask = (unsigned int)(index->capacity - 1);
+    for (unsigned int i = hash & mask; ; i = (i + 1) & mask) {
+        DeclIndexEntry *entry = &index->entries[i];
+        if (entry->node == NULL || decl_key_equals(entry, kind, hash, owner, name)) {
+            return entry;
+        }
+    }
+}
+
+// 插入键（已存在时保留先插入的声明）
+static void decl_index_insert(DeclIndex *index, DeclKeyKind kind, const char *owner, const char *name, ASTNode *node) {
+    if (name == NULL || node == NULL) return;
+    unsigned int hash = decl_key_hash(kind, owner, name);
+    DeclIndexEntry *entry = decl_index_probe(index, kind, hash, owner, name);
+    if (entry->node != NULL) return;
+    entry->kind = kind;
+    entry->hash = hash;
+    entry->owner = owner;
+    entry->name = name;
+    entry->node = node;
+    index->count++;
+}
+
+static ASTNode *decl_index_lookup(DeclIndex *index, DeclKeyKind kind, const char *owner, const char *name) {
+    unsigned int hash = decl_key_hash(kind, owner, name);
+    return decl_index_probe(index, kind, hash, owner, name)->node;
+}
+
+// 将方法数组中的方法加入索引（跳过尚未展开的宏调用等非函数节点）
+static void decl_index_insert_methods(DeclIndex *index, DeclKeyKind kind, const char *owner,
+                                      ASTNode **methods, int method_count) {
+    if (methods == NULL) return;
+    for (int i = 0; i < method_count; i++) {
+        ASTNode *m = methods[i];
+        if (m != NULL && m->type == AST_FN_DECL) {
+            decl_index_insert(index, kind, owner, m->data.fn_decl.name, m);
+        }
+    }
+}
+
+// 统计声明产生的索引键数量（用于确定表容量）
+static int decl_key_count(ASTNode *decl) {
+    switch (decl->type) {
+        case AST_ENUM_DECL:
+            return 1 + decl->data.enum_decl.variant_count;
+        case AST_UNION_DECL:
+            return 1 + decl->data.union_decl.variant_count + decl->data.union_decl.method_count;
+        case AST_STRUCT_DECL:
+            return 1 + decl->data.struct_decl.method_count;
+        case AST_METHOD_BLOCK:
+            return 1 + decl->data.method_block.method_count;
+        default:
+            return 1;
+    }
+}
+
+// 建立全局声明索引
+int ast_build_decl_index(ASTNode *program, Arena *arena) {
+    if (program == NULL || program->type != AST_PROGRAM || arena == NULL) {
+        return -1;
+    }
+    
+    ASTNode **decls = program->data.program.decls;
+    int decl_count = program->data.program.decl_count;
+    
+    // 容量取键数量的 2 倍以上（2的幂），保证探测链短且总有空槽位
+    int key_count = 0;
+    for (int i = 0; i < decl_count; i++) {
+        if (decls[i] != NULL) key_count += decl_key_count(decls[i]);
+    }
+    int capacity = 16;
+    while (capacity < key_count * 2) {
+        capacity *= 2;
+    }
+    
+    DeclIndex *index = (DeclIndex *)arena_alloc(arena, sizeof(DeclIndex));
+    index->entries = (DeclIndexEntry *)arena_alloc(arena, sizeof(DeclIndexEntry) * (size_t)capacity);
+    memset(index->entries, 0, sizeof(DeclIndexEntry) * (size_t)capacity);
+    index->capacity = capacity;
+    index->count = 0;
+    
+    // 第一遍：顶层声明与变体名
+    for (int i = 0; i < decl_count; i++) {
+        ASTNode *decl = decls[i];
+        if (decl == NULL) continue;
+        switch (decl->type) {
+            case AST_FN_DECL:
+                decl_index_insert(index, DECL_KEY_FN, NULL, decl->data.fn_decl.name, decl);
+                break;
+            case AST_STRUCT_DECL:
+                decl_index_insert(index, DECL_KEY_STRUCT, NULL, decl->data.struct_decl.name, decl);
+                break;
+            case AST_UNION_DECL:
+                decl_index_insert(index, DECL_KEY_UNION, NULL, decl->data.union_decl.name, decl);
+                if (decl->data.union_decl.variants != NULL) {
+                    for (int j = 0; j < decl->data.union_decl.variant_count; j++) {
+                        ASTNode *v = decl->data.union_decl.variants[j];
+                        if (v != NULL && v->type == AST_VAR_DECL) {
+                            decl_index_insert(index, DECL_KEY_UNION_VARIANT, NULL, v->data.var_decl.name, decl);
+                        }
+                    }
+                }
+                break;
+            case AST_ENUM_DECL:
+                decl_index_insert(index, DECL_KEY_ENUM, NULL, decl->data.enum_decl.name, decl);
+                if (decl->data.enum_decl.variants != NULL) {
+                    for (int j = 0; j < decl->data.enum_decl.variant_count; j++) {
+                        decl_index_insert(index, DECL_KEY_ENUM_VARIANT, NULL, decl->data.enum_decl.variants[j].name, decl);
+                    }
+                }
+                break;
+            case AST_INTERFACE_DECL:
+                decl_index_insert(index, DECL_KEY_INTERFACE, NULL, decl->data.interface_decl.name, decl);
+                break;
+            case AST_TYPE_ALIAS:
+                decl_index_insert(index, DECL_KEY_TYPE_ALIAS, NULL, decl->data.type_alias.name, decl);
+                break;
+            case AST_MACRO_DECL:
+                decl_index_insert(index, DECL_KEY_MACRO, NULL, decl->data.macro_decl.name, decl);
+                break;
+            case AST_VAR_DECL:
+                decl_index_insert(index, DECL_KEY_VAR, NULL, decl->data.var_decl.name, decl);
+                break;
+            default:
+                break;
+        }
+    }
+    
+    // 第二遍：方法块。解析器统一记录为 struct_name，目标为联合体时由类型检查器改写为
+    // union_name；索引在改写前后给出同样的结果，因此按已登记的联合体名归类
+    for (int i = 0; i < decl_count; i++) {
+        ASTNode *decl = decls[i];
+        if (decl == NULL || decl->type != AST_METHOD_BLOCK) continue;
+        const char *struct_name = decl->data.method_block.struct_name;
+        if (struct_name != NULL && decl_index_lookup(index, DECL_KEY_UNION, NULL, struct_name) == NULL) {
+            decl_index_insert(index, DECL_KEY_STRUCT_METHODS, NULL, struct_name, decl);
+        } else {
+            const char *union_name = struct_name != NULL ? struct_name : decl->data.method_block.union_name;
+            decl_index_insert(index, DECL_KEY_UNION_METHODS, NULL, union_name, decl);
+        }
+    }
+    
+    // 第三遍：方法。查找顺序为“首个外部方法块，其次类型内部方法”，
+    // 因此先插入各类型首个方法块中的方法，再插入类型内部方法（已存在的键保持不变）
+    for (int i = 0; i < decl_count; i++) {
+        ASTNode *decl = decls[i];
+        if (decl == NULL || decl->type != AST_METHOD_BLOCK) continue;
+        const char *name = decl->data.method_block.struct_name != NULL ?
+                           decl->data.method_block.struct_name : decl->data.method_block.union_name;
+        if (name == NULL) continue;
+        if (decl_index_lookup(index, DECL_KEY_STRUCT_METHODS, NULL, name) == decl) {
+            decl_index_insert_methods(index, DECL_KEY_STRUCT_METHOD, name,
+                                      decl->data.method_block.methods, decl->data.method_block.method_count);
+        } else if (decl_index_lookup(index, DECL_KEY_UNION_METHODS, NULL, name) == decl) {
+            decl_index_insert_methods(index, DECL_KEY_UNION_METHOD, name,
+                                      decl->data.method_block.methods, decl->data.method_block.method_count);
+        }
+    }
+    for (int i = 0; i < decl_count; i++) {
+        ASTNode *decl = decls[i];
+        if (decl == NULL) continue;
+        if (decl->type == AST_STRUCT_DECL && decl->data.struct_decl.name != NULL &&
+            decl_index_lookup(index, DECL_KEY_STRUCT, NULL, decl->data.struct_decl.name) == decl) {
+            decl_index_insert_methods(index, DECL_KEY_STRUCT_METHOD, decl->data.struct_decl.name,
+                                      decl->data.struct_decl.methods, decl->data.struct_decl.method_count);
+        } else if (decl->type == AST_UNION_DECL && decl->data.union_decl.name != NULL &&
+                   decl_index_lookup(index, DECL_KEY_UNION, NULL, decl->data.union_decl.name) == decl) {
+            decl_index_insert_methods(index, DECL_KEY_UNION_METHOD, decl->data.union_decl.name,
+                                      decl->data.union_decl.methods, decl->data.union_decl.method_count);
+        }
+    }
+    
+    program->data.program.decl_index = index;
+    return 0;
+}
+
+// 线性扫描时判断声明是否匹配键（无索引时的回退路径）
+static int decl_matches_key(ASTNode *decl, DeclKeyKind kind, const char *name) {
+    const char *decl_name = NULL;
+    switch (kind) {
+        case DECL_KEY_FN:
+            if (decl->type == AST_FN_DECL) decl_name = decl->data.fn_decl.name;
+            break;
+        case DECL_KEY_STRUCT:
+            if (decl->type == AST_STRUCT_DECL) decl_name = decl->data.struct_decl.name;
+            break;
+        case DECL_KEY_UNION:
+            if (decl->type == AST_UNION_DECL) decl_name = decl->data.union_decl.name;
+            break;
+        case DECL_KEY_ENUM:
+            if (decl->type == AST_ENUM_DECL) decl_name = decl->data.enum_decl.name;
+            break;
+        case DECL_KEY_INTERFACE:
+            if (decl->type == AST_INTERFACE_DECL) decl_name = decl->data.interface_decl.name;
+            break;
+        case DECL_KEY_TYPE_ALIAS:
+            if (decl->type == AST_TYPE_ALIAS) decl_name = decl->data.type_alias.name;
+            break;
+        case DECL_KEY_MACRO:
+            if (decl->type == AST_MACRO_DECL) decl_name = decl->data.macro_decl.name;
+            break;
+        case DECL_KEY_VAR:
+            if (decl->type == AST_VAR_DECL) decl_name = decl->data.var_decl.name;
+            break;
+        case DECL_KEY_STRUCT_METHODS:
+            if (decl->type == AST_METHOD_BLOCK) decl_name = decl->data.method_block.struct_name;
+            break;
+        case DECL_KEY_UNION_METHODS:
+            if (decl->type == AST_METHOD_BLOCK) decl_name = decl->data.method_block.union_name;
+            break;
+        case DECL_KEY_ENUM_VARIANT:
+            if (decl->type == AST_ENUM_DECL && decl->data.enum_decl.variants != NULL) {
+                for (int j = 0; j < decl->data.enum_decl.variant_count; j++) {
+                    const char *v = decl->data.enum_decl.variants[j].name;
+                    if (v != NULL && strcmp(v, name) == 0) return 1;
+                }
+            }
+            return 0;
+        case DECL_KEY_UNION_VARIANT:
+            if (decl->type == AST_UNION_DECL && decl->data.union_decl.variants != NULL) {
+                for (int j = 0; j < decl->data.union_decl.variant_count; j++) {
+                    ASTNode *v = decl->data.union_decl.variants[j];
+                    if (v != NULL && v->type == AST_VAR_DECL && v->data.var_decl.name != NULL &&
+                        strcmp(v->data.var_decl.name, name) == 0) return 1;
+                }
+            }
+            return 0;
+        default:
+            return 0;
+    }
+    return decl_name != NULL && strcmp(decl_name, name) == 0;
+}
+
+// 按键类别与名称查找顶层声明
+ASTNode *ast_find_decl(ASTNode *program, DeclKeyKind kind, const char *name) {
+    if (program == NULL || program->type != AST_PROGRAM || name == NULL) {
+        return NULL;
+    }
+    if (program->data.program.decl_index != NULL) {
+        return decl_index_lookup(program->data.program.decl_index, kind, NULL, name);
+    }
+    for (int i = 0; i < program->data.program.decl_count; i++) {
+        ASTNode *decl = program->data.program.decls[i];
+        if (decl != NULL && decl_matches_key(decl, kind, name)) {
+            return decl;
+        }
+    }
+    return NULL;
+}
+
+// 在方法数组中按名称查找方法
+static ASTNode *find_method_in_list(ASTNode **methods, int method_count, const char *method_name) {
+    if (methods == NULL) return NULL;
+    for (int i = 0; i < method_count; i++) {
+        ASTNode *m = methods[i];
+        if (m != NULL && m->type == AST_FN_DECL && m->data.fn_decl.name != NULL &&
+            strcmp(m->data.fn_decl.name, method_name) == 0) {
+            return m;
+        }
+    }
+    return NULL;
+}
+
+// 查找结构体/联合体方法
+ASTNode *ast_find_method(ASTNode *program, DeclKeyKind kind, const char *owner, const char *method_name) {
+    if (program == NULL || program->type != AST_PROGRAM || owner == NULL || method_name == NULL) {
+        return NULL;
+    }
+    if (program->data.program.decl_index != NULL) {
+        return decl_index_lookup(program->data.program.decl_index, kind, owner, method_name);
+    }
+    ASTNode *m = NULL;
+    if (kind == DECL_KEY_STRUCT_METHOD) {
+        ASTNode *block = ast_find_decl(program, DECL_KEY_STRUCT_METHODS, owner);
+        if (block != NULL) {
+            m = find_method_in_list(block->data.method_block.methods, block->data.method_block.method_count, method_name);
+        }
+        if (m == NULL) {
+            ASTNode *struct_decl = ast_find_decl(program, DECL_KEY_STRUCT, owner);
+            if (struct_decl != NULL) {
+                m = find_method_in_list(struct_decl->data.struct_decl.methods, struct_decl->data.struct_decl.method_count, method_name);
+            }
+        }
+    } else if (kind == DECL_KEY_UNION_METHOD) {
+        ASTNode *block = ast_find_decl(program, DECL_KEY_UNION_METHODS, owner);
+        if (block != NULL) {
+            m = find_method_in_list(block->data.method_block.methods, block->data.method_block.method_count, method_name);
+        }
+        if (m == NULL) {
+            ASTNode *union_decl = ast_find_decl(program, DECL_KEY_UNION, owner);
+            if (union_decl != NULL) {
+                m = find_method_in_list(union_decl->data.union_decl.methods, union_decl->data.union_decl.method_count, method_name);
+            }
+        }
+    }
+    return m;
+}
+
+
+// 访问节点数组中的非 NULL 节点
+static void visit_nodes(ASTNode **nodes, int count, void (*visit)(ASTNode *child, void *ctx), void *ctx) {
+    if (nodes == NULL) {
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        if (nodes[i] != NULL) {
+            visit(nodes[i], ctx);
+        }
+    }
+}
+
+// 访问单个可为 NULL 的节点
+static void visit_node(ASTNode *node, void (*visit)(ASTNode *child, void *ctx), void *ctx) {
+    if (node != NULL) {
+        visit(node, ctx);
+    }
+}
+
+// 依次访问节点的直接子节点
+void ast_for_each_child(ASTNode *node, void (*visit)(ASTNode *child, void *ctx), void *ctx) {
+    if (node == NULL || visit == NULL) {
+        return;
+    }
+    switch (node->type) {
+        case AST_PROGRAM:
+            visit_nodes(node->data.program.decls, node->data.program.decl_count, visit, ctx);
+            break;
+        case AST_STRUCT_DECL:
+            visit_nodes(node->data.struct_decl.methods, node->data.struct_decl.method_count, visit, ctx);
+            break;
+        case AST_UNION_DECL:
+            visit_nodes(node->data.union_decl.methods, node->data.union_decl.method_count, visit, ctx);
+            break;
+        case AST_METHOD_BLOCK:
+            visit_nodes(node->data.method_block.methods, node->data.method_block.method_count, visit, ctx);
+            break;
+        case AST_FN_DECL:
+            visit_node(node->data.fn_decl.body, visit, ctx);
+            break;
+        case AST_VAR_DECL:
+            visit_node(node->data.var_decl.init, visit, ctx);
+            break;
+        case AST_DESTRUCTURE_DECL:
+            visit_node(node->data.destructure_decl.init, visit, ctx);
+            break;
+        case AST_IF_STMT:
+            visit_node(node->data.if_stmt.condition, visit, ctx);
+            visit_node(node->data.if_stmt.then_branch, visit, ctx);
+            visit_node(node->data.if_stmt.else_branch, visit, ctx);
+            break;
+        case AST_WHILE_STMT:
+            visit_node(node->data.while_stmt.condition, visit, ctx);
+            visit_node(node->data.while_stmt.body, visit, ctx);
+            break;
+        case AST_FOR_STMT:
+            visit_node(node->data.for_stmt.array, visit, ctx);
+            visit_node(node->data.for_stmt.range_start, visit, ctx);
+            visit_node(node->data.for_stmt.range_end, visit, ctx);
+            visit_node(node->data.for_stmt.body, visit, ctx);
+            break;
+        case AST_RETURN_STMT:
+            visit_node(node->data.return_stmt.expr, visit, ctx);
+            break;
+        case AST_DEFER_STMT:
+            visit_node(node->data.defer_stmt.body, visit, ctx);
+            break;
+        case AST_ERRDEFER_STMT:
+            visit_node(node->data.errdefer_stmt.body, visit, ctx);
+            break;
+        case AST_TEST_STMT:
+            visit_node(node->data.test_stmt.body, visit, ctx);
+            break;
+        case AST_ASSIGN:
+            visit_node(node->data.assign.dest, visit, ctx);
+            visit_node(node->data.assign.src, visit, ctx);
+            break;
+        case AST_BLOCK:
+            visit_nodes(node->data.block.stmts, node->data.block.stmt_count, visit, ctx);
+            break;
+        case AST_BINARY_EXPR:
+            visit_node(node->data.binary_expr.left, visit, ctx);
+            visit_node(node->data.binary_expr.right, visit, ctx);
+            break;
+        case AST_UNARY_EXPR:
+            visit_node(node->data.unary_expr.operand, visit, ctx);
+            break;
+        case AST_CALL_EXPR:
+            visit_node(node->data.call_expr.callee, visit, ctx);
+            visit_nodes(node->data.call_expr.args, node->data.call_expr.arg_count, visit, ctx);
+            break;
+        case AST_MACRO_CALL:
+            visit_node(node->data.macro_call.callee, visit, ctx);
+            visit_nodes(node->data.macro_call.args, node->data.macro_call.arg_count, visit, ctx);
+            break;
+        case AST_MEMBER_ACCESS:
+            visit_node(node->data.member_access.object, visit, ctx);
+            break;
+        case AST_ARRAY_ACCESS:
+            visit_node(node->data.array_access.array, visit, ctx);
+            visit_node(node->data.array_access.index, visit, ctx);
+            break;
+        case AST_SLICE_EXPR:
+            visit_node(node->data.slice_expr.base, visit, ctx);
+            visit_node(node->data.slice_expr.start_expr, visit, ctx);
+            visit_node(node->data.slice_expr.len_expr, visit, ctx);
+            break;
+        case AST_STRUCT_INIT:
+            visit_nodes(node->data.struct_init.field_values, node->data.struct_init.field_count, visit, ctx);
+            break;
+        case AST_ARRAY_LITERAL:
+            visit_nodes(node->data.array_literal.elements, node->data.array_literal.element_count, visit, ctx);
+            visit_node(node->data.array_literal.repeat_count_expr, visit, ctx);
+            break;
+        case AST_TUPLE_LITERAL:
+            visit_nodes(node->data.tuple_literal.elements, node->data.tuple_literal.element_count, visit, ctx);
+            break;
+        case AST_SIZEOF:
+            if (!node->data.sizeof_expr.is_type) {
+                visit_node(node->data.sizeof_expr.target, visit, ctx);
+            }
+            break;
+        case AST_ALIGNOF:
+            if (!node->data.alignof_expr.is_type) {
+                visit_node(node->data.alignof_expr.target, visit, ctx);
+            }
+            break;
+        case AST_LEN:
+            visit_node(node->data.len_expr.array, visit, ctx);
+            break;
+        case AST_CAST_EXPR:
+            visit_node(node->data.cast_expr.expr, visit, ctx);
+            break;
+        case AST_STRING_INTERP:
+            for (int i = 0; i < node->data.string_interp.segment_count; i++) {
+                if (!node->data.string_interp.segments[i].is_text) {
+                    visit_node(node->data.string_interp.segments[i].expr, visit, ctx);
+                }
+            }
+            break;
+        case AST_TRY_EXPR:
+            visit_node(node->data.try_expr.operand, visit, ctx);
+            break;
+        case AST_CATCH_EXPR:
+            visit_node(node->data.catch_expr.operand, visit, ctx);
+            visit_node(node->data.catch_expr.catch_block, visit, ctx);
+            break;
+        case AST_AWAIT_EXPR:
+            visit_node(node->data.await_expr.operand, visit, ctx);
+            break;
+        case AST_MATCH_EXPR:
+            visit_node(node->data.match_expr.expr, visit, ctx);
+            for (int i = 0; i < node->data.match_expr.arm_count; i++) {
+                ASTMatchArm *arm = &node->data.match_expr.arms[i];
+                if (arm->kind == MATCH_PAT_LITERAL) {
+                    visit_node(arm->data.literal.expr, visit, ctx);
+                }
+                visit_node(arm->result_expr, visit, ctx);
+            }
+            break;
+        case AST_SYSCALL:
+            visit_node(node->data.syscall.syscall_number, visit, ctx);
+            visit_nodes(node->data.syscall.args, node->data.syscall.arg_count, visit, ctx);
+            break;
+        case AST_MC_EVAL:
+            visit_node(node->data.mc_eval.operand, visit, ctx);
+            break;
+        case AST_MC_CODE:
+            visit_node(node->data.mc_code.operand, visit, ctx);
+            break;
+        case AST_MC_AST:
+            visit_node(node->data.mc_ast.operand, visit, ctx);
+            break;
+        case AST_MC_ERROR:
+            visit_node(node->data.mc_error.operand, visit, ctx);
+            break;
+        case AST_MC_INTERP:
+            visit_node(node->data.mc_interp.operand, visit, ctx);
+            break;
+        case AST_MC_TYPE:
+            visit_node(node->data.mc_type.operand, visit, ctx);
+            break;
+        default:
+            break;
+    }
+}
@@ -137,12 +137,14 @@ struct ASTNode {
     int line;           // 行号
     int column;         // 列号
     const char *filename; // 文件名（从 Lexer 中获取，用于错误报告）
+    struct Type *resolved_type; // 类型检查器推断出的表达式类型（见 checker.h，未检查或非表达式节点为 NULL）
     
     union {
         // 程序节点
         struct {
             struct ASTNode **decls;      // 声明数组（从 Arena 分配）
             int decl_count;       // 声明数量
+            struct DeclIndex *decl_index;  // 全局声明索引（ast_build_decl_index 建立，可为 NULL）
         } program;
         
         // 枚举声明
@@ -563,6 +565,41 @@ typedef struct ASTStringInterpSegment {
     const char *format_spec;  // 格式说明符（!is_text 时可选，如 ".2f"，存储在 Arena）
 } ASTStringInterpSegment;
 
+// 全局声明索引的键类别
+typedef enum {
+    DECL_KEY_FN,              // 函数声明（名称）
+    DECL_KEY_STRUCT,          // 结构体声明
+    DECL_KEY_UNION,           // 联合体声明
+    DECL_KEY_ENUM,            // 枚举声明
+    DECL_KEY_INTERFACE,       // 接口声明
+    DECL_KEY_TYPE_ALIAS,      // 类型别名
+    DECL_KEY_MACRO,           // 宏声明
+    DECL_KEY_VAR,             // 全局变量/常量声明
+    DECL_KEY_STRUCT_METHODS,  // 结构体外部方法块（按结构体名）
+    DECL_KEY_UNION_METHODS,   // 联合体外部方法块（按联合体名）
+    DECL_KEY_STRUCT_METHOD,   // 结构体方法（owner=结构体名，name=方法名）
+    DECL_KEY_UNION_METHOD,    // 联合体方法（owner=联合体名，name=方法名）
+    DECL_KEY_ENUM_VARIANT,    // 枚举变体名 -> 首个包含该变体的枚举声明
+    DECL_KEY_UNION_VARIANT,   // 联合体变体名 -> 首个包含该变体的联合体声明
+} DeclKeyKind;
+
+// 全局声明索引项
+typedef struct DeclIndexEntry {
+    DeclKeyKind kind;         // 键类别
+    unsigned int hash;        // (kind, owner, name) 的哈希值
+    const char *owner;        // 方法所属类型名（仅方法键有效，其余为 NULL）
+    const char *name;         // 声明名称
+    struct ASTNode *node;     // 对应的声明节点（NULL 表示空槽位）
+} DeclIndexEntry;
+
+// 全局声明索引（开放寻址哈希表，从 Arena 分配）
+// 同一键只记录声明顺序中的第一个，与线性扫描 program.decls 的结果一致
+typedef struct DeclIndex {
+    DeclIndexEntry *entries;  // 槽位数组
+    int capacity;             // 槽位数量（2的幂）
+    int count;                // 已用槽位数量
+} DeclIndex;
+
 // AST 节点创建函数
 // 参数：type - 节点类型，line - 行号，column - 列号，arena - Arena 分配器
 // 返回：新创建的 AST 节点指针，失败返回 NULL
@@ -575,5 +612,27 @@ ASTNode *ast_new_node(ASTNodeType type, int line, int column, Arena *arena, cons
 // 返回：合并后的 AST_PROGRAM 节点，失败返回 NULL
 ASTNode *ast_merge_programs(ASTNode **programs, int count, Arena *arena);
 
+// 为 AST_PROGRAM 建立（或重建）全局声明索引，结果挂在 program->data.program.decl_index
+// 参数：program - AST_PROGRAM 节点，arena - Arena 分配器
+// 返回：成功返回 0，失败返回 -1
+// 注意：宏展开等改写顶层声明或方法块后需重新调用
+int ast_build_decl_index(ASTNode *program, Arena *arena);
+
+// 按键类别与名称查找顶层声明（有索引时 O(1)，否则线性扫描）
+// 参数：program - AST_PROGRAM 节点，kind - 键类别（非方法键），name - 名称
+// 返回：声明顺序中第一个匹配的节点，未找到返回 NULL
+ASTNode *ast_find_decl(ASTNode *program, DeclKeyKind kind, const char *name);
+
+// 查找结构体/联合体方法：先查外部方法块，再查类型内部定义的方法
+// 参数：program - AST_PROGRAM 节点，kind - DECL_KEY_STRUCT_METHOD 或 DECL_KEY_UNION_METHOD，
+//       owner - 结构体/联合体名，method_name - 方法名
+// 返回：方法的 AST_FN_DECL 节点，未找到返回 NULL
+ASTNode *ast_find_method(ASTNode *program, DeclKeyKind kind, const char *owner, const char *method_name);
+
+// 依次访问节点的直接子节点：声明（函数体、方法）、语句与表达式，不含类型节点与宏定义体
+// 参数：node - AST 节点，visit - 对每个非 NULL 子节点调用一次，ctx - 传给 visit 的上下文
+// 注意：只访问一层，需要遍历整棵树时在 visit 中递归调用
+void ast_for_each_child(ASTNode *node, void (*visit)(ASTNode *child, void *ctx), void *ctx);
+
 #endif // AST_H
 
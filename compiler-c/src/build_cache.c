@@ -0,0 +1,392 @@
+#define _DEFAULT_SOURCE  // 用于 d_type
+#include "build_cache.h"
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef PATH_MAX
+#define PATH_MAX 4096
+#endif
+
+// 清单文件头（格式变化时修改版本号，旧清单自动失效）
+#define BUILD_CACHE_MANIFEST_MAGIC "uya-build-cache 1"
+
+// 文件复制与哈希的读缓冲区大小
+#define BUILD_CACHE_IO_SIZE (64 * 1024)
+
+uint64_t build_cache_hash(uint64_t hash, const void *data, size_t len) {
+    const unsigned char *p = (const unsigned char *)data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= p[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint64_t build_cache_hash_str(uint64_t hash, const char *str) {
+    if (str == NULL) {
+        str = "";
+    }
+    return build_cache_hash(hash, str, strlen(str) + 1);
+}
+
+int build_cache_hash_file(const char *path, uint64_t *hash, size_t *size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    char buf[BUILD_CACHE_IO_SIZE];
+    uint64_t h = BUILD_CACHE_HASH_INIT;
+    size_t total = 0;
+    for (;;) {
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            close(fd);
+            return -1;
+        }
+        if (n == 0) {
+            break;
+        }
+        h = build_cache_hash(h, buf, (size_t)n);
+        total += (size_t)n;
+    }
+    close(fd);
+    *hash = h;
+    if (size != NULL) {
+        *size = total;
+    }
+    return 0;
+}
+
+// 复制文件内容（覆盖目标文件）
+// 返回：成功返回0，失败返回-1
+static int copy_file(const char *from, const char *to) {
+    int in = open(from, O_RDONLY);
+    if (in < 0) {
+        return -1;
+    }
+    int out = open(to, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out < 0) {
+        close(in);
+        return -1;
+    }
+    char buf[BUILD_CACHE_IO_SIZE];
+    int result = 0;
+    for (;;) {
+        ssize_t n = read(in, buf, sizeof(buf));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            result = -1;
+            break;
+        }
+        if (n == 0) {
+            break;
+        }
+        // 处理部分写入
+        ssize_t done = 0;
+        while (done < n) {
+            ssize_t w = write(out, buf + done, (size_t)(n - done));
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                result = -1;
+                break;
+            }
+            done += w;
+        }
+        if (result != 0) {
+            break;
+        }
+    }
+    close(in);
+    if (close(out) != 0) {
+        result = -1;
+    }
+    return result;
+}
+
+// 文件所在目录（没有 '/' 时为 "."）
+static void dir_of(const char *path, char *buf, size_t size) {
+    const char *slash = strrchr(path, '/');
+    if (slash == NULL) {
+        snprintf(buf, size, ".");
+    } else if (slash == path) {
+        snprintf(buf, size, "/");
+    } else {
+        snprintf(buf, size, "%.*s", (int)(slash - path), path);
+    }
+}
+
+// 目录签名：目录中 .uya 文件与子目录名称的哈希之和（与 readdir 顺序无关）混合其数量
+// 返回：成功返回0，目录无法读取返回-1
+static int dir_signature(const char *dir_path, uint64_t *signature) {
+    DIR *dir = opendir(dir_path);
+    if (dir == NULL) {
+        return -1;
+    }
+    uint64_t sum = 0;
+    uint64_t count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        const char *name = entry->d_name;
+        if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
+            continue;
+        }
+        size_t name_len = strlen(name);
+        int relevant = name_len > 4 && strcmp(name + name_len - 4, ".uya") == 0;
+        if (!relevant) {
+            int is_dir = entry->d_type == DT_DIR;
+            if (entry->d_type == DT_UNKNOWN) {
+                // 文件系统不提供类型时用 stat 判断
+                char full_path[PATH_MAX];
+                struct stat st;
+                snprintf(full_path, sizeof(full_path), "%s/%s", dir_path, name);
+                is_dir = stat(full_path, &st) == 0 && S_ISDIR(st.st_mode);
+            }
+            relevant = is_dir;
+        }
+        if (relevant) {
+            sum += build_cache_hash_str(BUILD_CACHE_HASH_INIT, name);
+            count++;
+        }
+    }
+    closedir(dir);
+    *signature = build_cache_hash(sum, &count, sizeof(count));
+    return 0;
+}
+
+// 环境变量值的哈希（未设置与空串相同，与 @mc_get_env 的语义一致）
+static uint64_t env_value_hash(const char *name) {
+    return build_cache_hash_str(BUILD_CACHE_HASH_INIT, getenv(name));
+}
+
+// 缓存条目中的文件路径：<目录>/<键>.<后缀>
+static int entry_path(const BuildCache *cache, const char *suffix, char *buf, size_t size) {
+    int n = snprintf(buf, size, "%s/%016llx.%s", cache->dir, (unsigned long long)cache->key, suffix);
+    return (n < 0 || (size_t)n >= size) ? -1 : 0;
+}
+
+// 第 index 个输出文件在缓存中的路径
+static int output_entry_path(const BuildCache *cache, int index, char *buf, size_t size) {
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), "%d", index);
+    return entry_path(cache, suffix, buf, size);
+}
+
+int build_cache_init(BuildCache *cache, const char *dir, uint64_t key) {
+    cache->dir = dir;
+    cache->key = key;
+
+    // 逐级创建目录（mkdir -p）
+    char path[PATH_MAX];
+    size_t len = strlen(dir);
+    if (len == 0 || len >= sizeof(path)) {
+        return -1;
+    }
+    memcpy(path, dir, len + 1);
+    for (size_t i = 1; i <= len; i++) {
+        if (path[i] == '/' || path[i] == '\0') {
+            char saved = path[i];
+            path[i] = '\0';
+            if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+                return -1;
+            }
+            path[i] = saved;
+        }
+    }
+    struct stat st;
+    return (stat(dir, &st) == 0 && S_ISDIR(st.st_mode)) ? 0 : -1;
+}
+
+// 读取整个文件到 Arena（以 '\0' 结尾）
+static char *read_whole_file(const char *path, Arena *arena) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    char *data = (char *)arena_alloc(arena, size + 1);
+    size_t done = 0;
+    while (data != NULL && done < size) {
+        ssize_t n = read(fd, data + done, size - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            data = NULL;
+            break;
+        }
+        done += (size_t)n;
+    }
+    close(fd);
+    if (data != NULL) {
+        data[size] = '\0';
+    }
+    return data;
+}
+
+int build_cache_lookup(BuildCache *cache, const char *output_paths[], int output_count, Arena *arena) {
+    char manifest_path[PATH_MAX];
+    if (entry_path(cache, "manifest", manifest_path, sizeof(manifest_path)) != 0) {
+        return -1;
+    }
+    char *manifest = read_whole_file(manifest_path, arena);
+    if (manifest == NULL) {
+        return -1;
+    }
+
+    // 逐行校验：f <哈希> <大小> <路径>、d <签名> <路径>、e <值哈希> <环境变量名>、o <输出数量>
+    char *line = manifest;
+    char *next = strchr(line, '\n');
+    if (next == NULL) {
+        return -1;
+    }
+    *next = '\0';
+    if (strcmp(line, BUILD_CACHE_MANIFEST_MAGIC) != 0) {
+        return -1;
+    }
+    int outputs_checked = 0;
+    for (line = next + 1; *line != '\0'; line = next + 1) {
+        next = strchr(line, '\n');
+        if (next == NULL) {
+            return -1;  // 清单不完整
+        }
+        *next = '\0';
+        char *p = NULL;
+        if (line[0] == 'f' && line[1] == ' ') {
+            uint64_t expected = strtoull(line + 2, &p, 16);
+            unsigned long long expected_size = strtoull(p, &p, 10);
+            if (*p != ' ') {
+                return -1;
+            }
+            uint64_t actual = 0;
+            size_t actual_size = 0;
+            if (build_cache_hash_file(p + 1, &actual, &actual_size) != 0 ||
+                actual != expected || actual_size != expected_size) {
+                return -1;
+            }
+        } else if (line[0] == 'd' && line[1] == ' ') {
+            uint64_t expected = strtoull(line + 2, &p, 16);
+            uint64_t actual = 0;
+            if (*p != ' ' || dir_signature(p + 1, &actual) != 0 || actual != expected) {
+                return -1;
+            }
+        } else if (line[0] == 'e' && line[1] == ' ') {
+            uint64_t expected = strtoull(line + 2, &p, 16);
+            if (*p != ' ' || env_value_hash(p + 1) != expected) {
+                return -1;
+            }
+        } else if (line[0] == 'o' && line[1] == ' ') {
+            if (strtol(line + 2, &p, 10) != output_count || *p != '\0') {
+                return -1;
+            }
+            outputs_checked = 1;
+        } else {
+            return -1;
+        }
+    }
+    if (!outputs_checked) {
+        return -1;
+    }
+
+    // 全部一致：复制缓存的输出
+    for (int i = 0; i < output_count; i++) {
+        char cached[PATH_MAX];
+        if (output_entry_path(cache, i, cached, sizeof(cached)) != 0 ||
+            copy_file(cached, output_paths[i]) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int build_cache_store(BuildCache *cache, const char *files[], int file_count,
+                      const char *env_names[], int env_count,
+                      const char *output_paths[], int output_count) {
+    char manifest_path[PATH_MAX];
+    char temp_path[PATH_MAX];
+    if (file_count > BUILD_CACHE_MAX_FILES || output_count > BUILD_CACHE_MAX_OUTPUTS ||
+        entry_path(cache, "manifest", manifest_path, sizeof(manifest_path)) != 0 ||
+        entry_path(cache, "manifest.tmp", temp_path, sizeof(temp_path)) != 0) {
+        return -1;
+    }
+    // 先删除旧清单，输出复制到一半失败时条目不会命中
+    unlink(manifest_path);
+
+    for (int i = 0; i < output_count; i++) {
+        char cached[PATH_MAX];
+        if (output_entry_path(cache, i, cached, sizeof(cached)) != 0 ||
+            copy_file(output_paths[i], cached) != 0) {
+            return -1;
+        }
+    }
+
+    FILE *f = fopen(temp_path, "w");
+    if (f == NULL) {
+        return -1;
+    }
+    int result = 0;
+    fprintf(f, "%s\n", BUILD_CACHE_MANIFEST_MAGIC);
+
+    // 模块文件的内容哈希
+    for (int i = 0; i < file_count && result == 0; i++) {
+        uint64_t hash = 0;
+        size_t size = 0;
+        if (strchr(files[i], '\n') != NULL || build_cache_hash_file(files[i], &hash, &size) != 0) {
+            result = -1;
+            break;
+        }
+        fprintf(f, "f %016llx %zu %s\n", (unsigned long long)hash, size, files[i]);
+    }
+
+    // 模块文件所在目录的签名（每个目录只记录一次）
+    for (int i = 0; i < file_count && result == 0; i++) {
+        char dir[PATH_MAX];
+        dir_of(files[i], dir, sizeof(dir));
+        int seen = 0;
+        for (int j = 0; j < i && !seen; j++) {
+            char other[PATH_MAX];
+            dir_of(files[j], other, sizeof(other));
+            seen = strcmp(other, dir) == 0;
+        }
+        if (seen) {
+            continue;
+        }
+        uint64_t signature = 0;
+        if (dir_signature(dir, &signature) != 0) {
+            result = -1;
+            break;
+        }
+        fprintf(f, "d %016llx %s\n", (unsigned long long)signature, dir);
+    }
+
+    // 宏读取的环境变量
+    for (int i = 0; i < env_count && result == 0; i++) {
+        if (strchr(env_names[i], '\n') != NULL) {
+            result = -1;
+            break;
+        }
+        fprintf(f, "e %016llx %s\n", (unsigned long long)env_value_hash(env_names[i]), env_names[i]);
+    }
+
+    fprintf(f, "o %d\n", output_count);
+    if (fclose(f) != 0) {
+        result = -1;
+    }
+    if (result == 0 && rename(temp_path, manifest_path) != 0) {
+        result = -1;
+    }
+    if (result != 0) {
+        unlink(temp_path);
+    }
+    return result;
+}
@@ -0,0 +1,59 @@
+#ifndef BUILD_CACHE_H
+#define BUILD_CACHE_H
+
+#include "arena.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// 增量编译缓存（--cache-dir DIR 或环境变量 UYA_CACHE_DIR）
+// 缓存条目以编译键命名：编译键由编译器二进制内容、影响输出的选项（#line、拆分数量）、
+// 输入参数、输出路径、工作目录与 UYA_ROOT 哈希得到，选项或编译器变化时自然使用不同的条目。
+// 每个条目包含：
+//   <键>.manifest：参与编译的每个模块文件的内容哈希与大小，以及这些文件所在目录的签名
+//                  （目录中 .uya 文件与子目录的名称集合：新增、删除、重命名会改变模块查找结果，
+//                  例如新增同名模块；其他文件如生成的 .c 与可执行文件不影响签名）；
+//                  以及宏通过 @mc_get_env 读取的环境变量的值哈希（环境变化时宏展开结果可能不同）；
+//   <键>.<i>：第 i 个输出文件的内容（单文件输出只有 0；拆分输出依次为各 .c 文件与头文件）。
+// 查找时逐个重新哈希清单中的文件，全部一致才命中，命中后直接复制缓存的输出，跳过解析、检查与代码生成。
+// 清单最后写入（先写临时文件再 rename），中途失败只会留下无清单的输出文件，不会被误用。
+
+// 缓存清单中的最大文件数量
+#define BUILD_CACHE_MAX_FILES 256
+
+// 缓存的最大输出文件数量
+#define BUILD_CACHE_MAX_OUTPUTS 260
+
+// 增量编译缓存
+typedef struct BuildCache {
+    const char *dir;            // 缓存目录（不存在时自动创建）
+    uint64_t key;               // 编译键
+} BuildCache;
+
+// FNV-1a 64 位哈希：在 hash 的基础上继续哈希 len 字节（初始值用 BUILD_CACHE_HASH_INIT）
+#define BUILD_CACHE_HASH_INIT 14695981039346656037ULL
+uint64_t build_cache_hash(uint64_t hash, const void *data, size_t len);
+
+// 在 hash 的基础上继续哈希以 '\0' 结尾的字符串（包括结尾的 '\0'，使相邻字符串的边界参与哈希；NULL 视为空串）
+uint64_t build_cache_hash_str(uint64_t hash, const char *str);
+
+// 哈希文件内容
+// 参数：path - 文件路径，hash - 输出：内容哈希，size - 输出：文件大小（可为 NULL）
+// 返回：成功返回0，无法读取返回-1
+int build_cache_hash_file(const char *path, uint64_t *hash, size_t *size);
+
+// 初始化缓存（创建缓存目录）
+// 返回：成功返回0，目录无法创建返回-1
+int build_cache_init(BuildCache *cache, const char *dir, uint64_t key);
+
+// 查找缓存：清单中的文件全部未变化时，把缓存的输出复制到 output_paths
+// 参数：output_paths - 输出文件路径（数量与顺序须与保存时一致），arena - 临时分配器（读取清单）
+// 返回：命中返回0，未命中（或复制失败）返回-1
+int build_cache_lookup(BuildCache *cache, const char *output_paths[], int output_count, Arena *arena);
+
+// 保存缓存：记录 files 的内容哈希与所在目录的签名、env_names 的当前值，并复制 output_paths 的内容
+// 返回：成功返回0，失败返回-1（失败不影响编译结果，下次编译重新生成）
+int build_cache_store(BuildCache *cache, const char *files[], int file_count,
+                      const char *env_names[], int env_count,
+                      const char *output_paths[], int output_count);
+
+#endif // BUILD_CACHE_H
@@ -1,5 +1,6 @@
 #include "checker.h"
 #include "lexer.h"
+#include "intern.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -308,8 +309,8 @@ static void resolve_int_limit_node(ASTNode *node, Type type) {
 
 static int is_enum_variant_name_in_program(ASTNode *program_node, const char *name);
 static void checker_report_error(TypeChecker *checker, ASTNode *node, const char *message);
-/* 获取或注册错误名称，返回 hash(error_name) 作为 error_id；0 表示失败；冲突时报错 */
-static uint32_t get_or_add_error_id(TypeChecker *checker, const char *name, ASTNode *node);
+/* 获取或注册错误名称，返回注册顺序编号（从 1 开始）作为 error_id；0 表示失败 */
+static uint32_t get_or_add_error_id(TypeChecker *checker, const char *name);
 static Type find_struct_field_type(TypeChecker *checker, ASTNode *struct_decl, const char *field_name);
 static Type find_struct_field_type_with_substitution(TypeChecker *checker, ASTNode *struct_decl, 
                                                      const char *field_name, Type *type_args, int type_arg_count);
@@ -327,34 +328,33 @@ int checker_init(TypeChecker *checker, Arena *arena, const char *default_filenam
     
     checker->arena = arena;
     
-    // 初始化符号表（所有槽位设为NULL）
-    for (int i = 0; i < SYMBOL_TABLE_SIZE; i++) {
-        checker->symbol_table.slots[i] = NULL;
-    }
+    // 初始化符号表（桶数组与 live 栈从 Arena 分配）
+    checker->symbol_table.buckets = (Symbol **)arena_alloc(arena, sizeof(Symbol *) * SYMBOL_TABLE_INITIAL_BUCKETS);
+    memset(checker->symbol_table.buckets, 0, sizeof(Symbol *) * SYMBOL_TABLE_INITIAL_BUCKETS);
+    checker->symbol_table.bucket_count = SYMBOL_TABLE_INITIAL_BUCKETS;
+    checker->symbol_table.live = (Symbol **)arena_alloc(arena, sizeof(Symbol *) * SYMBOL_TABLE_INITIAL_CAPACITY);
+    checker->symbol_table.capacity = SYMBOL_TABLE_INITIAL_CAPACITY;
     checker->symbol_table.count = 0;
     
-    // 初始化函数表（所有槽位设为NULL）
-    for (int i = 0; i < FUNCTION_TABLE_SIZE; i++) {
-        checker->function_table.slots[i] = NULL;
-    }
-    checker->function_table.count = 0;
-    
-    // 初始化模块表（所有槽位设为NULL）
-    for (int i = 0; i < MODULE_TABLE_SIZE; i++) {
-        checker->module_table.slots[i] = NULL;
-    }
-    checker->module_table.count = 0;
+    // 初始化规范类型表（首次驻留类型时分配槽位）
+    checker->type_table.slots = NULL;
+    checker->type_table.hashes = NULL;
+    checker->type_table.capacity = 0;
+    checker->type_table.count = 0;
     
-    // 初始化导入表（所有槽位设为NULL）
-    for (int i = 0; i < IMPORT_TABLE_SIZE; i++) {
-        checker->import_table.slots[i] = NULL;
-    }
-    checker->import_table.count = 0;
+    // 初始化函数表、模块表、导入表、宏展开缓存（首次插入时分配槽位）
+    hash_map_init(&checker->function_table, arena);
+    hash_map_init(&checker->module_table, arena);
+    hash_map_init(&checker->import_table, arena);
+    hash_map_init(&checker->macro_cache, arena);
+    hash_map_init(&checker->macro_env_names, arena);
+    checker->time_report = NULL;
     
     checker->scope_level = 0;
     checker->loop_depth = 0;
     checker->program_node = NULL;
     checker->error_count = 0;
+    checker->symbols_declared = 0;
     checker->default_filename = default_filename;
     checker->current_return_type.kind = TYPE_VOID;
     checker->in_function = 0;
@@ -371,7 +371,12 @@ int checker_init(TypeChecker *checker, Arena *arena, const char *default_filenam
     // 初始化泛型相关字段
     checker->current_type_params = NULL;
     checker->current_type_param_count = 0;
-    checker->mono_instance_count = 0;
+    checker->mono_table.slots = NULL;
+    checker->mono_table.capacity = 0;
+    checker->mono_table.count = 0;
+    checker->mono_table.group_slots = NULL;
+    checker->mono_table.group_capacity = 0;
+    checker->mono_table.group_count = 0;
     
     return 0;
 }
@@ -384,11 +389,39 @@ int checker_get_error_count(TypeChecker *checker) {
     return checker->error_count;
 }
 
-// 符号表插入函数（使用开放寻址的哈希表）
+// 符号表扩容：live 栈翻倍；桶数组翻倍后按插入顺序重新头插，保持链头为最内层绑定
+// 参数：checker - TypeChecker 指针
+static void symbol_table_grow(TypeChecker *checker) {
+    SymbolTable *table = &checker->symbol_table;
+    
+    int new_capacity = table->capacity * 2;
+    Symbol **new_live = (Symbol **)arena_alloc(checker->arena, sizeof(Symbol *) * (size_t)new_capacity);
+    memcpy(new_live, table->live, sizeof(Symbol *) * (size_t)table->count);
+    table->live = new_live;
+    table->capacity = new_capacity;
+    
+    // 负载因子保持在 1 以内
+    if (new_capacity > table->bucket_count) {
+        int new_bucket_count = table->bucket_count * 2;
+        Symbol **new_buckets = (Symbol **)arena_alloc(checker->arena, sizeof(Symbol *) * (size_t)new_bucket_count);
+        memset(new_buckets, 0, sizeof(Symbol *) * (size_t)new_bucket_count);
+        for (int i = 0; i < table->count; i++) {
+            Symbol *symbol = table->live[i];
+            unsigned int index = symbol->hash & (unsigned int)(new_bucket_count - 1);
+            symbol->next_in_bucket = new_buckets[index];
+            new_buckets[index] = symbol;
+        }
+        table->buckets = new_buckets;
+        table->bucket_count = new_bucket_count;
+    }
+}
+
+// 符号表插入函数（链式哈希表，头插）
 // 参数：checker - TypeChecker 指针，symbol - 要插入的符号（从 Arena 分配）
 // 返回：成功返回 0，失败返回 -1
 // 注意：禁止变量遮蔽，内层作用域不能声明与外层作用域同名的变量（应在类型检查时验证）
 //      如果符号已存在（相同名称和相同作用域级别），返回 -1
+//      符号总是以当前作用域级别插入，因此 live 栈中的作用域级别单调不减
 static int symbol_table_insert(TypeChecker *checker, Symbol *symbol) {
     if (checker == NULL || symbol == NULL || symbol->name == NULL) {
         return -1;
@@ -400,61 +433,42 @@ static int symbol_table_insert(TypeChecker *checker, Symbol *symbol) {
         return -1;  // 符号已存在（相同作用域级别）
     }
     
-    // 计算哈希值
-    unsigned int hash = hash_string(symbol->name);
-    unsigned int index = hash & (SYMBOL_TABLE_SIZE - 1);  // 使用位与运算（表大小必须是2的幂）
-    
-    // 开放寻址：查找空槽位
-    for (int i = 0; i < SYMBOL_TABLE_SIZE; i++) {
-        unsigned int slot = (index + i) & (SYMBOL_TABLE_SIZE - 1);
-        
-        if (checker->symbol_table.slots[slot] == NULL) {
-            // 找到空槽位，插入符号
-            checker->symbol_table.slots[slot] = symbol;
-            checker->symbol_table.count++;
-            return 0;
-        }
+    SymbolTable *table = &checker->symbol_table;
+    if (table->count >= table->capacity) {
+        symbol_table_grow(checker);
     }
     
-    // 哈希表已满（理论上不应该发生，因为我们有足够大的表）
-    return -1;
+    symbol->hash = hash_string(symbol->name);
+    unsigned int index = symbol->hash & (unsigned int)(table->bucket_count - 1);
+    symbol->next_in_bucket = table->buckets[index];
+    table->buckets[index] = symbol;
+    table->live[table->count++] = symbol;
+    checker->symbols_declared++;
+    return 0;
 }
 
 // 符号表查找函数（支持作用域查找，返回最内层匹配的符号）
 // 参数：checker - TypeChecker 指针，name - 符号名称
 // 返回：找到的符号指针（最内层的匹配符号），未找到返回 NULL
-// 注意：查找所有匹配的符号，返回作用域级别最高的（最内层的）
+// 注意：桶链按插入顺序头插，第一个匹配即作用域级别最高的（最内层的）
 static Symbol *symbol_table_lookup(TypeChecker *checker, const char *name) {
     if (checker == NULL || name == NULL) {
         return NULL;
     }
     
-    Symbol *found = NULL;
-    int found_scope = -1;
-    
-    // 遍历整个符号表，查找所有匹配的符号
-    // 由于使用开放寻址，同名符号可能存储在不同的位置（由于哈希冲突）
-    for (int i = 0; i < SYMBOL_TABLE_SIZE; i++) {
-        Symbol *symbol = checker->symbol_table.slots[i];
-        
-        if (symbol == NULL) {
-            continue;
-        }
-        
-        // 检查是否是目标符号
-        if (strcmp(symbol->name, name) == 0) {
-            // 找到匹配的符号，选择作用域级别最高的（最内层的）
-            if (found == NULL || symbol->scope_level > found_scope) {
-                found = symbol;
-                found_scope = symbol->scope_level;
-            }
+    unsigned int hash = hash_string(name);
+    SymbolTable *table = &checker->symbol_table;
+    Symbol *symbol = table->buckets[hash & (unsigned int)(table->bucket_count - 1)];
+    for (; symbol != NULL; symbol = symbol->next_in_bucket) {
+        if (symbol->hash == hash && INTERN_STR_EQ(symbol->name, name)) {
+            return symbol;
         }
     }
     
-    return found;
+    return NULL;
 }
 
-// 函数表插入函数（使用开放寻址的哈希表）
+// 函数表插入函数
 // 参数：checker - TypeChecker 指针，sig - 要插入的函数签名（从 Arena 分配）
 // 返回：成功返回 0，失败返回 -1
 // 注意：如果函数已存在，返回 -1
@@ -463,57 +477,40 @@ static int function_table_insert(TypeChecker *checker, FunctionSignature *sig) {
         return -1;
     }
     
-    // 计算哈希值
-    unsigned int hash = hash_string(sig->name);
-    unsigned int index = hash & (FUNCTION_TABLE_SIZE - 1);
+    FunctionSignature *existing = (FunctionSignature *)hash_map_get(&checker->function_table, sig->name);
+    if (existing == NULL) {
+        // 新函数，插入函数签名
+        hash_map_put(&checker->function_table, sig->name, sig);
+        checker->symbols_declared++;
+        return 0;
+    }
     
-    // 开放寻址：查找空槽位或已存在的函数
-    for (int i = 0; i < FUNCTION_TABLE_SIZE; i++) {
-        unsigned int slot = (index + i) & (FUNCTION_TABLE_SIZE - 1);
-        FunctionSignature *existing = checker->function_table.slots[slot];
-        
-        if (existing == NULL) {
-            // 找到空槽位，插入函数签名
-            checker->function_table.slots[slot] = sig;
-            checker->function_table.count++;
+    // 函数已存在
+    // 如果都是 extern 声明，允许重复（跳过插入，不报错）
+    if (existing->is_extern && sig->is_extern) {
+        // 检查签名是否相同（参数类型和返回类型）
+        if (existing->param_count == sig->param_count &&
+            type_equals(existing->return_type, sig->return_type) &&
+            existing->is_varargs == sig->is_varargs) {
+            // 签名相同，允许重复的 extern 声明（跳过插入）
             return 0;
+        } else {
+            // 签名不同，这是错误（extern 声明冲突）
+            return -1;
         }
-        
-        // 检查是否是相同名称的函数
-        if (existing->name != NULL && strcmp(existing->name, sig->name) == 0) {
-            // 函数已存在
-            // 如果都是 extern 声明，允许重复（跳过插入，不报错）
-            if (existing->is_extern && sig->is_extern) {
-                // 检查签名是否相同（参数类型和返回类型）
-                if (existing->param_count == sig->param_count &&
-                    type_equals(existing->return_type, sig->return_type) &&
-                    existing->is_varargs == sig->is_varargs) {
-                    // 签名相同，允许重复的 extern 声明（跳过插入）
-                    return 0;
-                } else {
-                    // 签名不同，这是错误（extern 声明冲突）
-                    return -1;
-                }
-            } else if (!existing->is_extern && !sig->is_extern) {
-                // 都是定义，不允许重复定义
-                return -1;
-            } else {
-                // 一个是 extern，一个是定义，允许（extern 声明可以与定义共存）
-                // 但如果已有定义，跳过插入；如果已有 extern，插入定义
-                if (existing->is_extern) {
-                    // 已有 extern 声明，现在插入定义，替换它
-                    checker->function_table.slots[slot] = sig;
-                    return 0;
-                } else {
-                    // 已有定义，现在是 extern 声明，跳过插入
-                    return 0;
-                }
-            }
+    } else if (!existing->is_extern && !sig->is_extern) {
+        // 都是定义，不允许重复定义
+        return -1;
+    } else {
+        // 一个是 extern，一个是定义，允许（extern 声明可以与定义共存）
+        // 但如果已有定义，跳过插入；如果已有 extern，插入定义
+        if (existing->is_extern) {
+            // 已有 extern 声明，现在插入定义，替换它
+            hash_map_put(&checker->function_table, sig->name, sig);
         }
+        // 已有定义，现在是 extern 声明，跳过插入
+        return 0;
     }
-    
-    // 哈希表已满（理论上不应该发生）
-    return -1;
 }
 
 // 函数表查找函数
@@ -523,28 +520,42 @@ static FunctionSignature *function_table_lookup(TypeChecker *checker, const char
     if (checker == NULL || name == NULL) {
         return NULL;
     }
-    
-    // 计算哈希值
-    unsigned int hash = hash_string(name);
-    unsigned int index = hash & (FUNCTION_TABLE_SIZE - 1);
-    
-    // 开放寻址：查找函数
-    for (int i = 0; i < FUNCTION_TABLE_SIZE; i++) {
-        unsigned int slot = (index + i) & (FUNCTION_TABLE_SIZE - 1);
-        FunctionSignature *sig = checker->function_table.slots[slot];
-        
-        if (sig == NULL) {
-            // 空槽位，继续查找
-            continue;
-        }
-        
-        // 检查是否是目标函数
-        if (strcmp(sig->name, name) == 0) {
-            return sig;
-        }
+    return (FunctionSignature *)hash_map_get(&checker->function_table, name);
+}
+
+// 模块表查找函数
+// 参数：checker - TypeChecker 指针，module_name - 模块名
+// 返回：找到的模块信息指针，未找到返回 NULL
+static ModuleInfo *module_table_lookup(TypeChecker *checker, const char *module_name) {
+    if (checker == NULL || module_name == NULL) {
+        return NULL;
     }
-    
-    return NULL;  // 未找到
+    return (ModuleInfo *)hash_map_get(&checker->module_table, module_name);
+}
+
+// 导入表查找函数
+// 参数：checker - TypeChecker 指针，local_name - 本地名称
+// 返回：该名称的第一个导入项（通过 next 按导入顺序遍历同名导入项），未找到返回 NULL
+static ImportedItem *import_table_lookup(TypeChecker *checker, const char *local_name) {
+    if (checker == NULL || local_name == NULL) {
+        return NULL;
+    }
+    return (ImportedItem *)hash_map_get(&checker->import_table, local_name);
+}
+
+// 导入表插入函数（同名导入项追加到链尾）
+// 参数：checker - TypeChecker 指针，import - 要插入的导入项（从 Arena 分配）
+static void import_table_insert(TypeChecker *checker, ImportedItem *import) {
+    import->next = NULL;
+    ImportedItem *head = import_table_lookup(checker, import->local_name);
+    if (head == NULL) {
+        hash_map_put(&checker->import_table, import->local_name, import);
+        return;
+    }
+    while (head->next != NULL) {
+        head = head->next;
+    }
+    head->next = import;
 }
 
 // 进入作用域（增加作用域级别）
@@ -557,25 +568,20 @@ static void checker_enter_scope(TypeChecker *checker) {
 
 // 退出作用域（减少作用域级别，并移除该作用域的符号）
 // 参数：checker - TypeChecker 指针
-// 注意：退出作用域时，移除当前作用域级别的所有符号
-// 注意：在开放寻址哈希表中删除元素会导致查找链断裂，但我们的使用场景中，
-//      退出作用域时删除符号是必要的，因此遍历整个表进行删除
+// 注意：当前作用域的符号位于 live 栈顶，且各自是所在桶链的链头，逐个弹出即可（O(本作用域符号数)）
 static void checker_exit_scope(TypeChecker *checker) {
     if (checker == NULL || checker->scope_level <= 0) {
         return;
     }
     
     int current_scope = checker->scope_level;
+    SymbolTable *table = &checker->symbol_table;
     
-    // 移除当前作用域级别的所有符号
-    // 注意：在开放寻址哈希表中，删除元素会导致查找链断裂，但我们的使用场景中，
-    //      符号表主要用于类型检查阶段，退出作用域后不会再查找已删除的符号
-    for (int i = 0; i < SYMBOL_TABLE_SIZE; i++) {
-        Symbol *symbol = checker->symbol_table.slots[i];
-        if (symbol != NULL && symbol->scope_level == current_scope) {
-            checker->symbol_table.slots[i] = NULL;
-            checker->symbol_table.count--;
-        }
+    while (table->count > 0 && table->live[table->count - 1]->scope_level == current_scope) {
+        Symbol *symbol = table->live[--table->count];
+        unsigned int index = symbol->hash & (unsigned int)(table->bucket_count - 1);
+        table->buckets[index] = symbol->next_in_bucket;
+        symbol->next_in_bucket = NULL;
     }
     
     checker->scope_level--;
@@ -593,9 +599,9 @@ static int moved_set_contains(TypeChecker *checker, const char *name) {
 
 static int has_active_pointer_to(TypeChecker *checker, const char *var_name) {
     if (checker == NULL || var_name == NULL) return 0;
-    for (int i = 0; i < SYMBOL_TABLE_SIZE; i++) {
-        Symbol *s = checker->symbol_table.slots[i];
-        if (s != NULL && s->pointee_of != NULL && strcmp(s->pointee_of, var_name) == 0)
+    for (int i = 0; i < checker->symbol_table.count; i++) {
+        Symbol *s = checker->symbol_table.live[i];
+        if (s->pointee_of != NULL && strcmp(s->pointee_of, var_name) == 0)
             return 1;
     }
     return 0;
@@ -708,6 +714,180 @@ static int type_can_implicitly_convert(Type from, Type to) {
     return 0;
 }
 
+// 名称哈希（类型中的名称不一定经过驻留，按内容计算）
+static unsigned int type_name_hash(const char *name) {
+    return name != NULL ? intern_hash_bytes(name, strlen(name)) : 0u;
+}
+
+// 子类型指针哈希（子类型均为规范类型，按地址计算）
+static unsigned int type_ptr_hash(const Type *type) {
+    return (unsigned int)((uintptr_t)type >> 3);
+}
+
+// 名称相等（均为 NULL 也视为相等）
+static int type_name_equals(const char *a, const char *b) {
+    if (a == NULL || b == NULL) {
+        return a == b;
+    }
+    return INTERN_STR_EQ(a, b);
+}
+
+// 计算类型的浅层哈希：只读取该种类有效的字段，子类型按指针计算
+static unsigned int type_shallow_hash(const Type *type) {
+    unsigned int hash = (unsigned int)type->kind * 2654435761u;
+    switch (type->kind) {
+        case TYPE_ENUM:
+            return hash ^ type_name_hash(type->data.enum_name);
+        case TYPE_STRUCT:
+            hash ^= type_name_hash(type->data.struct_type.name);
+            for (int i = 0; i < type->data.struct_type.type_arg_count; i++) {
+                hash = hash * 31u + type_shallow_hash(&type->data.struct_type.type_args[i]);
+            }
+            return hash;
+        case TYPE_UNION:
+            return hash ^ type_name_hash(type->data.union_name);
+        case TYPE_INTERFACE:
+            return hash ^ type_name_hash(type->data.interface_name);
+        case TYPE_POINTER:
+            return (hash ^ type_ptr_hash(type->data.pointer.pointer_to)) * 31u + (unsigned int)type->data.pointer.is_ffi_pointer;
+        case TYPE_ARRAY:
+            return (hash ^ type_ptr_hash(type->data.array.element_type)) * 31u + (unsigned int)type->data.array.array_size;
+        case TYPE_SLICE:
+            return (hash ^ type_ptr_hash(type->data.slice.element_type)) * 31u + (unsigned int)type->data.slice.slice_len;
+        case TYPE_TUPLE:
+            hash += (unsigned int)type->data.tuple.count;
+            for (int i = 0; i < type->data.tuple.count && type->data.tuple.element_types != NULL; i++) {
+                hash = hash * 31u + type_shallow_hash(&type->data.tuple.element_types[i]);
+            }
+            return hash;
+        case TYPE_ERROR_UNION:
+            return hash ^ type_ptr_hash(type->data.error_union.payload_type);
+        case TYPE_ERROR:
+            return hash ^ type->data.error.error_id;
+        case TYPE_ATOMIC:
+            return hash ^ type_ptr_hash(type->data.atomic.inner_type);
+        case TYPE_GENERIC_PARAM:
+            return hash ^ type_name_hash(type->data.generic_param.param_name);
+        default:
+            return hash;
+    }
+}
+
+// 浅层比较：种类与字段相同、子类型指针相同（与 type_equals 不同，切片长度与泛型实参也必须相同）
+static int type_shallow_equals(const Type *a, const Type *b) {
+    if (a->kind != b->kind) {
+        return 0;
+    }
+    switch (a->kind) {
+        case TYPE_ENUM:
+            return type_name_equals(a->data.enum_name, b->data.enum_name);
+        case TYPE_STRUCT:
+            if (!type_name_equals(a->data.struct_type.name, b->data.struct_type.name) ||
+                a->data.struct_type.type_arg_count != b->data.struct_type.type_arg_count) {
+                return 0;
+            }
+            for (int i = 0; i < a->data.struct_type.type_arg_count; i++) {
+                if (!type_shallow_equals(&a->data.struct_type.type_args[i], &b->data.struct_type.type_args[i])) {
+                    return 0;
+                }
+            }
+            return 1;
+        case TYPE_UNION:
+            return type_name_equals(a->data.union_name, b->data.union_name);
+        case TYPE_INTERFACE:
+            return type_name_equals(a->data.interface_name, b->data.interface_name);
+        case TYPE_POINTER:
+            return a->data.pointer.pointer_to == b->data.pointer.pointer_to &&
+                   a->data.pointer.is_ffi_pointer == b->data.pointer.is_ffi_pointer;
+        case TYPE_ARRAY:
+            return a->data.array.element_type == b->data.array.element_type &&
+                   a->data.array.array_size == b->data.array.array_size;
+        case TYPE_SLICE:
+            return a->data.slice.element_type == b->data.slice.element_type &&
+                   a->data.slice.slice_len == b->data.slice.slice_len;
+        case TYPE_TUPLE:
+            if (a->data.tuple.count != b->data.tuple.count) {
+                return 0;
+            }
+            if (a->data.tuple.element_types == NULL || b->data.tuple.element_types == NULL) {
+                return a->data.tuple.element_types == b->data.tuple.element_types;
+            }
+            for (int i = 0; i < a->data.tuple.count; i++) {
+                if (!type_shallow_equals(&a->data.tuple.element_types[i], &b->data.tuple.element_types[i])) {
+                    return 0;
+                }
+            }
+            return 1;
+        case TYPE_ERROR_UNION:
+            return a->data.error_union.payload_type == b->data.error_union.payload_type;
+        case TYPE_ERROR:
+            return a->data.error.error_id == b->data.error.error_id;
+        case TYPE_ATOMIC:
+            return a->data.atomic.inner_type == b->data.atomic.inner_type;
+        case TYPE_GENERIC_PARAM:
+            return type_name_equals(a->data.generic_param.param_name, b->data.generic_param.param_name);
+        default:
+            return 1;
+    }
+}
+
+// 规范类型表翻倍并重新散列
+static void type_table_grow(TypeChecker *checker) {
+    TypeTable *table = &checker->type_table;
+    int new_capacity = table->capacity > 0 ? table->capacity * 2 : TYPE_TABLE_INITIAL_CAPACITY;
+    Type **new_slots = (Type **)arena_alloc(checker->arena, sizeof(Type *) * (size_t)new_capacity);
+    unsigned int *new_hashes = (unsigned int *)arena_alloc(checker->arena, sizeof(unsigned int) * (size_t)new_capacity);
+    memset(new_slots, 0, sizeof(Type *) * (size_t)new_capacity);
+    unsigned int mask = (unsigned int)(new_capacity - 1);
+    for (int i = 0; i < table->capacity; i++) {
+        if (table->slots[i] == NULL) continue;
+        unsigned int j = table->hashes[i] & mask;
+        while (new_slots[j] != NULL) {
+            j = (j + 1) & mask;
+        }
+        new_slots[j] = table->slots[i];
+        new_hashes[j] = table->hashes[i];
+    }
+    table->slots = new_slots;
+    table->hashes = new_hashes;
+    table->capacity = new_capacity;
+}
+
+// 获取类型的规范副本（hash-consing）
+// 参数：checker - TypeChecker 指针，type - 类型值（其子类型指针应已是规范类型）
+// 返回：规范类型指针（只读共享，调用者不得修改其内容）；结构相同的类型返回同一指针
+// 注意：结构体泛型实参数组与元组元素数组直接引用，不复制
+static Type *type_intern(TypeChecker *checker, Type type) {
+    TypeTable *table = &checker->type_table;
+    if (table->count * 2 >= table->capacity) {
+        type_table_grow(checker);
+    }
+    unsigned int hash = type_shallow_hash(&type);
+    unsigned int mask = (unsigned int)(table->capacity - 1);
+    unsigned int i = hash & mask;
+    while (table->slots[i] != NULL) {
+        if (table->hashes[i] == hash && type_shallow_equals(table->slots[i], &type)) {
+            return table->slots[i];
+        }
+        i = (i + 1) & mask;
+    }
+    Type *canonical = (Type *)arena_alloc(checker->arena, sizeof(Type));
+    *canonical = type;
+    canonical->c_spelling = NULL;
+    table->slots[i] = canonical;
+    table->hashes[i] = hash;
+    table->count++;
+    return canonical;
+}
+
+// 基础类型的规范指针（如 i8、i64，用于构造 &[i8]、!i64 等内建类型）
+static Type *type_intern_kind(TypeChecker *checker, TypeKind kind) {
+    Type type;
+    memset(&type, 0, sizeof(type));
+    type.kind = kind;
+    return type_intern(checker, type);
+}
+
 // 类型比较函数（比较两个Type是否相等）
 // 参数：t1, t2 - 要比较的两个类型
 // 返回：1 表示相等，0 表示不相等
@@ -729,7 +909,7 @@ static int type_equals(Type t1, Type t2) {
             return 0;
         }
         // 比较枚举名称
-        return strcmp(t1.data.enum_name, t2.data.enum_name) == 0;
+        return INTERN_STR_EQ(t1.data.enum_name, t2.data.enum_name);
     }
     
     // 对于结构体类型，需要比较结构体名称
@@ -743,12 +923,12 @@ static int type_equals(Type t1, Type t2) {
             return 0;
         }
         // 比较结构体名称
-        return strcmp(t1.data.struct_type.name, t2.data.struct_type.name) == 0;
+        return INTERN_STR_EQ(t1.data.struct_type.name, t2.data.struct_type.name);
     }
     if (t1.kind == TYPE_UNION) {
         if (t1.data.union_name == NULL && t2.data.union_name == NULL) return 1;
         if (t1.data.union_name == NULL || t2.data.union_name == NULL) return 0;
-        return strcmp(t1.data.union_name, t2.data.union_name) == 0;
+        return INTERN_STR_EQ(t1.data.union_name, t2.data.union_name);
     }
     // 对于接口类型，比较接口名称
     if (t1.kind == TYPE_INTERFACE) {
@@ -762,7 +942,8 @@ static int type_equals(Type t1, Type t2) {
         if (t1.data.pointer.is_ffi_pointer != t2.data.pointer.is_ffi_pointer) {
             return 0;
         }
-        if (t1.data.pointer.pointer_to == NULL && t2.data.pointer.pointer_to == NULL) {
+        // 规范类型：子类型指针相同即相等（也覆盖均为 NULL 的情况）
+        if (t1.data.pointer.pointer_to == t2.data.pointer.pointer_to) {
             return 1;
         }
         if (t1.data.pointer.pointer_to == NULL || t2.data.pointer.pointer_to == NULL) {
@@ -776,7 +957,7 @@ static int type_equals(Type t1, Type t2) {
         if (t1.data.array.array_size != t2.data.array.array_size) {
             return 0;
         }
-        if (t1.data.array.element_type == NULL && t2.data.array.element_type == NULL) {
+        if (t1.data.array.element_type == t2.data.array.element_type) {
             return 1;
         }
         if (t1.data.array.element_type == NULL || t2.data.array.element_type == NULL) {
@@ -788,7 +969,7 @@ static int type_equals(Type t1, Type t2) {
     // 对于切片类型，比较元素类型（已知长度可不同，&[T] 与 &[T: N] 可赋值兼容）
     if (t1.kind == TYPE_SLICE) {
         if (t2.kind != TYPE_SLICE) return 0;
-        if (t1.data.slice.element_type == NULL && t2.data.slice.element_type == NULL) return 1;
+        if (t1.data.slice.element_type == t2.data.slice.element_type) return 1;
         if (t1.data.slice.element_type == NULL || t2.data.slice.element_type == NULL) return 0;
         return type_equals(*t1.data.slice.element_type, *t2.data.slice.element_type);
     }
@@ -812,9 +993,8 @@ static int type_equals(Type t1, Type t2) {
     // 错误联合类型 !T：比较载荷类型
     if (t1.kind == TYPE_ERROR_UNION) {
         if (t2.kind != TYPE_ERROR_UNION) return 0;
-        if (t1.data.error_union.payload_type == NULL || t2.data.error_union.payload_type == NULL) {
-            return t1.data.error_union.payload_type == t2.data.error_union.payload_type;
-        }
+        if (t1.data.error_union.payload_type == t2.data.error_union.payload_type) return 1;
+        if (t1.data.error_union.payload_type == NULL || t2.data.error_union.payload_type == NULL) return 0;
         return type_equals(*t1.data.error_union.payload_type, *t2.data.error_union.payload_type);
     }
     
@@ -835,6 +1015,56 @@ static int type_equals(Type t1, Type t2) {
     return 1;
 }
 
+// 与 type_equals 一致的类型哈希：type_equals 相等的类型哈希值相同
+// （结构体只按名称、切片不含已知长度，与 type_equals 的判等范围相同）
+static unsigned int type_equals_hash(const Type *type) {
+    unsigned int hash = (unsigned int)type->kind * 2654435761u;
+    switch (type->kind) {
+        case TYPE_ENUM:
+            return hash ^ type_name_hash(type->data.enum_name);
+        case TYPE_STRUCT:
+            return hash ^ type_name_hash(type->data.struct_type.name);
+        case TYPE_UNION:
+            return hash ^ type_name_hash(type->data.union_name);
+        case TYPE_INTERFACE:
+            return hash ^ type_name_hash(type->data.interface_name);
+        case TYPE_POINTER:
+            hash += (unsigned int)type->data.pointer.is_ffi_pointer;
+            if (type->data.pointer.pointer_to != NULL) {
+                hash = hash * 31u + type_equals_hash(type->data.pointer.pointer_to);
+            }
+            return hash;
+        case TYPE_ARRAY:
+            hash += (unsigned int)type->data.array.array_size;
+            if (type->data.array.element_type != NULL) {
+                hash = hash * 31u + type_equals_hash(type->data.array.element_type);
+            }
+            return hash;
+        case TYPE_SLICE:
+            if (type->data.slice.element_type != NULL) {
+                hash = hash * 31u + type_equals_hash(type->data.slice.element_type);
+            }
+            return hash;
+        case TYPE_TUPLE:
+            hash += (unsigned int)type->data.tuple.count;
+            for (int i = 0; i < type->data.tuple.count && type->data.tuple.element_types != NULL; i++) {
+                hash = hash * 31u + type_equals_hash(&type->data.tuple.element_types[i]);
+            }
+            return hash;
+        case TYPE_ERROR_UNION:
+            if (type->data.error_union.payload_type != NULL) {
+                hash = hash * 31u + type_equals_hash(type->data.error_union.payload_type);
+            }
+            return hash;
+        case TYPE_ERROR:
+            return hash ^ type->data.error.error_id;
+        case TYPE_GENERIC_PARAM:
+            return hash ^ type_name_hash(type->data.generic_param.param_name);
+        default:
+            return hash;
+    }
+}
+
 // 从AST类型节点创建Type结构
 // 参数：checker - TypeChecker 指针，type_node - AST类型节点
 // 返回：Type结构，如果类型节点无效返回TYPE_VOID类型
@@ -884,18 +1114,9 @@ static Type type_from_ast(TypeChecker *checker, ASTNode *type_node) {
             return result;
         }
         
-        // 分配指向的类型结构（从Arena分配）
-        Type *pointed_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (pointed_type_ptr == NULL) {
-            // Arena 分配失败
-            result.kind = TYPE_VOID;
-            return result;
-        }
-        *pointed_type_ptr = pointed_type;
-        
-        // 创建指针类型
+        // 创建指针类型（指向的类型取规范副本）
         result.kind = TYPE_POINTER;
-        result.data.pointer.pointer_to = pointed_type_ptr;
+        result.data.pointer.pointer_to = type_intern(checker, pointed_type);
         result.data.pointer.is_ffi_pointer = type_node->data.type_pointer.is_ffi_pointer;
         
         return result;
@@ -909,13 +1130,8 @@ static Type type_from_ast(TypeChecker *checker, ASTNode *type_node) {
             return result;
         }
         
-        // 分配元素类型结构（从Arena分配）
-        Type *element_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (element_type_ptr == NULL) {
-            result.kind = TYPE_VOID;
-            return result;
-        }
-        *element_type_ptr = element_type;
+        // 元素类型取规范副本
+        Type *element_type_ptr = type_intern(checker, element_type);
         
         // 解析数组大小（必须是编译期常量）
         // 注意：这里先简单验证，详细的编译期常量检查在类型检查阶段进行
@@ -948,12 +1164,7 @@ static Type type_from_ast(TypeChecker *checker, ASTNode *type_node) {
             result.kind = TYPE_VOID;
             return result;
         }
-        Type *element_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (element_type_ptr == NULL) {
-            result.kind = TYPE_VOID;
-            return result;
-        }
-        *element_type_ptr = element_type;
+        Type *element_type_ptr = type_intern(checker, element_type);
         int slice_len = -1;  // -1 表示动态长度 &[T]
         if (type_node->data.type_slice.size_expr != NULL &&
             type_node->data.type_slice.size_expr->type == AST_NUMBER) {
@@ -997,14 +1208,8 @@ static Type type_from_ast(TypeChecker *checker, ASTNode *type_node) {
         }
         Type payload = type_from_ast(checker, payload_node);
         // 注意：!void 是有效的错误联合类型，payload 可以是 TYPE_VOID
-        Type *payload_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (payload_ptr == NULL) {
-            result.kind = TYPE_VOID;
-            return result;
-        }
-        *payload_ptr = payload;
         result.kind = TYPE_ERROR_UNION;
-        result.data.error_union.payload_type = payload_ptr;
+        result.data.error_union.payload_type = type_intern(checker, payload);
         return result;
     } else if (type_node->type == AST_TYPE_ATOMIC) {
         // 原子类型 atomic T（仅支持整数类型）
@@ -1025,15 +1230,8 @@ static Type type_from_ast(TypeChecker *checker, ASTNode *type_node) {
             result.kind = TYPE_VOID;
             return result;
         }
-        // 分配内部类型结构（从Arena分配）
-        Type *inner_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (inner_type_ptr == NULL) {
-            result.kind = TYPE_VOID;
-            return result;
-        }
-        *inner_type_ptr = inner_type;
         result.kind = TYPE_ATOMIC;
-        result.data.atomic.inner_type = inner_type_ptr;
+        result.data.atomic.inner_type = type_intern(checker, inner_type);
         return result;
     } else if (type_node->type == AST_TYPE_NAMED) {
         // 命名类型（i32, bool, byte, void, 泛型参数 T，或结构体名称）
@@ -1194,11 +1392,23 @@ static int checker_interp_format_max_width(const Type *t, const char *spec) {
     }
 }
 
+static Type checker_infer_type_impl(TypeChecker *checker, ASTNode *expr);
+
+// 推断表达式类型并记录到 expr->resolved_type（规范类型），供代码生成直接读取
+// 同一节点被多次推断时以最后一次为准（如 max/min 在上下文解析后重新推断）
+static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
+    Type result = checker_infer_type_impl(checker, expr);
+    if (checker != NULL && expr != NULL) {
+        expr->resolved_type = type_intern(checker, result);
+    }
+    return result;
+}
+
 // 表达式类型推断函数（从表达式AST节点推断类型）
 // 参数：checker - TypeChecker 指针，expr - 表达式AST节点
 // 返回：Type结构，如果无法推断返回TYPE_VOID类型
 // 注意：这是简化版本，完整的类型推断需要类型检查上下文
-static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
+static Type checker_infer_type_impl(TypeChecker *checker, ASTNode *expr) {
     Type result;
     
     if (checker == NULL || expr == NULL) {
@@ -1236,23 +1446,9 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
         case AST_SRC_NAME:
         case AST_SRC_PATH: {
             // @src_name/@src_path 返回 &[i8] 类型（切片类型）
-            Type *slice_type = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (slice_type == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            slice_type->kind = TYPE_SLICE;
-            
-            Type *element_type = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (element_type == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            element_type->kind = TYPE_I8;
-            slice_type->data.slice.element_type = element_type;
-            
             result.kind = TYPE_SLICE;
-            result.data.slice.element_type = element_type;
+            result.data.slice.element_type = type_intern_kind(checker, TYPE_I8);
+            result.data.slice.slice_len = -1;
             return result;
         }
         
@@ -1271,23 +1467,9 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                 return result;
             }
             
-            Type *slice_type = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (slice_type == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            slice_type->kind = TYPE_SLICE;
-            
-            Type *element_type = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (element_type == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            element_type->kind = TYPE_I8;
-            slice_type->data.slice.element_type = element_type;
-            
             result.kind = TYPE_SLICE;
-            result.data.slice.element_type = element_type;
+            result.data.slice.element_type = type_intern_kind(checker, TYPE_I8);
+            result.data.slice.slice_len = -1;
             return result;
         }
         
@@ -1367,13 +1549,7 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
             // 3. 返回类型：!i64（错误联合类型）
             result.kind = TYPE_ERROR_UNION;
             
-            Type *payload_type = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (payload_type == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            payload_type->kind = TYPE_I64;
-            result.data.error_union.payload_type = payload_type;
+            result.data.error_union.payload_type = type_intern_kind(checker, TYPE_I64);
             
             return result;
         }
@@ -1384,17 +1560,9 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
             Type byte_type;
             byte_type.kind = TYPE_BYTE;
             
-            // 分配指向的类型结构（从Arena分配）
-            Type *pointed_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (pointed_type_ptr == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            *pointed_type_ptr = byte_type;
-            
             // 创建 FFI 指针类型（*byte）
             result.kind = TYPE_POINTER;
-            result.data.pointer.pointer_to = pointed_type_ptr;
+            result.data.pointer.pointer_to = type_intern(checker, byte_type);
             result.data.pointer.is_ffi_pointer = 1;  // FFI 指针类型
             return result;
         }
@@ -1418,14 +1586,8 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                 total += w;
             }
             expr->data.string_interp.computed_size = total;
-            Type *i8_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (i8_ptr == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            i8_ptr->kind = TYPE_I8;
             result.kind = TYPE_ARRAY;
-            result.data.array.element_type = i8_ptr;
+            result.data.array.element_type = type_intern_kind(checker, TYPE_I8);
             result.data.array.array_size = total;
             return result;
         }
@@ -1474,7 +1636,7 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                 result.kind = TYPE_VOID;
                 return result;
             }
-            uint32_t id = get_or_add_error_id(checker, name, expr);
+            uint32_t id = get_or_add_error_id(checker, name);
             if (id == 0) {
                 checker_report_error(checker, expr, "错误集已满");
                 result.kind = TYPE_VOID;
@@ -1607,17 +1769,9 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                     return result;
                 }
                 
-                // 分配操作数类型结构（从Arena分配）
-                Type *pointed_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-                if (pointed_type_ptr == NULL) {
-                    result.kind = TYPE_VOID;
-                    return result;
-                }
-                *pointed_type_ptr = operand_type;
-                
                 // 创建指针类型（普通指针）
                 result.kind = TYPE_POINTER;
-                result.data.pointer.pointer_to = pointed_type_ptr;
+                result.data.pointer.pointer_to = type_intern(checker, operand_type);
                 result.data.pointer.is_ffi_pointer = 0;  // 普通指针
                 return result;
             } else if (op == TOKEN_ASTERISK) {
@@ -1659,13 +1813,8 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                 // 先检查是否是模块限定调用（module.func(args)）
                 if (object->type == AST_IDENTIFIER && object->data.identifier.name != NULL) {
                     const char *obj_name = object->data.identifier.name;
-                    unsigned int ih = hash_string(obj_name);
-                    unsigned int ii = ih & (IMPORT_TABLE_SIZE - 1);
-                    for (int i2 = 0; i2 < IMPORT_TABLE_SIZE; i2++) {
-                        unsigned int sl = (ii + i2) & (IMPORT_TABLE_SIZE - 1);
-                        ImportedItem *imp = checker->import_table.slots[sl];
-                        if (imp == NULL) break;
-                        if (imp->item_type == -1 && strcmp(imp->local_name, obj_name) == 0) {
+                    for (ImportedItem *imp = import_table_lookup(checker, obj_name); imp != NULL; imp = imp->next) {
+                        if (imp->item_type == -1) {
                             // 模块限定调用：标记并查找函数返回类型
                             callee->data.member_access.is_module_access = 1;
                             const char *func_name = callee->data.member_access.field_name;
@@ -1805,53 +1954,41 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                         
                         // 不是枚举，检查是否是模块导入（use std.c.stdio; -> stdio.xxx）
                         {
-                            unsigned int ih = hash_string(enum_name);
-                            unsigned int ii = ih & (IMPORT_TABLE_SIZE - 1);
-                            for (int i2 = 0; i2 < IMPORT_TABLE_SIZE; i2++) {
-                                unsigned int sl = (ii + i2) & (IMPORT_TABLE_SIZE - 1);
-                                ImportedItem *imp = checker->import_table.slots[sl];
-                                if (imp == NULL) break;
-                                if (imp->item_type == -1 && strcmp(imp->local_name, enum_name) == 0) {
+                            for (ImportedItem *imp = import_table_lookup(checker, enum_name); imp != NULL; imp = imp->next) {
+                                if (imp->item_type == -1) {
                                     // 找到模块导入！标记为模块限定访问
                                     expr->data.member_access.is_module_access = 1;
                                     // 从模块导出表查找成员的类型
                                     const char *field = expr->data.member_access.field_name;
                                     if (field != NULL) {
-                                        unsigned int mh = hash_string(imp->module_name);
-                                        unsigned int mi = mh & (MODULE_TABLE_SIZE - 1);
-                                        for (int m = 0; m < MODULE_TABLE_SIZE; m++) {
-                                            unsigned int ms = (mi + m) & (MODULE_TABLE_SIZE - 1);
-                                            ModuleInfo *mod = checker->module_table.slots[ms];
-                                            if (mod == NULL) break;
-                                            if (strcmp(mod->module_name, imp->module_name) == 0) {
-                                                for (int e = 0; e < mod->export_count; e++) {
-                                                    if (strcmp(mod->exports[e].name, field) == 0) {
-                                                        // 根据导出项类型返回适当的类型
-                                                        int et = mod->exports[e].item_type;
-                                                        if (et == 1) {
-                                                            // 函数：查找函数声明获取返回类型
-                                                            result.kind = TYPE_VOID;
-                                                            return result;
-                                                        } else if (et == 2) {
-                                                            result.kind = TYPE_STRUCT;
-                                                            result.data.struct_type.name = field;
-                                                            result.data.struct_type.type_args = NULL;
-                                                            result.data.struct_type.type_arg_count = 0;
-                                                            return result;
-                                                        } else if (et == 5) {
-                                                            result.kind = TYPE_ENUM;
-                                                            result.data.enum_name = field;
-                                                            return result;
-                                                        } else if (et == 10) {
-                                                            // 常量：推断类型（简化处理，返回 void 让放宽检查通过）
-                                                            result.kind = TYPE_VOID;
-                                                            return result;
-                                                        }
+                                        ModuleInfo *mod = module_table_lookup(checker, imp->module_name);
+                                        if (mod != NULL) {
+                                            for (int e = 0; e < mod->export_count; e++) {
+                                                if (strcmp(mod->exports[e].name, field) == 0) {
+                                                    // 根据导出项类型返回适当的类型
+                                                    int et = mod->exports[e].item_type;
+                                                    if (et == 1) {
+                                                        // 函数：查找函数声明获取返回类型
+                                                        result.kind = TYPE_VOID;
+                                                        return result;
+                                                    } else if (et == 2) {
+                                                        result.kind = TYPE_STRUCT;
+                                                        result.data.struct_type.name = field;
+                                                        result.data.struct_type.type_args = NULL;
+                                                        result.data.struct_type.type_arg_count = 0;
+                                                        return result;
+                                                    } else if (et == 5) {
+                                                        result.kind = TYPE_ENUM;
+                                                        result.data.enum_name = field;
+                                                        return result;
+                                                    } else if (et == 10) {
+                                                        // 常量：推断类型（简化处理，返回 void 让放宽检查通过）
                                                         result.kind = TYPE_VOID;
                                                         return result;
                                                     }
+                                                    result.kind = TYPE_VOID;
+                                                    return result;
                                                 }
-                                                break;
                                             }
                                         }
                                     }
@@ -1944,14 +2081,8 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                 result.kind = TYPE_VOID;
                 return result;
             }
-            Type *element_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (element_type_ptr == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            *element_type_ptr = *elem;
             result.kind = TYPE_SLICE;
-            result.data.slice.element_type = element_type_ptr;
+            result.data.slice.element_type = type_intern(checker, *elem);
             result.data.slice.slice_len = -1;  // 动态长度，若 len 为编译期常量可在后续优化
             return result;
         }
@@ -2017,14 +2148,8 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                     result.kind = TYPE_VOID;
                     return result;
                 }
-                Type *element_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-                if (element_type_ptr == NULL) {
-                    result.kind = TYPE_VOID;
-                    return result;
-                }
-                *element_type_ptr = element_type;
                 result.kind = TYPE_ARRAY;
-                result.data.array.element_type = element_type_ptr;
+                result.data.array.element_type = type_intern(checker, element_type);
                 result.data.array.array_size = n;
                 return result;
             }
@@ -2041,15 +2166,8 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
                 return result;
             }
             
-            Type *element_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-            if (element_type_ptr == NULL) {
-                result.kind = TYPE_VOID;
-                return result;
-            }
-            *element_type_ptr = element_type;
-            
             result.kind = TYPE_ARRAY;
-            result.data.array.element_type = element_type_ptr;
+            result.data.array.element_type = type_intern(checker, element_type);
             result.data.array.array_size = element_count;
             
             return result;
@@ -2113,14 +2231,8 @@ static Type checker_infer_type(TypeChecker *checker, ASTNode *expr) {
             Type target_type = type_from_ast(checker, target_type_node);
             if (expr->data.cast_expr.is_force_cast) {
                 // as! 强转：返回 !T（错误联合类型）
-                Type *payload_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-                if (payload_ptr == NULL) {
-                    result.kind = TYPE_VOID;
-                    return result;
-                }
-                *payload_ptr = target_type;
                 result.kind = TYPE_ERROR_UNION;
-                result.data.error_union.payload_type = payload_ptr;
+                result.data.error_union.payload_type = type_intern(checker, target_type);
                 return result;
             }
             return target_type;
@@ -2264,21 +2376,7 @@ static ASTNode *get_builtin_type_info_decl(void) {
 // 参数：program_node - 程序节点，fn_name - 函数名称
 // 返回：找到的函数声明节点指针，未找到返回 NULL
 static ASTNode *find_fn_decl_from_program(ASTNode *program_node, const char *fn_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || fn_name == NULL) {
-        return NULL;
-    }
-    
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_FN_DECL) {
-            if (decl->data.fn_decl.name != NULL && 
-                strcmp(decl->data.fn_decl.name, fn_name) == 0) {
-                return decl;
-            }
-        }
-    }
-    
-    return NULL;
+    return ast_find_decl(program_node, DECL_KEY_FN, fn_name);
 }
 
 // 检查函数是否是泛型函数
@@ -2312,37 +2410,21 @@ static Type substitute_generic_type(TypeChecker *checker, Type type,
     
     // 递归处理复合类型
     if (type.kind == TYPE_POINTER && type.data.pointer.pointer_to != NULL) {
-        Type *new_pointed = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (new_pointed) {
-            *new_pointed = substitute_generic_type(checker, *type.data.pointer.pointer_to,
-                                                    type_params, type_param_count,
-                                                    type_args, type_arg_count);
-            type.data.pointer.pointer_to = new_pointed;
-        }
+        type.data.pointer.pointer_to = type_intern(checker, substitute_generic_type(checker, *type.data.pointer.pointer_to,
+                                                 type_params, type_param_count,
+                                                 type_args, type_arg_count));
     } else if (type.kind == TYPE_ARRAY && type.data.array.element_type != NULL) {
-        Type *new_elem = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (new_elem) {
-            *new_elem = substitute_generic_type(checker, *type.data.array.element_type,
+        type.data.array.element_type = type_intern(checker, substitute_generic_type(checker, *type.data.array.element_type,
                                                  type_params, type_param_count,
-                                                 type_args, type_arg_count);
-            type.data.array.element_type = new_elem;
-        }
+                                                 type_args, type_arg_count));
     } else if (type.kind == TYPE_SLICE && type.data.slice.element_type != NULL) {
-        Type *new_elem = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (new_elem) {
-            *new_elem = substitute_generic_type(checker, *type.data.slice.element_type,
+        type.data.slice.element_type = type_intern(checker, substitute_generic_type(checker, *type.data.slice.element_type,
                                                  type_params, type_param_count,
-                                                 type_args, type_arg_count);
-            type.data.slice.element_type = new_elem;
-        }
+                                                 type_args, type_arg_count));
     } else if (type.kind == TYPE_ERROR_UNION && type.data.error_union.payload_type != NULL) {
-        Type *new_payload = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (new_payload) {
-            *new_payload = substitute_generic_type(checker, *type.data.error_union.payload_type,
-                                                    type_params, type_param_count,
-                                                    type_args, type_arg_count);
-            type.data.error_union.payload_type = new_payload;
-        }
+        type.data.error_union.payload_type = type_intern(checker, substitute_generic_type(checker, *type.data.error_union.payload_type,
+                                                 type_params, type_param_count,
+                                                 type_args, type_arg_count));
     }
     
     return type;
@@ -2392,11 +2474,83 @@ static void register_transitive_mono_instances(TypeChecker *checker, ASTNode *ty
                                                 TypeParam *type_params, int type_param_count,
                                                 ASTNode **type_args, int type_arg_count);
 
+// 单态化分组键哈希（泛型名称 + 函数/结构体）
+static unsigned int mono_group_hash(const char *generic_name, int is_function) {
+    return type_name_hash(generic_name) * 31u + (unsigned int)is_function;
+}
+
+// 单态化实例表的分组槽位翻倍并重新散列
+static void mono_table_grow_groups(TypeChecker *checker) {
+    MonoTable *table = &checker->mono_table;
+    int new_capacity = table->group_capacity > 0 ? table->group_capacity * 2 : MONO_TABLE_INITIAL_CAPACITY;
+    MonoGroup **new_slots = (MonoGroup **)arena_alloc(checker->arena, sizeof(MonoGroup *) * (size_t)new_capacity);
+    memset(new_slots, 0, sizeof(MonoGroup *) * (size_t)new_capacity);
+    unsigned int mask = (unsigned int)(new_capacity - 1);
+    for (int i = 0; i < table->group_capacity; i++) {
+        MonoGroup *group = table->group_slots[i];
+        if (group == NULL) continue;
+        unsigned int j = group->hash & mask;
+        while (new_slots[j] != NULL) {
+            j = (j + 1) & mask;
+        }
+        new_slots[j] = group;
+    }
+    table->group_slots = new_slots;
+    table->group_capacity = new_capacity;
+}
+
+// 单态化实例表的实例槽位翻倍并重新散列
+static void mono_table_grow_instances(TypeChecker *checker) {
+    MonoTable *table = &checker->mono_table;
+    int new_capacity = table->capacity > 0 ? table->capacity * 2 : MONO_TABLE_INITIAL_CAPACITY;
+    MonoInstance **new_slots = (MonoInstance **)arena_alloc(checker->arena, sizeof(MonoInstance *) * (size_t)new_capacity);
+    memset(new_slots, 0, sizeof(MonoInstance *) * (size_t)new_capacity);
+    unsigned int mask = (unsigned int)(new_capacity - 1);
+    for (int i = 0; i < table->capacity; i++) {
+        MonoInstance *inst = table->slots[i];
+        if (inst == NULL) continue;
+        unsigned int j = inst->hash & mask;
+        while (new_slots[j] != NULL) {
+            j = (j + 1) & mask;
+        }
+        new_slots[j] = inst;
+    }
+    table->slots = new_slots;
+    table->capacity = new_capacity;
+}
+
+// 查找泛型声明的分组槽位
+// 返回：分组所在槽位下标，或应插入的空槽位下标（调用前需保证表非空）
+static unsigned int mono_table_group_slot(const MonoTable *table, const char *generic_name,
+                                          int is_function, unsigned int hash) {
+    unsigned int mask = (unsigned int)(table->group_capacity - 1);
+    unsigned int i = hash & mask;
+    while (table->group_slots[i] != NULL) {
+        MonoGroup *group = table->group_slots[i];
+        if (group->hash == hash && group->is_function == is_function &&
+            INTERN_STR_EQ(group->generic_name, generic_name)) {
+            break;
+        }
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+// 查找泛型声明的单态化实例
+const MonoInstance *mono_table_find_group(const MonoTable *table, const char *generic_name, int is_function) {
+    if (table == NULL || generic_name == NULL || table->group_count == 0) {
+        return NULL;
+    }
+    unsigned int i = mono_table_group_slot(table, generic_name, is_function,
+                                           mono_group_hash(generic_name, is_function));
+    return table->group_slots[i] != NULL ? table->group_slots[i]->first : NULL;
+}
+
 // 返回：成功返回 0，失败返回 -1
 static int register_mono_instance(TypeChecker *checker, const char *generic_name,
                                    ASTNode **type_arg_nodes, int type_arg_count,
                                    int is_function) {
-    if (checker == NULL || generic_name == NULL || checker->mono_instance_count >= 512) {
+    if (checker == NULL || generic_name == NULL) {
         return -1;
     }
     
@@ -2408,17 +2562,30 @@ static int register_mono_instance(TypeChecker *checker, const char *generic_name
         }
     }
     
+    MonoTable *table = &checker->mono_table;
+    Type *type_args = (Type *)arena_alloc(checker->arena, sizeof(Type) * type_arg_count);
+    unsigned int group_hash = mono_group_hash(generic_name, is_function);
+    unsigned int hash = group_hash * 31u + (unsigned int)type_arg_count;
+    for (int i = 0; i < type_arg_count; i++) {
+        type_args[i] = type_from_ast(checker, type_arg_nodes[i]);
+        hash = hash * 31u + type_equals_hash(&type_args[i]);
+    }
+    
     // 检查是否已存在相同实例
-    for (int i = 0; i < checker->mono_instance_count; i++) {
-        if (checker->mono_instances[i].generic_name != NULL &&
-            strcmp(checker->mono_instances[i].generic_name, generic_name) == 0 &&
-            checker->mono_instances[i].is_function == is_function &&
-            checker->mono_instances[i].type_arg_count == type_arg_count) {
+    if (table->count * 2 >= table->capacity) {
+        mono_table_grow_instances(checker);
+    }
+    unsigned int mask = (unsigned int)(table->capacity - 1);
+    unsigned int slot = hash & mask;
+    while (table->slots[slot] != NULL) {
+        MonoInstance *existing = table->slots[slot];
+        if (existing->hash == hash && existing->is_function == is_function &&
+            existing->type_arg_count == type_arg_count &&
+            INTERN_STR_EQ(existing->generic_name, generic_name)) {
             // 比较类型实参
             int match = 1;
             for (int j = 0; j < type_arg_count && match; j++) {
-                Type arg_type = type_from_ast(checker, type_arg_nodes[j]);
-                if (!type_equals(checker->mono_instances[i].type_args[j], arg_type)) {
+                if (!type_equals(existing->type_args[j], type_args[j])) {
                     match = 0;
                 }
             }
@@ -2426,28 +2593,42 @@ static int register_mono_instance(TypeChecker *checker, const char *generic_name
                 return 0;  // 已存在相同实例
             }
         }
+        slot = (slot + 1) & mask;
     }
     
     // 注册新实例
-    int idx = checker->mono_instance_count++;
-    checker->mono_instances[idx].generic_name = generic_name;
-    checker->mono_instances[idx].is_function = is_function;
-    checker->mono_instances[idx].type_arg_count = type_arg_count;
-    checker->mono_instances[idx].type_args = (Type *)arena_alloc(checker->arena, sizeof(Type) * type_arg_count);
-    if (checker->mono_instances[idx].type_args == NULL) {
-        checker->mono_instance_count--;
-        return -1;
-    }
-    // 保存 AST 节点数组
-    checker->mono_instances[idx].type_arg_nodes = (ASTNode **)arena_alloc(checker->arena, sizeof(ASTNode *) * type_arg_count);
-    if (checker->mono_instances[idx].type_arg_nodes == NULL) {
-        checker->mono_instance_count--;
-        return -1;
-    }
+    MonoInstance *inst = (MonoInstance *)arena_alloc(checker->arena, sizeof(MonoInstance));
+    inst->type_arg_nodes = (ASTNode **)arena_alloc(checker->arena, sizeof(ASTNode *) * type_arg_count);
     for (int i = 0; i < type_arg_count; i++) {
-        checker->mono_instances[idx].type_args[i] = type_from_ast(checker, type_arg_nodes[i]);
-        checker->mono_instances[idx].type_arg_nodes[i] = type_arg_nodes[i];
+        inst->type_arg_nodes[i] = type_arg_nodes[i];
+    }
+    inst->generic_name = generic_name;
+    inst->type_args = type_args;
+    inst->type_arg_count = type_arg_count;
+    inst->is_function = is_function;
+    inst->hash = hash;
+    inst->next_in_group = NULL;
+    int idx = table->count++;
+    table->slots[slot] = inst;
+    
+    // 追加到所属泛型声明的分组末尾（保持注册顺序）
+    if (table->group_count * 2 >= table->group_capacity) {
+        mono_table_grow_groups(checker);
+    }
+    unsigned int group_slot = mono_table_group_slot(table, generic_name, is_function, group_hash);
+    MonoGroup *group = table->group_slots[group_slot];
+    if (group == NULL) {
+        group = (MonoGroup *)arena_alloc(checker->arena, sizeof(MonoGroup));
+        group->generic_name = generic_name;
+        group->is_function = is_function;
+        group->hash = group_hash;
+        group->first = inst;
+        table->group_slots[group_slot] = group;
+        table->group_count++;
+    } else {
+        group->last->next_in_group = inst;
     }
+    group->last = inst;
     fprintf(stderr, "[DEBUG] Registered mono instance #%d: %s<%s> (is_fn=%d) type_arg_nodes[0]=%p\n",
         idx, generic_name,
         type_arg_count > 0 && type_arg_nodes[0] && type_arg_nodes[0]->type == AST_TYPE_NAMED && type_arg_nodes[0]->data.type_named.name ? type_arg_nodes[0]->data.type_named.name : "?",
@@ -2542,22 +2723,17 @@ static void register_transitive_mono_instances(TypeChecker *checker, ASTNode *ty
 // 参数：program_node - 程序节点，struct_name - 结构体名称
 // 返回：找到的结构体声明节点指针，未找到返回 NULL
 static ASTNode *find_struct_decl_from_program(ASTNode *program_node, const char *struct_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || struct_name == NULL) {
+    if (struct_name == NULL) {
         return NULL;
     }
     
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_STRUCT_DECL) {
-            if (decl->data.struct_decl.name != NULL && 
-                strcmp(decl->data.struct_decl.name, struct_name) == 0) {
-                return decl;
-            }
-        }
+    ASTNode *decl = ast_find_decl(program_node, DECL_KEY_STRUCT, struct_name);
+    if (decl != NULL) {
+        return decl;
     }
     
     // 如果未找到用户定义的结构体，检查是否是内置 TypeInfo
-    if (strcmp(struct_name, "TypeInfo") == 0) {
+    if (program_node != NULL && program_node->type == AST_PROGRAM && strcmp(struct_name, "TypeInfo") == 0) {
         return get_builtin_type_info_decl();
     }
     
@@ -2565,73 +2741,21 @@ static ASTNode *find_struct_decl_from_program(ASTNode *program_node, const char
 }
 
 static ASTNode *find_union_decl_from_program(ASTNode *program_node, const char *union_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || union_name == NULL) {
-        return NULL;
-    }
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_UNION_DECL) {
-            if (decl->data.union_decl.name != NULL &&
-                strcmp(decl->data.union_decl.name, union_name) == 0) {
-                return decl;
-            }
-        }
-    }
-    return NULL;
+    return ast_find_decl(program_node, DECL_KEY_UNION, union_name);
 }
 
 // 从程序节点中查找枚举声明
 static ASTNode *find_enum_decl_from_program(ASTNode *program_node, const char *enum_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || enum_name == NULL) {
-        return NULL;
-    }
-    
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_ENUM_DECL) {
-            if (decl->data.enum_decl.name != NULL && 
-                strcmp(decl->data.enum_decl.name, enum_name) == 0) {
-                return decl;
-            }
-        }
-    }
-    
-    return NULL;
+    return ast_find_decl(program_node, DECL_KEY_ENUM, enum_name);
 }
 
 // 查找类型别名声明
 static ASTNode *find_type_alias_from_program(ASTNode *program_node, const char *alias_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || alias_name == NULL) {
-        return NULL;
-    }
-    
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_TYPE_ALIAS) {
-            if (decl->data.type_alias.name != NULL && 
-                strcmp(decl->data.type_alias.name, alias_name) == 0) {
-                return decl;
-            }
-        }
-    }
-    
-    return NULL;
+    return ast_find_decl(program_node, DECL_KEY_TYPE_ALIAS, alias_name);
 }
 
 static ASTNode *find_interface_decl_from_program(ASTNode *program_node, const char *interface_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || interface_name == NULL) {
-        return NULL;
-    }
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_INTERFACE_DECL) {
-            if (decl->data.interface_decl.name != NULL &&
-                strcmp(decl->data.interface_decl.name, interface_name) == 0) {
-                return decl;
-            }
-        }
-    }
-    return NULL;
+    return ast_find_decl(program_node, DECL_KEY_INTERFACE, interface_name);
 }
 
 // 检测接口组合的循环依赖（DFS）
@@ -2704,93 +2828,21 @@ static ASTNode *find_interface_method_sig(ASTNode *program_node, const char *int
 }
 
 static ASTNode *find_method_block_for_struct(ASTNode *program_node, const char *struct_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || struct_name == NULL) {
-        return NULL;
-    }
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_METHOD_BLOCK) {
-            if (decl->data.method_block.struct_name != NULL &&
-                strcmp(decl->data.method_block.struct_name, struct_name) == 0) {
-                return decl;
-            }
-        }
-    }
-    return NULL;
+    return ast_find_decl(program_node, DECL_KEY_STRUCT_METHODS, struct_name);
 }
 
 // 查找结构体方法（同时检查外部方法块和内部定义的方法）
 // 返回：方法的 AST_FN_DECL 节点，未找到返回 NULL
 static ASTNode *find_method_in_struct(ASTNode *program_node, const char *struct_name, const char *method_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || struct_name == NULL || method_name == NULL) {
-        return NULL;
-    }
-    // 1. 先检查外部方法块
-    ASTNode *method_block = find_method_block_for_struct(program_node, struct_name);
-    if (method_block != NULL) {
-        for (int i = 0; i < method_block->data.method_block.method_count; i++) {
-            ASTNode *m = method_block->data.method_block.methods[i];
-            if (m != NULL && m->type == AST_FN_DECL && m->data.fn_decl.name != NULL &&
-                strcmp(m->data.fn_decl.name, method_name) == 0) {
-                return m;
-            }
-        }
-    }
-    // 2. 再检查结构体内部定义的方法
-    ASTNode *struct_decl = find_struct_decl_from_program(program_node, struct_name);
-    if (struct_decl != NULL && struct_decl->data.struct_decl.methods != NULL) {
-        for (int i = 0; i < struct_decl->data.struct_decl.method_count; i++) {
-            ASTNode *m = struct_decl->data.struct_decl.methods[i];
-            if (m != NULL && m->type == AST_FN_DECL && m->data.fn_decl.name != NULL &&
-                strcmp(m->data.fn_decl.name, method_name) == 0) {
-                return m;
-            }
-        }
-    }
-    return NULL;
+    return ast_find_method(program_node, DECL_KEY_STRUCT_METHOD, struct_name, method_name);
 }
 
 static ASTNode *find_method_block_for_union(ASTNode *program_node, const char *union_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || union_name == NULL) {
-        return NULL;
-    }
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_METHOD_BLOCK) {
-            if (decl->data.method_block.union_name != NULL &&
-                strcmp(decl->data.method_block.union_name, union_name) == 0) {
-                return decl;
-            }
-        }
-    }
-    return NULL;
+    return ast_find_decl(program_node, DECL_KEY_UNION_METHODS, union_name);
 }
 
 static ASTNode *find_method_in_union(ASTNode *program_node, const char *union_name, const char *method_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || union_name == NULL || method_name == NULL) {
-        return NULL;
-    }
-    ASTNode *method_block = find_method_block_for_union(program_node, union_name);
-    if (method_block != NULL) {
-        for (int i = 0; i < method_block->data.method_block.method_count; i++) {
-            ASTNode *m = method_block->data.method_block.methods[i];
-            if (m != NULL && m->type == AST_FN_DECL && m->data.fn_decl.name != NULL &&
-                strcmp(m->data.fn_decl.name, method_name) == 0) {
-                return m;
-            }
-        }
-    }
-    ASTNode *union_decl = find_union_decl_from_program(program_node, union_name);
-    if (union_decl != NULL && union_decl->data.union_decl.methods != NULL) {
-        for (int i = 0; i < union_decl->data.union_decl.method_count; i++) {
-            ASTNode *m = union_decl->data.union_decl.methods[i];
-            if (m != NULL && m->type == AST_FN_DECL && m->data.fn_decl.name != NULL &&
-                strcmp(m->data.fn_decl.name, method_name) == 0) {
-                return m;
-            }
-        }
-    }
-    return NULL;
+    return ast_find_method(program_node, DECL_KEY_UNION_METHOD, union_name, method_name);
 }
 
 // 校验 drop 方法签名（规范 §12）：fn drop(self: T) void，T 为按值（非指针），每类型仅一个
@@ -2865,21 +2917,7 @@ static int struct_implements_interface(TypeChecker *checker, const char *struct_
 // 检查 name 是否是程序中任意枚举的变体名（裸枚举常量检测）
 // 返回 1 表示是枚举变体名，0 表示不是
 static int is_enum_variant_name_in_program(ASTNode *program_node, const char *name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || name == NULL) {
-        return 0;
-    }
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_ENUM_DECL && decl->data.enum_decl.variants != NULL) {
-            for (int j = 0; j < decl->data.enum_decl.variant_count; j++) {
-                if (decl->data.enum_decl.variants[j].name != NULL &&
-                    strcmp(decl->data.enum_decl.variants[j].name, name) == 0) {
-                    return 1;
-                }
-            }
-        }
-    }
-    return 0;
+    return ast_find_decl(program_node, DECL_KEY_ENUM_VARIANT, name) != NULL;
 }
 
 // 评估编译时常量表达式（用于 [value: N] 的 N 等），返回整数值；-1 表示无法评估
@@ -2895,17 +2933,9 @@ static int checker_eval_const_expr(TypeChecker *checker, ASTNode *expr) {
             if (checker->program_node == NULL) return -1;
             ASTNode *program = checker->program_node;
             if (program->type != AST_PROGRAM) return -1;
-            for (int i = 0; i < program->data.program.decl_count; i++) {
-                ASTNode *decl = program->data.program.decls[i];
-                if (decl != NULL && decl->type == AST_VAR_DECL &&
-                    decl->data.var_decl.name != NULL &&
-                    strcmp(decl->data.var_decl.name, expr->data.identifier.name) == 0 &&
-                    decl->data.var_decl.is_const) {
-                    ASTNode *init = decl->data.var_decl.init;
-                    if (init != NULL)
-                        return checker_eval_const_expr(checker, init);
-                    return -1;
-                }
+            ASTNode *decl = ast_find_decl(program, DECL_KEY_VAR, expr->data.identifier.name);
+            if (decl != NULL && decl->data.var_decl.is_const && decl->data.var_decl.init != NULL) {
+                return checker_eval_const_expr(checker, decl->data.var_decl.init);
             }
             return -1;
         }
@@ -2980,38 +3010,19 @@ static const char *checker_arena_strdup(Arena *arena, const char *src) {
     return p;
 }
 
-static uint32_t hash_error_name(const char *name) {
-    uint32_t h = 5381;
-    unsigned char c;
-    while ((c = (unsigned char)*name++) != 0) {
-        h = ((h << 5) + h) + c;
-    }
-    return (h == 0) ? 1 : h;
-}
-
-static uint32_t get_or_add_error_id(TypeChecker *checker, const char *name, ASTNode *node) {
+static uint32_t get_or_add_error_id(TypeChecker *checker, const char *name) {
     if (checker == NULL || name == NULL) return 0;
-    uint32_t h = hash_error_name(name);
     for (int i = 0; i < checker->error_name_count; i++) {
         if (checker->error_names[i] != NULL && strcmp(checker->error_names[i], name) == 0) {
-            return checker->error_hashes[i];
-        }
-        if (checker->error_hashes[i] == h && strcmp(checker->error_names[i], name) != 0) {
-            char buf[256];
-            snprintf(buf, sizeof(buf),
-                "error_id 冲突: error.%s 与 error.%s 的 hash 相同 (0x%X)，请重命名其一",
-                name, checker->error_names[i], (unsigned)h);
-            checker_report_error(checker, node, buf);
-            return 0;
+            return (uint32_t)(i + 1);
         }
     }
     if (checker->error_name_count >= 128) return 0;
     const char *copy = checker_arena_strdup(checker->arena, name);
     if (copy == NULL) return 0;
     checker->error_names[checker->error_name_count] = copy;
-    checker->error_hashes[checker->error_name_count] = h;
     checker->error_name_count++;
-    return h;
+    return (uint32_t)checker->error_name_count;
 }
 
 // 检查表达式类型是否匹配预期类型
@@ -3296,9 +3307,9 @@ static int checker_check_var_decl(TypeChecker *checker, ASTNode *node) {
     symbol->decl_node = node;
     
     if (symbol_table_insert(checker, symbol) != 0) {
-        // 符号插入失败（哈希表已满）：报告错误
+        // 符号插入失败（同作用域已有同名符号）：报告错误
         char error_msg[256];
-        snprintf(error_msg, sizeof(error_msg), "符号表已满，无法添加变量 '%s'", node->data.var_decl.name);
+        snprintf(error_msg, sizeof(error_msg), "无法添加变量 '%s' 到符号表", node->data.var_decl.name);
         checker_report_error(checker, node, error_msg);
         return 0;
     }
@@ -3376,7 +3387,7 @@ static int checker_check_destructure_decl(TypeChecker *checker, ASTNode *node) {
             return 0;
         }
         if (symbol_table_insert(checker, symbol) != 0) {
-            checker_report_error(checker, node, "符号表已满");
+            checker_report_error(checker, node, "无法添加变量到符号表");
             return 0;
         }
     }
@@ -4210,12 +4221,14 @@ static Type checker_check_member_access(TypeChecker *checker, ASTNode *node) {
                 strcmp(field_name, "array_literal_elements") == 0 ||
                 strcmp(field_name, "struct_init_field_values") == 0) {
                 // 返回 &ASTNode 类型（数组元素类型）
+                Type node_type;
+                node_type.kind = TYPE_STRUCT;
+                node_type.data.struct_type.name = "ASTNode";
+                node_type.data.struct_type.type_args = NULL;
+                node_type.data.struct_type.type_arg_count = 0;
                 result.kind = TYPE_POINTER;
-                result.data.pointer.pointer_to = (Type *)arena_alloc(checker->arena, sizeof(Type));
-                if (result.data.pointer.pointer_to != NULL) {
-                    result.data.pointer.pointer_to->kind = TYPE_STRUCT;
-                    result.data.pointer.pointer_to->data.struct_type.name = "ASTNode";
-                }
+                result.data.pointer.pointer_to = type_intern(checker, node_type);
+                result.data.pointer.is_ffi_pointer = 0;
                 return result;
             }
             // 对于其他字段，返回 void 类型（表示类型推断失败，但不报错）
@@ -4432,6 +4445,8 @@ static Type checker_check_struct_init(TypeChecker *checker, ASTNode *node) {
         // 这在编译器自举时很常见，因为结构体可能尚未定义或存在前向引用
         result.kind = TYPE_STRUCT;
         result.data.struct_type.name = struct_name;
+        result.data.struct_type.type_args = NULL;
+        result.data.struct_type.type_arg_count = 0;
         return result;
     }
     
@@ -4441,6 +4456,8 @@ static Type checker_check_struct_init(TypeChecker *checker, ASTNode *node) {
         // 这在编译器自举时可能发生
         result.kind = TYPE_STRUCT;
         result.data.struct_type.name = struct_name;
+        result.data.struct_type.type_args = NULL;
+        result.data.struct_type.type_arg_count = 0;
         return result;
     }
     
@@ -4465,6 +4482,8 @@ static Type checker_check_struct_init(TypeChecker *checker, ASTNode *node) {
     
     result.kind = TYPE_STRUCT;
     result.data.struct_type.name = struct_name;
+    result.data.struct_type.type_args = NULL;
+    result.data.struct_type.type_arg_count = 0;
     return result;
 }
 
@@ -4799,17 +4818,9 @@ static Type checker_check_unary_expr(TypeChecker *checker, ASTNode *node) {
             return result;
         }
         
-        // 分配操作数类型结构（从Arena分配）
-        Type *pointed_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-        if (pointed_type_ptr == NULL) {
-            checker_report_error(checker, node, "类型检查错误");
-            return result;
-        }
-        *pointed_type_ptr = operand_type;
-        
         // 返回指向操作数类型的指针类型（普通指针）
         result.kind = TYPE_POINTER;
-        result.data.pointer.pointer_to = pointed_type_ptr;
+        result.data.pointer.pointer_to = type_intern(checker, operand_type);
         result.data.pointer.is_ffi_pointer = 0;
         return result;
     } else if (op == TOKEN_ASTERISK) {
@@ -5069,7 +5080,7 @@ static int checker_check_node(TypeChecker *checker, ASTNode *node) {
                 return 0;
             }
             if (node->data.error_decl.name != NULL) {
-                get_or_add_error_id(checker, node->data.error_decl.name, node);
+                get_or_add_error_id(checker, node->data.error_decl.name);
             }
             return 1;
             
@@ -5332,24 +5343,9 @@ static int checker_check_node(TypeChecker *checker, ASTNode *node) {
                 
                 if (node->data.for_stmt.is_ref) {
                     // 引用迭代：变量类型为 &T（指向元素的指针）
-                    Type element_type = *array_type.data.array.element_type;
-                    Type *element_type_ptr = (Type *)arena_alloc(checker->arena, sizeof(Type));
-                    if (element_type_ptr == NULL) {
-                        checker_report_error(checker, node, "类型检查错误：内存分配失败");
-                        checker_enter_scope(checker);
-                        checker->loop_depth++;
-                        if (node->data.for_stmt.body != NULL) {
-                            checker_check_node(checker, node->data.for_stmt.body);
-                        }
-                        checker->loop_depth--;
-                        checker_exit_scope(checker);
-                        return 1;
-                    } else {
-                        *element_type_ptr = element_type;
-                        var_type.kind = TYPE_POINTER;
-                        var_type.data.pointer.pointer_to = element_type_ptr;
-                        var_type.data.pointer.is_ffi_pointer = 0;
-                    }
+                    var_type.kind = TYPE_POINTER;
+                    var_type.data.pointer.pointer_to = type_intern(checker, *array_type.data.array.element_type);
+                    var_type.data.pointer.is_ffi_pointer = 0;
                 } else {
                     // 值迭代：变量类型为数组元素类型 T
                     var_type = *array_type.data.array.element_type;
@@ -5413,6 +5409,10 @@ static int checker_check_node(TypeChecker *checker, ASTNode *node) {
                         symbol_table_insert(checker, sym);
                     }
                 }
+                if (arm->kind == MATCH_PAT_ERROR && arm->data.error_pat.error_name != NULL &&
+                    get_or_add_error_id(checker, arm->data.error_pat.error_name) == 0) {
+                    checker_report_error(checker, node, "错误集已满");
+                }
                 if (arm->kind == MATCH_PAT_ENUM && arm->data.enum_pat.enum_name != NULL && arm->data.enum_pat.variant_name != NULL) {
                     if (expr_type.kind != TYPE_ENUM) {
                         checker_report_error(checker, node, "枚举模式只能匹配枚举类型");
@@ -5966,15 +5966,7 @@ static int checker_check_node(TypeChecker *checker, ASTNode *node) {
 
 // 从程序中查找宏声明（仅搜索当前程序）
 static ASTNode *find_macro_decl_from_program(ASTNode *program_node, const char *macro_name) {
-    if (program_node == NULL || program_node->type != AST_PROGRAM || macro_name == NULL) return NULL;
-    for (int i = 0; i < program_node->data.program.decl_count; i++) {
-        ASTNode *decl = program_node->data.program.decls[i];
-        if (decl != NULL && decl->type == AST_MACRO_DECL && decl->data.macro_decl.name != NULL &&
-            strcmp(decl->data.macro_decl.name, macro_name) == 0) {
-            return decl;
-        }
-    }
-    return NULL;
+    return ast_find_decl(program_node, DECL_KEY_MACRO, macro_name);
 }
 
 // 从程序和导入的模块中查找宏声明（支持跨模块宏）
@@ -5986,22 +5978,16 @@ static ASTNode *find_macro_decl_with_imports(TypeChecker *checker, const char *m
     if (decl != NULL) return decl;
     
     // 然后在导入表中查找
-    for (int i = 0; i < IMPORT_TABLE_SIZE; i++) {
-        ImportedItem *import = checker->import_table.slots[i];
-        if (import == NULL) continue;
-        if (import->item_type == 8 && import->local_name != NULL &&
-            strcmp(import->local_name, macro_name) == 0) {
+    for (ImportedItem *import = import_table_lookup(checker, macro_name); import != NULL; import = import->next) {
+        if (import->item_type == 8) {
             // 找到匹配的导入宏，从源模块获取声明
-            for (int j = 0; j < MODULE_TABLE_SIZE; j++) {
-                ModuleInfo *module = checker->module_table.slots[j];
-                if (module == NULL) continue;
-                if (module->module_name != NULL && strcmp(module->module_name, import->module_name) == 0) {
-                    for (int k = 0; k < module->export_count; k++) {
-                        ExportedItem *exp = &module->exports[k];
-                        if (exp->item_type == 8 && exp->name != NULL &&
-                            strcmp(exp->name, import->original_name) == 0) {
-                            return exp->decl_node;
-                        }
+            ModuleInfo *module = module_table_lookup(checker, import->module_name);
+            if (module != NULL) {
+                for (int k = 0; k < module->export_count; k++) {
+                    ExportedItem *exp = &module->exports[k];
+                    if (exp->item_type == 8 && exp->name != NULL &&
+                        strcmp(exp->name, import->original_name) == 0) {
+                        return exp->decl_node;
                     }
                 }
             }
@@ -6019,23 +6005,63 @@ typedef struct MacroParamBinding {
     ASTNode *arg_ast;          // 实参 AST 节点
 } MacroParamBinding;
 
+// 宏展开模板中由实参拷贝得到的子树（见宏展开缓存）
+typedef struct MacroTemplateHole {
+    ASTNode *node;                // 模板中的子树根
+    int param_index;              // 对应的宏参数下标
+    int full_bindings;            // 1 表示拷贝实参时仍应用参数替换（${} 插值），0 表示不替换
+} MacroTemplateHole;
+
+// 宏展开模板（宏展开缓存的值）
+// 宏体拷贝得到的节点位置来自宏定义，与调用位置无关；实参拷贝得到的子树（洞）携带调用位置，
+// 复用时按调用位置重新拷贝当前实参，结果与重新展开完全相同
+typedef struct MacroTemplate {
+    ASTNode *root;                // 展开结果（尚未展开其中嵌套的宏调用）
+    MacroParamBinding *bindings;  // 展开时的合并绑定（宏参数在前，宏体局部常量在后）
+    int binding_count;            // 合并绑定数量
+    int param_count;              // 宏参数数量
+    MacroTemplateHole *holes;     // 洞数组（从 Arena 分配，按需翻倍）
+    int hole_count;               // 洞数量
+    int hole_capacity;            // 洞数组容量
+    MacroTemplateHole **hole_slots; // 按节点地址散列的洞索引（开放寻址，模板建立后生成，无洞时为 NULL）
+    unsigned int hole_slot_mask;  // 洞索引槽位数量 - 1（槽位数量为2的幂）
+    int full_binding_holes;       // 拷贝时需要完整绑定的洞数量（为 0 时复用无需重建绑定）
+    int cacheable;                // 0 表示结果依赖调用位置以外的信息，不能复用
+} MacroTemplate;
+
+// 宏展开缓存中一个宏名称的条目
+// 宏名称的解析结果不随检查进度变化（程序声明固定，导入表只在同名链尾追加），解析一次后直接复用
+typedef struct MacroCacheEntry {
+    ASTNode *macro_decl;          // 宏声明
+    HashMap templates;            // 实参结构 -> 展开模板（MacroTemplate）
+} MacroCacheEntry;
+
 // 宏展开上下文
 typedef struct MacroExpandContext {
     MacroParamBinding *bindings;  // 参数绑定数组
     int binding_count;            // 绑定数量
     Arena *arena;                 // Arena 分配器
     TypeChecker *checker;         // 类型检查器
+    MacroTemplate *record;        // 非 NULL 时记录实参拷贝位置（首次展开，建立模板）
+    MacroTemplate *replay;        // 非 NULL 时拷贝模板：洞重新拷贝当前实参，其余节点原样拷贝
+    ASTNode **args;               // 拷贝模板时本次调用的实参（按宏参数下标）
 } MacroExpandContext;
 
-// 在绑定中查找参数
-static ASTNode *find_param_binding(MacroExpandContext *ctx, const char *name) {
-    if (ctx == NULL || ctx->bindings == NULL || name == NULL) return NULL;
+// 在绑定中查找参数，返回绑定下标，未找到返回 -1（拷贝模板时不做参数替换）
+static int find_param_binding_index(MacroExpandContext *ctx, const char *name) {
+    if (ctx == NULL || ctx->bindings == NULL || ctx->replay != NULL || name == NULL) return -1;
     for (int i = 0; i < ctx->binding_count; i++) {
         if (ctx->bindings[i].param_name != NULL && strcmp(ctx->bindings[i].param_name, name) == 0) {
-            return ctx->bindings[i].arg_ast;
+            return i;
         }
     }
-    return NULL;
+    return -1;
+}
+
+// 在绑定中查找参数
+static ASTNode *find_param_binding(MacroExpandContext *ctx, const char *name) {
+    int index = find_param_binding_index(ctx, name);
+    return index >= 0 ? ctx->bindings[index].arg_ast : NULL;
 }
 
 // 辅助函数：复制字符串到 Arena
@@ -6054,6 +6080,93 @@ static ASTNode *deep_copy_ast(ASTNode *node, MacroExpandContext *ctx);
 static int64_t macro_eval_expr(ASTNode *expr, MacroExpandContext *ctx, int *success);
 static ASTNode *create_number_literal(int64_t value, Arena *arena, int line, int column);
 
+// ============ 宏展开缓存（规范 uya.md §25.8） ============
+// 缓存按宏名称分条目（见 MacroCacheEntry），条目内以实参的结构（不含位置）为键，
+// 值为首次展开得到的模板（见 MacroTemplate）。
+// 结果还依赖调用位置以外信息的展开（保留 @mc_* 节点、type 标签把实参标识符转为类型节点）不缓存。
+
+// 记录模板中的洞（只记录宏参数；宏体局部常量的值由实参决定，其节点位置来自宏定义）
+static void macro_template_add_hole(MacroExpandContext *ctx, ASTNode *node, int param_index, int full_bindings) {
+    MacroTemplate *tmpl = ctx->record;
+    if (tmpl == NULL || node == NULL || param_index >= tmpl->param_count) return;
+    if (tmpl->hole_count >= tmpl->hole_capacity) {
+        int new_capacity = tmpl->hole_capacity > 0 ? tmpl->hole_capacity * 2 : 8;
+        MacroTemplateHole *holes = (MacroTemplateHole *)arena_alloc(ctx->arena, sizeof(MacroTemplateHole) * (size_t)new_capacity);
+        if (holes == NULL) {
+            tmpl->cacheable = 0;
+            return;
+        }
+        if (tmpl->hole_count > 0) {
+            memcpy(holes, tmpl->holes, sizeof(MacroTemplateHole) * (size_t)tmpl->hole_count);
+        }
+        tmpl->holes = holes;
+        tmpl->hole_capacity = new_capacity;
+    }
+    tmpl->holes[tmpl->hole_count].node = node;
+    tmpl->holes[tmpl->hole_count].param_index = param_index;
+    tmpl->holes[tmpl->hole_count].full_bindings = full_bindings;
+    tmpl->hole_count++;
+    if (full_bindings) {
+        tmpl->full_binding_holes++;
+    }
+}
+
+// 洞索引的节点地址散列
+static unsigned int macro_hole_hash(const ASTNode *node) {
+    return (unsigned int)(((uintptr_t)node >> 4) * 2654435761u);
+}
+
+// 模板建立后生成洞索引（槽位数量不少于洞数量的 2 倍），拷贝模板时每个节点 O(1) 判断是否为洞
+// 返回：成功返回 0，内存分配失败返回 -1
+static int macro_template_index_holes(MacroTemplate *tmpl, Arena *arena) {
+    if (tmpl->hole_count == 0) return 0;
+    unsigned int capacity = 8;
+    while (capacity < (unsigned int)tmpl->hole_count * 2) {
+        capacity *= 2;
+    }
+    MacroTemplateHole **slots = (MacroTemplateHole **)arena_alloc(arena, sizeof(MacroTemplateHole *) * capacity);
+    if (slots == NULL) return -1;
+    memset(slots, 0, sizeof(MacroTemplateHole *) * capacity);
+    unsigned int mask = capacity - 1;
+    for (int i = 0; i < tmpl->hole_count; i++) {
+        unsigned int j = macro_hole_hash(tmpl->holes[i].node) & mask;
+        while (slots[j] != NULL) {
+            j = (j + 1) & mask;
+        }
+        slots[j] = &tmpl->holes[i];
+    }
+    tmpl->hole_slots = slots;
+    tmpl->hole_slot_mask = mask;
+    return 0;
+}
+
+// 当前展开不能缓存
+static void macro_template_reject(MacroExpandContext *ctx) {
+    if (ctx->record != NULL) {
+        ctx->record->cacheable = 0;
+    }
+}
+
+// 拷贝模板时，若 node 是洞则按当前实参重新拷贝（与首次展开的拷贝方式相同），否则返回 NULL
+// 洞由模板的洞索引按节点地址查找，不逐个比较
+static ASTNode *macro_template_fill_hole(ASTNode *node, MacroExpandContext *ctx) {
+    MacroTemplate *tmpl = ctx->replay;
+    if (tmpl->hole_slots == NULL) return NULL;
+    for (unsigned int i = macro_hole_hash(node) & tmpl->hole_slot_mask; tmpl->hole_slots[i] != NULL;
+         i = (i + 1) & tmpl->hole_slot_mask) {
+        MacroTemplateHole *hole = tmpl->hole_slots[i];
+        if (hole->node == node) {
+            MacroExpandContext arg_ctx = { NULL, 0, ctx->arena, ctx->checker, NULL, NULL, NULL };
+            if (hole->full_bindings) {
+                arg_ctx.bindings = ctx->bindings;
+                arg_ctx.binding_count = ctx->binding_count;
+            }
+            return deep_copy_ast(ctx->args[hole->param_index], &arg_ctx);
+        }
+    }
+    return NULL;
+}
+
 // 编译时求值表达式（用于 @mc_eval）
 static int64_t macro_eval_expr(ASTNode *expr, MacroExpandContext *ctx, int *success) {
     *success = 0;
@@ -6127,13 +6240,21 @@ static ASTNode *create_number_literal(int64_t value, Arena *arena, int line, int
 static ASTNode *deep_copy_ast(ASTNode *node, MacroExpandContext *ctx) {
     if (node == NULL || ctx == NULL || ctx->arena == NULL) return NULL;
     
+    // 拷贝模板：洞按当前实参重新拷贝
+    if (ctx->replay != NULL) {
+        ASTNode *arg_copy = macro_template_fill_hole(node, ctx);
+        if (arg_copy != NULL) return arg_copy;
+    }
+    
     // 如果是标识符，检查是否是宏参数
     if (node->type == AST_IDENTIFIER && node->data.identifier.name != NULL) {
-        ASTNode *arg = find_param_binding(ctx, node->data.identifier.name);
-        if (arg != NULL) {
+        int index = find_param_binding_index(ctx, node->data.identifier.name);
+        if (index >= 0 && ctx->bindings[index].arg_ast != NULL) {
             // 参数引用，递归拷贝实参 AST（不再应用参数替换，避免无限递归）
-            MacroExpandContext no_param_ctx = { NULL, 0, ctx->arena, ctx->checker };
-            return deep_copy_ast(arg, &no_param_ctx);
+            MacroExpandContext no_param_ctx = { NULL, 0, ctx->arena, ctx->checker, NULL, NULL, NULL };
+            ASTNode *arg_copy = deep_copy_ast(ctx->bindings[index].arg_ast, &no_param_ctx);
+            macro_template_add_hole(ctx, arg_copy, index, 0);
+            return arg_copy;
         }
     }
     
@@ -6271,11 +6392,13 @@ static ASTNode *deep_copy_ast(ASTNode *node, MacroExpandContext *ctx) {
             const char *name = node->data.type_named.name;
             // 检查类型名称是否是宏参数
             if (name != NULL) {
-                ASTNode *arg = find_param_binding(ctx, name);
-                if (arg != NULL) {
+                int index = find_param_binding_index(ctx, name);
+                if (index >= 0 && ctx->bindings[index].arg_ast != NULL) {
                     // 参数引用，返回参数 AST 的深拷贝
-                    MacroExpandContext no_param_ctx = { NULL, 0, ctx->arena, ctx->checker };
-                    return deep_copy_ast(arg, &no_param_ctx);
+                    MacroExpandContext no_param_ctx = { NULL, 0, ctx->arena, ctx->checker, NULL, NULL, NULL };
+                    ASTNode *arg_copy = deep_copy_ast(ctx->bindings[index].arg_ast, &no_param_ctx);
+                    macro_template_add_hole(ctx, arg_copy, index, 0);
+                    return arg_copy;
                 }
             }
             copy->data.type_named.name = name ? macro_strdup(ctx->arena, name) : NULL;
@@ -6290,9 +6413,11 @@ static ASTNode *deep_copy_ast(ASTNode *node, MacroExpandContext *ctx) {
             copy->data.type_array.size_expr = deep_copy_ast(node->data.type_array.size_expr, ctx);
             break;
         case AST_MC_CODE:
+            macro_template_reject(ctx);
             copy->data.mc_code.operand = deep_copy_ast(node->data.mc_code.operand, ctx);
             break;
         case AST_MC_AST:
+            macro_template_reject(ctx);
             copy->data.mc_ast.operand = deep_copy_ast(node->data.mc_ast.operand, ctx);
             break;
         case AST_MC_EVAL: {
@@ -6307,10 +6432,12 @@ static ASTNode *deep_copy_ast(ASTNode *node, MacroExpandContext *ctx) {
                 }
             }
             // 求值失败，保留原节点
+            macro_template_reject(ctx);
             copy->data.mc_eval.operand = deep_copy_ast(node->data.mc_eval.operand, ctx);
             break;
         }
         case AST_MC_ERROR:
+            macro_template_reject(ctx);
             copy->data.mc_error.operand = deep_copy_ast(node->data.mc_error.operand, ctx);
             break;
         case AST_MC_INTERP: {
@@ -6319,20 +6446,21 @@ static ASTNode *deep_copy_ast(ASTNode *node, MacroExpandContext *ctx) {
             if (operand != NULL && operand->type == AST_IDENTIFIER && operand->data.identifier.name != NULL) {
                 const char *name = operand->data.identifier.name;
                 // 查找是否匹配宏参数
-                for (int i = 0; i < ctx->binding_count; i++) {
-                    if (ctx->bindings[i].param_name != NULL && 
-                        strcmp(ctx->bindings[i].param_name, name) == 0 &&
-                        ctx->bindings[i].arg_ast != NULL) {
-                        // 匹配参数，返回参数 AST 的深拷贝
-                        return deep_copy_ast(ctx->bindings[i].arg_ast, ctx);
-                    }
+                int index = find_param_binding_index(ctx, name);
+                if (index >= 0 && ctx->bindings[index].arg_ast != NULL) {
+                    // 匹配参数，返回参数 AST 的深拷贝
+                    ASTNode *arg_copy = deep_copy_ast(ctx->bindings[index].arg_ast, ctx);
+                    macro_template_add_hole(ctx, arg_copy, index, 1);
+                    return arg_copy;
                 }
             }
             // 不是标识符或不匹配参数，递归处理内部表达式
+            macro_template_reject(ctx);
             copy->data.mc_interp.operand = deep_copy_ast(operand, ctx);
             break;
         }
         case AST_MC_TYPE: {
+            macro_template_reject(ctx);
             // 宏类型反射 @mc_type(expr)：获取表达式或类型的编译时类型信息
             // 返回一个包含类型信息的结构体初始化 AST
             ASTNode *operand = deep_copy_ast(node->data.mc_type.operand, ctx);
@@ -6667,8 +6795,11 @@ static ASTNode *handle_mc_get_env(ASTNode *call_node, MacroExpandContext *ctx) {
         return NULL;
     }
     
-    // 读取环境变量
+    // 读取环境变量（记录变量名，增量编译缓存据此判断环境是否变化）
     const char *env_name = arg->data.string_literal.value;
+    if (ctx->checker != NULL && hash_map_get(&ctx->checker->macro_env_names, env_name) == NULL) {
+        hash_map_put(&ctx->checker->macro_env_names, env_name, (void *)env_name);
+    }
     const char *env_value = getenv(env_name);
     if (env_value == NULL) env_value = "";
     
@@ -6773,7 +6904,14 @@ static ASTNode *extract_macro_output(ASTNode *body, MacroExpandContext *ctx, con
             }
         }
     }
-    MacroExpandContext merged_ctx = { all_bindings, total_bindings, ctx->arena, ctx->checker };
+    MacroExpandContext merged_ctx = { all_bindings, total_bindings, ctx->arena, ctx->checker, ctx->record, NULL, NULL };
+    if (ctx->record != NULL) {
+        if (total_bindings > 0 && all_bindings == NULL) {
+            macro_template_reject(ctx);
+        }
+        ctx->record->bindings = all_bindings;
+        ctx->record->binding_count = total_bindings;
+    }
     
     /* 查找最后一个产生输出的语句 */
     ASTNode *last_output = NULL;
@@ -6801,6 +6939,7 @@ static ASTNode *extract_macro_output(ASTNode *body, MacroExpandContext *ctx, con
             // 对于 type 返回类型，如果结果是标识符，转换为类型节点
             if (return_tag != NULL && strcmp(return_tag, "type") == 0 &&
                 result != NULL && result->type == AST_IDENTIFIER && result->data.identifier.name != NULL) {
+                macro_template_reject(&merged_ctx);  // 类型节点的位置可能来自实参
                 ASTNode *type_node = ast_new_node(AST_TYPE_NAMED, result->line, result->column, 
                     merged_ctx.arena, result->filename);
                 if (type_node != NULL) {
@@ -6878,6 +7017,7 @@ static ASTNode *extract_macro_output(ASTNode *body, MacroExpandContext *ctx, con
             ASTNode *result = deep_copy_ast(s, &merged_ctx);
             // 如果结果是标识符，转换为类型节点
             if (result != NULL && result->type == AST_IDENTIFIER && result->data.identifier.name != NULL) {
+                macro_template_reject(&merged_ctx);  // 类型节点的位置可能来自实参
                 ASTNode *type_node = ast_new_node(AST_TYPE_NAMED, result->line, result->column, 
                     merged_ctx.arena, result->filename);
                 if (type_node != NULL) {
@@ -6896,6 +7036,209 @@ static ASTNode *extract_macro_output(ASTNode *body, MacroExpandContext *ctx, con
 }
 
 
+// 宏缓存键：宏声明地址与各实参的结构序列化（不含位置，字符串与名称带长度前缀，无歧义）
+// 只支持常量与简单表达式/类型实参，其他实参或键过长返回 -1（不缓存）
+static int macro_cache_key_append(char *buf, size_t size, size_t *len, ASTNode *arg) {
+    if (arg == NULL) {
+        return -1;
+    }
+    int n;
+    size_t avail = *len < size ? size - *len : 0;
+    char *out = buf + *len;
+    switch (arg->type) {
+        case AST_NUMBER:
+            n = snprintf(out, avail, "n%d;", arg->data.number.value);
+            break;
+        case AST_FLOAT:
+            n = snprintf(out, avail, "f%a;", arg->data.float_literal.value);
+            break;
+        case AST_BOOL:
+            n = snprintf(out, avail, "b%d", arg->data.bool_literal.value ? 1 : 0);
+            break;
+        case AST_STRING:
+            if (arg->data.string_literal.value == NULL) return -1;
+            n = snprintf(out, avail, "s%zu:%s", strlen(arg->data.string_literal.value), arg->data.string_literal.value);
+            break;
+        case AST_IDENTIFIER:
+            if (arg->data.identifier.name == NULL) return -1;
+            n = snprintf(out, avail, "i%zu:%s", strlen(arg->data.identifier.name), arg->data.identifier.name);
+            break;
+        case AST_TYPE_NAMED:
+            if (arg->data.type_named.name == NULL || arg->data.type_named.type_arg_count != 0) return -1;
+            n = snprintf(out, avail, "t%zu:%s", strlen(arg->data.type_named.name), arg->data.type_named.name);
+            break;
+        case AST_TYPE_POINTER:
+            n = snprintf(out, avail, "p%d", arg->data.type_pointer.is_ffi_pointer);
+            if (n < 0 || (size_t)n >= avail) return -1;
+            *len += (size_t)n;
+            return macro_cache_key_append(buf, size, len, arg->data.type_pointer.pointed_type);
+        case AST_UNARY_EXPR:
+            n = snprintf(out, avail, "u%d", arg->data.unary_expr.op);
+            if (n < 0 || (size_t)n >= avail) return -1;
+            *len += (size_t)n;
+            return macro_cache_key_append(buf, size, len, arg->data.unary_expr.operand);
+        case AST_BINARY_EXPR:
+            n = snprintf(out, avail, "x%d", arg->data.binary_expr.op);
+            if (n < 0 || (size_t)n >= avail) return -1;
+            *len += (size_t)n;
+            if (macro_cache_key_append(buf, size, len, arg->data.binary_expr.left) != 0) return -1;
+            return macro_cache_key_append(buf, size, len, arg->data.binary_expr.right);
+        case AST_MEMBER_ACCESS:
+            if (arg->data.member_access.field_name == NULL) return -1;
+            n = snprintf(out, avail, "m%d.%zu:%s", arg->data.member_access.is_module_access,
+                         strlen(arg->data.member_access.field_name), arg->data.member_access.field_name);
+            if (n < 0 || (size_t)n >= avail) return -1;
+            *len += (size_t)n;
+            return macro_cache_key_append(buf, size, len, arg->data.member_access.object);
+        default:
+            return -1;
+    }
+    if (n < 0 || (size_t)n >= avail) return -1;
+    *len += (size_t)n;
+    return 0;
+}
+
+// 查找宏名称对应的缓存条目，首次遇到时解析宏声明并建立条目
+// 返回：宏声明存在时返回条目，否则返回 NULL（名称不是宏时不建立条目，之后可能由新导入解析为宏）
+static MacroCacheEntry *macro_cache_lookup(TypeChecker *checker, const char *name) {
+    MacroCacheEntry *entry = (MacroCacheEntry *)hash_map_get(&checker->macro_cache, name);
+    if (entry != NULL) {
+        return entry;
+    }
+    ASTNode *macro_decl = find_macro_decl_with_imports(checker, name);
+    if (macro_decl == NULL) {
+        return NULL;
+    }
+    entry = (MacroCacheEntry *)arena_alloc(checker->arena, sizeof(MacroCacheEntry));
+    if (entry == NULL) {
+        return NULL;
+    }
+    entry->macro_decl = macro_decl;
+    hash_map_init(&entry->templates, checker->arena);
+    hash_map_put(&checker->macro_cache, name, entry);
+    return entry;
+}
+
+// 展开宏调用：建立参数绑定并展开宏体（不展开结果中嵌套的宏调用）
+// 相同宏与相同实参结构的调用复用缓存的展开模板，结果与重新展开相同；
+// 命中时直接按本次实参拷贝模板，只有模板含 ${} 插值的洞时才重建绑定
+// 参数：alloc_failed - 输出：内存分配失败时置 1
+// 返回：展开结果，宏未产生有效输出返回 NULL
+static ASTNode *expand_macro_with_cache(TypeChecker *checker, MacroCacheEntry *entry, ASTNode *call_node, int *alloc_failed) {
+    ASTNode *macro_decl = entry->macro_decl;
+    int param_count = macro_decl->data.macro_decl.param_count;
+    const char *return_tag = macro_decl->data.macro_decl.return_tag;
+    ASTNode **args = call_node->data.call_expr.args;
+
+    // 查找缓存（键为各实参的结构）
+    char key[256];
+    size_t key_len = 0;
+    key[0] = '\0';
+    int cacheable = 1;
+    for (int i = 0; i < param_count && cacheable; i++) {
+        cacheable = macro_cache_key_append(key, sizeof(key), &key_len, args[i]) == 0;
+    }
+    MacroTemplate *tmpl = cacheable ? (MacroTemplate *)hash_map_get(&entry->templates, key) : NULL;
+
+    // 参数绑定（未命中时展开宏体需要；命中时只有 ${} 插值的洞需要）
+    MacroParamBinding *bindings = NULL;
+    int binding_count = 0;
+    if (tmpl == NULL) {
+        binding_count = param_count;
+    } else if (tmpl->full_binding_holes > 0) {
+        binding_count = tmpl->binding_count;
+    }
+    if (binding_count > 0) {
+        bindings = (MacroParamBinding *)arena_alloc(checker->arena, 
+            sizeof(MacroParamBinding) * (size_t)binding_count);
+        if (bindings == NULL) {
+            *alloc_failed = 1;
+            return NULL;
+        }
+        // 宏参数换为本次实参，宏体局部常量沿用模板的绑定
+        if (tmpl != NULL) {
+            memcpy(bindings, tmpl->bindings, sizeof(MacroParamBinding) * (size_t)binding_count);
+        }
+        for (int i = 0; i < param_count && i < binding_count; i++) {
+            ASTNode *param = macro_decl->data.macro_decl.params[i];
+            if (param != NULL && param->type == AST_VAR_DECL && 
+                param->data.var_decl.name != NULL) {
+                bindings[i].param_name = param->data.var_decl.name;
+                bindings[i].arg_ast = args[i];
+            } else {
+                bindings[i].param_name = NULL;
+                bindings[i].arg_ast = NULL;
+            }
+        }
+    }
+
+    if (tmpl == NULL) {
+        MacroTemplate *record = NULL;
+        if (cacheable) {
+            record = (MacroTemplate *)arena_alloc(checker->arena, sizeof(MacroTemplate));
+            if (record != NULL) {
+                memset(record, 0, sizeof(MacroTemplate));
+                record->param_count = param_count;
+                record->cacheable = 1;
+            }
+        }
+        // 首次展开：展开宏体（记录实参拷贝位置）
+        MacroExpandContext ctx = {
+            bindings,
+            param_count,
+            checker->arena,
+            checker,
+            record,
+            NULL,
+            NULL
+        };
+        ASTNode *body = macro_decl->data.macro_decl.body;
+        ASTNode *expanded = extract_macro_output(body, &ctx, return_tag);
+        if (expanded == NULL || record == NULL || !record->cacheable ||
+            macro_template_index_holes(record, checker->arena) != 0) {
+            return expanded;
+        }
+        // 展开结果作为模板保存，返回其拷贝（调用者会原地展开结果中嵌套的宏调用）
+        record->root = expanded;
+        const char *key_copy = macro_strdup(checker->arena, key);
+        if (key_copy == NULL) {
+            return expanded;
+        }
+        hash_map_put(&entry->templates, key_copy, record);
+        tmpl = record;
+        // 模板的合并绑定以本次实参开头，拷贝时直接使用
+        if (tmpl->full_binding_holes > 0) {
+            bindings = tmpl->bindings;
+            binding_count = tmpl->binding_count;
+        }
+    }
+
+    // 拷贝模板：洞按本次实参重新拷贝
+    MacroExpandContext replay_ctx = {
+        bindings,
+        binding_count,
+        checker->arena,
+        checker,
+        NULL,
+        tmpl,
+        args
+    };
+    return deep_copy_ast(tmpl->root, &replay_ctx);
+}
+
+// 展开宏调用（见 expand_macro_with_cache），启用 --time-report 时统计宏展开次数与耗时
+static ASTNode *expand_macro_call(TypeChecker *checker, MacroCacheEntry *entry, ASTNode *call_node, int *alloc_failed) {
+    if (checker->time_report == NULL) {
+        return expand_macro_with_cache(checker, entry, call_node, alloc_failed);
+    }
+    TimeReportTimer timer;
+    time_report_start(checker->time_report, &timer, checker->arena);
+    ASTNode *expanded = expand_macro_with_cache(checker, entry, call_node, alloc_failed);
+    time_report_stop(checker->time_report, "check.macro_expand", &timer);
+    checker->time_report->macro_expansion_count++;
+    return expanded;
+}
+
 // 递归展开宏调用，node_ptr 为指向当前节点的指针（便于替换）
 static void expand_macros_in_node(TypeChecker *checker, ASTNode **node_ptr) {
     if (checker == NULL || node_ptr == NULL || *node_ptr == NULL) return;
@@ -6905,8 +7248,9 @@ static void expand_macros_in_node(TypeChecker *checker, ASTNode **node_ptr) {
         ASTNode *callee = node->data.call_expr.callee;
         if (callee != NULL && callee->type == AST_IDENTIFIER && callee->data.identifier.name != NULL) {
             const char *name = callee->data.identifier.name;
-            ASTNode *macro_decl = find_macro_decl_with_imports(checker, name);
-            if (macro_decl != NULL) {
+            MacroCacheEntry *entry = macro_cache_lookup(checker, name);
+            if (entry != NULL) {
+                ASTNode *macro_decl = entry->macro_decl;
                 // 获取返回标签
                 const char *return_tag = macro_decl->data.macro_decl.return_tag;
                 
@@ -6932,39 +7276,13 @@ static void expand_macros_in_node(TypeChecker *checker, ASTNode **node_ptr) {
                     return;
                 }
                 
-                // 建立参数绑定
-                MacroParamBinding *bindings = NULL;
-                if (param_count > 0) {
-                    bindings = (MacroParamBinding *)arena_alloc(checker->arena, 
-                        sizeof(MacroParamBinding) * param_count);
-                    if (bindings == NULL) {
-                        checker_report_error(checker, node, "宏展开失败：内存分配失败");
-                        return;
-                    }
-                    for (int i = 0; i < param_count; i++) {
-                        ASTNode *param = macro_decl->data.macro_decl.params[i];
-                        if (param != NULL && param->type == AST_VAR_DECL && 
-                            param->data.var_decl.name != NULL) {
-                            bindings[i].param_name = param->data.var_decl.name;
-                            bindings[i].arg_ast = node->data.call_expr.args[i];
-                        } else {
-                            bindings[i].param_name = NULL;
-                            bindings[i].arg_ast = NULL;
-                        }
-                    }
+                // 展开宏体（相同宏与实参复用缓存的展开模板）
+                int alloc_failed = 0;
+                ASTNode *expanded = expand_macro_call(checker, entry, node, &alloc_failed);
+                if (alloc_failed) {
+                    checker_report_error(checker, node, "宏展开失败：内存分配失败");
+                    return;
                 }
-                
-                // 创建展开上下文
-                MacroExpandContext ctx = {
-                    bindings,
-                    param_count,
-                    checker->arena,
-                    checker
-                };
-                
-                // 展开宏体
-                ASTNode *body = macro_decl->data.macro_decl.body;
-                ASTNode *expanded = extract_macro_output(body, &ctx, return_tag);
                 if (expanded == NULL) {
                     char buf[128];
                     snprintf(buf, sizeof(buf), "宏 %s 未产生有效的 %s 输出 (节点类型: %d)", 
@@ -7132,8 +7450,9 @@ static void expand_macros_in_node(TypeChecker *checker, ASTNode **node_ptr) {
                         ASTNode *callee = method->data.call_expr.callee;
                         if (callee != NULL && callee->type == AST_IDENTIFIER && callee->data.identifier.name != NULL) {
                             const char *name = callee->data.identifier.name;
-                            ASTNode *macro_decl = find_macro_decl_with_imports(checker, name);
-                            if (macro_decl != NULL) {
+                            MacroCacheEntry *entry = macro_cache_lookup(checker, name);
+                            if (entry != NULL) {
+                                ASTNode *macro_decl = entry->macro_decl;
                                 const char *return_tag = macro_decl->data.macro_decl.return_tag;
                                 if (return_tag != NULL && strcmp(return_tag, "struct") == 0) {
                                     // struct 返回类型的宏，展开为方法定义
@@ -7147,39 +7466,13 @@ static void expand_macros_in_node(TypeChecker *checker, ASTNode **node_ptr) {
                                         continue;
                                     }
                                     
-                                    // 建立参数绑定
-                                    MacroParamBinding *bindings = NULL;
-                                    if (param_count > 0) {
-                                        bindings = (MacroParamBinding *)arena_alloc(checker->arena, 
-                                            sizeof(MacroParamBinding) * param_count);
-                                        if (bindings == NULL) {
-                                            checker_report_error(checker, method, "宏展开失败：内存分配失败");
-                                            continue;
-                                        }
-                                        for (int j = 0; j < param_count; j++) {
-                                            ASTNode *param = macro_decl->data.macro_decl.params[j];
-                                            if (param != NULL && param->type == AST_VAR_DECL && 
-                                                param->data.var_decl.name != NULL) {
-                                                bindings[j].param_name = param->data.var_decl.name;
-                                                bindings[j].arg_ast = method->data.call_expr.args[j];
-                                            } else {
-                                                bindings[j].param_name = NULL;
-                                                bindings[j].arg_ast = NULL;
-                                            }
-                                        }
+                                    // 展开宏体（相同宏与实参复用缓存的展开模板）
+                                    int alloc_failed = 0;
+                                    ASTNode *expanded = expand_macro_call(checker, entry, method, &alloc_failed);
+                                    if (alloc_failed) {
+                                        checker_report_error(checker, method, "宏展开失败：内存分配失败");
+                                        continue;
                                     }
-                                    
-                                    // 创建展开上下文
-                                    MacroExpandContext ctx = {
-                                        bindings,
-                                        param_count,
-                                        checker->arena,
-                                        checker
-                                    };
-                                    
-                                    // 展开宏体
-                                    ASTNode *body = macro_decl->data.macro_decl.body;
-                                    ASTNode *expanded = extract_macro_output(body, &ctx, return_tag);
                                     if (expanded == NULL) {
                                         char buf[128];
                                         snprintf(buf, sizeof(buf), "宏 %s 未产生有效的方法定义", name);
@@ -7266,6 +7559,11 @@ int checker_check(TypeChecker *checker, ASTNode *ast) {
     // 宏展开：在类型检查前展开所有宏调用
     expand_macros_in_node(checker, (ASTNode **)&ast);
     
+    // 宏展开可能改写顶层声明与方法块，重建全局声明索引
+    if (ast_build_decl_index(ast, checker->arena) != 0) {
+        return -1;
+    }
+    
     // 第二遍：检查所有声明（包括函数体、结构体、变量等）
     // 此时所有函数都已被注册，函数体中的函数调用可以正确解析
     checker_check_node(checker, ast);
@@ -7683,36 +7981,25 @@ static ModuleInfo *find_or_create_module(TypeChecker *checker, const char *modul
         return NULL;
     }
     
-    // 计算哈希值
-    unsigned int hash = hash_string(module_name);
-    unsigned int index = hash & (MODULE_TABLE_SIZE - 1);
-    
     // 查找现有模块
-    for (int i = 0; i < MODULE_TABLE_SIZE; i++) {
-        unsigned int slot = (index + i) & (MODULE_TABLE_SIZE - 1);
-        ModuleInfo *module = checker->module_table.slots[slot];
-        if (module != NULL && strcmp(module->module_name, module_name) == 0) {
-            return module;
-        }
-        if (module == NULL) {
-            // 找到空槽位，创建新模块
-            module = (ModuleInfo *)arena_alloc(checker->arena, sizeof(ModuleInfo));
-            if (module == NULL) {
-                return NULL;
-            }
-            module->module_name = module_name;
-            module->filename = filename;
-            module->exports = NULL;
-            module->export_count = 0;
-            module->dependencies = NULL;
-            module->dependency_count = 0;
-            checker->module_table.slots[slot] = module;
-            checker->module_table.count++;
-            return module;
-        }
+    ModuleInfo *module = module_table_lookup(checker, module_name);
+    if (module != NULL) {
+        return module;
     }
     
-    return NULL;  // 哈希表已满
+    // 创建新模块
+    module = (ModuleInfo *)arena_alloc(checker->arena, sizeof(ModuleInfo));
+    if (module == NULL) {
+        return NULL;
+    }
+    module->module_name = module_name;
+    module->filename = filename;
+    module->exports = NULL;
+    module->export_count = 0;
+    module->dependencies = NULL;
+    module->dependency_count = 0;
+    hash_map_put(&checker->module_table, module_name, module);
+    return module;
 }
 
 // 建立模块导出表（遍历所有声明，收集 export 标记的项）
@@ -7872,18 +8159,7 @@ static int process_use_stmt(TypeChecker *checker, ASTNode *node) {
         
         if (full_path != NULL) {
             // 检查全路径是否是已知模块（在 module_table 中有导出项）
-            unsigned int h = hash_string(full_path);
-            unsigned int idx = h & (MODULE_TABLE_SIZE - 1);
-            ModuleInfo *full_mod = NULL;
-            for (int i = 0; i < MODULE_TABLE_SIZE; i++) {
-                unsigned int slot = (idx + i) & (MODULE_TABLE_SIZE - 1);
-                ModuleInfo *m = checker->module_table.slots[slot];
-                if (m != NULL && strcmp(m->module_name, full_path) == 0) {
-                    full_mod = m;
-                    break;
-                }
-                if (m == NULL) break;
-            }
+            ModuleInfo *full_mod = module_table_lookup(checker, full_path);
             
             if (full_mod != NULL && full_mod->export_count > 0) {
                 // 全路径是有效模块 → 整体导入
@@ -7924,17 +8200,7 @@ static int process_use_stmt(TypeChecker *checker, ASTNode *node) {
         // main 模块是程序入口点，可以自由引用任何模块
         if (strcmp(current_module_name, "main") != 0) {
             // 查找当前模块
-            unsigned int current_hash = hash_string(current_module_name);
-            unsigned int current_index = current_hash & (MODULE_TABLE_SIZE - 1);
-            ModuleInfo *current_module = NULL;
-            for (int i = 0; i < MODULE_TABLE_SIZE; i++) {
-                unsigned int slot = (current_index + i) & (MODULE_TABLE_SIZE - 1);
-                ModuleInfo *m = checker->module_table.slots[slot];
-                if (m != NULL && strcmp(m->module_name, current_module_name) == 0) {
-                    current_module = m;
-                    break;
-                }
-            }
+            ModuleInfo *current_module = module_table_lookup(checker, current_module_name);
             
             // 如果找到当前模块，添加依赖关系
             if (current_module != NULL) {
@@ -7993,16 +8259,7 @@ static int process_use_stmt(TypeChecker *checker, ASTNode *node) {
         import->item_type = -1;  // -1 = 模块导入
         
         // 插入导入表
-        unsigned int import_hash = hash_string(import->local_name);
-        unsigned int import_index = import_hash & (IMPORT_TABLE_SIZE - 1);
-        for (int i = 0; i < IMPORT_TABLE_SIZE; i++) {
-            unsigned int slot = (import_index + i) & (IMPORT_TABLE_SIZE - 1);
-            if (checker->import_table.slots[slot] == NULL) {
-                checker->import_table.slots[slot] = import;
-                checker->import_table.count++;
-                break;
-            }
-        }
+        import_table_insert(checker, import);
     } else if (item_name != NULL) {
         // 导入特定项（如 use module_a.public_func;）
         // 检查项是否存在且已导出
@@ -8034,16 +8291,7 @@ static int process_use_stmt(TypeChecker *checker, ASTNode *node) {
         import->item_type = item_type;
         
         // 插入导入表
-        unsigned int import_hash = hash_string(import->local_name);
-        unsigned int import_index = import_hash & (IMPORT_TABLE_SIZE - 1);
-        for (int i = 0; i < IMPORT_TABLE_SIZE; i++) {
-            unsigned int slot = (import_index + i) & (IMPORT_TABLE_SIZE - 1);
-            if (checker->import_table.slots[slot] == NULL) {
-                checker->import_table.slots[slot] = import;
-                checker->import_table.count++;
-                break;
-            }
-        }
+        import_table_insert(checker, import);
     } else {
         // 无法确定是模块导入还是项导入
         checker_report_error(checker, node, "use 语句无法解析（请使用 use module; 或 use module.item; 格式）");
@@ -8060,18 +8308,7 @@ static int process_use_stmt(TypeChecker *checker, ASTNode *node) {
 //     }
 //     
 //     // 查找模块
-//     unsigned int hash = hash_string(module_name);
-//     unsigned int index = hash & (MODULE_TABLE_SIZE - 1);
-//     ModuleInfo *module = NULL;
-//     for (int i = 0; i < MODULE_TABLE_SIZE; i++) {
-//         unsigned int slot = (index + i) & (MODULE_TABLE_SIZE - 1);
-//         ModuleInfo *m = checker->module_table.slots[slot];
-//         if (m != NULL && strcmp(m->module_name, module_name) == 0) {
-//             module = m;
-//             break;
-//         }
-//     }
-//     
+//     ModuleInfo *module = module_table_lookup(checker, module_name);
 //     if (module == NULL) {
 //         return 0;
 //     }
@@ -8090,7 +8327,7 @@ static int process_use_stmt(TypeChecker *checker, ASTNode *node) {
 // 参数：checker - TypeChecker 指针，module_name - 当前模块名，path - 当前路径，path_len - 路径长度
 //       visit_state - 访问状态数组，visit_count - 访问状态数量
 // 返回：发现循环返回 1，否则返回 0
-#define MAX_MODULES 64
+#define MAX_MODULES 64  // 依赖路径的最大深度
 struct VisitState {
     const char *module_name;
     int state;  // 0=未访问，1=正在访问（在递归栈中），2=已访问
@@ -8154,21 +8391,14 @@ static int dfs_visit_module(TypeChecker *checker, const char *module_name, const
             // 查找导致循环的依赖（在路径中最后一个模块的依赖中）
             ASTNode *error_node = NULL;
             if (path_len > 0) {
-                const char *last_module = path[path_len - 1];
-                unsigned int last_hash = hash_string(last_module);
-                unsigned int last_index = last_hash & (MODULE_TABLE_SIZE - 1);
-                for (int i = 0; i < MODULE_TABLE_SIZE; i++) {
-                    unsigned int slot = (last_index + i) & (MODULE_TABLE_SIZE - 1);
-                    ModuleInfo *m = checker->module_table.slots[slot];
-                    if (m != NULL && strcmp(m->module_name, last_module) == 0) {
-                        // 查找对 module_name 的依赖
-                        for (int j = 0; j < m->dependency_count; j++) {
-                            if (strcmp(m->dependencies[j].target_module, module_name) == 0) {
-                                error_node = m->dependencies[j].use_stmt_node;
-                                break;
-                            }
+                ModuleInfo *m = module_table_lookup(checker, path[path_len - 1]);
+                if (m != NULL) {
+                    // 查找对 module_name 的依赖
+                    for (int j = 0; j < m->dependency_count; j++) {
+                        if (strcmp(m->dependencies[j].target_module, module_name) == 0) {
+                            error_node = m->dependencies[j].use_stmt_node;
+                            break;
                         }
-                        break;
                     }
                 }
             }
@@ -8192,17 +8422,7 @@ static int dfs_visit_module(TypeChecker *checker, const char *module_name, const
         visit_state[state_idx].state = 1;
         
         // 查找模块
-        ModuleInfo *module = NULL;
-        unsigned int hash = hash_string(module_name);
-        unsigned int index = hash & (MODULE_TABLE_SIZE - 1);
-        for (int i = 0; i < MODULE_TABLE_SIZE; i++) {
-            unsigned int slot = (index + i) & (MODULE_TABLE_SIZE - 1);
-            ModuleInfo *m = checker->module_table.slots[slot];
-            if (m != NULL && strcmp(m->module_name, module_name) == 0) {
-                module = m;
-                break;
-            }
-        }
+        ModuleInfo *module = module_table_lookup(checker, module_name);
         
         if (module != NULL) {
             // 递归访问所有依赖
@@ -8233,20 +8453,22 @@ static void detect_circular_dependencies(TypeChecker *checker) {
         return;
     }
     
-    // 为每个模块分配访问状态（0=未访问，1=正在访问，2=已访问）
-    // 使用简单的数组存储，最大支持 64 个模块
-    struct VisitState visit_state[MAX_MODULES];
+    // 为每个模块分配访问状态（0=未访问，1=正在访问，2=已访问），按模块注册顺序排列
+    if (checker->module_table.count == 0) {
+        return;
+    }
+    struct VisitState *visit_state = (struct VisitState *)arena_alloc(checker->arena,
+        sizeof(struct VisitState) * (size_t)checker->module_table.count);
     int visit_count = 0;
     
     // 初始化访问状态
-    for (int i = 0; i < MODULE_TABLE_SIZE; i++) {
-        ModuleInfo *module = checker->module_table.slots[i];
-        if (module != NULL) {
-            if (visit_count < MAX_MODULES) {
-                visit_state[visit_count].module_name = module->module_name;
-                visit_state[visit_count].state = 0;
-                visit_count++;
-            }
+    for (int i = 0; i < checker->module_table.entry_count; i++) {
+        const HashMapEntry *entry = hash_map_entry_at(&checker->module_table, i);
+        if (entry != NULL) {
+            ModuleInfo *module = (ModuleInfo *)entry->value;
+            visit_state[visit_count].module_name = module->module_name;
+            visit_state[visit_count].state = 0;
+            visit_count++;
         }
     }
     
@@ -3,6 +3,8 @@
 
 #include "ast.h"
 #include "arena.h"
+#include "hash_map.h"
+#include "time_report.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -79,6 +81,7 @@ typedef struct Type {
             const char *param_name;     // 泛型参数名称（如 "T", "K", "V"，仅当 kind == TYPE_GENERIC_PARAM 时有效）
         } generic_param;
     } data;
+    const char *c_spelling;     // 规范类型的 C 类型拼写缓存（由代码生成在首次使用时填写，NULL 表示未计算；不参与类型比较）
 } Type;
 
 // 符号信息（变量、函数参数等）
@@ -91,6 +94,8 @@ typedef struct Symbol {
     int column;                 // 列号
     const char *pointee_of;     // 若本变量值为 &x，则为 x 的名字（移动语义：禁止移动 x），否则 NULL
     ASTNode *decl_node;         // 引入该绑定的 VAR_DECL 节点（用于写回 was_moved），可为 NULL
+    unsigned int hash;          // 名称哈希值（插入时计算，用于桶定位与快速比较）
+    struct Symbol *next_in_bucket; // 同一哈希桶中的下一个符号（链头为最内层绑定）
 } Symbol;
 
 // 函数签名信息
@@ -105,22 +110,21 @@ typedef struct FunctionSignature {
     int column;                 // 列号
 } FunctionSignature;
 
-// 符号表（固定大小哈希表，使用开放寻址）
-#define SYMBOL_TABLE_SIZE 256   // 固定大小（必须是2的幂）
+// 符号表（链式哈希表 + 作用域撤销栈）
+// 桶内链表按插入顺序头插，链头即最内层绑定，查找为 O(1) 期望；
+// live 栈按插入顺序记录所有活跃符号，退出作用域时只弹出栈顶属于该作用域的符号。
+// 桶数组与 live 栈均从 Arena 分配，容量不足时翻倍（无固定上限）
+#define SYMBOL_TABLE_INITIAL_BUCKETS 64   // 初始桶数量（必须是2的幂）
+#define SYMBOL_TABLE_INITIAL_CAPACITY 64  // 初始 live 栈容量
 
 typedef struct SymbolTable {
-    Symbol *slots[SYMBOL_TABLE_SIZE];  // 符号槽位数组（固定大小）
-    int count;                          // 当前符号数量
+    Symbol **buckets;           // 哈希桶数组（从 Arena 分配）
+    int bucket_count;           // 桶数量（2的幂）
+    Symbol **live;              // 活跃符号栈（按插入顺序，从 Arena 分配）
+    int capacity;               // live 栈容量
+    int count;                  // 当前活跃符号数量
 } SymbolTable;
 
-// 函数表（固定大小哈希表，使用开放寻址）
-#define FUNCTION_TABLE_SIZE 512  // 固定大小（必须是2的幂）- 增加到 512 以支持更多函数
-
-typedef struct FunctionTable {
-    FunctionSignature *slots[FUNCTION_TABLE_SIZE];  // 函数槽位数组（固定大小）
-    int count;                                       // 当前函数数量
-} FunctionTable;
-
 // 模块导出项信息
 typedef struct ExportedItem {
     const char *name;           // 项名称（函数名、结构体名等）
@@ -145,49 +149,86 @@ typedef struct ModuleInfo {
     int dependency_count;       // 依赖数量
 } ModuleInfo;
 
-// 模块表（固定大小哈希表）
-#define MODULE_TABLE_SIZE 64    // 固定大小（必须是2的幂）
-
-typedef struct ModuleTable {
-    ModuleInfo *slots[MODULE_TABLE_SIZE];  // 模块槽位数组
-    int count;                              // 当前模块数量
-} ModuleTable;
-
 // 导入项信息（use 语句导入的项）
 typedef struct ImportedItem {
     const char *local_name;     // 本地使用的名称（可能是别名）
     const char *original_name;  // 原始名称
     const char *module_name;   // 来源模块名
-    int item_type;              // 项类型：1=函数，2=结构体，3=联合体，4=接口，5=枚举，6=常量，7=错误，8=宏
+    int item_type;              // 项类型：-1=模块，1=函数，2=结构体，3=联合体，4=接口，5=枚举，6=常量，7=错误，8=宏
+    struct ImportedItem *next;  // 本地名称相同的下一个导入项（按导入顺序）
 } ImportedItem;
 
-// 导入表（用于当前文件/模块的导入）
-#define IMPORT_TABLE_SIZE 128   // 固定大小（必须是2的幂）
+// 规范类型表（hash-consing，开放寻址，满载一半时翻倍）
+// 结构相同的类型只保存一份：子类型指针（pointer_to、element_type、payload_type 等）
+// 指向表中的规范类型，相同类型的子类型指针相同，type_equals 比较指针即可得出结果
+#define TYPE_TABLE_INITIAL_CAPACITY 256  // 初始槽位数量（必须是2的幂）
 
-typedef struct ImportTable {
-    ImportedItem *slots[IMPORT_TABLE_SIZE];  // 导入项槽位数组
-    int count;                                // 当前导入项数量
-} ImportTable;
+typedef struct TypeTable {
+    Type **slots;               // 规范类型槽位数组（从 Arena 分配，NULL 表示空槽位）
+    unsigned int *hashes;       // 各槽位类型的哈希值
+    int capacity;               // 槽位数量（2的幂）
+    int count;                  // 规范类型数量
+} TypeTable;
+
+// 单态化实例：泛型函数/结构体的一组具体类型实参
+typedef struct MonoInstance {
+    const char *generic_name;       // 泛型函数/结构体名称
+    Type *type_args;                // 类型实参数组（从 Arena 分配）
+    ASTNode **type_arg_nodes;       // 类型实参 AST 节点数组（从 Arena 分配）
+    int type_arg_count;             // 类型实参数量
+    int is_function;                // 1 表示函数，0 表示结构体
+    unsigned int hash;              // 实例键哈希（泛型名称 + 类型实参）
+    struct MonoInstance *next_in_group;  // 同一泛型声明的下一个实例（按注册顺序）
+} MonoInstance;
+
+// 同一泛型声明（名称 + 函数/结构体）的全部实例，按注册顺序链接
+typedef struct MonoGroup {
+    const char *generic_name;       // 泛型函数/结构体名称
+    int is_function;                // 1 表示函数，0 表示结构体
+    unsigned int hash;              // 分组键哈希
+    MonoInstance *first;            // 第一个实例
+    MonoInstance *last;             // 最后一个实例（追加用）
+} MonoGroup;
+
+// 单态化实例表（开放寻址，满载一半时翻倍）
+// 实例键为 (泛型声明, 类型实参)，类型实参按 type_equals 判等；
+// 代码生成按分组遍历实例，顺序与注册顺序一致，输出确定
+#define MONO_TABLE_INITIAL_CAPACITY 64  // 初始槽位数量（必须是2的幂）
+
+typedef struct MonoTable {
+    MonoInstance **slots;           // 实例槽位数组（从 Arena 分配，NULL 表示空槽位）
+    int capacity;                   // 实例槽位数量（2的幂）
+    int count;                      // 实例数量
+    MonoGroup **group_slots;        // 分组槽位数组（从 Arena 分配，NULL 表示空槽位）
+    int group_capacity;             // 分组槽位数量（2的幂）
+    int group_count;                // 分组数量
+} MonoTable;
 
 // 类型检查器结构
 typedef struct TypeChecker {
     Arena *arena;               // Arena 分配器（用于分配类型、符号等）
     SymbolTable symbol_table;   // 符号表
-    FunctionTable function_table; // 函数表
-    ModuleTable module_table;   // 模块表（记录所有模块及其导出项）
-    ImportTable import_table;   // 导入表（记录当前模块的导入项）
+    HashMap function_table;     // 函数表（函数名 -> FunctionSignature）
+    TypeTable type_table;       // 规范类型表
+    HashMap module_table;       // 模块表（模块名 -> ModuleInfo，记录所有模块及其导出项）
+    HashMap import_table;       // 导入表（本地名称 -> ImportedItem 链，记录当前模块的导入项）
+    HashMap macro_cache;        // 宏展开缓存（宏名称 -> 宏声明与各实参结构的展开模板，规范 uya.md §25.8）
+    HashMap macro_env_names;    // @mc_get_env 读取过的环境变量名（名称 -> 名称，按读取顺序）
+    TimeReport *time_report;    // 编译统计（--time-report，NULL 表示不统计宏展开耗时）
     int scope_level;            // 当前作用域级别
     int loop_depth;             // 循环深度（用于检查 break/continue 是否在循环中）
     ASTNode *program_node;      // 程序节点（用于查找结构体声明等）
     int error_count;            // 错误计数（简化版本，暂不存储错误消息）
+    int symbols_declared;       // 插入过的符号总数（变量、常量、参数与新函数签名，含已退出作用域的局部符号）
     const char *default_filename; // 默认文件名（用于错误报告，可为 NULL）
     Type current_return_type;   // 当前函数的返回类型（用于检查 return 语句）
     int in_function;            // 是否在函数中（1 表示是，0 表示否）
     int in_defer_or_errdefer;   // 是否在 defer/errdefer 块中（1 表示是，禁止 return/break/continue）
     ASTNode *current_function_decl;  // 当前正在检查的函数声明（用于 @params 类型推断，可为 NULL）
-    // 错误集：收集所有使用的错误名称，error_id = hash(error_name)
-    const char *error_names[128];   // 错误名称（Arena 存储）
-    uint32_t error_hashes[128];     // 对应 error_id（hash 值，0 保留表示无错误）
+    // 错误集：收集整个程序使用的错误名称（error 声明、error.X 与 match 错误模式），
+    // 检查期间 error_id = 注册顺序编号（从 1 开始，0 表示无错误）；
+    // 代码生成按名称重新编号（见 c99_codegen_set_error_ids）
+    const char *error_names[128];   // 错误名称（Arena 存储，按注册顺序）
     int error_name_count;           // 已注册错误数量
     // 移动语义（规范 uya.md §12.5）：当前函数内已移动的变量名，移动后不能再次使用
     const char *moved_names[128];
@@ -201,16 +242,8 @@ typedef struct TypeChecker {
     TypeParam *current_type_params;     // 当前作用域的类型参数数组（指向 AST 节点中的 type_params）
     int current_type_param_count;       // 当前类型参数数量
     
-    // 单态化实例收集
-    // 泛型函数实例：key = "fn_name<type1,type2,...>", value = 具体类型数组
-    struct {
-        const char *generic_name;       // 泛型函数/结构体名称
-        Type *type_args;                // 类型实参数组（从 Arena 分配）
-        ASTNode **type_arg_nodes;       // 类型实参 AST 节点数组（从 Arena 分配）
-        int type_arg_count;             // 类型实参数量
-        int is_function;                // 1 表示函数，0 表示结构体
-    } mono_instances[512];
-    int mono_instance_count;
+    // 单态化实例收集（按泛型声明分组，无数量上限）
+    MonoTable mono_table;
 } TypeChecker;
 
 // 初始化 TypeChecker
@@ -229,5 +262,10 @@ int checker_check(TypeChecker *checker, ASTNode *ast);
 // 返回：错误数量
 int checker_get_error_count(TypeChecker *checker);
 
+// 查找泛型声明的单态化实例
+// 参数：table - 单态化实例表，generic_name - 泛型函数/结构体名称，is_function - 1 表示函数，0 表示结构体
+// 返回：第一个实例（通过 next_in_group 按注册顺序遍历），没有实例返回 NULL
+const MonoInstance *mono_table_find_group(const MonoTable *table, const char *generic_name, int is_function);
+
 #endif // CHECKER_H
 
@@ -0,0 +1,425 @@
+#include "internal.h"
+#include "hash_map.h"
+#include <string.h>
+
+// 接口调用去虚化
+// 接口值只在调用处由结构体装箱产生（形参为接口类型、实参为实现该接口的结构体），
+// 若某函数的接口形参在全程序所有调用处都只收到同一个具体结构体（直接装箱，或由调用者
+// 同样已知的接口形参原样转发），函数体中 param.method(...) 可直接调用 uya_S_method，
+// 省去经 vtable 的间接调用，也让 C 编译器能够内联。
+//
+// 分析在函数生成之前完成（并行生成时只读）：
+//   每个候选形参的取值为 未知(NULL) -> 具体结构体名 -> 多种(C99_DEVIRT_TOP)，
+//   在调用处取交汇，迭代到不再变化。函数名被取值（非直接调用）时其全部形参为多种。
+
+// 多种具体类型（格的顶部）
+static const char C99_DEVIRT_TOP[] = "";
+
+// 候选函数：非泛型、有函数体、在顶层唯一的函数，至少一个接口形参
+typedef struct DevirtFn {
+    ASTNode *fn_decl;
+    const char **iface_names;   // 各形参的接口名（不是候选形参时为 NULL）
+    const char **states;        // 各形参的具体结构体名（NULL 未知，C99_DEVIRT_TOP 多种）
+} DevirtFn;
+
+// 调用候选函数的调用处：各接口形参对应实参的具体结构体在收集时确定，
+// 由调用者的接口形参原样转发时记录其下标，取值随调用者的形参变化
+typedef struct DevirtCall {
+    DevirtFn *callee;
+    const char **arg_structs;   // 各形参的实参具体结构体（C99_DEVIRT_TOP 无法确定，转发时为 NULL）
+    int *forward_params;        // 转发的调用者形参下标（不是转发时为 -1）
+    DevirtFn *caller;           // 调用处所在的候选函数（不是候选函数时为 NULL）
+} DevirtCall;
+
+typedef struct DevirtContext {
+    C99CodeGenerator *codegen;
+    DevirtFn *fns;
+    int fn_count;
+    HashMap fn_index;           // 函数名 -> 候选函数（遍历全程序时按名称查找）
+    DevirtCall *calls;
+    int call_count;
+    int call_capacity;
+    ASTNode *current_fn_decl;   // 当前遍历所在的函数
+    DevirtFn *current;          // 当前遍历所在的候选函数（不是候选函数时为 NULL）
+    const char *param_name;     // 检查形参、查找局部变量时使用：名称
+    int param_escapes;          // 检查形参时使用：形参被赋值、遮蔽或取地址
+    const char *local_struct;   // 查找局部变量时使用：声明的结构体类型（C99_DEVIRT_TOP 表示不是或不唯一）
+} DevirtContext;
+
+static DevirtFn *devirt_find_fn(DevirtContext *ctx, const char *name) {
+    if (!name) return NULL;
+    return (DevirtFn *)hash_map_get(&ctx->fn_index, name);
+}
+
+static DevirtFn *devirt_find_fn_decl(DevirtContext *ctx, ASTNode *fn_decl) {
+    DevirtFn *df = devirt_find_fn(ctx, fn_decl->data.fn_decl.name);
+    return (df && df->fn_decl == fn_decl) ? df : NULL;
+}
+
+static void devirt_set_all_top(DevirtFn *fn) {
+    for (int i = 0; i < fn->fn_decl->data.fn_decl.param_count; i++) {
+        if (fn->iface_names[i]) fn->states[i] = C99_DEVIRT_TOP;
+    }
+}
+
+static int devirt_is_name(const char *a, const char *b) {
+    return a && b && strcmp(a, b) == 0;
+}
+
+// 检查形参是否在函数体中被赋值、遮蔽或取地址（此时不能认为它一直是调用处传入的值）
+static void devirt_check_param(ASTNode *node, void *data) {
+    DevirtContext *ctx = (DevirtContext *)data;
+    const char *name = ctx->param_name;
+    switch (node->type) {
+        case AST_ASSIGN:
+            if (node->data.assign.dest && node->data.assign.dest->type == AST_IDENTIFIER &&
+                devirt_is_name(node->data.assign.dest->data.identifier.name, name)) {
+                ctx->param_escapes = 1;
+            }
+            break;
+        case AST_UNARY_EXPR:
+            if (node->data.unary_expr.op == TOKEN_AMPERSAND && node->data.unary_expr.operand &&
+                node->data.unary_expr.operand->type == AST_IDENTIFIER &&
+                devirt_is_name(node->data.unary_expr.operand->data.identifier.name, name)) {
+                ctx->param_escapes = 1;
+            }
+            break;
+        case AST_VAR_DECL:
+            if (devirt_is_name(node->data.var_decl.name, name)) ctx->param_escapes = 1;
+            break;
+        case AST_DESTRUCTURE_DECL:
+            for (int i = 0; i < node->data.destructure_decl.name_count; i++) {
+                if (devirt_is_name(node->data.destructure_decl.names[i], name)) ctx->param_escapes = 1;
+            }
+            break;
+        case AST_FOR_STMT:
+            if (devirt_is_name(node->data.for_stmt.var_name, name)) ctx->param_escapes = 1;
+            break;
+        case AST_CATCH_EXPR:
+            if (devirt_is_name(node->data.catch_expr.err_name, name)) ctx->param_escapes = 1;
+            break;
+        case AST_MATCH_EXPR:
+            for (int i = 0; i < node->data.match_expr.arm_count; i++) {
+                ASTMatchArm *arm = &node->data.match_expr.arms[i];
+                if ((arm->kind == MATCH_PAT_BIND && devirt_is_name(arm->data.bind.var_name, name)) ||
+                    (arm->kind == MATCH_PAT_UNION && devirt_is_name(arm->data.union_pat.var_name, name))) {
+                    ctx->param_escapes = 1;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    if (!ctx->param_escapes) {
+        ast_for_each_child(node, devirt_check_param, ctx);
+    }
+}
+
+// 收集候选函数
+static void devirt_collect_fns(DevirtContext *ctx) {
+    C99CodeGenerator *codegen = ctx->codegen;
+    ASTNode **decls = codegen->program_node->data.program.decls;
+    int decl_count = codegen->program_node->data.program.decl_count;
+    hash_map_init(&ctx->fn_index, codegen->arena);
+    ctx->fns = (DevirtFn *)arena_alloc(codegen->arena, sizeof(DevirtFn) * (size_t)(decl_count > 0 ? decl_count : 1));
+    if (!ctx->fns) return;
+    for (int i = 0; i < decl_count; i++) {
+        ASTNode *fn = decls[i];
+        if (!fn || fn->type != AST_FN_DECL || !fn->data.fn_decl.name || !fn->data.fn_decl.body ||
+            fn->data.fn_decl.type_param_count > 0 || fn->data.fn_decl.is_varargs || fn->data.fn_decl.is_async) {
+            continue;
+        }
+        int param_count = fn->data.fn_decl.param_count;
+        const char **iface_names = NULL;
+        for (int p = 0; p < param_count; p++) {
+            ASTNode *param = fn->data.fn_decl.params[p];
+            ASTNode *type = (param && param->type == AST_VAR_DECL) ? param->data.var_decl.type : NULL;
+            if (!type || type->type != AST_TYPE_NAMED || type->data.type_named.type_arg_count > 0) continue;
+            ASTNode *iface = find_interface_decl_c99(codegen, type->data.type_named.name);
+            if (!iface || iface->data.interface_decl.type_param_count > 0) continue;
+            ctx->param_name = param->data.var_decl.name;
+            ctx->param_escapes = 0;
+            devirt_check_param(fn->data.fn_decl.body, ctx);
+            if (ctx->param_escapes) continue;
+            if (!iface_names) {
+                iface_names = (const char **)arena_alloc(codegen->arena, sizeof(const char *) * (size_t)param_count);
+                if (!iface_names) return;
+                memset(iface_names, 0, sizeof(const char *) * (size_t)param_count);
+            }
+            iface_names[p] = type->data.type_named.name;
+        }
+        if (!iface_names) continue;
+        const char **states = (const char **)arena_alloc(codegen->arena, sizeof(const char *) * (size_t)param_count);
+        if (!states) return;
+        memset(states, 0, sizeof(const char *) * (size_t)param_count);
+        DevirtFn *df = &ctx->fns[ctx->fn_count++];
+        df->fn_decl = fn;
+        df->iface_names = iface_names;
+        df->states = states;
+        if (devirt_find_fn(ctx, fn->data.fn_decl.name) == NULL) {
+            hash_map_put(&ctx->fn_index, fn->data.fn_decl.name, df);
+        }
+    }
+
+    // 同名的顶层函数（如 extern 声明与定义、不同模块的同名函数）无法按名称区分调用处，不作为候选
+    for (int i = 0; i < decl_count; i++) {
+        ASTNode *fn = decls[i];
+        if (!fn || fn->type != AST_FN_DECL) continue;
+        DevirtFn *df = devirt_find_fn(ctx, fn->data.fn_decl.name);
+        if (df && df->fn_decl != fn) devirt_set_all_top(df);
+    }
+}
+
+// 声明类型为非泛型结构体时返回结构体名，否则返回 C99_DEVIRT_TOP
+static const char *devirt_decl_struct(C99CodeGenerator *codegen, ASTNode *var_decl) {
+    ASTNode *type = var_decl->data.var_decl.type;
+    ASTNode *init = var_decl->data.var_decl.init;
+    if (type && type->type == AST_TYPE_NAMED && type->data.type_named.type_arg_count == 0) {
+        ASTNode *s = find_struct_decl_c99(codegen, type->data.type_named.name);
+        if (s && s->data.struct_decl.type_param_count == 0) return type->data.type_named.name;
+    } else if (!type && init && init->type == AST_STRUCT_INIT && init->data.struct_init.type_arg_count == 0 &&
+               init->data.struct_init.struct_name) {
+        return init->data.struct_init.struct_name;
+    }
+    return C99_DEVIRT_TOP;
+}
+
+// 在函数体中查找名称的全部声明：都声明为同一个结构体时记录其名称，否则为 C99_DEVIRT_TOP
+static void devirt_find_local(ASTNode *node, void *data) {
+    DevirtContext *ctx = (DevirtContext *)data;
+    const char *name = ctx->param_name;
+    const char *found = NULL;
+    switch (node->type) {
+        case AST_VAR_DECL:
+            if (devirt_is_name(node->data.var_decl.name, name)) found = devirt_decl_struct(ctx->codegen, node);
+            break;
+        case AST_DESTRUCTURE_DECL:
+            for (int i = 0; i < node->data.destructure_decl.name_count; i++) {
+                if (devirt_is_name(node->data.destructure_decl.names[i], name)) found = C99_DEVIRT_TOP;
+            }
+            break;
+        case AST_FOR_STMT:
+            if (devirt_is_name(node->data.for_stmt.var_name, name)) found = C99_DEVIRT_TOP;
+            break;
+        case AST_CATCH_EXPR:
+            if (devirt_is_name(node->data.catch_expr.err_name, name)) found = C99_DEVIRT_TOP;
+            break;
+        case AST_MATCH_EXPR:
+            for (int i = 0; i < node->data.match_expr.arm_count; i++) {
+                ASTMatchArm *arm = &node->data.match_expr.arms[i];
+                if ((arm->kind == MATCH_PAT_BIND && devirt_is_name(arm->data.bind.var_name, name)) ||
+                    (arm->kind == MATCH_PAT_UNION && devirt_is_name(arm->data.union_pat.var_name, name))) {
+                    found = C99_DEVIRT_TOP;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    if (found) {
+        if (!ctx->local_struct) {
+            ctx->local_struct = found;
+        } else if (found == C99_DEVIRT_TOP || strcmp(ctx->local_struct, found) != 0) {
+            ctx->local_struct = C99_DEVIRT_TOP;
+        }
+    }
+    if (ctx->local_struct != C99_DEVIRT_TOP) {
+        ast_for_each_child(node, devirt_find_local, ctx);
+    }
+}
+
+// 标识符实参的具体结构体（按所在函数的形参、局部变量与全局变量的声明类型确定）
+// 返回：结构体名；C99_DEVIRT_TOP 表示无法确定；由调用者的候选接口形参转发时返回 NULL 并写入 *forward
+static const char *devirt_identifier_struct(DevirtContext *ctx, ASTNode *arg, int *forward) {
+    C99CodeGenerator *codegen = ctx->codegen;
+    const char *name = arg->data.identifier.name;
+    ASTNode *fn = ctx->current_fn_decl;
+    ctx->param_name = name;
+    ctx->local_struct = NULL;
+    if (fn) {
+        for (int p = 0; p < fn->data.fn_decl.param_count; p++) {
+            ASTNode *param = fn->data.fn_decl.params[p];
+            if (!param || param->type != AST_VAR_DECL || !devirt_is_name(param->data.var_decl.name, name)) continue;
+            if (ctx->current && ctx->current->iface_names[p]) {
+                *forward = p;
+                return NULL;
+            }
+            ctx->local_struct = devirt_decl_struct(codegen, param);
+        }
+        if (fn->data.fn_decl.body && ctx->local_struct != C99_DEVIRT_TOP) {
+            devirt_find_local(fn->data.fn_decl.body, ctx);
+        }
+    }
+    if (!ctx->local_struct) {
+        ASTNode *global = ast_find_decl(codegen->program_node, DECL_KEY_VAR, name);
+        ctx->local_struct = (global && global->type == AST_VAR_DECL) ? devirt_decl_struct(codegen, global) : C99_DEVIRT_TOP;
+    }
+    return ctx->local_struct;
+}
+
+// 记录对候选函数的调用处，确定各接口形参对应实参的具体结构体
+static void devirt_add_call(DevirtContext *ctx, ASTNode *call, DevirtFn *callee) {
+    C99CodeGenerator *codegen = ctx->codegen;
+    int param_count = callee->fn_decl->data.fn_decl.param_count;
+    if (ctx->call_count >= ctx->call_capacity) {
+        int new_capacity = ctx->call_capacity > 0 ? ctx->call_capacity * 2 : 64;
+        DevirtCall *calls = (DevirtCall *)arena_alloc(codegen->arena, sizeof(DevirtCall) * (size_t)new_capacity);
+        if (!calls) {
+            devirt_set_all_top(callee);
+            return;
+        }
+        if (ctx->call_count > 0) memcpy(calls, ctx->calls, sizeof(DevirtCall) * (size_t)ctx->call_count);
+        ctx->calls = calls;
+        ctx->call_capacity = new_capacity;
+    }
+    const char **arg_structs = (const char **)arena_alloc(codegen->arena, sizeof(const char *) * (size_t)param_count);
+    int *forward_params = (int *)arena_alloc(codegen->arena, sizeof(int) * (size_t)param_count);
+    if (!arg_structs || !forward_params) {
+        devirt_set_all_top(callee);
+        return;
+    }
+    for (int p = 0; p < param_count; p++) {
+        const char *iface_name = callee->iface_names[p];
+        ASTNode *arg = p < call->data.call_expr.arg_count ? call->data.call_expr.args[p] : NULL;
+        const char *s = C99_DEVIRT_TOP;
+        forward_params[p] = -1;
+        if (!iface_name || !arg) {
+            s = C99_DEVIRT_TOP;
+        } else if (arg->type == AST_STRUCT_INIT) {
+            if (arg->data.struct_init.type_arg_count == 0 && arg->data.struct_init.struct_name) {
+                s = arg->data.struct_init.struct_name;
+            }
+        } else if (arg->type == AST_IDENTIFIER) {
+            s = devirt_identifier_struct(ctx, arg, &forward_params[p]);
+            if (!s && !devirt_is_name(ctx->current->iface_names[forward_params[p]], iface_name)) {
+                s = C99_DEVIRT_TOP;
+                forward_params[p] = -1;
+            }
+        }
+        /* 只有实现了该接口的结构体会在调用处装箱 */
+        if (s && s != C99_DEVIRT_TOP && !struct_implements_interface_c99(codegen, s, iface_name)) {
+            s = C99_DEVIRT_TOP;
+        }
+        arg_structs[p] = s;
+    }
+    DevirtCall *c = &ctx->calls[ctx->call_count++];
+    c->callee = callee;
+    c->arg_structs = arg_structs;
+    c->forward_params = forward_params;
+    c->caller = ctx->current;
+}
+
+// 遍历全程序：记录对候选函数的直接调用，其他方式引用候选函数名时其形参为多种
+static void devirt_collect_calls(ASTNode *node, void *data) {
+    DevirtContext *ctx = (DevirtContext *)data;
+    switch (node->type) {
+        case AST_FN_DECL: {
+            ASTNode *saved_fn_decl = ctx->current_fn_decl;
+            DevirtFn *saved = ctx->current;
+            ctx->current_fn_decl = node;
+            ctx->current = devirt_find_fn_decl(ctx, node);
+            ast_for_each_child(node, devirt_collect_calls, ctx);
+            ctx->current_fn_decl = saved_fn_decl;
+            ctx->current = saved;
+            return;
+        }
+        case AST_CALL_EXPR: {
+            ASTNode *callee = node->data.call_expr.callee;
+            DevirtFn *df = (callee && callee->type == AST_IDENTIFIER && node->data.call_expr.type_arg_count == 0)
+                           ? devirt_find_fn(ctx, callee->data.identifier.name) : NULL;
+            if (df) {
+                devirt_add_call(ctx, node, df);
+                for (int i = 0; i < node->data.call_expr.arg_count; i++) {
+                    if (node->data.call_expr.args[i]) devirt_collect_calls(node->data.call_expr.args[i], ctx);
+                }
+                return;
+            }
+            break;
+        }
+        case AST_IDENTIFIER: {
+            DevirtFn *df = devirt_find_fn(ctx, node->data.identifier.name);
+            if (df) devirt_set_all_top(df);
+            return;
+        }
+        case AST_MEMBER_ACCESS: {
+            DevirtFn *df = devirt_find_fn(ctx, node->data.member_access.field_name);
+            if (df) devirt_set_all_top(df);
+            break;
+        }
+        default:
+            break;
+    }
+    ast_for_each_child(node, devirt_collect_calls, ctx);
+}
+
+// 在调用处取交汇，返回是否有形参的取值变化
+static int devirt_meet_call(DevirtCall *c) {
+    int changed = 0;
+    for (int p = 0; p < c->callee->fn_decl->data.fn_decl.param_count; p++) {
+        const char *state = c->callee->states[p];
+        if (!c->callee->iface_names[p] || state == C99_DEVIRT_TOP) continue;
+        const char *s = c->forward_params[p] >= 0 ? c->caller->states[c->forward_params[p]] : c->arg_structs[p];
+        if (s == NULL) continue;
+        if (state == NULL && s != C99_DEVIRT_TOP) {
+            c->callee->states[p] = s;
+            changed = 1;
+        } else if (state == NULL || strcmp(state, s) != 0) {
+            c->callee->states[p] = C99_DEVIRT_TOP;
+            changed = 1;
+        }
+    }
+    return changed;
+}
+
+void c99_analyze_devirt(C99CodeGenerator *codegen) {
+    codegen->devirt_params = NULL;
+    codegen->devirt_param_count = 0;
+    if (!codegen->program_node) return;
+
+    DevirtContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.codegen = codegen;
+    devirt_collect_fns(&ctx);
+    if (ctx.fn_count == 0) return;
+
+    devirt_collect_calls(codegen->program_node, &ctx);
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int i = 0; i < ctx.call_count; i++) {
+            if (devirt_meet_call(&ctx.calls[i])) changed = 1;
+        }
+    }
+
+    int count = 0;
+    for (int i = 0; i < ctx.fn_count; i++) {
+        for (int p = 0; p < ctx.fns[i].fn_decl->data.fn_decl.param_count; p++) {
+            if (ctx.fns[i].states[p] && ctx.fns[i].states[p] != C99_DEVIRT_TOP) count++;
+        }
+    }
+    if (count == 0) return;
+    codegen->devirt_params = (C99DevirtParam *)arena_alloc(codegen->arena, sizeof(C99DevirtParam) * (size_t)count);
+    if (!codegen->devirt_params) return;
+    for (int i = 0; i < ctx.fn_count; i++) {
+        ASTNode *fn = ctx.fns[i].fn_decl;
+        for (int p = 0; p < fn->data.fn_decl.param_count; p++) {
+            const char *s = ctx.fns[i].states[p];
+            if (!s || s == C99_DEVIRT_TOP) continue;
+            C99DevirtParam *dp = &codegen->devirt_params[codegen->devirt_param_count++];
+            dp->fn_decl = fn;
+            dp->param_name = fn->data.fn_decl.params[p]->data.var_decl.name;
+            dp->struct_name = s;
+        }
+    }
+}
+
+const char *c99_devirt_param_struct(C99CodeGenerator *codegen, const char *param_name) {
+    if (!param_name || !codegen->current_function_decl) return NULL;
+    for (int i = 0; i < codegen->devirt_param_count; i++) {
+        C99DevirtParam *dp = &codegen->devirt_params[i];
+        if (dp->fn_decl == codegen->current_function_decl && strcmp(dp->param_name, param_name) == 0) {
+            return dp->struct_name;
+        }
+    }
+    return NULL;
+}
@@ -3,26 +3,10 @@
 #include <stdlib.h>
 
 ASTNode *find_enum_decl_c99(C99CodeGenerator *codegen, const char *enum_name) {
-    if (!codegen || !enum_name || !codegen->program_node) {
+    if (!codegen || !enum_name) {
         return NULL;
     }
-    
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl || decl->type != AST_ENUM_DECL) {
-            continue;
-        }
-        
-        const char *decl_name = decl->data.enum_decl.name;
-        if (decl_name && strcmp(decl_name, enum_name) == 0) {
-            return decl;
-        }
-    }
-    
-    return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_ENUM, enum_name);
 }
 
 // 查找枚举变体的值（返回-1表示未找到）
@@ -151,9 +135,9 @@ int gen_enum_definition(C99CodeGenerator *codegen, ASTNode *enum_decl) {
         
         // 添加逗号（除非是最后一个）
         if (i < variant_count - 1) {
-            fputs(",", codegen->output);
+            emitter_lit(codegen->output, ",");
         }
-        fputs("\n", codegen->output);
+        emitter_lit(codegen->output, "\n");
     }
     
     codegen->indent_level--;
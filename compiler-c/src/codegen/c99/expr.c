@@ -45,65 +45,65 @@ static const char *unsigned_type_for_wrapping(const char *type_c) {
 /* 根据 C 类型字符串生成整数极值字面量（用于饱和运算），无匹配则用 i32 极值 */
 static void gen_saturate_limit(C99CodeGenerator *codegen, const char *type_c, int is_max) {
     if (!type_c) {
-        fprintf(codegen->output, "%s", is_max ? "2147483647" : "(-2147483647-1)");
+        emitter_puts(codegen->output, is_max ? "2147483647" : "(-2147483647-1)");
         return;
     }
     if (strstr(type_c, "int8")) {
-        fprintf(codegen->output, "%s", is_max ? "127" : "(-128)");
+        emitter_puts(codegen->output, is_max ? "127" : "(-128)");
         return;
     }
     if (strstr(type_c, "int16")) {
-        fprintf(codegen->output, "%s", is_max ? "32767" : "(-32768)");
+        emitter_puts(codegen->output, is_max ? "32767" : "(-32768)");
         return;
     }
     if (strstr(type_c, "int32")) {
-        fprintf(codegen->output, "%s", is_max ? "2147483647" : "(-2147483647-1)");
+        emitter_puts(codegen->output, is_max ? "2147483647" : "(-2147483647-1)");
         return;
     }
     if (strstr(type_c, "int64")) {
-        fprintf(codegen->output, "%s", is_max ? "9223372036854775807LL" : "(-9223372036854775807LL-1LL)");
+        emitter_puts(codegen->output, is_max ? "9223372036854775807LL" : "(-9223372036854775807LL-1LL)");
         return;
     }
-    fprintf(codegen->output, "%s", is_max ? "2147483647" : "(-2147483647-1)");
+    emitter_puts(codegen->output, is_max ? "2147483647" : "(-2147483647-1)");
 }
 
 /* 根据整数类型与 max/min 生成 C 极值字面量（resolved_kind 为 TypeKind） */
 static void gen_int_limit_literal(C99CodeGenerator *codegen, int is_max, int resolved_kind) {
     if (resolved_kind == 0) {
-        fputs("0", codegen->output);
+        emitter_lit(codegen->output, "0");
         return;
     }
     switch ((TypeKind)resolved_kind) {
         case TYPE_I8:
-            fprintf(codegen->output, "%s", is_max ? "127" : "(-128)");
+            emitter_puts(codegen->output, is_max ? "127" : "(-128)");
             break;
         case TYPE_I16:
-            fprintf(codegen->output, "%s", is_max ? "32767" : "(-32768)");
+            emitter_puts(codegen->output, is_max ? "32767" : "(-32768)");
             break;
         case TYPE_I32:
-            fprintf(codegen->output, "%s", is_max ? "2147483647" : "(-2147483647-1)");
+            emitter_puts(codegen->output, is_max ? "2147483647" : "(-2147483647-1)");
             break;
         case TYPE_I64:
-            fprintf(codegen->output, "%s", is_max ? "9223372036854775807LL" : "(-9223372036854775807LL-1LL)");
+            emitter_puts(codegen->output, is_max ? "9223372036854775807LL" : "(-9223372036854775807LL-1LL)");
             break;
         case TYPE_U8:
         case TYPE_BYTE:
-            fprintf(codegen->output, "%s", is_max ? "255" : "0");
+            emitter_puts(codegen->output, is_max ? "255" : "0");
             break;
         case TYPE_U16:
-            fprintf(codegen->output, "%s", is_max ? "65535" : "0");
+            emitter_puts(codegen->output, is_max ? "65535" : "0");
             break;
         case TYPE_U32:
-            fprintf(codegen->output, "%s", is_max ? "4294967295U" : "0");
+            emitter_puts(codegen->output, is_max ? "4294967295U" : "0");
             break;
         case TYPE_USIZE:
-            fprintf(codegen->output, "%s", is_max ? "((size_t)-1)" : "0");
+            emitter_puts(codegen->output, is_max ? "((size_t)-1)" : "0");
             break;
         case TYPE_U64:
-            fprintf(codegen->output, "%s", is_max ? "18446744073709551615ULL" : "0");
+            emitter_puts(codegen->output, is_max ? "18446744073709551615ULL" : "0");
             break;
         default:
-            fputs("0", codegen->output);
+            emitter_lit(codegen->output, "0");
             break;
     }
 }
@@ -115,7 +115,7 @@ void c99_emit_string_interp_fill(C99CodeGenerator *codegen, ASTNode *expr, const
     
     int fill_id = codegen->interp_fill_counter++;
     c99_emit_indent(codegen);
-    fprintf(codegen->output, "int _off_%d = 0;\n", fill_id);
+    emitter_printf(codegen->output, "int _off_%d = 0;\n", fill_id);
     for (int i = 0; i < n; i++) {
         ASTStringInterpSegment *seg = &expr->data.string_interp.segments[i];
         if (seg->is_text) {
@@ -123,9 +123,9 @@ void c99_emit_string_interp_fill(C99CodeGenerator *codegen, ASTNode *expr, const
             const char *cn = add_string_constant(codegen, seg->text ? seg->text : "");
             if (cn) {
                 c99_emit_indent(codegen);
-                fprintf(codegen->output, "__uya_memcpy(%s + _off_%d, %s, %zu);\n", buf_name, fill_id, cn, len);
+                emitter_printf(codegen->output, "__uya_memcpy(%s + _off_%d, %s, %zu);\n", buf_name, fill_id, cn, len);
                 c99_emit_indent(codegen);
-                fprintf(codegen->output, "_off_%d += %zu;\n", fill_id, len);
+                emitter_printf(codegen->output, "_off_%d += %zu;\n", fill_id, len);
             }
             continue;
         }
@@ -139,13 +139,44 @@ void c99_emit_string_interp_fill(C99CodeGenerator *codegen, ASTNode *expr, const
             const char *fmt_const = add_string_constant(codegen, fmt_buf);
             if (!fmt_const) continue;
             c99_emit_indent(codegen);
-            fprintf(codegen->output, "_off_%d += sprintf(%s + _off_%d, %s, ", fill_id, buf_name, fill_id, fmt_const);
+            emitter_printf(codegen->output, "_off_%d += sprintf(%s + _off_%d, %s, ", fill_id, buf_name, fill_id, fmt_const);
             gen_expr(codegen, seg->expr);
-            fputs(");\n", codegen->output);
+            emitter_lit(codegen->output, ");\n");
         }
     }
     c99_emit_indent(codegen);
-    fprintf(codegen->output, "%s[_off_%d] = '\\0';\n", buf_name, fill_id);
+    emitter_printf(codegen->output, "%s[_off_%d] = '\\0';\n", buf_name, fill_id);
+}
+
+/* 输出 match 表达式一个臂的结果赋值 "_uya_r = result; "，有绑定（变量绑定、联合体载荷）或兜底臂时包在 { } 中
+ * （if 链与 switch 的 case 共用） */
+static void gen_match_arm_result(C99CodeGenerator *codegen, ASTMatchArm *arm, const char *m_type) {
+    const char *close = "";
+    if (arm->kind == MATCH_PAT_BIND) {
+        const char *v = get_safe_c_identifier(codegen, arm->data.bind.var_name);
+        if (v) {
+            emitter_printf(codegen->output, "{ %s %s = _uya_m; ", m_type, v);
+            close = "} ";
+        }
+    } else if (arm->kind == MATCH_PAT_WILDCARD || arm->kind == MATCH_PAT_ELSE) {
+        emitter_lit(codegen->output, "{ ");
+        close = "} ";
+    } else if (arm->kind == MATCH_PAT_UNION && arm->data.union_pat.var_name && strcmp(arm->data.union_pat.var_name, "_") != 0) {
+        ASTNode *union_decl = find_union_decl_by_variant_c99(codegen, arm->data.union_pat.variant_name);
+        int idx = union_decl ? find_union_variant_index(union_decl, arm->data.union_pat.variant_name) : -1;
+        const char *vname = get_safe_c_identifier(codegen, arm->data.union_pat.variant_name);
+        const char *bind = get_safe_c_identifier(codegen, arm->data.union_pat.var_name);
+        if (idx >= 0 && vname && bind) {
+            ASTNode *vnode = union_decl->data.union_decl.variants[idx];
+            const char *vtype = (vnode && vnode->type == AST_VAR_DECL && vnode->data.var_decl.type) ? c99_type_to_c(codegen, vnode->data.var_decl.type) : "int";
+            emitter_printf(codegen->output, "{ %s %s = _uya_m.u.%s; ", vtype, bind, vname);
+            close = "} ";
+        }
+    }
+    emitter_lit(codegen->output, "_uya_r = ");
+    gen_expr(codegen, arm->result_expr);
+    emitter_lit(codegen->output, "; ");
+    emitter_puts(codegen->output, close);
 }
 
 void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
@@ -157,20 +188,20 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             const char *type_c = get_c_type_of_expr(codegen, expr);
             if (type_c && (strstr(type_c, "int64") != NULL || strstr(type_c, "i64") != NULL)) {
                 // i64 类型：使用 LL 后缀
-                fprintf(codegen->output, "%dLL", expr->data.number.value);
+                emitter_printf(codegen->output, "%dLL", expr->data.number.value);
             } else {
                 // 其他类型：使用普通整数
-                fprintf(codegen->output, "%d", expr->data.number.value);
+                emitter_int(codegen->output, expr->data.number.value);
             }
             break;
         }
         case AST_FLOAT: {
             double val = expr->data.float_literal.value;
-            fprintf(codegen->output, "%.17g", val);
+            emitter_printf(codegen->output, "%.17g", val);
             break;
         }
         case AST_BOOL:
-            fprintf(codegen->output, "%s", expr->data.bool_literal.value ? "true" : "false");
+            emitter_puts(codegen->output, expr->data.bool_literal.value ? "true" : "false");
             break;
         case AST_INT_LIMIT:
             gen_int_limit_literal(codegen, expr->data.int_limit.is_max, expr->data.int_limit.resolved_kind);
@@ -194,9 +225,9 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             // 查找已存在的字符串常量（收集阶段已添加）
             const char *str_const = find_string_constant(codegen, basename);
             if (str_const) {
-                fprintf(codegen->output, "%s", str_const);
+                emitter_puts(codegen->output, str_const);
             } else {
-                fputs("\"\"", codegen->output);
+                emitter_lit(codegen->output, "\"\"");
             }
             break;
         }
@@ -209,19 +240,19 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             // 查找已存在的字符串常量（收集阶段已添加）
             const char *str_const = find_string_constant(codegen, filepath);
             if (str_const) {
-                fprintf(codegen->output, "%s", str_const);
+                emitter_puts(codegen->output, str_const);
             } else {
-                fputs("\"\"", codegen->output);
+                emitter_lit(codegen->output, "\"\"");
             }
             break;
         }
         case AST_SRC_LINE:
             // 从节点获取行号
-            fprintf(codegen->output, "%d", expr->line);
+            emitter_int(codegen->output, expr->line);
             break;
         case AST_SRC_COL:
             // 从节点获取列号
-            fprintf(codegen->output, "%d", expr->column);
+            emitter_int(codegen->output, expr->column);
             break;
         case AST_FUNC_NAME: {
             // 从 codegen->current_function_decl 获取函数名
@@ -234,9 +265,9 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             // 查找已存在的字符串常量（收集阶段已添加）
             const char *str_const = find_string_constant(codegen, func_name);
             if (str_const) {
-                fprintf(codegen->output, "%s", str_const);
+                emitter_puts(codegen->output, str_const);
             } else {
-                fputs("\"\"", codegen->output);
+                emitter_lit(codegen->output, "\"\"");
             }
             break;
         }
@@ -255,33 +286,33 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             //     _uya_result;
             // })
             
-            fputs("({ ", codegen->output);
+            emitter_lit(codegen->output, "({ ");
             
             // 生成系统调用
-            fputs("long _uya_syscall_ret = uya_syscall", codegen->output);
-            fprintf(codegen->output, "%d(", expr->data.syscall.arg_count);
+            emitter_lit(codegen->output, "long _uya_syscall_ret = uya_syscall");
+            emitter_printf(codegen->output, "%d(", expr->data.syscall.arg_count);
             
             // 生成系统调用号
             gen_expr(codegen, expr->data.syscall.syscall_number);
             
             // 生成参数
             for (int i = 0; i < expr->data.syscall.arg_count; i++) {
-                fputs(", ", codegen->output);
+                emitter_lit(codegen->output, ", ");
                 gen_expr(codegen, expr->data.syscall.args[i]);
             }
             
-            fputs("); ", codegen->output);
+            emitter_lit(codegen->output, "); ");
             
             // 生成错误联合类型包装
-            fputs("struct err_union_int64_t _uya_result; ", codegen->output);
-            fputs("if (_uya_syscall_ret < 0) { ", codegen->output);
-            fputs("_uya_result.error_id = (int)(-_uya_syscall_ret); ", codegen->output);
-            fputs("} else { ", codegen->output);
-            fputs("_uya_result.error_id = 0; ", codegen->output);
-            fputs("_uya_result.value = _uya_syscall_ret; ", codegen->output);
-            fputs("} ", codegen->output);
-            fputs("_uya_result; ", codegen->output);
-            fputs("})", codegen->output);
+            emitter_lit(codegen->output, "struct err_union_int64_t _uya_result; ");
+            emitter_lit(codegen->output, "if (_uya_syscall_ret < 0) { ");
+            emitter_lit(codegen->output, "_uya_result.error_id = (int)(-_uya_syscall_ret); ");
+            emitter_lit(codegen->output, "} else { ");
+            emitter_lit(codegen->output, "_uya_result.error_id = 0; ");
+            emitter_lit(codegen->output, "_uya_result.value = _uya_syscall_ret; ");
+            emitter_lit(codegen->output, "} ");
+            emitter_lit(codegen->output, "_uya_result; ");
+            emitter_lit(codegen->output, "})");
             break;
         }
         case AST_STRING: {
@@ -289,17 +320,17 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             if (str_const) {
                 // 字符串常量声明为 static const uint8_t[]，用 (uint8_t *) 转换
                 // 避免赋给非 const 指针字段时的 -Wdiscarded-qualifiers 警告
-                fprintf(codegen->output, "(uint8_t *)%s", str_const);
+                emitter_printf(codegen->output, "(uint8_t *)%s", str_const);
             } else {
-                fputs("(uint8_t *)\"\"", codegen->output);
+                emitter_lit(codegen->output, "(uint8_t *)\"\"");
             }
             break;
         }
         case AST_STRING_INTERP: {
             if (codegen->string_interp_buf) {
-                fputs(codegen->string_interp_buf, codegen->output);
+                emitter_puts(codegen->output, codegen->string_interp_buf);
             } else {
-                fputs("((char*)0)", codegen->output);
+                emitter_lit(codegen->output, "((char*)0)");
             }
             break;
         }
@@ -315,9 +346,9 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     if (id == 0) id = 1;
                     const char *safe = get_safe_c_identifier(codegen, left->data.identifier.name);
                     if (op == TOKEN_NOT_EQUAL)
-                        fprintf(codegen->output, "(%s.error_id != %uU)", safe, id);
+                        emitter_printf(codegen->output, "(%s.error_id != %uU)", safe, id);
                     else
-                        fprintf(codegen->output, "(%s.error_id == %uU)", safe, id);
+                        emitter_printf(codegen->output, "(%s.error_id == %uU)", safe, id);
                     break;
                 }
                 if (left->type == AST_ERROR_VALUE && right->type == AST_IDENTIFIER) {
@@ -325,9 +356,9 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     if (id == 0) id = 1;
                     const char *safe = get_safe_c_identifier(codegen, right->data.identifier.name);
                     if (op == TOKEN_NOT_EQUAL)
-                        fprintf(codegen->output, "(%uU != %s.error_id)", id, safe);
+                        emitter_printf(codegen->output, "(%uU != %s.error_id)", id, safe);
                     else
-                        fprintf(codegen->output, "(%uU == %s.error_id)", id, safe);
+                        emitter_printf(codegen->output, "(%uU == %s.error_id)", id, safe);
                     break;
                 }
             }
@@ -350,7 +381,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 // 按字段比较，避免 padding 未初始化导致 memcmp 结果错误
                 ASTNode *struct_decl = NULL;
                 if (left->type == AST_IDENTIFIER) {
-                    const char *type_c = get_identifier_type_c(codegen, left->data.identifier.name);
+                    const char *type_c = get_identifier_type_c(codegen, left);
                     struct_decl = type_c ? find_struct_decl_from_type_c(codegen, type_c) : NULL;
                 } else if (left->type == AST_STRUCT_INIT) {
                     struct_decl = find_struct_decl_c99(codegen, left->data.struct_init.struct_name);
@@ -361,15 +392,15 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     if (field_count == 0) {
                         /* 空结构体：视为相等，直接输出 1(==) 或 0(!=)，不再包括号 */
                         if (op == TOKEN_EQUAL) {
-                            fputs("(1)", codegen->output);
+                            emitter_lit(codegen->output, "(1)");
                         } else {
-                            fputs("(0)", codegen->output);
+                            emitter_lit(codegen->output, "(0)");
                         }
                     } else {
                     if (op == TOKEN_NOT_EQUAL) {
-                        fputs("(!(", codegen->output);
+                        emitter_lit(codegen->output, "(!(");
                     } else {
-                        fputc('(', codegen->output);
+                        emitter_putc(codegen->output, '(');
                     }
                         for (int i = 0; i < field_count; i++) {
                             ASTNode *field = fields[i];
@@ -391,71 +422,71 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                                 }
                             }
                             if (field_needs_memcmp) {
-                                fputs("(__uya_memcmp(&(", codegen->output);
+                                emitter_lit(codegen->output, "(__uya_memcmp(&(");
                                 gen_expr(codegen, left);
-                                fputs(").", codegen->output);
-                                fputs(safe_field, codegen->output);
-                                fputs(", &(", codegen->output);
+                                emitter_lit(codegen->output, ").");
+                                emitter_puts(codegen->output, safe_field);
+                                emitter_lit(codegen->output, ", &(");
                                 gen_expr(codegen, right);
-                                fputs(").", codegen->output);
-                                fputs(safe_field, codegen->output);
-                                fputs(", sizeof((", codegen->output);
+                                emitter_lit(codegen->output, ").");
+                                emitter_puts(codegen->output, safe_field);
+                                emitter_lit(codegen->output, ", sizeof((");
                                 gen_expr(codegen, left);
-                                fputs(").", codegen->output);
-                                fputs(safe_field, codegen->output);
-                                fputs(")) == 0)", codegen->output);
+                                emitter_lit(codegen->output, ").");
+                                emitter_puts(codegen->output, safe_field);
+                                emitter_lit(codegen->output, ")) == 0)");
                             } else {
-                                fputs("((", codegen->output);
+                                emitter_lit(codegen->output, "((");
                                 gen_expr(codegen, left);
-                                fputs(").", codegen->output);
-                                fputs(safe_field, codegen->output);
-                                fputs(" == (", codegen->output);
+                                emitter_lit(codegen->output, ").");
+                                emitter_puts(codegen->output, safe_field);
+                                emitter_lit(codegen->output, " == (");
                                 gen_expr(codegen, right);
-                                fputs(").", codegen->output);
-                                fputs(safe_field, codegen->output);
-                                fputs(")", codegen->output);
+                                emitter_lit(codegen->output, ").");
+                                emitter_puts(codegen->output, safe_field);
+                                emitter_lit(codegen->output, ")");
                             }
-                            if (i < field_count - 1) fputs(" && ", codegen->output);
+                            if (i < field_count - 1) emitter_lit(codegen->output, " && ");
                         }
-                    fputc(')', codegen->output);
+                    emitter_putc(codegen->output, ')');
                     if (op == TOKEN_NOT_EQUAL) {
-                        fputc(')', codegen->output);
+                        emitter_putc(codegen->output, ')');
                     }
                     }
                 } else {
                     /* 回退：无法按字段比较时用 memcmp，整体加括号 */
                     const char *struct_name = NULL;
-                    fputc('(', codegen->output);
+                    emitter_putc(codegen->output, '(');
                     if (left->type == AST_IDENTIFIER) {
-                        fputs("__uya_memcmp(&", codegen->output);
+                        emitter_lit(codegen->output, "__uya_memcmp(&");
                         gen_expr(codegen, left);
-                        fputs(", &", codegen->output);
+                        emitter_lit(codegen->output, ", &");
                         gen_expr(codegen, right);
-                        fputs(", sizeof(", codegen->output);
+                        emitter_lit(codegen->output, ", sizeof(");
                         gen_expr(codegen, left);
-                        fputs("))", codegen->output);
+                        emitter_lit(codegen->output, "))");
                     } else if (left->type == AST_STRUCT_INIT) {
                         struct_name = get_safe_c_identifier(codegen, left->data.struct_init.struct_name);
-                        fputs("__uya_memcmp(&", codegen->output);
+                        emitter_lit(codegen->output, "__uya_memcmp(&");
                         gen_expr(codegen, left);
-                        fputs(", &", codegen->output);
+                        emitter_lit(codegen->output, ", &");
                         gen_expr(codegen, right);
-                        fprintf(codegen->output, ", sizeof(struct %s))", struct_name ? struct_name : "void");
+                        emitter_printf(codegen->output, ", sizeof(struct %s))", struct_name ? struct_name : "void");
                     } else {
-                        fputs("__uya_memcmp(&", codegen->output);
+                        emitter_lit(codegen->output, "__uya_memcmp(&");
                         gen_expr(codegen, left);
-                        fputs(", &", codegen->output);
+                        emitter_lit(codegen->output, ", &");
                         gen_expr(codegen, right);
-                        fputs(", sizeof(", codegen->output);
+                        emitter_lit(codegen->output, ", sizeof(");
                         gen_expr(codegen, left);
-                        fputs("))", codegen->output);
+                        emitter_lit(codegen->output, "))");
                     }
                     if (op == TOKEN_EQUAL) {
-                        fputs(" == 0)", codegen->output);
+                        emitter_lit(codegen->output, " == 0)");
                     } else if (op == TOKEN_NOT_EQUAL) {
-                        fputs(" != 0)", codegen->output);
+                        emitter_lit(codegen->output, " != 0)");
                     } else {
-                        fputc(')', codegen->output);
+                        emitter_putc(codegen->output, ')');
                     }
                 }
             } else if (op == TOKEN_PLUS_PIPE || op == TOKEN_MINUS_PIPE || op == TOKEN_ASTERISK_PIPE ||
@@ -468,112 +499,112 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     const char *base_type = type_c;
                     if (base_type && strncmp(base_type, "const ", 6) == 0) base_type = base_type + 6;
                     if (!base_type) base_type = "int32_t";
-                    fputs("({ ", codegen->output);
-                    fprintf(codegen->output, "%s _l = (", base_type);
+                    emitter_lit(codegen->output, "({ ");
+                    emitter_printf(codegen->output, "%s _l = (", base_type);
                     gen_expr(codegen, left);
-                    fputs("); ", codegen->output);
-                    fprintf(codegen->output, "%s _r = (", base_type);
+                    emitter_lit(codegen->output, "); ");
+                    emitter_printf(codegen->output, "%s _r = (", base_type);
                     gen_expr(codegen, right);
-                    fputs("); ", codegen->output);
-                    fprintf(codegen->output, "%s _s; ", base_type);
+                    emitter_lit(codegen->output, "); ");
+                    emitter_printf(codegen->output, "%s _s; ", base_type);
                     if (op == TOKEN_PLUS_PIPE) {
-                        fputs("__builtin_add_overflow(_l, _r, &_s) ? (_l>=0 && _r>=0 ? ", codegen->output);
+                        emitter_lit(codegen->output, "__builtin_add_overflow(_l, _r, &_s) ? (_l>=0 && _r>=0 ? ");
                     } else if (op == TOKEN_MINUS_PIPE) {
-                        fputs("__builtin_sub_overflow(_l, _r, &_s) ? (_l>=0 && _r<0 ? ", codegen->output);
+                        emitter_lit(codegen->output, "__builtin_sub_overflow(_l, _r, &_s) ? (_l>=0 && _r<0 ? ");
                     } else {
                         /* 乘法饱和：用 if-else 避免嵌套三元运算符的 C 解析歧义 */
-                        fprintf(codegen->output, "%s _res; ", base_type);
-                        fputs("if (__builtin_mul_overflow(_l, _r, &_s)) _res = ((_l>=0 && _r>=0) || (_l<0 && _r<0)) ? ", codegen->output);
+                        emitter_printf(codegen->output, "%s _res; ", base_type);
+                        emitter_lit(codegen->output, "if (__builtin_mul_overflow(_l, _r, &_s)) _res = ((_l>=0 && _r>=0) || (_l<0 && _r<0)) ? ");
                     }
                     gen_saturate_limit(codegen, type_c, 1);
-                    fputs(" : ", codegen->output);
+                    emitter_lit(codegen->output, " : ");
                     gen_saturate_limit(codegen, type_c, 0);
                     if (op == TOKEN_ASTERISK_PIPE)
-                        fputs("; else _res = _s; _res; })", codegen->output);
+                        emitter_lit(codegen->output, "; else _res = _s; _res; })");
                     else
-                        fputs(") : _s; })", codegen->output);
+                        emitter_lit(codegen->output, ") : _s; })");
                 } else {
                     /* 包装：(T)((UT)(a) op (UT)(b)) */
                     const char *ut = unsigned_type_for_wrapping(type_c);
-                    fprintf(codegen->output, "((%s)((%s)(", type_c, ut);
+                    emitter_printf(codegen->output, "((%s)((%s)(", type_c, ut);
                     gen_expr(codegen, left);
-                    if (op == TOKEN_PLUS_PERCENT) fputs(") + (", codegen->output);
-                    else if (op == TOKEN_MINUS_PERCENT) fputs(") - (", codegen->output);
-                    else fputs(") * (", codegen->output);
-                    fprintf(codegen->output, "%s)(", ut);
+                    if (op == TOKEN_PLUS_PERCENT) emitter_lit(codegen->output, ") + (");
+                    else if (op == TOKEN_MINUS_PERCENT) emitter_lit(codegen->output, ") - (");
+                    else emitter_lit(codegen->output, ") * (");
+                    emitter_printf(codegen->output, "%s)(", ut);
                     gen_expr(codegen, right);
-                    fputs(")))", codegen->output);
+                    emitter_lit(codegen->output, ")))");
                 }
-            } else {
-                // 普通二元表达式
-                fputc('(', codegen->output);
+            } else if (!c99_gen_checked_arith(codegen, expr)) {
+                // 普通二元表达式（无法证明安全的 + - * / % 已由 c99_gen_checked_arith 生成带检查的形式）
+                emitter_putc(codegen->output, '(');
                 gen_expr(codegen, left);
                 // 操作符映射
                 if (op == TOKEN_PLUS) {
-                    fputs(" + ", codegen->output);
+                    emitter_lit(codegen->output, " + ");
                 } else if (op == TOKEN_MINUS) {
-                    fputs(" - ", codegen->output);
+                    emitter_lit(codegen->output, " - ");
                 } else if (op == TOKEN_ASTERISK) {
-                    fputs(" * ", codegen->output);
+                    emitter_lit(codegen->output, " * ");
                 } else if (op == TOKEN_SLASH) {
-                    fputs(" / ", codegen->output);
+                    emitter_lit(codegen->output, " / ");
                 } else if (op == TOKEN_PERCENT) {
-                    fputs(" % ", codegen->output);
+                    emitter_lit(codegen->output, " % ");
                 } else if (op == TOKEN_EQUAL) {
-                    fputs(" == ", codegen->output);
+                    emitter_lit(codegen->output, " == ");
                 } else if (op == TOKEN_NOT_EQUAL) {
-                    fputs(" != ", codegen->output);
+                    emitter_lit(codegen->output, " != ");
                 } else if (op == TOKEN_LESS) {
-                    fputs(" < ", codegen->output);
+                    emitter_lit(codegen->output, " < ");
                 } else if (op == TOKEN_GREATER) {
-                    fputs(" > ", codegen->output);
+                    emitter_lit(codegen->output, " > ");
                 } else if (op == TOKEN_LESS_EQUAL) {
-                    fputs(" <= ", codegen->output);
+                    emitter_lit(codegen->output, " <= ");
                 } else if (op == TOKEN_GREATER_EQUAL) {
-                    fputs(" >= ", codegen->output);
+                    emitter_lit(codegen->output, " >= ");
                 } else if (op == TOKEN_LOGICAL_AND) {
-                    fputs(" && ", codegen->output);
+                    emitter_lit(codegen->output, " && ");
                 } else if (op == TOKEN_LOGICAL_OR) {
-                    fputs(" || ", codegen->output);
+                    emitter_lit(codegen->output, " || ");
                 } else if (op == TOKEN_AMPERSAND) {
-                    fputs(" & ", codegen->output);
+                    emitter_lit(codegen->output, " & ");
                 } else if (op == TOKEN_PIPE) {
-                    fputs(" | ", codegen->output);
+                    emitter_lit(codegen->output, " | ");
                 } else if (op == TOKEN_CARET) {
-                    fputs(" ^ ", codegen->output);
+                    emitter_lit(codegen->output, " ^ ");
                 } else if (op == TOKEN_LSHIFT) {
-                    fputs(" << ", codegen->output);
+                    emitter_lit(codegen->output, " << ");
                 } else if (op == TOKEN_RSHIFT) {
-                    fputs(" >> ", codegen->output);
+                    emitter_lit(codegen->output, " >> ");
                 } else {
-                    fputs(" + ", codegen->output); // 默认为加法
+                    emitter_lit(codegen->output, " + "); // 默认为加法
                 }
                 gen_expr(codegen, right);
-                fputc(')', codegen->output);
+                emitter_putc(codegen->output, ')');
             }
             break;
         }
         case AST_UNARY_EXPR: {
             int op = expr->data.unary_expr.op;
             ASTNode *operand = expr->data.unary_expr.operand;
-            fputc('(', codegen->output);
+            emitter_putc(codegen->output, '(');
             if (op == TOKEN_ASTERISK) {
-                fputs("*", codegen->output);
+                emitter_lit(codegen->output, "*");
             } else if (op == TOKEN_AMPERSAND) {
-                fputs("&", codegen->output);
+                emitter_lit(codegen->output, "&");
             } else if (op == TOKEN_MINUS) {
-                fputs("-", codegen->output);
+                emitter_lit(codegen->output, "-");
             } else if (op == TOKEN_EXCLAMATION) {
-                fputs("!", codegen->output);
+                emitter_lit(codegen->output, "!");
             } else if (op == TOKEN_TILDE) {
-                fputs("~", codegen->output);
+                emitter_lit(codegen->output, "~");
             } else if (op == TOKEN_PLUS) {
-                fputs("+", codegen->output);
+                emitter_lit(codegen->output, "+");
             } else {
-                fputs("+", codegen->output); // 默认
+                emitter_lit(codegen->output, "+"); // 默认
             }
             gen_expr(codegen, operand);
-            fputc(')', codegen->output);
+            emitter_putc(codegen->output, ')');
             break;
         }
         case AST_MEMBER_ACCESS: {
@@ -587,7 +618,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             // 模块限定访问（module.item）：直接输出项名
             if (expr->data.member_access.is_module_access) {
                 const char *safe_name = get_safe_c_identifier(codegen, field_name);
-                fprintf(codegen->output, "%s", safe_name);
+                emitter_puts(codegen->output, safe_name);
                 break;
             }
             
@@ -603,7 +634,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                         if (enum_value >= 0) {
                             // 找到变体，直接输出枚举值名称（C中枚举值不需要前缀）
                             const char *safe_variant_name = get_safe_c_identifier(codegen, field_name);
-                            fprintf(codegen->output, "%s", safe_variant_name);
+                            emitter_puts(codegen->output, safe_variant_name);
                             break;
                         }
                     }
@@ -631,12 +662,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             int is_pointer = 0;
             if (object->type == AST_IDENTIFIER) {
                 // 标识符：检查变量类型是否是指针
-                // 注意：需要使用 get_safe_c_identifier 转换名称，因为变量表中存储的是转换后的名称
-                const char *var_name = object->data.identifier.name;
-                if (var_name) {
-                    const char *safe_name = get_safe_c_identifier(codegen, var_name);
-                    is_pointer = is_identifier_pointer_type(codegen, safe_name);
-                }
+                is_pointer = is_identifier_pointer_type(codegen, object);
             } else if (object->type == AST_MEMBER_ACCESS) {
                 // 嵌套成员访问：检查嵌套访问的结果类型是否是指针
                 is_pointer = is_member_access_pointer_type(codegen, object);
@@ -663,60 +689,58 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             if (codegen->emitting_assign_lhs && object->type == AST_IDENTIFIER && object->data.identifier.name &&
                 strcmp(object->data.identifier.name, "self") == 0 && codegen->current_method_struct_name) {
                 const char *safe_struct = get_safe_c_identifier(codegen, codegen->current_method_struct_name);
-                if (safe_struct) fprintf(codegen->output, "((struct %s *)self)", safe_struct);
+                if (safe_struct) emitter_printf(codegen->output, "((struct %s *)self)", safe_struct);
                 else gen_expr(codegen, object);
             } else {
                 gen_expr(codegen, object);
             }
             if (is_pointer) {
                 // 指针类型使用 -> 操作符
-                fprintf(codegen->output, "->%s", safe_field_name);
+                emitter_printf(codegen->output, "->%s", safe_field_name);
             } else {
                 // 非指针类型使用 . 操作符
-                fprintf(codegen->output, ".%s", safe_field_name);
+                emitter_printf(codegen->output, ".%s", safe_field_name);
             }
             break;
         }
         case AST_ARRAY_ACCESS: {
             ASTNode *array = expr->data.array_access.array;
-            ASTNode *index = expr->data.array_access.index;
             if (array->type == AST_SLICE_EXPR) {
-                fputc('(', codegen->output);
+                emitter_putc(codegen->output, '(');
                 gen_expr(codegen, array);
-                fputs(").ptr[", codegen->output);
-                gen_expr(codegen, index);
-                fputc(']', codegen->output);
+                emitter_lit(codegen->output, ").ptr[");
+                c99_gen_index_expr(codegen, expr, 1);
+                emitter_putc(codegen->output, ']');
                 break;
             }
             if (array->type == AST_MEMBER_ACCESS) {
                 const char *type_c = get_c_type_of_expr(codegen, array);
                 if (type_c && strstr(type_c, "uya_slice_")) {
-                    fputc('(', codegen->output);
+                    emitter_putc(codegen->output, '(');
                     gen_expr(codegen, array);
-                    fputs(").ptr[", codegen->output);
-                    gen_expr(codegen, index);
-                    fputc(']', codegen->output);
+                    emitter_lit(codegen->output, ").ptr[");
+                    c99_gen_index_expr(codegen, expr, 1);
+                    emitter_putc(codegen->output, ']');
                     break;
                 }
             }
             if (array->type == AST_IDENTIFIER) {
-                const char *type_c = get_identifier_type_c(codegen, array->data.identifier.name);
+                const char *type_c = get_identifier_type_c(codegen, array);
                 if (type_c && strstr(type_c, "uya_slice_")) {
                     // 检查标识符是否是指针类型
-                    const char *safe_name = get_safe_c_identifier(codegen, array->data.identifier.name);
-                    int is_pointer = is_identifier_pointer_type(codegen, safe_name);
+                    int is_pointer = is_identifier_pointer_type(codegen, array);
                     if (is_pointer) {
                         // 指针类型使用 -> 操作符
                         gen_expr(codegen, array);
-                        fputs("->ptr[", codegen->output);
+                        emitter_lit(codegen->output, "->ptr[");
                     } else {
                         // 非指针类型使用 . 操作符
-                        fputc('(', codegen->output);
+                        emitter_putc(codegen->output, '(');
                         gen_expr(codegen, array);
-                        fputs(").ptr[", codegen->output);
+                        emitter_lit(codegen->output, ").ptr[");
                     }
-                    gen_expr(codegen, index);
-                    fputc(']', codegen->output);
+                    c99_gen_index_expr(codegen, expr, is_pointer ? 2 : 1);
+                    emitter_putc(codegen->output, ']');
                     break;
                 }
             }
@@ -724,9 +748,9 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             // 在 C 中可以直接使用 file_paths_buffer[i]，不需要 (*file_paths_buffer)[i]
             // 因为 file_paths_buffer[i] 会自动解引用
             gen_expr(codegen, array);
-            fputc('[', codegen->output);
-            gen_expr(codegen, index);
-            fputc(']', codegen->output);
+            emitter_putc(codegen->output, '[');
+            c99_gen_index_expr(codegen, expr, 0);
+            emitter_putc(codegen->output, ']');
             break;
         }
         case AST_SLICE_EXPR: {
@@ -735,30 +759,30 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             ASTNode *len_expr = expr->data.slice_expr.len_expr;
             const char *slice_type_c = get_c_type_of_expr(codegen, expr);
             if (!slice_type_c) slice_type_c = "struct uya_slice_int32_t";
-            fputc('(', codegen->output);
-            fprintf(codegen->output, "%s){ .ptr = ", slice_type_c);
+            emitter_putc(codegen->output, '(');
+            emitter_printf(codegen->output, "%s){ .ptr = ", slice_type_c);
             if (base->type == AST_SLICE_EXPR) {
-                fputc('(', codegen->output);
+                emitter_putc(codegen->output, '(');
                 gen_expr(codegen, base);
-                fputs(").ptr + ", codegen->output);
+                emitter_lit(codegen->output, ").ptr + ");
             } else if (base->type == AST_IDENTIFIER) {
-                const char *type_c = get_identifier_type_c(codegen, base->data.identifier.name);
+                const char *type_c = get_identifier_type_c(codegen, base);
                 if (type_c && strstr(type_c, "uya_slice_")) {
-                    fputc('(', codegen->output);
+                    emitter_putc(codegen->output, '(');
                     gen_expr(codegen, base);
-                    fputs(").ptr + ", codegen->output);
+                    emitter_lit(codegen->output, ").ptr + ");
                 } else {
                     gen_expr(codegen, base);
-                    fputs(" + ", codegen->output);
+                    emitter_lit(codegen->output, " + ");
                 }
             } else {
                 gen_expr(codegen, base);
-                fputs(" + ", codegen->output);
+                emitter_lit(codegen->output, " + ");
             }
             gen_expr(codegen, start_expr);
-            fputs(", .len = ", codegen->output);
+            emitter_lit(codegen->output, ", .len = ");
             gen_expr(codegen, len_expr);
-            fputc('}', codegen->output);
+            emitter_putc(codegen->output, '}');
             break;
         }
         case AST_STRUCT_INIT: {
@@ -781,20 +805,9 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             ASTNode **init_field_values = expr->data.struct_init.field_values;
             
             // 查找结构体声明以获取字段默认值
-            ASTNode *struct_decl = NULL;
-            if (codegen->program_node && codegen->program_node->type == AST_PROGRAM) {
-                for (int i = 0; i < codegen->program_node->data.program.decl_count; i++) {
-                    ASTNode *decl = codegen->program_node->data.program.decls[i];
-                    if (decl && decl->type == AST_STRUCT_DECL && 
-                        decl->data.struct_decl.name &&
-                        strcmp(decl->data.struct_decl.name, orig_name) == 0) {
-                        struct_decl = decl;
-                        break;
-                    }
-                }
-            }
+            ASTNode *struct_decl = ast_find_decl(codegen->program_node, DECL_KEY_STRUCT, orig_name);
             
-            fprintf(codegen->output, "(struct %s){", struct_name);
+            emitter_printf(codegen->output, "(struct %s){", struct_name);
             
             // 如果找到结构体声明，按结构体字段顺序生成初始化值（包含默认值）
             if (struct_decl && struct_decl->data.struct_decl.fields) {
@@ -818,8 +831,8 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                         }
                     }
                     
-                    if (output_count > 0) fputs(", ", codegen->output);
-                    fprintf(codegen->output, ".%s = ", safe_field_name);
+                    if (output_count > 0) emitter_lit(codegen->output, ", ");
+                    emitter_printf(codegen->output, ".%s = ", safe_field_name);
                     
                     if (user_value) {
                         // 使用用户提供的值
@@ -829,7 +842,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                         gen_expr(codegen, field->data.var_decl.init);
                     } else {
                         // 没有默认值，使用零值
-                        fputs("0", codegen->output);
+                        emitter_lit(codegen->output, "0");
                     }
                     output_count++;
                 }
@@ -837,37 +850,37 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 // 回退：只生成用户提供的字段（原来的行为）
                 for (int i = 0; i < init_field_count; i++) {
                     const char *safe_field_name = get_safe_c_identifier(codegen, init_field_names[i]);
-                    fprintf(codegen->output, ".%s = ", safe_field_name);
+                    emitter_printf(codegen->output, ".%s = ", safe_field_name);
                     gen_expr(codegen, init_field_values[i]);
-                    if (i < init_field_count - 1) fputs(", ", codegen->output);
+                    if (i < init_field_count - 1) emitter_lit(codegen->output, ", ");
                 }
             }
-            fputc('}', codegen->output);
+            emitter_putc(codegen->output, '}');
             break;
         }
         case AST_ARRAY_LITERAL: {
             ASTNode **elements = expr->data.array_literal.elements;
             int element_count = expr->data.array_literal.element_count;
             ASTNode *repeat_count_expr = expr->data.array_literal.repeat_count_expr;
-            fputc('{', codegen->output);
+            emitter_putc(codegen->output, '{');
             if (repeat_count_expr != NULL && element_count >= 1) {
                 /* [value: N] 形式：重复 value 共 N 次 */
                 int n = eval_const_expr(codegen, repeat_count_expr);
                 if (n <= 0) n = 1;
                 for (int i = 0; i < n; i++) {
                     gen_expr(codegen, elements[0]);
-                    if (i < n - 1) fputs(", ", codegen->output);
+                    if (i < n - 1) emitter_lit(codegen->output, ", ");
                 }
             } else if (element_count > 0) {
                 for (int i = 0; i < element_count; i++) {
                     gen_expr(codegen, elements[i]);
-                    if (i < element_count - 1) fputs(", ", codegen->output);
+                    if (i < element_count - 1) emitter_lit(codegen->output, ", ");
                 }
             } else {
                 /* 空数组字面量：生成 {0} 避免 ISO C 警告 */
-                fputs("0", codegen->output);
+                emitter_lit(codegen->output, "0");
             }
-            fputc('}', codegen->output);
+            emitter_putc(codegen->output, '}');
             break;
         }
         case AST_PARAMS: {
@@ -876,7 +889,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             ASTNode *fn = codegen->current_function_decl;
             if (!fn || fn->type != AST_FN_DECL || fn->data.fn_decl.param_count <= 0 ||
                 !fn->data.fn_decl.params) {
-                fputs("(struct { int32_t f0; }){ .f0 = 0 }", codegen->output);
+                emitter_lit(codegen->output, "(struct { int32_t f0; }){ .f0 = 0 }");
                 break;
             }
             ASTNode **params = fn->data.fn_decl.params;
@@ -888,7 +901,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             }
             char *type_buf = (char *)arena_alloc(codegen->arena, total_len);
             if (!type_buf) {
-                fputs("(struct { int32_t f0; }){ .f0 = 0 }", codegen->output);
+                emitter_lit(codegen->output, "(struct { int32_t f0; }){ .f0 = 0 }");
                 break;
             }
             size_t off = 0;
@@ -900,18 +913,18 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 off += (size_t)snprintf(type_buf + off, total_len - off, "%s f%d; ", et, i);
             }
             snprintf(type_buf + off, total_len - off, "}");
-            fprintf(codegen->output, "(%s){", type_buf);
+            emitter_printf(codegen->output, "(%s){", type_buf);
             for (int i = 0; i < n; i++) {
-                fprintf(codegen->output, ".f%d = ", i);
+                emitter_printf(codegen->output, ".f%d = ", i);
                 if (params[i] && params[i]->type == AST_VAR_DECL && params[i]->data.var_decl.name) {
                     const char *pname = get_safe_c_identifier(codegen, params[i]->data.var_decl.name);
-                    fprintf(codegen->output, "%s", pname);
+                    emitter_puts(codegen->output, pname);
                 } else {
-                    fputs("0", codegen->output);
+                    emitter_lit(codegen->output, "0");
                 }
-                if (i < n - 1) fputs(", ", codegen->output);
+                if (i < n - 1) emitter_lit(codegen->output, ", ");
             }
-            fputc('}', codegen->output);
+            emitter_putc(codegen->output, '}');
             break;
         }
         case AST_TUPLE_LITERAL: {
@@ -919,7 +932,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             ASTNode **elements = expr->data.tuple_literal.elements;
             int n = expr->data.tuple_literal.element_count;
             if (n <= 0 || !elements) {
-                fputs("(struct { int32_t f0; }){ .f0 = 0 }", codegen->output);
+                emitter_lit(codegen->output, "(struct { int32_t f0; }){ .f0 = 0 }");
                 break;
             }
             size_t total_len = 64;
@@ -929,7 +942,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             }
             char *type_buf = (char *)arena_alloc(codegen->arena, total_len);
             if (!type_buf) {
-                fputs("(struct { int32_t f0; }){ .f0 = 0 }", codegen->output);
+                emitter_lit(codegen->output, "(struct { int32_t f0; }){ .f0 = 0 }");
                 break;
             }
             size_t off = 0;
@@ -940,19 +953,19 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 off += (size_t)snprintf(type_buf + off, total_len - off, "%s f%d; ", et, i);
             }
             snprintf(type_buf + off, total_len - off, "}");
-            fprintf(codegen->output, "(%s){", type_buf);
+            emitter_printf(codegen->output, "(%s){", type_buf);
             for (int i = 0; i < n; i++) {
-                fprintf(codegen->output, ".f%d = ", i);
+                emitter_printf(codegen->output, ".f%d = ", i);
                 gen_expr(codegen, elements[i]);
-                if (i < n - 1) fputs(", ", codegen->output);
+                if (i < n - 1) emitter_lit(codegen->output, ", ");
             }
-            fputc('}', codegen->output);
+            emitter_putc(codegen->output, '}');
             break;
         }
         case AST_SIZEOF: {
             ASTNode *target = expr->data.sizeof_expr.target;
             int is_type = expr->data.sizeof_expr.is_type;
-            fputs("sizeof(", codegen->output);
+            emitter_lit(codegen->output, "sizeof(");
             if (is_type) {
                 // 显式检查是否是结构体类型（即使在 c99_type_to_c 中查找失败）
                 if (target->type == AST_TYPE_NAMED) {
@@ -961,7 +974,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                         // 检查是否是结构体（检查是否在表中，不管是否已定义）
                         const char *safe_name = get_safe_c_identifier(codegen, name);
                         if (is_struct_in_table(codegen, safe_name)) {
-                            fprintf(codegen->output, "struct %s", safe_name);
+                            emitter_printf(codegen->output, "struct %s", safe_name);
                         } else {
                             // 如果不在表中，尝试从程序节点中查找结构体声明
                             if (codegen->program_node) {
@@ -975,7 +988,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                                         if (struct_name) {
                                             const char *safe_struct_name = get_safe_c_identifier(codegen, struct_name);
                                             if (strcmp(safe_struct_name, safe_name) == 0) {
-                                                fprintf(codegen->output, "struct %s", safe_name);
+                                                emitter_printf(codegen->output, "struct %s", safe_name);
                                                 found = 1;
                                                 break;
                                             }
@@ -985,16 +998,16 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                                 if (!found) {
                                     // 不是结构体，使用默认类型转换
                                     const char *type_c = c99_type_to_c(codegen, target);
-                                    fprintf(codegen->output, "%s", type_c);
+                                    emitter_puts(codegen->output, type_c);
                                 }
                             } else {
                                 const char *type_c = c99_type_to_c(codegen, target);
-                                fprintf(codegen->output, "%s", type_c);
+                                emitter_puts(codegen->output, type_c);
                             }
                         }
                     } else {
                         const char *type_c = c99_type_to_c(codegen, target);
-                        fprintf(codegen->output, "%s", type_c);
+                        emitter_puts(codegen->output, type_c);
                     }
                 } else {
                     const char *type_c = c99_type_to_c(codegen, target);
@@ -1012,16 +1025,16 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                             if (close_bracket) {
                                 size_t base_len = bracket - type_c;
                                 size_t array_spec_len = close_bracket - bracket + 1;
-                                fprintf(codegen->output, "%.*s(*)", (int)base_len, type_c);
-                                fprintf(codegen->output, "%.*s", (int)array_spec_len, bracket);
+                                emitter_printf(codegen->output, "%.*s(*)", (int)base_len, type_c);
+                                emitter_printf(codegen->output, "%.*s", (int)array_spec_len, bracket);
                             } else {
-                                fprintf(codegen->output, "%s", type_c);
+                                emitter_puts(codegen->output, type_c);
                             }
                         } else {
-                            fprintf(codegen->output, "%s", type_c);
+                            emitter_puts(codegen->output, type_c);
                         }
                     } else {
-                        fprintf(codegen->output, "%s", type_c);
+                        emitter_puts(codegen->output, type_c);
                     }
                 }
             } else {
@@ -1033,14 +1046,14 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     if (name && !is_c_keyword(name)) {
                         const char *safe_name = get_safe_c_identifier(codegen, name);
                         if (is_struct_in_table(codegen, safe_name)) {
-                            fprintf(codegen->output, "struct %s", safe_name);
+                            emitter_printf(codegen->output, "struct %s", safe_name);
                         } else {
                             int is_enum = is_enum_in_table(codegen, safe_name);
                             if (!is_enum && find_enum_decl_c99(codegen, safe_name)) {
                                 is_enum = 1;
                             }
                             if (is_enum) {
-                                fprintf(codegen->output, "enum %s", safe_name);
+                                emitter_printf(codegen->output, "enum %s", safe_name);
                             } else {
                                 gen_expr(codegen, target);
                             }
@@ -1052,31 +1065,30 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     gen_expr(codegen, target);
                 }
             }
-            fputc(')', codegen->output);
+            emitter_putc(codegen->output, ')');
             break;
         }
         case AST_LEN: {
             ASTNode *array = expr->data.len_expr.array;
             if (array->type == AST_SLICE_EXPR) {
-                fputc('(', codegen->output);
+                emitter_putc(codegen->output, '(');
                 gen_expr(codegen, array);
-                fputs(").len", codegen->output);
+                emitter_lit(codegen->output, ").len");
                 break;
             }
             if (array->type == AST_MEMBER_ACCESS) {
                 const char *type_c = get_c_type_of_expr(codegen, array);
                 if (type_c && strstr(type_c, "uya_slice_")) {
                     gen_expr(codegen, array);
-                    fputs(".len", codegen->output);
+                    emitter_lit(codegen->output, ".len");
                     break;
                 }
             }
             if (array->type == AST_IDENTIFIER) {
-                const char *var_name = array->data.identifier.name;
-                const char *type_c = get_identifier_type_c(codegen, var_name);
+                const char *type_c = get_identifier_type_c(codegen, array);
                 if (type_c && strstr(type_c, "uya_slice_")) {
                     gen_expr(codegen, array);
-                    fputs(".len", codegen->output);
+                    emitter_lit(codegen->output, ".len");
                     break;
                 }
             }
@@ -1089,7 +1101,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 
                 // 检查局部变量
                 for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-                    if (strcmp(codegen->local_variables[i].name, var_name) == 0) {
+                    if (INTERN_STR_EQ(codegen->local_variables[i].name, var_name)) {
                         const char *type_c = codegen->local_variables[i].type_c;
                         if (type_c) {
                             // 从类型字符串中提取数组大小，格式如 "int32_t[3]"
@@ -1105,7 +1117,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                                         num_buf[len] = '\0';
                                         array_size = atoi(num_buf);
                                         if (array_size > 0) {
-                                            fprintf(codegen->output, "%d", array_size);
+                                            emitter_int(codegen->output, array_size);
                                             found = 1;
                                             break;
                                         }
@@ -1125,11 +1137,11 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             
             // 备用方案：使用 sizeof 计算（适用于非参数数组）
             // 注意：这只适用于栈分配的数组，不适用于函数参数
-            fputs("sizeof(", codegen->output);
+            emitter_lit(codegen->output, "sizeof(");
             gen_expr(codegen, array);
-            fputs(") / sizeof((", codegen->output);
+            emitter_lit(codegen->output, ") / sizeof((");
             gen_expr(codegen, array);
-            fputs(")[0])", codegen->output);
+            emitter_lit(codegen->output, ")[0])");
             break;
         }
         case AST_ALIGNOF: {
@@ -1158,7 +1170,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                             // 对于变量名，需要获取变量的类型
                             // 查找局部变量表
                             for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-                                if (strcmp(codegen->local_variables[i].name, safe_name) == 0) {
+                                if (INTERN_STR_EQ(codegen->local_variables[i].name, safe_name)) {
                                     type_c = codegen->local_variables[i].type_c;
                                     break;
                                 }
@@ -1167,7 +1179,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                             // 如果局部变量表中找不到，查找全局变量表
                             if (!type_c) {
                                 for (int i = 0; i < codegen->global_variable_count; i++) {
-                                    if (strcmp(codegen->global_variables[i].name, safe_name) == 0) {
+                                    if (INTERN_STR_EQ(codegen->global_variables[i].name, safe_name)) {
                                         type_c = codegen->global_variables[i].type_c;
                                         break;
                                     }
@@ -1187,9 +1199,9 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     // 对于复杂表达式，我们需要使用 typeof，但 C99 不支持
                     // 所以这里我们尝试使用变量的类型
                     // 如果失败，将生成错误的代码，但这是 C99 的限制
-                    fputs("uya_alignof(", codegen->output);
+                    emitter_lit(codegen->output, "uya_alignof(");
                     gen_expr(codegen, target);
-                    fputc(')', codegen->output);
+                    emitter_putc(codegen->output, ')');
                     break;
                 }
             }
@@ -1200,7 +1212,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             
             /* void 类型不能用于 uya_alignof 宏（struct { char c; void t; } 非法），直接输出 1 */
             if (strcmp(type_c, "void") == 0) {
-                fputs("1", codegen->output);
+                emitter_lit(codegen->output, "1");
                 break;
             }
             
@@ -1215,25 +1227,25 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     elem_type[elem_len] = '\0';
                     // 移除可能的 const 限定符（如果存在）
                     if (strncmp(elem_type, "const ", 6) == 0) {
-                        fputs("uya_alignof(", codegen->output);
-                        fprintf(codegen->output, "%s", elem_type + 6);
-                        fputc(')', codegen->output);
+                        emitter_lit(codegen->output, "uya_alignof(");
+                        emitter_puts(codegen->output, elem_type + 6);
+                        emitter_putc(codegen->output, ')');
                     } else {
-                        fputs("uya_alignof(", codegen->output);
-                        fprintf(codegen->output, "%s", elem_type);
-                        fputc(')', codegen->output);
+                        emitter_lit(codegen->output, "uya_alignof(");
+                        emitter_puts(codegen->output, elem_type);
+                        emitter_putc(codegen->output, ')');
                     }
                 } else {
                     // 分配失败，回退到原始类型（会失败，但至少不会崩溃）
-                    fputs("uya_alignof(", codegen->output);
-                    fprintf(codegen->output, "%s", type_c);
-                    fputc(')', codegen->output);
+                    emitter_lit(codegen->output, "uya_alignof(");
+                    emitter_puts(codegen->output, type_c);
+                    emitter_putc(codegen->output, ')');
                 }
             } else {
                 // 非数组类型：直接使用
-                fputs("uya_alignof(", codegen->output);
-                fprintf(codegen->output, "%s", type_c);
-                fputc(')', codegen->output);
+                emitter_lit(codegen->output, "uya_alignof(");
+                emitter_puts(codegen->output, type_c);
+                emitter_putc(codegen->output, ')');
             }
             break;
         }
@@ -1250,35 +1262,42 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 const char *union_c = c99_type_to_c(codegen, &tmp);
                 int is_void = (target_type->type == AST_TYPE_NAMED && target_type->data.type_named.name &&
                     strcmp(target_type->data.type_named.name, "void") == 0);
-                fprintf(codegen->output, "({ %s _uya_asbang = { .error_id = 0", union_c);
+                if (c99_error_union_is_niche(union_c)) {
+                    /* 紧凑布局的 !&T：error_id 与 value 共用存储，只初始化 value */
+                    emitter_printf(codegen->output, "({ %s _uya_asbang = { .value = (%s)(", union_c, type_c);
+                    gen_expr(codegen, src_expr);
+                    emitter_lit(codegen->output, ") }; _uya_asbang; })");
+                    break;
+                }
+                emitter_printf(codegen->output, "({ %s _uya_asbang = { .error_id = 0", union_c);
                 if (!is_void) {
-                    fprintf(codegen->output, ", .value = (%s)(", type_c);
+                    emitter_printf(codegen->output, ", .value = (%s)(", type_c);
                     gen_expr(codegen, src_expr);
-                    fputs(") }; _uya_asbang; })", codegen->output);
+                    emitter_lit(codegen->output, ") }; _uya_asbang; })");
                 } else {
-                    fputs(" }; ", codegen->output);
+                    emitter_lit(codegen->output, " }; ");
                     gen_expr(codegen, src_expr);
-                    fputs("; _uya_asbang; })", codegen->output);
+                    emitter_lit(codegen->output, "; _uya_asbang; })");
                 }
                 break;
             }
-            fputc('(', codegen->output);
-            fprintf(codegen->output, "%s)", type_c);
+            emitter_putc(codegen->output, '(');
+            emitter_printf(codegen->output, "%s)", type_c);
             gen_expr(codegen, src_expr);
             break;
         }
         case AST_IDENTIFIER: {
             const char *name = expr->data.identifier.name;
             if (name && strcmp(name, "null") == 0) {
-                fputs("NULL", codegen->output);
+                emitter_lit(codegen->output, "NULL");
             } else {
                 const char *safe_name = get_safe_c_identifier(codegen, name);
-                const char *type_c = get_identifier_type_c(codegen, name);
+                const char *type_c = get_identifier_type_c(codegen, expr);
                 // 如果是原子类型，生成原子 load
                 if (type_c && strstr(type_c, "_Atomic") != NULL) {
-                    fprintf(codegen->output, "__atomic_load_n(&%s, __ATOMIC_SEQ_CST)", safe_name);
+                    emitter_printf(codegen->output, "__atomic_load_n(&%s, __ATOMIC_SEQ_CST)", safe_name);
                 } else {
-                    fprintf(codegen->output, "%s", safe_name);
+                    emitter_puts(codegen->output, safe_name);
                 }
             }
             break;
@@ -1286,14 +1305,14 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
         case AST_ERROR_VALUE: {
             unsigned id = expr->data.error_value.name ? get_or_add_error_id(codegen, expr->data.error_value.name) : 0;
             if (id == 0) id = 1;
-            fprintf(codegen->output, "%uU", id);
+            emitter_printf(codegen->output, "%uU", id);
             break;
         }
         case AST_TRY_EXPR: {
             ASTNode *operand = expr->data.try_expr.operand;
             ASTNode *ret_type = codegen->current_function_return_type;
             if (!operand) {
-                fputs("0", codegen->output);
+                emitter_lit(codegen->output, "0");
                 break;
             }
             /* 操作数类型（如 !f32），可能与函数返回类型（如 !i32）不同 */
@@ -1303,19 +1322,25 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 /* 回退：操作数非 !T 或不在 !T 函数内 */
                 if (ret_type && ret_type->type == AST_TYPE_ERROR_UNION) {
                     const char *union_c = c99_type_to_c(codegen, ret_type);
-                    fprintf(codegen->output, "({ %s _uya_try_tmp = ", union_c);
+                    emitter_printf(codegen->output, "({ %s _uya_try_tmp = ", union_c);
                     gen_expr(codegen, operand);
-                    fprintf(codegen->output, "; if (_uya_try_tmp.error_id != 0) return _uya_try_tmp; _uya_try_tmp.value; })");
+                    emitter_lit(codegen->output, "; if (");
+                    c99_emit_error_test(codegen, union_c, "_uya_try_tmp");
+                    emitter_lit(codegen->output, ") return _uya_try_tmp; _uya_try_tmp.value; })");
                 } else {
-                    fputs("0", codegen->output);
+                    emitter_lit(codegen->output, "0");
                 }
                 break;
             }
             const char *ret_union_c = c99_type_to_c(codegen, ret_type);
-            fprintf(codegen->output, "({ %s _uya_try_tmp = ", operand_union_c);
+            emitter_printf(codegen->output, "({ %s _uya_try_tmp = ", operand_union_c);
             gen_expr(codegen, operand);
             /* 错误传播时需转换为函数返回类型 */
-            fprintf(codegen->output, "; if (_uya_try_tmp.error_id != 0) return (%s){ .error_id = _uya_try_tmp.error_id, .value = 0 }; _uya_try_tmp.value; })", ret_union_c);
+            emitter_lit(codegen->output, "; if (");
+            c99_emit_error_test(codegen, operand_union_c, "_uya_try_tmp");
+            /* 只初始化 error_id，value 按 C 的规则零初始化（结构体、数组等 payload 也适用）；
+               紧凑布局的 !&T 中 value 与 error_id 共用存储，同样不能再初始化 value */
+            emitter_printf(codegen->output, ") return (%s){ .error_id = _uya_try_tmp.error_id }; _uya_try_tmp.value; })", ret_union_c);
             break;
         }
         case AST_AWAIT_EXPR: {
@@ -1326,7 +1351,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             if (operand) {
                 gen_expr(codegen, operand);
             } else {
-                fputs("0", codegen->output);
+                emitter_lit(codegen->output, "0");
             }
             break;
         }
@@ -1336,7 +1361,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             const char *err_name = expr->data.catch_expr.err_name;
             ASTNode *ret_type = codegen->current_function_return_type;
             if (!operand || !block) {
-                fputs("0", codegen->output);
+                emitter_lit(codegen->output, "0");
                 break;
             }
             /* 操作数类型（如 !f32）可能与函数返回类型（如 !i32）不同 */
@@ -1347,10 +1372,23 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             if (operand_is_err_union) {
                 /* 使用操作数的 !T 类型及 payload 类型 */
                 union_c = operand_union_c;
-                /* 从操作数推断 payload：as! T 的 payload 为 T */
-                if (operand->type == AST_CAST_EXPR && operand->data.cast_expr.is_force_cast &&
+                /* 优先使用检查器推断的 catch 表达式类型（即 payload）；否则 as! T 的 payload 为 T */
+                const char *resolved_payload_c = get_resolved_c_type_of_expr(codegen, expr);
+                ASTNode *callee_fn = NULL;
+                if (operand->type == AST_CALL_EXPR && operand->data.call_expr.callee &&
+                    operand->data.call_expr.callee->type == AST_IDENTIFIER) {
+                    callee_fn = find_function_decl_c99(codegen, operand->data.call_expr.callee->data.identifier.name);
+                }
+                if (resolved_payload_c) {
+                    payload_c = resolved_payload_c;
+                } else if (operand->type == AST_CAST_EXPR && operand->data.cast_expr.is_force_cast &&
                     operand->data.cast_expr.target_type) {
                     payload_c = c99_type_to_c(codegen, operand->data.cast_expr.target_type);
+                } else if (callee_fn && callee_fn->data.fn_decl.type_param_count == 0 && callee_fn->data.fn_decl.return_type &&
+                    callee_fn->data.fn_decl.return_type->type == AST_TYPE_ERROR_UNION &&
+                    callee_fn->data.fn_decl.return_type->data.type_error_union.payload_type) {
+                    /* 调用非泛型函数：payload 为其返回类型 !T 的 T */
+                    payload_c = c99_type_to_c(codegen, callee_fn->data.fn_decl.return_type->data.type_error_union.payload_type);
                 } else if (ret_type && ret_type->type == AST_TYPE_ERROR_UNION &&
                     ret_type->data.type_error_union.payload_type) {
                     payload_c = c99_type_to_c(codegen, ret_type->data.type_error_union.payload_type);
@@ -1369,7 +1407,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 ASTNode *payload_node = ret_type->data.type_error_union.payload_type;
                 payload_c = payload_node ? c99_type_to_c(codegen, payload_node) : "void";
             } else {
-                fputs("0", codegen->output);
+                emitter_lit(codegen->output, "0");
                 break;
             }
             int n = block->data.block.stmt_count;
@@ -1377,26 +1415,28 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             int is_void_payload = (payload_c && strcmp(payload_c, "void") == 0);
             if (is_void_payload) {
                 // !void 类型：不需要声明结果变量
-                fprintf(codegen->output, "({ %s _uya_catch_tmp = ", union_c);
+                emitter_printf(codegen->output, "({ %s _uya_catch_tmp = ", union_c);
             } else {
-                fprintf(codegen->output, "({ %s _uya_catch_result; %s _uya_catch_tmp = ", payload_c, union_c);
+                emitter_printf(codegen->output, "({ %s _uya_catch_result; %s _uya_catch_tmp = ", payload_c, union_c);
             }
             gen_expr(codegen, operand);
-            fputs("; if (_uya_catch_tmp.error_id != 0) {\n", codegen->output);
+            emitter_lit(codegen->output, "; if (");
+            c99_emit_error_test(codegen, union_c, "_uya_catch_tmp");
+            emitter_lit(codegen->output, ") {\n");
             codegen->indent_level++;
             if (err_name) {
                 const char *safe = get_safe_c_identifier(codegen, err_name);
                 c99_emit_indent(codegen);
-                fprintf(codegen->output, "%s %s = _uya_catch_tmp;\n", union_c, safe);
+                emitter_printf(codegen->output, "%s %s = _uya_catch_tmp;\n", union_c, safe);
             }
             for (int i = 0; i < n; i++) {
                 ASTNode *s = block->data.block.stmts[i];
                 if (!s) continue;
                 if (i == n - 1 && last_stmt && last_stmt->type != AST_RETURN_STMT && !is_void_payload) {
                     c99_emit_indent(codegen);
-                    fputs("_uya_catch_result = (", codegen->output);
+                    emitter_lit(codegen->output, "_uya_catch_result = (");
                     gen_expr(codegen, last_stmt);
-                    fputs(");\n", codegen->output);
+                    emitter_lit(codegen->output, ");\n");
                 } else {
                     gen_stmt(codegen, s);
                 }
@@ -1404,9 +1444,9 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             codegen->indent_level--;
             c99_emit_indent(codegen);
             if (is_void_payload) {
-                fputs("} else { /* void payload */ } 0; })", codegen->output);
+                emitter_lit(codegen->output, "} else { /* void payload */ } 0; })");
             } else {
-                fputs("} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; })", codegen->output);
+                emitter_lit(codegen->output, "} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; })");
             }
             break;
         }
@@ -1422,34 +1462,34 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 if (strcmp(callee_name, "printf") == 0 && arg_count == 1 && args[0] && args[0]->type == AST_STRING_INTERP) {
                     ASTNode *interp = args[0];
                     const char *safe = get_safe_c_identifier(codegen, "printf");
-                    fprintf(codegen->output, "%s(", safe);
+                    emitter_printf(codegen->output, "%s(", safe);
                     emit_printf_fmt_inline(codegen, interp);
                     int n = interp->data.string_interp.segment_count;
                     for (int i = 0; i < n; i++) {
                         ASTStringInterpSegment *seg = &interp->data.string_interp.segments[i];
                         if (!seg->is_text && seg->expr) {
-                            fputs(", ", codegen->output);
+                            emitter_lit(codegen->output, ", ");
                             gen_expr(codegen, seg->expr);
                         }
                     }
-                    fputc(')', codegen->output);
+                    emitter_putc(codegen->output, ')');
                     break;
                 } else if (strcmp(callee_name, "fprintf") == 0 && arg_count == 2 && args[1] && args[1]->type == AST_STRING_INTERP) {
                     ASTNode *interp = args[1];
                     const char *safe = get_safe_c_identifier(codegen, "fprintf");
-                    fprintf(codegen->output, "%s(", safe);
+                    emitter_printf(codegen->output, "%s(", safe);
                     gen_expr(codegen, args[0]);
-                    fputs(", ", codegen->output);
+                    emitter_lit(codegen->output, ", ");
                     emit_printf_fmt_inline(codegen, interp);
                     int n = interp->data.string_interp.segment_count;
                     for (int i = 0; i < n; i++) {
                         ASTStringInterpSegment *seg = &interp->data.string_interp.segments[i];
                         if (!seg->is_text && seg->expr) {
-                            fputs(", ", codegen->output);
+                            emitter_lit(codegen->output, ", ");
                             gen_expr(codegen, seg->expr);
                         }
                     }
-                    fputc(')', codegen->output);
+                    emitter_putc(codegen->output, ')');
                     break;
                 }
             }
@@ -1468,7 +1508,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 if (!temp_name) continue;
                 codegen->interp_arg_temp_names[i] = temp_name;
                 c99_emit_indent(codegen);
-                fprintf(codegen->output, "char %s[%d];\n", temp_name, size);
+                emitter_printf(codegen->output, "char %s[%d];\n", temp_name, size);
                 c99_emit_string_interp_fill(codegen, args[i], temp_name);
             }
             
@@ -1476,18 +1516,18 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             if (callee && callee->type == AST_MEMBER_ACCESS && callee->data.member_access.is_module_access) {
                 const char *func_name = get_safe_c_identifier(codegen, callee->data.member_access.field_name);
                 callee_name = callee->data.member_access.field_name;
-                fprintf(codegen->output, "%s(", func_name);
+                emitter_printf(codegen->output, "%s(", func_name);
                 for (int i = 0; i < arg_count; i++) {
-                    if (i > 0) fputs(", ", codegen->output);
+                    if (i > 0) emitter_lit(codegen->output, ", ");
                     if (codegen->interp_arg_temp_names[i]) {
-                        fputs("(uint8_t *)", codegen->output);
-                        fputs(codegen->interp_arg_temp_names[i], codegen->output);
+                        emitter_lit(codegen->output, "(uint8_t *)");
+                        emitter_puts(codegen->output, codegen->interp_arg_temp_names[i]);
                     } else {
-                        if (args[i] && args[i]->type == AST_STRING) fputs("(uint8_t *)", codegen->output);
+                        if (args[i] && args[i]->type == AST_STRING) emitter_lit(codegen->output, "(uint8_t *)");
                         gen_expr(codegen, args[i]);
                     }
                 }
-                fputc(')', codegen->output);
+                emitter_putc(codegen->output, ')');
                 break;
             }
             
@@ -1504,13 +1544,13 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                             const char *vname = get_safe_c_identifier(codegen, method_name);
                             if (uname && vname) {
                                 if (union_decl->data.union_decl.is_extern) {
-                                    fprintf(codegen->output, "((union %s){ .%s = (", uname, vname);
+                                    emitter_printf(codegen->output, "((union %s){ .%s = (", uname, vname);
                                     gen_expr(codegen, args[0]);
-                                    fputs(") })", codegen->output);
+                                    emitter_lit(codegen->output, ") })");
                                 } else {
-                                    fprintf(codegen->output, "((struct uya_tagged_%s){ ._tag = %d, .u = (union %s){ .%s = (", uname, idx, uname, vname);
+                                    emitter_printf(codegen->output, "((struct uya_tagged_%s){ ._tag = %d, .u = (union %s){ .%s = (", uname, idx, uname, vname);
                                     gen_expr(codegen, args[0]);
-                                    fputs(") } })", codegen->output);
+                                    emitter_lit(codegen->output, ") } })");
                                 }
                                 break;
                             }
@@ -1522,27 +1562,43 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                     const char *p = strstr(obj_type_c, "uya_interface_");
                     if (p) {
                         p += 14;  /* skip "uya_interface_" to get interface name */
-                        const char *safe_method = get_safe_c_identifier(codegen, method_name);
-                        fprintf(codegen->output, "((struct uya_vtable_%s *)(", p);
-                        gen_expr(codegen, obj);
-                        fprintf(codegen->output, ").vtable)->%s((", safe_method);
-                        gen_expr(codegen, obj);
-                        fputs(").data", codegen->output);
+                        /* 去虚化：接口形参的具体结构体已知时直接调用 uya_S_method((struct S *)obj.data, ...) */
+                        const char *devirt_struct = (obj->type == AST_IDENTIFIER)
+                            ? c99_devirt_param_struct(codegen, obj->data.identifier.name) : NULL;
+                        ASTNode *devirt_method = devirt_struct ? find_method_in_struct_c99(codegen, devirt_struct, method_name) : NULL;
+                        const char *devirt_cname = NULL;
+                        if (devirt_method && devirt_method->data.fn_decl.param_count > 0 &&
+                            devirt_method->data.fn_decl.params[0]->data.var_decl.type &&
+                            devirt_method->data.fn_decl.params[0]->data.var_decl.type->type == AST_TYPE_POINTER) {
+                            devirt_cname = get_method_c_name(codegen, devirt_struct, method_name);
+                        }
+                        if (devirt_cname) {
+                            emitter_printf(codegen->output, "%s((struct %s *)(", devirt_cname, get_safe_c_identifier(codegen, devirt_struct));
+                            gen_expr(codegen, obj);
+                            emitter_lit(codegen->output, ").data");
+                        } else {
+                            const char *safe_method = get_safe_c_identifier(codegen, method_name);
+                            emitter_printf(codegen->output, "((struct uya_vtable_%s *)(", p);
+                            gen_expr(codegen, obj);
+                            emitter_printf(codegen->output, ").vtable)->%s((", safe_method);
+                            gen_expr(codegen, obj);
+                            emitter_lit(codegen->output, ").data");
+                        }
                         for (int i = 0; i < arg_count; i++) {
-                            fputs(", ", codegen->output);
+                            emitter_lit(codegen->output, ", ");
                             if (codegen->interp_arg_temp_names[i]) {
-                                fputs("(uint8_t *)", codegen->output);
-                                fputs(codegen->interp_arg_temp_names[i], codegen->output);
+                                emitter_lit(codegen->output, "(uint8_t *)");
+                                emitter_puts(codegen->output, codegen->interp_arg_temp_names[i]);
                             } else {
                                 if (args[i] && args[i]->type == AST_STRING) {
                                     // 检查是否是标准库函数，如果是则使用 (const char *) 而不是 (uint8_t *)
                                     int is_stdlib = is_stdlib_function_for_string_arg(callee_name);
-                                    fputs(is_stdlib ? "(const char *)" : "(uint8_t *)", codegen->output);
+                                    emitter_puts(codegen->output, is_stdlib ? "(const char *)" : "(uint8_t *)");
                                 }
                                 gen_expr(codegen, args[i]);
                             }
                         }
-                        fputc(')', codegen->output);
+                        emitter_putc(codegen->output, ')');
                         break;
                     }
                 }
@@ -1572,20 +1628,20 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                                     const char *cname = get_method_c_name(codegen, union_decl->data.union_decl.name, method_name);
                                     if (cname) {
                                         int is_ptr = (strchr(obj_type_c, '*') != NULL);
-                                        fprintf(codegen->output, "%s(%s(", cname, is_ptr ? "" : "&");
+                                        emitter_printf(codegen->output, "%s(%s(", cname, is_ptr ? "" : "&");
                                         gen_expr(codegen, obj);
-                                        fputs(")", codegen->output);
+                                        emitter_lit(codegen->output, ")");
                                         for (int i = 0; i < arg_count; i++) {
-                                            fputs(", ", codegen->output);
+                                            emitter_lit(codegen->output, ", ");
                                             if (codegen->interp_arg_temp_names[i]) {
-                                                fputs("(uint8_t *)", codegen->output);
-                                                fputs(codegen->interp_arg_temp_names[i], codegen->output);
+                                                emitter_lit(codegen->output, "(uint8_t *)");
+                                                emitter_puts(codegen->output, codegen->interp_arg_temp_names[i]);
                                             } else {
-                                                if (args[i] && args[i]->type == AST_STRING) fputs("(uint8_t *)", codegen->output);
+                                                if (args[i] && args[i]->type == AST_STRING) emitter_lit(codegen->output, "(uint8_t *)");
                                                 gen_expr(codegen, args[i]);
                                             }
                                         }
-                                        fputc(')', codegen->output);
+                                        emitter_putc(codegen->output, ')');
                                         break;
                                     }
                                 }
@@ -1596,20 +1652,20 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                                     const char *cname = get_method_c_name(codegen, type_name_buf, method_name);
                                     if (cname) {
                                         int is_ptr = (strchr(obj_type_c, '*') != NULL);
-                                        fprintf(codegen->output, "%s(%s(", cname, is_ptr ? "" : "&");
+                                        emitter_printf(codegen->output, "%s(%s(", cname, is_ptr ? "" : "&");
                                         gen_expr(codegen, obj);
-                                        fputs(")", codegen->output);
+                                        emitter_lit(codegen->output, ")");
                                         for (int i = 0; i < arg_count; i++) {
-                                            fputs(", ", codegen->output);
+                                            emitter_lit(codegen->output, ", ");
                                             if (codegen->interp_arg_temp_names[i]) {
-                                                fputs("(uint8_t *)", codegen->output);
-                                                fputs(codegen->interp_arg_temp_names[i], codegen->output);
+                                                emitter_lit(codegen->output, "(uint8_t *)");
+                                                emitter_puts(codegen->output, codegen->interp_arg_temp_names[i]);
                                             } else {
-                                                if (args[i] && args[i]->type == AST_STRING) fputs("(uint8_t *)", codegen->output);
+                                                if (args[i] && args[i]->type == AST_STRING) emitter_lit(codegen->output, "(uint8_t *)");
                                                 gen_expr(codegen, args[i]);
                                             }
                                         }
-                                        fputc(')', codegen->output);
+                                        emitter_putc(codegen->output, ')');
                                         break;
                                     }
                                 }
@@ -1639,21 +1695,21 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 if (vname && last_param) {
                     const char *last_safe = get_safe_c_identifier(codegen, last_param);
                     /* GCC statement expression: ({ ...; expr }) 的值是最后的 expr */
-                    fprintf(codegen->output, "((void)0, ({\n");
+                    emitter_lit(codegen->output, "((void)0, ({\n");
                     codegen->indent_level++;
                     c99_emit(codegen, "va_list uya_va;\n");
                     c99_emit(codegen, "va_start(uya_va, %s);\n", last_safe);
-                    fprintf(codegen->output, "%*sint32_t _uya_ret = %s(", codegen->indent_level * 4, "", vname);
+                    emitter_printf(codegen->output, "%*sint32_t _uya_ret = %s(", codegen->indent_level * 4, "", vname);
                     for (int i = 0; i < arg_count; i++) {
-                        if (i > 0) fputs(", ", codegen->output);
+                        if (i > 0) emitter_lit(codegen->output, ", ");
                         if (args[i] && args[i]->type == AST_STRING) {
                             // 检查是否是标准库函数，如果是则使用 (const char *) 而不是 (uint8_t *)
                             int is_stdlib = is_stdlib_function_for_string_arg(callee_name);
-                            fputs(is_stdlib ? "(const char *)" : "(uint8_t *)", codegen->output);
+                            emitter_puts(codegen->output, is_stdlib ? "(const char *)" : "(uint8_t *)");
                         }
                         gen_expr(codegen, args[i]);
                     }
-                    fputs(", uya_va);\n", codegen->output);
+                    emitter_lit(codegen->output, ", uya_va);\n");
                     c99_emit(codegen, "va_end(uya_va);\n");
                     c99_emit(codegen, "_uya_ret;\n");  /* 语句表达式的值 */
                     codegen->indent_level--;
@@ -1677,22 +1733,22 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 }
                 
                 const char *safe_name = get_safe_c_identifier(codegen, output_name);
-                fprintf(codegen->output, "%s(", safe_name);
+                emitter_printf(codegen->output, "%s(", safe_name);
                 if (printf_one_fmt) {
-                    fputs("\"%s\", ", codegen->output);  /* 单参数 printf 用字面量格式避免 -Wformat-security */
+                    emitter_lit(codegen->output, "\"%s\", ");  /* 单参数 printf 用字面量格式避免 -Wformat-security */
                 }
             } else {
-                fputs("unknown(", codegen->output);
+                emitter_lit(codegen->output, "unknown(");
             }
             
             // 生成参数
             for (int i = 0; i < arg_count; i++) {
-                if (i > 0) fputs(", ", codegen->output);
+                if (i > 0) emitter_lit(codegen->output, ", ");
                 if (codegen->interp_arg_temp_names[i]) {
                     // 检查是否是标准库函数，如果是则使用 (const char *) 而不是 (uint8_t *)
                     int is_stdlib = is_stdlib_function_for_string_arg(callee_name);
-                    fputs(is_stdlib ? "(const char *)" : "(uint8_t *)", codegen->output);
-                    fputs(codegen->interp_arg_temp_names[i], codegen->output);
+                    emitter_puts(codegen->output, is_stdlib ? "(const char *)" : "(uint8_t *)");
+                    emitter_puts(codegen->output, codegen->interp_arg_temp_names[i]);
                     continue;
                 }
                 // 检查参数是否是字符串常量或 *byte 类型，如果是则添加类型转换以消除 const 警告
@@ -1701,7 +1757,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 int is_byte_ptr_arg = 0;
                 if (args[i] && args[i]->type == AST_IDENTIFIER) {
                     const char *arg_name = args[i]->data.identifier.name;
-                    const char *arg_type_c = get_identifier_type_c(codegen, arg_name);
+                    const char *arg_type_c = get_identifier_type_c(codegen, args[i]);
                     if (arg_type_c && strcmp(arg_type_c, "uint8_t *") == 0) {
                         is_byte_ptr_arg = 1;
                     } else if (!arg_type_c) {
@@ -1721,7 +1777,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 if (is_string_arg || is_byte_ptr_arg) {
                     // 检查是否是标准库函数，如果是则使用 (const char *) 而不是 (uint8_t *)
                     int is_stdlib = is_stdlib_function_for_string_arg(callee_name);
-                    fputs(is_stdlib ? "(const char *)" : "(uint8_t *)", codegen->output);
+                    emitter_puts(codegen->output, is_stdlib ? "(const char *)" : "(uint8_t *)");
                 }
                 
                 // 检查是否是大结构体参数且函数期望指针
@@ -1747,7 +1803,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 }
                 
                 if (need_address) {
-                    fputc('&', codegen->output);
+                    emitter_putc(codegen->output, '&');
                 }
                 /* 装箱：当形参是接口类型且实参是实现了该接口的结构体时，生成 vtable+data */
                 if (fn_decl && fn_decl->type == AST_FN_DECL && i < fn_decl->data.fn_decl.param_count) {
@@ -1759,7 +1815,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                         if (iface && args[i]) {
                             const char *struct_name_for_check = NULL;
                             if (args[i]->type == AST_IDENTIFIER) {
-                                const char *arg_type_c = get_identifier_type_c(codegen, args[i]->data.identifier.name);
+                                const char *arg_type_c = get_identifier_type_c(codegen, args[i]);
                                 if (arg_type_c) {
                                     /* 去掉可选的 "const " 前缀 */
                                     if (strncmp(arg_type_c, "const ", 6) == 0) arg_type_c += 6;
@@ -1788,10 +1844,10 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                             if (struct_name_for_check) {
                                     const char *safe_iface = get_safe_c_identifier(codegen, param_type_name);
                                     const char *safe_struct = get_safe_c_identifier(codegen, struct_name_for_check);
-                                    fprintf(codegen->output, "(struct uya_interface_%s){ .vtable = (void*)&uya_vtable_%s_%s, .data = (void*)&(",
+                                    emitter_printf(codegen->output, "(struct uya_interface_%s){ .vtable = (void*)&uya_vtable_%s_%s, .data = (void*)&(",
                                             safe_iface, safe_iface, safe_struct);
                                     gen_expr(codegen, args[i]);
-                                    fputs(") }", codegen->output);
+                                    emitter_lit(codegen->output, ") }");
                                     continue;
                             }
                         }
@@ -1799,7 +1855,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 }
                 gen_expr(codegen, args[i]);
             }
-            fputc(')', codegen->output);
+            emitter_putc(codegen->output, ')');
             break;
         }
         case AST_ASSIGN: {
@@ -1807,15 +1863,15 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             ASTNode *dest = expr->data.assign.dest;
             ASTNode *src = expr->data.assign.src;
             
-            fputc('(', codegen->output);
+            emitter_putc(codegen->output, '(');
             if (dest->type == AST_UNDERSCORE) {
                 gen_expr(codegen, src);
             } else {
                 gen_expr(codegen, dest);
-                fputs(" = ", codegen->output);
+                emitter_lit(codegen->output, " = ");
                 gen_expr(codegen, src);
             }
-            fputc(')', codegen->output);
+            emitter_putc(codegen->output, ')');
             break;
         }
         case AST_MATCH_EXPR: {
@@ -1828,11 +1884,30 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 const char *t = get_c_type_of_expr(codegen, expr->data.match_expr.arms[0].result_expr);
                 if (t) res_type = t;
             }
-            fputs("({ ", codegen->output);
-            fprintf(codegen->output, "%s _uya_m = ", m_type);
+            emitter_lit(codegen->output, "({ ");
+            emitter_printf(codegen->output, "%s _uya_m = ", m_type);
             gen_expr(codegen, match_expr);
-            fputs("; ", codegen->output);
-            fprintf(codegen->output, "%s _uya_r; ", res_type);
+            emitter_lit(codegen->output, "; ");
+            emitter_printf(codegen->output, "%s _uya_r; ", res_type);
+            C99MatchPlan plan;
+            if (c99_plan_match_switch(codegen, expr, m_type, &plan)) {
+                /* 常量/枚举/联合体标签/错误码模式：switch 分派 */
+                emitter_printf(codegen->output, "switch (%s) { ", c99_match_subject_expr(&plan));
+                for (int c = 0; c < plan.case_count; c++) {
+                    char label[64];
+                    c99_format_match_case_label(&plan.cases[c], label, sizeof(label));
+                    emitter_puts(codegen->output, label);
+                    gen_match_arm_result(codegen, &expr->data.match_expr.arms[plan.cases[c].arm], m_type);
+                    emitter_lit(codegen->output, "break; ");
+                }
+                if (plan.default_arm >= 0) {
+                    emitter_lit(codegen->output, "default: ");
+                    gen_match_arm_result(codegen, &expr->data.match_expr.arms[plan.default_arm], m_type);
+                    emitter_lit(codegen->output, "break; ");
+                }
+                emitter_lit(codegen->output, "} _uya_r; })");
+                break;
+            }
             int first = 1;
             for (int i = 0; i < expr->data.match_expr.arm_count; i++) {
                 ASTMatchArm *arm = &expr->data.match_expr.arms[i];
@@ -1840,38 +1915,28 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 first = 0;
                 if (arm->kind == MATCH_PAT_LITERAL && arm->data.literal.expr) {
                     if (arm->data.literal.expr->type == AST_NUMBER) {
-                        fprintf(codegen->output, "%sif (_uya_m == %d) _uya_r = ", prefix, arm->data.literal.expr->data.number.value);
+                        emitter_printf(codegen->output, "%sif (_uya_m == %d) ", prefix, arm->data.literal.expr->data.number.value);
                     } else if (arm->data.literal.expr->type == AST_BOOL) {
-                        fprintf(codegen->output, "%sif (_uya_m == %s) _uya_r = ", prefix, arm->data.literal.expr->data.bool_literal.value ? "1" : "0");
+                        emitter_printf(codegen->output, "%sif (_uya_m == %s) ", prefix, arm->data.literal.expr->data.bool_literal.value ? "1" : "0");
                     }
-                    gen_expr(codegen, arm->result_expr);
-                    fputs("; ", codegen->output);
+                    gen_match_arm_result(codegen, arm, m_type);
                 } else if (arm->kind == MATCH_PAT_ENUM) {
                     ASTNode *enum_decl = find_enum_decl_c99(codegen, arm->data.enum_pat.enum_name);
                     int ev = enum_decl ? find_enum_variant_value(codegen, enum_decl, arm->data.enum_pat.variant_name) : -1;
                     if (ev >= 0) {
-                        fprintf(codegen->output, "%sif (_uya_m == %d) _uya_r = ", prefix, ev);
+                        emitter_printf(codegen->output, "%sif (_uya_m == %d) ", prefix, ev);
                     } else {
-                        fprintf(codegen->output, "%sif (0) _uya_r = ", prefix);  /* 占位 */
+                        emitter_printf(codegen->output, "%sif (0) ", prefix);  /* 占位 */
                     }
-                    gen_expr(codegen, arm->result_expr);
-                    fputs("; ", codegen->output);
-                } else if (arm->kind == MATCH_PAT_BIND) {
-                    const char *v = get_safe_c_identifier(codegen, arm->data.bind.var_name);
-                    if (v) fprintf(codegen->output, "%s{ %s %s = _uya_m; _uya_r = ", prefix, m_type, v);
-                    gen_expr(codegen, arm->result_expr);
-                    if (v) fputs("; } ", codegen->output);
-                    else fputs("; ", codegen->output);
-                } else if (arm->kind == MATCH_PAT_WILDCARD || arm->kind == MATCH_PAT_ELSE) {
-                    fprintf(codegen->output, "%s{ _uya_r = ", prefix);
-                    gen_expr(codegen, arm->result_expr);
-                    fputs("; } ", codegen->output);
+                    gen_match_arm_result(codegen, arm, m_type);
+                } else if (arm->kind == MATCH_PAT_BIND || arm->kind == MATCH_PAT_WILDCARD || arm->kind == MATCH_PAT_ELSE) {
+                    emitter_puts(codegen->output, prefix);
+                    gen_match_arm_result(codegen, arm, m_type);
                 } else if (arm->kind == MATCH_PAT_ERROR) {
                     unsigned id = arm->data.error_pat.error_name ? get_or_add_error_id(codegen, arm->data.error_pat.error_name) : 0;
                     if (id == 0) id = 1;
-                    fprintf(codegen->output, "%sif (_uya_m.error_id == %uU) _uya_r = ", prefix, id);
-                    gen_expr(codegen, arm->result_expr);
-                    fputs("; ", codegen->output);
+                    emitter_printf(codegen->output, "%sif (_uya_m.error_id == %uU) ", prefix, id);
+                    gen_match_arm_result(codegen, arm, m_type);
                 } else if (arm->kind == MATCH_PAT_UNION && arm->data.union_pat.variant_name) {
                     ASTNode *union_decl = find_union_decl_by_variant_c99(codegen, arm->data.union_pat.variant_name);
                     if (union_decl) {
@@ -1879,21 +1944,13 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                         const char *uname = get_safe_c_identifier(codegen, union_decl->data.union_decl.name);
                         const char *vname = get_safe_c_identifier(codegen, arm->data.union_pat.variant_name);
                         if (idx >= 0 && uname && vname) {
-                            ASTNode *vnode = union_decl->data.union_decl.variants[idx];
-                            const char *vtype = (vnode && vnode->type == AST_VAR_DECL && vnode->data.var_decl.type) ? c99_type_to_c(codegen, vnode->data.var_decl.type) : "int";
-                            const char *bind = (arm->data.union_pat.var_name && strcmp(arm->data.union_pat.var_name, "_") != 0) ? get_safe_c_identifier(codegen, arm->data.union_pat.var_name) : NULL;
-                            if (bind) {
-                                fprintf(codegen->output, "%sif (_uya_m._tag == %d) { %s %s = _uya_m.u.%s; _uya_r = ", prefix, idx, vtype, bind, vname);
-                            } else {
-                                fprintf(codegen->output, "%sif (_uya_m._tag == %d) _uya_r = ", prefix, idx);
-                            }
-                            gen_expr(codegen, arm->result_expr);
-                            fputs(bind ? "; } " : "; ", codegen->output);
+                            emitter_printf(codegen->output, "%sif (_uya_m._tag == %d) ", prefix, idx);
+                            gen_match_arm_result(codegen, arm, m_type);
                         }
                     }
                 }
             }
-            fputs("_uya_r; })", codegen->output);
+            emitter_lit(codegen->output, "_uya_r; })");
             break;
         }
         case AST_BLOCK: {
@@ -1902,7 +1959,7 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             ASTNode **block_stmts = expr->data.block.stmts;
             int block_count = expr->data.block.stmt_count;
             
-            fputs("({ ", codegen->output);
+            emitter_lit(codegen->output, "({ ");
             
             // 找到最后一个非声明的表达式作为返回值
             int last_expr_idx = -1;
@@ -1926,18 +1983,18 @@ void gen_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 if (i == last_expr_idx) {
                     // 最后一个表达式：直接输出，不加分号
                     gen_expr(codegen, bs);
-                    fputs("; ", codegen->output);
+                    emitter_lit(codegen->output, "; ");
                 } else {
                     // 其他语句：正常输出
                     gen_stmt(codegen, bs);
                 }
             }
             
-            fputs("})", codegen->output);
+            emitter_lit(codegen->output, "})");
             break;
         }
         default:
-            fputs("0", codegen->output);
+            emitter_lit(codegen->output, "0");
             break;
     }
 }
@@ -5,34 +5,14 @@
 
 // 查找结构体对应的方法块
 ASTNode *find_method_block_for_struct_c99(C99CodeGenerator *codegen, const char *struct_name) {
-    if (!codegen || !struct_name || !codegen->program_node) return NULL;
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl || decl->type != AST_METHOD_BLOCK) continue;
-        if (decl->data.method_block.struct_name &&
-            strcmp(decl->data.method_block.struct_name, struct_name) == 0) {
-            return decl;
-        }
-    }
-    return NULL;
+    if (!codegen || !struct_name) return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_STRUCT_METHODS, struct_name);
 }
 
 // 查找联合体对应的方法块
 ASTNode *find_method_block_for_union_c99(C99CodeGenerator *codegen, const char *union_name) {
-    if (!codegen || !union_name || !codegen->program_node) return NULL;
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl || decl->type != AST_METHOD_BLOCK) continue;
-        if (decl->data.method_block.union_name &&
-            strcmp(decl->data.method_block.union_name, union_name) == 0) {
-            return decl;
-        }
-    }
-    return NULL;
+    if (!codegen || !union_name) return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_UNION_METHODS, union_name);
 }
 
 // 在方法块中按名称查找方法
@@ -49,7 +29,8 @@ ASTNode *find_method_in_block(ASTNode *method_block, const char *method_name) {
 }
 
 // 从单态化名称中提取原始泛型名称（如 Container_i32 -> Container）
-static const char *extract_generic_name_from_mono(const char *mono_name) {
+// 结果写入调用者提供的 buf（-jN 下多个线程同时生成函数体，不能使用静态缓冲区）
+static const char *extract_generic_name_from_mono(const char *mono_name, char *buf, size_t buf_size) {
     if (!mono_name) return NULL;
     // 查找最后一个 '_'，之后跟随的是类型参数
     // 例如：Container_i32 -> Container, Pair_i32_i64 -> Pair_i32（需要更复杂的逻辑）
@@ -83,8 +64,7 @@ static const char *extract_generic_name_from_mono(const char *mono_name) {
     if (!is_type) return NULL;
     // 返回下划线前的部分
     size_t len = underscore - mono_name;
-    static char buf[128];
-    if (len >= sizeof(buf)) return NULL;
+    if (len >= buf_size) return NULL;
     memcpy(buf, mono_name, len);
     buf[len] = '\0';
     return buf;
@@ -94,43 +74,14 @@ static const char *extract_generic_name_from_mono(const char *mono_name) {
 // 支持单态化名称：如果 struct_name 是 Container_i32，会尝试查找 Container 的方法
 ASTNode *find_method_in_struct_c99(C99CodeGenerator *codegen, const char *struct_name, const char *method_name) {
     if (!codegen || !struct_name || !method_name) return NULL;
-    // 1. 先检查外部方法块
-    ASTNode *method_block = find_method_block_for_struct_c99(codegen, struct_name);
-    if (method_block) {
-        ASTNode *m = find_method_in_block(method_block, method_name);
-        if (m) return m;
-    }
-    // 2. 再检查结构体内部定义的方法
-    ASTNode *struct_decl = find_struct_decl_c99(codegen, struct_name);
-    if (struct_decl && struct_decl->data.struct_decl.methods) {
-        for (int i = 0; i < struct_decl->data.struct_decl.method_count; i++) {
-            ASTNode *m = struct_decl->data.struct_decl.methods[i];
-            if (m && m->type == AST_FN_DECL && m->data.fn_decl.name &&
-                strcmp(m->data.fn_decl.name, method_name) == 0) {
-                return m;
-            }
-        }
-    }
-    // 3. 如果是单态化名称（如 Container_i32），尝试提取原始名称并查找
-    const char *generic_name = extract_generic_name_from_mono(struct_name);
+    // 1. 外部方法块与结构体内部定义的方法（由全局声明索引按先后顺序解析）
+    ASTNode *m = ast_find_method(codegen->program_node, DECL_KEY_STRUCT_METHOD, struct_name, method_name);
+    if (m) return m;
+    // 2. 如果是单态化名称（如 Container_i32），尝试提取原始名称并查找
+    char generic_buf[128];
+    const char *generic_name = extract_generic_name_from_mono(struct_name, generic_buf, sizeof(generic_buf));
     if (generic_name) {
-        // 检查外部方法块
-        method_block = find_method_block_for_struct_c99(codegen, generic_name);
-        if (method_block) {
-            ASTNode *m = find_method_in_block(method_block, method_name);
-            if (m) return m;
-        }
-        // 检查结构体内部定义的方法
-        struct_decl = find_struct_decl_c99(codegen, generic_name);
-        if (struct_decl && struct_decl->data.struct_decl.methods) {
-            for (int i = 0; i < struct_decl->data.struct_decl.method_count; i++) {
-                ASTNode *m = struct_decl->data.struct_decl.methods[i];
-                if (m && m->type == AST_FN_DECL && m->data.fn_decl.name &&
-                    strcmp(m->data.fn_decl.name, method_name) == 0) {
-                    return m;
-                }
-            }
-        }
+        return ast_find_method(codegen->program_node, DECL_KEY_STRUCT_METHOD, generic_name, method_name);
     }
     return NULL;
 }
@@ -138,22 +89,7 @@ ASTNode *find_method_in_struct_c99(C99CodeGenerator *codegen, const char *struct
 // 查找联合体方法（同时检查外部方法块和内部定义的方法）
 ASTNode *find_method_in_union_c99(C99CodeGenerator *codegen, const char *union_name, const char *method_name) {
     if (!codegen || !union_name || !method_name) return NULL;
-    ASTNode *method_block = find_method_block_for_union_c99(codegen, union_name);
-    if (method_block) {
-        ASTNode *m = find_method_in_block(method_block, method_name);
-        if (m) return m;
-    }
-    ASTNode *union_decl = find_union_decl_c99(codegen, union_name);
-    if (union_decl && union_decl->data.union_decl.methods) {
-        for (int i = 0; i < union_decl->data.union_decl.method_count; i++) {
-            ASTNode *m = union_decl->data.union_decl.methods[i];
-            if (m && m->type == AST_FN_DECL && m->data.fn_decl.name &&
-                strcmp(m->data.fn_decl.name, method_name) == 0) {
-                return m;
-            }
-        }
-    }
-    return NULL;
+    return ast_find_method(codegen->program_node, DECL_KEY_UNION_METHOD, union_name, method_name);
 }
 
 int type_has_drop_c99(C99CodeGenerator *codegen, const char *struct_name) {
@@ -175,29 +111,13 @@ const char *get_method_c_name(C99CodeGenerator *codegen, const char *struct_name
 
 // 查找函数声明
 ASTNode *find_function_decl_c99(C99CodeGenerator *codegen, const char *func_name) {
-    if (!codegen || !func_name || !codegen->program_node) {
+    if (!codegen || !func_name) {
         return NULL;
     }
-    
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl || decl->type != AST_FN_DECL) {
-            continue;
-        }
-        
-        const char *decl_name = decl->data.fn_decl.name;
-        if (decl_name && strcmp(decl_name, func_name) == 0) {
-            return decl;
-        }
-    }
-    
-    return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_FN, func_name);
 }
 
-void format_param_type(C99CodeGenerator *codegen __attribute__((unused)), const char *type_c, const char *param_name, FILE *output) {
+void format_param_type(C99CodeGenerator *codegen __attribute__((unused)), const char *type_c, const char *param_name, Emitter *output) {
     if (!type_c || !param_name) return;
     
     // 检查是否是指向数组的指针类型（格式：T (*)[N]）
@@ -212,7 +132,7 @@ void format_param_type(C99CodeGenerator *codegen __attribute__((unused)), const
             size_t base_len = ptr_bracket - type_c;
             // 提取 [N] 部分
             const char *dims = array_bracket;
-            fprintf(output, "%.*s (*%s)%s", (int)base_len, type_c, param_name, dims);
+            emitter_printf(output, "%.*s (*%s)%s", (int)base_len, type_c, param_name, dims);
             return;
         }
     }
@@ -222,13 +142,13 @@ void format_param_type(C99CodeGenerator *codegen __attribute__((unused)), const
     if (bracket) {
         // 提取元素类型（bracket之前的部分）
         size_t len = bracket - type_c;
-        fprintf(output, "%.*s %s%s", (int)len, type_c, param_name, bracket);
+        emitter_printf(output, "%.*s %s%s", (int)len, type_c, param_name, bracket);
     } else {
         // 非数组类型
         // 检查是否是指针类型（包含 '*'）
         // 如果是指针类型，格式应该是 "type * name"（* 紧跟在类型后面）
         // c99_type_to_c 已经返回了正确的格式（如 "struct Type *"），所以直接输出即可
-        fprintf(output, "%s %s", type_c, param_name);
+        emitter_printf(output, "%s %s", type_c, param_name);
     }
 }
 
@@ -295,7 +215,7 @@ void gen_function_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl) {
     if (is_main) {
         // main 函数生成 uya_main 的前向声明
         const char *return_c = convert_array_return_type(codegen, return_type);
-        fprintf(codegen->output, "%s uya_main(void);\n", return_c);
+        emitter_printf(codegen->output, "%s uya_main(void);\n", return_c);
         return;
     }
     
@@ -332,12 +252,12 @@ void gen_function_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl) {
     // 注意：这些函数在标准库中有实现，需要前向声明以避免隐式声明冲突
     if (is_conflicting_stdio_func) {
         // 生成前向声明（非 extern），因为函数有实际定义
-        fprintf(codegen->output, "%s %s(", return_c, func_name);
+        emitter_printf(codegen->output, "%s %s(", return_c, func_name);
     } else if (is_extern) {
         // 对于extern函数，添加extern关键字
-        fprintf(codegen->output, "extern %s %s(", return_c, func_name);
+        emitter_printf(codegen->output, "extern %s %s(", return_c, func_name);
     } else {
-        fprintf(codegen->output, "%s %s(", return_c, func_name);
+        emitter_printf(codegen->output, "%s %s(", return_c, func_name);
     }
     
     // 参数列表
@@ -361,8 +281,8 @@ void gen_function_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl) {
             if (struct_size > 16) {
                 // 大结构体：转换为指针类型
                 param_type_c = c99_type_to_c(codegen, param_type);
-                fprintf(codegen->output, "%s *%s", param_type_c, param_name);
-                if (i < param_count - 1) fputs(", ", codegen->output);
+                emitter_printf(codegen->output, "%s *%s", param_type_c, param_name);
+                if (i < param_count - 1) emitter_lit(codegen->output, ", ");
                 continue;
             }
         }
@@ -389,26 +309,26 @@ void gen_function_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl) {
             const char *bracket = strchr(param_type_c, '[');
             if (bracket) {
                 size_t len = bracket - param_type_c;
-                fprintf(codegen->output, "%.*s %s_param%s", (int)len, param_type_c, param_name, bracket);
+                emitter_printf(codegen->output, "%.*s %s_param%s", (int)len, param_type_c, param_name, bracket);
             } else {
-                fprintf(codegen->output, "%s %s_param", param_type_c, param_name);
+                emitter_printf(codegen->output, "%s %s_param", param_type_c, param_name);
             }
         } else if (param_type->type == AST_TYPE_SLICE) {
             // Slice 类型参数：通过指针传递（slice 是引用类型）
-            fprintf(codegen->output, "%s *%s", param_type_c, param_name);
+            emitter_printf(codegen->output, "%s *%s", param_type_c, param_name);
         } else {
             format_param_type(codegen, param_type_c, param_name, codegen->output);
         }
-        if (i < param_count - 1) fputs(", ", codegen->output);
+        if (i < param_count - 1) emitter_lit(codegen->output, ", ");
     }
     
     // 处理可变参数
     if (is_varargs) {
-        if (param_count > 0) fputs(", ", codegen->output);
-        fputs("...", codegen->output);
+        if (param_count > 0) emitter_lit(codegen->output, ", ");
+        emitter_lit(codegen->output, "...");
     }
     
-    fputs(");\n", codegen->output);
+    emitter_lit(codegen->output, ");\n");
 }
 
 // 生成函数定义
@@ -440,9 +360,9 @@ void gen_function(C99CodeGenerator *codegen, ASTNode *fn_decl) {
     
     if (is_main) {
         // main 函数重命名为 uya_main（符合 Uya 规范：main 函数无参数）
-        fprintf(codegen->output, "%s uya_main(void)", return_c);
+        emitter_printf(codegen->output, "%s uya_main(void)", return_c);
     } else {
-        fprintf(codegen->output, "%s %s(", return_c, func_name);
+        emitter_printf(codegen->output, "%s %s(", return_c, func_name);
         
         // 参数列表
         for (int i = 0; i < param_count; i++) {
@@ -477,31 +397,31 @@ void gen_function(C99CodeGenerator *codegen, ASTNode *fn_decl) {
                 const char *bracket = strchr(param_type_c, '[');
                 if (bracket) {
                     size_t len = bracket - param_type_c;
-                    fprintf(codegen->output, "%.*s %s_param%s", (int)len, param_type_c, param_name, bracket);
+                    emitter_printf(codegen->output, "%.*s %s_param%s", (int)len, param_type_c, param_name, bracket);
                 } else {
-                    fprintf(codegen->output, "%s %s_param", param_type_c, param_name);
+                    emitter_printf(codegen->output, "%s %s_param", param_type_c, param_name);
                 }
             } else if (param_type->type == AST_TYPE_SLICE) {
                 // Slice 类型参数：通过指针传递（slice 是引用类型）
-                fprintf(codegen->output, "%s *%s", param_type_c, param_name);
+                emitter_printf(codegen->output, "%s *%s", param_type_c, param_name);
             } else {
                 format_param_type(codegen, param_type_c, param_name, codegen->output);
             }
-            if (i < param_count - 1) fputs(", ", codegen->output);
+            if (i < param_count - 1) emitter_lit(codegen->output, ", ");
         }
         
         // 处理可变参数
         if (is_varargs) {
-            if (param_count > 0) fputs(", ", codegen->output);
-            fputs("...", codegen->output);
+            if (param_count > 0) emitter_lit(codegen->output, ", ");
+            emitter_lit(codegen->output, "...");
         }
     }
     
     // 添加函数体开始
     if (is_main) {
-        fputs(" {\n", codegen->output);
+        emitter_lit(codegen->output, " {\n");
     } else {
-        fputs(") {\n", codegen->output);
+        emitter_lit(codegen->output, ") {\n");
     }
     codegen->indent_level++;
     
@@ -539,7 +459,7 @@ void gen_function(C99CodeGenerator *codegen, ASTNode *fn_decl) {
             c99_emit(codegen, "// 数组参数按值传递：创建局部副本\n");
             if (bracket) {
                 size_t len = bracket - array_type_c;
-                fprintf(codegen->output, "    %.*s %s%s;\n", (int)len, array_type_c, param_name, bracket);
+                emitter_printf(codegen->output, "    %.*s %s%s;\n", (int)len, array_type_c, param_name, bracket);
             } else {
                 c99_emit(codegen, "%s %s;\n", array_type_c, param_name);
             }
@@ -598,16 +518,16 @@ void gen_method_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl, const cha
     const char *return_c = convert_array_return_type(codegen, fn_decl->data.fn_decl.return_type);
     ASTNode **params = fn_decl->data.fn_decl.params;
     int param_count = fn_decl->data.fn_decl.param_count;
-    fprintf(codegen->output, "%s %s(", return_c, c_name);
+    emitter_printf(codegen->output, "%s %s(", return_c, c_name);
     for (int i = 0; i < param_count; i++) {
         ASTNode *param = params[i];
         if (!param || param->type != AST_VAR_DECL) continue;
         const char *param_name = get_safe_c_identifier(codegen, param->data.var_decl.name);
         const char *param_type_c = c99_type_to_c_with_self_opt(codegen, param->data.var_decl.type, struct_name, (i == 0));
         format_param_type(codegen, param_type_c, param_name, codegen->output);
-        if (i < param_count - 1) fputs(", ", codegen->output);
+        if (i < param_count - 1) emitter_lit(codegen->output, ", ");
     }
-    fputs(");\n", codegen->output);
+    emitter_lit(codegen->output, ");\n");
 }
 
 // 生成方法函数定义（uya_StructName_methodname）
@@ -620,16 +540,16 @@ void gen_method_function(C99CodeGenerator *codegen, ASTNode *fn_decl, const char
     ASTNode **params = fn_decl->data.fn_decl.params;
     int param_count = fn_decl->data.fn_decl.param_count;
     emit_line_directive(codegen, fn_decl->line, fn_decl->filename);
-    fprintf(codegen->output, "%s %s(", return_c, c_name);
+    emitter_printf(codegen->output, "%s %s(", return_c, c_name);
     for (int i = 0; i < param_count; i++) {
         ASTNode *param = params[i];
         if (!param || param->type != AST_VAR_DECL) continue;
         const char *param_name = get_safe_c_identifier(codegen, param->data.var_decl.name);
         const char *param_type_c = c99_type_to_c_with_self_opt(codegen, param->data.var_decl.type, struct_name, (i == 0));
         format_param_type(codegen, param_type_c, param_name, codegen->output);
-        if (i < param_count - 1) fputs(", ", codegen->output);
+        if (i < param_count - 1) emitter_lit(codegen->output, ", ");
     }
-    fputs(") {\n", codegen->output);
+    emitter_lit(codegen->output, ") {\n");
     codegen->indent_level++;
     codegen->current_function_return_type = fn_decl->data.fn_decl.return_type;
     ASTNode *saved_current_function_decl = codegen->current_function_decl;
@@ -666,7 +586,7 @@ void gen_method_function(C99CodeGenerator *codegen, ASTNode *fn_decl, const char
                 const char *drop_c = get_method_c_name(codegen, field_type_name, "drop");
                 const char *field_safe = get_safe_c_identifier(codegen, field->data.var_decl.name);
                 if (drop_c && field_safe) {
-                    fprintf(codegen->output, "    /* drop field */ %s(%s.%s);\n", drop_c, self_safe, field_safe);
+                    emitter_printf(codegen->output, "    /* drop field */ %s(%s.%s);\n", drop_c, self_safe, field_safe);
                 }
             }
         }
@@ -869,7 +789,7 @@ void gen_mono_function_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl, AS
     // 返回类型（替换类型参数）
     const char *return_c = c99_mono_type_to_c(codegen, return_type);
     
-    fprintf(codegen->output, "%s %s(", return_c, mono_name);
+    emitter_printf(codegen->output, "%s %s(", return_c, mono_name);
     
     // 参数列表
     for (int i = 0; i < param_count; i++) {
@@ -881,16 +801,16 @@ void gen_mono_function_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl, AS
         const char *param_type_c = c99_mono_type_to_c(codegen, param_type);
         
         format_param_type(codegen, param_type_c, param_name, codegen->output);
-        if (i < param_count - 1) fputs(", ", codegen->output);
+        if (i < param_count - 1) emitter_lit(codegen->output, ", ");
     }
     
     // 处理可变参数
     if (is_varargs) {
-        if (param_count > 0) fputs(", ", codegen->output);
-        fputs("...", codegen->output);
+        if (param_count > 0) emitter_lit(codegen->output, ", ");
+        emitter_lit(codegen->output, "...");
     }
     
-    fputs(");\n", codegen->output);
+    emitter_lit(codegen->output, ");\n");
     
     // 恢复上下文
     codegen->current_type_params = saved_type_params;
@@ -931,7 +851,7 @@ void gen_mono_function(C99CodeGenerator *codegen, ASTNode *fn_decl, ASTNode **ty
     // 返回类型（替换类型参数）
     const char *return_c = c99_mono_type_to_c(codegen, return_type);
     
-    fprintf(codegen->output, "%s %s(", return_c, mono_name);
+    emitter_printf(codegen->output, "%s %s(", return_c, mono_name);
     
     // 参数列表
     for (int i = 0; i < param_count; i++) {
@@ -943,16 +863,16 @@ void gen_mono_function(C99CodeGenerator *codegen, ASTNode *fn_decl, ASTNode **ty
         const char *param_type_c = c99_mono_type_to_c(codegen, param_type);
         
         format_param_type(codegen, param_type_c, param_name, codegen->output);
-        if (i < param_count - 1) fputs(", ", codegen->output);
+        if (i < param_count - 1) emitter_lit(codegen->output, ", ");
     }
     
     // 处理可变参数
     if (is_varargs) {
-        if (param_count > 0) fputs(", ", codegen->output);
-        fputs("...", codegen->output);
+        if (param_count > 0) emitter_lit(codegen->output, ", ");
+        emitter_lit(codegen->output, "...");
     }
     
-    fputs(") {\n", codegen->output);
+    emitter_lit(codegen->output, ") {\n");
     
     // 设置当前函数返回类型（替换后）
     ASTNode *saved_return_type = codegen->current_function_return_type;
@@ -12,38 +12,38 @@ void gen_global_init_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             int field_count = expr->data.struct_init.field_count;
             const char **field_names = expr->data.struct_init.field_names;
             ASTNode **field_values = expr->data.struct_init.field_values;
-            fputc('{', codegen->output);
+            emitter_putc(codegen->output, '{');
             for (int i = 0; i < field_count; i++) {
                 const char *safe_field_name = get_safe_c_identifier(codegen, field_names[i]);
-                fprintf(codegen->output, ".%s = ", safe_field_name);
+                emitter_printf(codegen->output, ".%s = ", safe_field_name);
                 gen_global_init_expr(codegen, field_values[i]);
-                if (i < field_count - 1) fputs(", ", codegen->output);
+                if (i < field_count - 1) emitter_lit(codegen->output, ", ");
             }
-            fputc('}', codegen->output);
+            emitter_putc(codegen->output, '}');
             break;
         }
         case AST_ARRAY_LITERAL: {
             ASTNode **elements = expr->data.array_literal.elements;
             int element_count = expr->data.array_literal.element_count;
             ASTNode *repeat_count_expr = expr->data.array_literal.repeat_count_expr;
-            fputc('{', codegen->output);
+            emitter_putc(codegen->output, '{');
             if (repeat_count_expr != NULL && element_count >= 1) {
                 int n = eval_const_expr(codegen, repeat_count_expr);
                 if (n <= 0) n = 1;
                 for (int i = 0; i < n; i++) {
                     gen_global_init_expr(codegen, elements[0]);
-                    if (i < n - 1) fputs(", ", codegen->output);
+                    if (i < n - 1) emitter_lit(codegen->output, ", ");
                 }
             } else if (element_count > 0) {
                 for (int i = 0; i < element_count; i++) {
                     gen_global_init_expr(codegen, elements[i]);
-                    if (i < element_count - 1) fputs(", ", codegen->output);
+                    if (i < element_count - 1) emitter_lit(codegen->output, ", ");
                 }
             } else {
                 /* 空数组字面量：生成 0 避免 ISO C 警告 */
-                fputs("0", codegen->output);
+                emitter_lit(codegen->output, "0");
             }
-            fputc('}', codegen->output);
+            emitter_putc(codegen->output, '}');
             break;
         }
         default:
@@ -53,17 +53,9 @@ void gen_global_init_expr(C99CodeGenerator *codegen, ASTNode *expr) {
     }
 }
 
-// 生成全局变量定义
-void gen_global_var(C99CodeGenerator *codegen, ASTNode *var_decl) {
-    if (!var_decl || var_decl->type != AST_VAR_DECL) return;
-    
-    const char *var_name = get_safe_c_identifier(codegen, var_decl->data.var_decl.name);
-    ASTNode *var_type = var_decl->data.var_decl.type;
-    ASTNode *init_expr = var_decl->data.var_decl.init;
-    int is_const = var_decl->data.var_decl.is_const;
-    
-    if (!var_name || !var_type) return;
-    
+// 输出全局变量的声明部分（类型与名称，不含初始化与分号）
+// 返回：C 类型字符串（数组为元素基类型），用于登记全局变量表
+static const char *emit_global_var_declarator(C99CodeGenerator *codegen, const char *var_name, ASTNode *var_type, int is_const) {
     const char *type_c = NULL;
     
     // 检查是否为数组类型
@@ -88,45 +80,60 @@ void gen_global_var(C99CodeGenerator *codegen, ASTNode *var_decl) {
                 
                 // 生成数组声明：const base_type var_name dimensions
                 if (is_const) {
-                    fprintf(codegen->output, "const %s %s%s", base_type, var_name, dimensions);
+                    emitter_printf(codegen->output, "const %s %s%s", base_type, var_name, dimensions);
                 } else {
-                    fprintf(codegen->output, "%s %s%s", base_type, var_name, dimensions);
+                    emitter_printf(codegen->output, "%s %s%s", base_type, var_name, dimensions);
                 }
                 type_c = base_type;  // 保存基类型用于后续使用
             } else {
                 // 分配失败，回退到简单处理
                 type_c = full_type_c;
                 if (is_const) {
-                    fprintf(codegen->output, "const %s %s", type_c, var_name);
+                    emitter_printf(codegen->output, "const %s %s", type_c, var_name);
                 } else {
-                    fprintf(codegen->output, "%s %s", type_c, var_name);
+                    emitter_printf(codegen->output, "%s %s", type_c, var_name);
                 }
             }
         } else {
             // 没有找到 '['，可能是错误情况，回退到简单处理
             type_c = full_type_c;
             if (is_const) {
-                fprintf(codegen->output, "const %s %s", type_c, var_name);
+                emitter_printf(codegen->output, "const %s %s", type_c, var_name);
             } else {
-                fprintf(codegen->output, "%s %s", type_c, var_name);
+                emitter_printf(codegen->output, "%s %s", type_c, var_name);
             }
         }
     } else {
         type_c = c99_type_to_c(codegen, var_type);
         if (is_const) {
-            fprintf(codegen->output, "const %s %s", type_c, var_name);
+            emitter_printf(codegen->output, "const %s %s", type_c, var_name);
         } else {
-            fprintf(codegen->output, "%s %s", type_c, var_name);
+            emitter_printf(codegen->output, "%s %s", type_c, var_name);
         }
     }
+    return type_c;
+}
+
+// 生成全局变量定义
+void gen_global_var(C99CodeGenerator *codegen, ASTNode *var_decl) {
+    if (!var_decl || var_decl->type != AST_VAR_DECL) return;
+    
+    const char *var_name = get_safe_c_identifier(codegen, var_decl->data.var_decl.name);
+    ASTNode *var_type = var_decl->data.var_decl.type;
+    ASTNode *init_expr = var_decl->data.var_decl.init;
+    int is_const = var_decl->data.var_decl.is_const;
+    
+    if (!var_name || !var_type) return;
+    
+    const char *type_c = emit_global_var_declarator(codegen, var_name, var_type, is_const);
     
     // 初始化表达式（使用全局作用域兼容的生成方式）
     if (init_expr) {
-        fputs(" = ", codegen->output);
+        emitter_lit(codegen->output, " = ");
         gen_global_init_expr(codegen, init_expr);
     }
     
-    fputs(";\n", codegen->output);
+    emitter_lit(codegen->output, ";\n");
     
     // 添加到全局变量表（可选，用于后续引用）
     if (codegen->global_variable_count < C99_MAX_GLOBAL_VARS) {
@@ -136,3 +143,16 @@ void gen_global_var(C99CodeGenerator *codegen, ASTNode *var_decl) {
         codegen->global_variable_count++;
     }
 }
+
+// 生成全局变量的 extern 声明（拆分输出时写入共享头文件，不登记全局变量表）
+void gen_global_var_extern(C99CodeGenerator *codegen, ASTNode *var_decl) {
+    if (!var_decl || var_decl->type != AST_VAR_DECL) return;
+    
+    const char *var_name = get_safe_c_identifier(codegen, var_decl->data.var_decl.name);
+    ASTNode *var_type = var_decl->data.var_decl.type;
+    if (!var_name || !var_type) return;
+    
+    emitter_lit(codegen->output, "extern ");
+    emit_global_var_declarator(codegen, var_name, var_type, var_decl->data.var_decl.is_const);
+    emitter_lit(codegen->output, ";\n");
+}
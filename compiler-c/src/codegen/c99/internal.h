@@ -3,14 +3,18 @@
 
 #include "codegen_c99.h"
 #include "lexer.h"
+#include "intern.h"
 #include <stdio.h>
 
 // 工具函数（utils.c）
 const char *arena_strdup(Arena *arena, const char *src);
 unsigned get_or_add_error_id(C99CodeGenerator *codegen, const char *name);
+void emit_error_name_table(C99CodeGenerator *codegen);
+int c99_error_union_is_niche(const char *union_c);
+void c99_emit_error_test(C99CodeGenerator *codegen, const char *union_c, const char *var);
 int is_c_keyword(const char *name);
 const char *get_safe_c_identifier(C99CodeGenerator *codegen, const char *name);
-void escape_string_for_c(FILE *output, const char *str);
+void escape_string_for_c(Emitter *output, const char *str);
 int eval_const_expr(C99CodeGenerator *codegen, ASTNode *expr);
 void emit_line_directive(C99CodeGenerator *codegen, int line, const char *filename);
 
@@ -37,12 +41,13 @@ const char *get_array_wrapper_struct_name(C99CodeGenerator *codegen, ASTNode *ar
 void gen_array_wrapper_struct(C99CodeGenerator *codegen, ASTNode *array_type, const char *struct_name);
 
 // 类型检查（types.c）
-int is_identifier_pointer_type(C99CodeGenerator *codegen, const char *name);
+int is_identifier_pointer_type(C99CodeGenerator *codegen, ASTNode *ident);
 int is_identifier_pointer_to_array_type(C99CodeGenerator *codegen, const char *name);
 int is_identifier_struct_type(C99CodeGenerator *codegen, const char *name);
-const char *get_identifier_type_c(C99CodeGenerator *codegen, const char *name);
+const char *get_identifier_type_c(C99CodeGenerator *codegen, ASTNode *ident);
 /* 从表达式推断 C 类型字符串（用于元组字面量复合字面量），尽力而为 */
 const char *get_c_type_of_expr(C99CodeGenerator *codegen, ASTNode *expr);
+const char *get_resolved_c_type_of_expr(C99CodeGenerator *codegen, ASTNode *expr);
 int is_member_access_pointer_type(C99CodeGenerator *codegen, ASTNode *member_access);
 int is_array_access_pointer_type(C99CodeGenerator *codegen, ASTNode *array_access);
 int calculate_struct_size(C99CodeGenerator *codegen, ASTNode *type_node);
@@ -101,7 +106,7 @@ int type_has_drop_c99(C99CodeGenerator *codegen, const char *struct_name);
 void gen_method_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl, const char *struct_name);
 void gen_method_function(C99CodeGenerator *codegen, ASTNode *fn_decl, const char *struct_name);
 int is_stdlib_function(const char *func_name);
-void format_param_type(C99CodeGenerator *codegen, const char *type_c, const char *param_name, FILE *output);
+void format_param_type(C99CodeGenerator *codegen, const char *type_c, const char *param_name, Emitter *output);
 void gen_function_prototype(C99CodeGenerator *codegen, ASTNode *fn_decl);
 void gen_function(C99CodeGenerator *codegen, ASTNode *fn_decl);
 /* 替换类型节点中的类型参数为具体类型（递归） */
@@ -127,9 +132,92 @@ void collect_generic_instances_from_node(C99CodeGenerator *codegen, ASTNode *nod
 // 语句生成（stmt.c）
 void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt);
 
+// match 的 switch 分派（match.c）
+typedef enum C99MatchSubject {
+    C99_MATCH_SUBJECT_VALUE,        // switch (_uya_m)：整数/布尔常量与枚举
+    C99_MATCH_SUBJECT_TAG,          // switch (_uya_m._tag)：联合体变体
+    C99_MATCH_SUBJECT_ERROR_ID      // switch (_uya_m.error_id)：错误码
+} C99MatchSubject;
+
+typedef struct C99MatchCase {
+    int arm;                        // 生成结果的臂下标
+    long long lo;                   // case 值区间 [lo, hi]（相邻且结果相同的臂合并）
+    long long hi;
+} C99MatchCase;
+
+typedef struct C99MatchPlan {
+    C99MatchSubject subject;
+    C99MatchCase *cases;            // 按臂的顺序排列，重复的值只保留第一个臂
+    int case_count;
+    int default_arm;                // 兜底臂（绑定/通配/else）下标，-1 表示没有
+} C99MatchPlan;
+
+/* 判断 match 能否用 switch 分派（臂中有作用于外层循环的 break 时不能），能则填写 plan 并返回 1 */
+int c99_plan_match_switch(C99CodeGenerator *codegen, ASTNode *match, const char *m_type, C99MatchPlan *plan);
+/* 格式化 case 标签："case v: " 或 "case lo ... hi: "（GCC case 区间扩展） */
+void c99_format_match_case_label(const C99MatchCase *mc, char *buf, size_t size);
+/* switch 的控制表达式 */
+const char *c99_match_subject_expr(const C99MatchPlan *plan);
+
+// 接口调用去虚化（devirt.c）
+/* 分析各函数的接口形参在全部调用处收到的具体结构体，结果写入 codegen->devirt_params */
+void c99_analyze_devirt(C99CodeGenerator *codegen);
+/* 当前函数的接口形参已知的具体结构体名，未知返回 NULL */
+const char *c99_devirt_param_struct(C99CodeGenerator *codegen, const char *param_name);
+
+// 下标、除数与整数运算的区间分析（range.c）
+/* 逐函数分析下标、除数与整数运算的取值区间，无法证明安全的位置写入 codegen->safety_check_sites / safety_hoists */
+void c99_analyze_safety(C99CodeGenerator *codegen);
+/* 生成下标访问的索引表达式（需要时包裹越界检查）；slice_access：0 数组，1 切片值，2 切片指针 */
+void c99_gen_index_expr(C99CodeGenerator *codegen, ASTNode *access, int slice_access);
+/* 无法证明安全的 + - * / % 生成带溢出与除零检查的形式并返回 1，否则不生成并返回 0 */
+int c99_gen_checked_arith(C99CodeGenerator *codegen, ASTNode *binary);
+/* 在循环语句之前生成外提的下标范围检查 */
+void c99_gen_loop_hoists(C99CodeGenerator *codegen, ASTNode *loop);
+/* 生成安全检查的辅助函数（未开启 --safety-checks 时不生成） */
+void c99_emit_safety_helpers(C99CodeGenerator *codegen);
+
 // 全局变量生成（global.c）
 void gen_global_init_expr(C99CodeGenerator *codegen, ASTNode *expr);
 void gen_global_var(C99CodeGenerator *codegen, ASTNode *var_decl);
+void gen_global_var_extern(C99CodeGenerator *codegen, ASTNode *var_decl);
+
+// 生成单元（parallel.c）
+// 第八步 b 按声明顺序输出的每个函数定义、方法定义或非常量全局变量是一个生成单元
+typedef enum C99UnitKind {
+    C99_UNIT_FUNCTION,              // 普通函数定义
+    C99_UNIT_MONO_FUNCTION,         // 泛型函数的单态化实例
+    C99_UNIT_METHOD,                // 方法定义（含泛型结构体单态化实例的方法）
+    C99_UNIT_GLOBAL_VAR             // 非常量全局变量
+} C99UnitKind;
+
+typedef struct C99CodegenUnit {
+    C99UnitKind kind;
+    ASTNode *decl;                  // 函数、方法或变量声明
+    const char *type_name;          // 方法所属类型名（单态化实例为实例名）
+    TypeParam *type_params;         // 单态化上下文：结构体实例方法的类型参数（其他单元为 NULL）
+    int type_param_count;
+    ASTNode **type_args;            // 单态化上下文：类型实参
+    int type_arg_count;
+    
+    // 并行生成（-jN）时使用
+    int global_count;               // 串行顺序下生成该单元时全局变量表中已有的条目数
+    Emitter output;                 // 单元的输出缓冲区
+    int temp_count;                 // 单元消耗的字符串插值临时变量编号数
+    int fill_count;                 // 单元消耗的字符串插值填充编号数
+    int first_line;                 // 单元第一次请求的 #line 行号（0 表示没有）
+    const char *first_filename;
+    int last_line;                  // 单元结束时的 #line 状态
+    const char *last_filename;
+} C99CodegenUnit;
+
+void c99_collect_units(C99CodeGenerator *codegen, ASTNode **decls, int decl_count, C99CodegenUnit **units, int *unit_count);
+void c99_gen_unit(C99CodeGenerator *codegen, const C99CodegenUnit *unit);
+void c99_gen_units(C99CodeGenerator *codegen, C99CodegenUnit *units, int unit_count);
+
+// 拆分输出（split.c）
+void c99_split_begin(C99CodeGenerator *codegen, const char *output_file);
+void c99_split_units(C99CodeGenerator *codegen, Emitter *header, C99CodegenUnit *units, int unit_count);
 
 #endif // CODEGEN_C99_INTERNAL_H
 
@@ -78,7 +78,7 @@ static void gen_test_function(C99CodeGenerator *codegen, ASTNode *test_stmt) {
     
     // 生成函数定义
     emit_line_directive(codegen, test_stmt->line, test_stmt->filename);
-    fprintf(codegen->output, "static void %s(void) {\n", func_name);
+    emitter_printf(codegen->output, "static void %s(void) {\n", func_name);
     
     // 生成函数体
     gen_stmt(codegen, body);
@@ -86,14 +86,14 @@ static void gen_test_function(C99CodeGenerator *codegen, ASTNode *test_stmt) {
     // 恢复之前的返回类型
     codegen->current_function_return_type = saved_return_type;
     
-    fprintf(codegen->output, "}\n");
+    emitter_lit(codegen->output, "}\n");
 }
 
 /* 生成测试运行器函数 */
 static void gen_test_runner(C99CodeGenerator *codegen, ASTNode **tests, int test_count) {
     if (!tests || test_count <= 0) return;
     
-    fprintf(codegen->output, "static void uya_run_tests(void) {\n");
+    emitter_lit(codegen->output, "static void uya_run_tests(void) {\n");
     
     for (int i = 0; i < test_count; i++) {
         ASTNode *test = tests[i];
@@ -101,11 +101,11 @@ static void gen_test_runner(C99CodeGenerator *codegen, ASTNode **tests, int test
         
         const char *func_name = get_test_function_name(codegen, test->data.test_stmt.description);
         if (func_name) {
-            fprintf(codegen->output, "    %s();\n", func_name);
+            emitter_printf(codegen->output, "    %s();\n", func_name);
         }
     }
     
-    fprintf(codegen->output, "}\n");
+    emitter_lit(codegen->output, "}\n");
 }
 
 /* 递归收集 AST 中使用的切片类型，以便 step 6b 输出对应 struct */
@@ -264,10 +264,14 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
     // 保存程序节点引用
     codegen->program_node = ast;
     
+    // --time-report：按步骤分组计时（收集、类型定义、前向声明、定义）
+    TimeReportTimer step_timer;
+    time_report_start(codegen->time_report, &step_timer, codegen->arena);
+    
     // 输出文件头
-    fputs("// C99 代码由 Uya Mini 编译器生成\n", codegen->output);
-    fputs("// 使用 -std=c99 编译\n", codegen->output);
-    fputs("//\n", codegen->output);
+    emitter_lit(codegen->output, "// C99 代码由 Uya Mini 编译器生成\n");
+    emitter_lit(codegen->output, "// 使用 -std=c99 编译\n");
+    emitter_lit(codegen->output, "//\n");
     
     // 先检查是否定义了与标准库冲突的函数
     ASTNode **decls = ast->data.program.decls;
@@ -287,39 +291,40 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
         }
     }
     
-    fputs("#include <stdint.h>\n", codegen->output);
-    fputs("#include <stdbool.h>\n", codegen->output);
-    fputs("#include <stddef.h>\n", codegen->output);
-    fputs("#include <stdarg.h>\n", codegen->output);  // for va_list (variadic forward)
+    emitter_lit(codegen->output, "#include <stdint.h>\n");
+    emitter_lit(codegen->output, "#include <stdbool.h>\n");
+    emitter_lit(codegen->output, "#include <stddef.h>\n");
+    emitter_lit(codegen->output, "#include <stdarg.h>\n");  // for va_list (variadic forward)
     // 只有在没有定义冲突函数时才包含 <stdio.h>
     if (!codegen->has_stdio_conflicts) {
-        fputs("#include <stdio.h>\n", codegen->output);  // for standard I/O functions (printf, puts, etc.)
+        emitter_lit(codegen->output, "#include <stdio.h>\n");  // for standard I/O functions (printf, puts, etc.)
     }
     // 如果使用了 memcpy 或 memset，添加 <string.h>
     if (codegen->needs_string_h) {
-        fputs("#include <string.h>\n", codegen->output);
+        emitter_lit(codegen->output, "#include <string.h>\n");
     }
-    fputs("\n", codegen->output);
+    emitter_lit(codegen->output, "\n");
     // C99 兼容的 alignof 宏（使用 offsetof 技巧）
-    fputs("// C99 兼容的 alignof 实现\n", codegen->output);
-    fputs("#define uya_alignof(type) offsetof(struct { char c; type t; }, t)\n", codegen->output);
-    fputs("\n", codegen->output);
+    emitter_lit(codegen->output, "// C99 兼容的 alignof 实现\n");
+    emitter_lit(codegen->output, "#define uya_alignof(type) offsetof(struct { char c; type t; }, t)\n");
+    emitter_lit(codegen->output, "\n");
     // 内置 memcpy/memcmp 实现（避免与用户定义的 memcpy/memcmp 冲突）
-    fputs("static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {\n", codegen->output);
-    fputs("    char *d = (char *)dest; const char *s = (const char *)src;\n", codegen->output);
-    fputs("    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;\n", codegen->output);
-    fputs("}\n", codegen->output);
-    fputs("static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {\n", codegen->output);
-    fputs("    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;\n", codegen->output);
-    fputs("    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;\n", codegen->output);
-    fputs("}\n\n", codegen->output);
+    emitter_lit(codegen->output, "static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {\n");
+    emitter_lit(codegen->output, "    char *d = (char *)dest; const char *s = (const char *)src;\n");
+    emitter_lit(codegen->output, "    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;\n");
+    emitter_lit(codegen->output, "}\n");
+    emitter_lit(codegen->output, "static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {\n");
+    emitter_lit(codegen->output, "    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;\n");
+    emitter_lit(codegen->output, "    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;\n");
+    emitter_lit(codegen->output, "}\n\n");
     
     // 生成错误联合类型结构体（用于 @syscall 和其他错误联合类型）
-    fputs("// 错误联合类型（用于 !i64 等）\n", codegen->output);
-    fputs("struct err_union_int64_t { uint32_t error_id; int64_t value; };\n", codegen->output);
+    emitter_lit(codegen->output, "// 错误联合类型（用于 !i64 等）\n");
+    emitter_printf(codegen->output, "struct err_union_int64_t { %s error_id; int64_t value; };\n",
+                   codegen->compact_error_abi ? "uint16_t" : "uint32_t");
     // 标记为已定义，避免在函数前置声明时重复定义
     mark_struct_defined(codegen, "err_union_int64_t");
-    fputs("\n", codegen->output);
+    emitter_lit(codegen->output, "\n");
     
     // 第一步：收集所有字符串常量（从全局变量初始化和函数体）
     // 注意：decls 和 decl_count 已在上面定义
@@ -335,7 +340,7 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
     
     // 第二步：输出字符串常量定义（在所有其他代码之前）
     emit_string_constants(codegen);
-    fputs("\n", codegen->output);
+    emitter_lit(codegen->output, "\n");
     
     // 第三步：收集错误名称（error Name; 及后续 error.X 使用）
     for (int i = 0; i < decl_count; i++) {
@@ -345,6 +350,16 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
             get_or_add_error_id(codegen, decl->data.error_decl.name);
         }
     }
+    emit_error_name_table(codegen);
+    
+    // 第三步 b：接口调用去虚化分析（函数生成前完成，生成期间只读）
+    c99_analyze_devirt(codegen);
+    
+    // 第三步 c：下标与除数的区间分析（同上，仅 --safety-checks / --safety-report）
+    c99_analyze_safety(codegen);
+    
+    time_report_stop(codegen->time_report, "codegen.collect", &step_timer);
+    time_report_start(codegen->time_report, &step_timer, codegen->arena);
     
     // 第四步：收集所有结构体和枚举定义（添加到表中但不生成代码）
     for (int i = 0; i < decl_count; i++) {
@@ -366,14 +381,14 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
     
     // 第四步：生成所有结构体的前向声明（解决相互依赖）
     // 首先添加内置 TypeInfo 的前向声明（用于 @mc_type）
-    fputs("struct TypeInfo;\n", codegen->output);
+    emitter_lit(codegen->output, "struct TypeInfo;\n");
     for (int i = 0; i < codegen->struct_definition_count; i++) {
         if (!is_struct_defined(codegen, codegen->struct_definitions[i].name)) {
-            fprintf(codegen->output, "struct %s;\n", codegen->struct_definitions[i].name);
+            emitter_printf(codegen->output, "struct %s;\n", codegen->struct_definitions[i].name);
         }
     }
     if (codegen->struct_definition_count > 0) {
-        fputs("\n", codegen->output);
+        emitter_lit(codegen->output, "\n");
     }
 
     // 第五步：生成所有枚举定义（在结构体之前，因为结构体可能使用枚举类型）
@@ -382,7 +397,7 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
         if (!decl) continue;
         if (decl->type == AST_ENUM_DECL) {
             gen_enum_definition(codegen, decl);
-            fputs("\n", codegen->output);
+            emitter_lit(codegen->output, "\n");
         }
     }
     
@@ -411,18 +426,18 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
                 }
                 // current 现在是基础元素类型
                 const char *base_type_c = c99_type_to_c(codegen, current);
-                fprintf(codegen->output, "typedef %s %s", base_type_c, alias_name);
+                emitter_printf(codegen->output, "typedef %s %s", base_type_c, alias_name);
                 for (int d = 0; d < dim_count; d++) {
-                    fprintf(codegen->output, "[%d]", dims[d]);
+                    emitter_printf(codegen->output, "[%d]", dims[d]);
                 }
-                fputs(";\n", codegen->output);
+                emitter_lit(codegen->output, ";\n");
             } else {
                 const char *target_type_c = c99_type_to_c(codegen, target_type);
-                fprintf(codegen->output, "typedef %s %s;\n", target_type_c, alias_name);
+                emitter_printf(codegen->output, "typedef %s %s;\n", target_type_c, alias_name);
             }
         }
     }
-    fputs("\n", codegen->output);
+    emitter_lit(codegen->output, "\n");
     
     // 第六步 a：收集所有使用的切片类型（含结构体字段中的 &[T]）
     for (int i = 0; i < decl_count; i++) {
@@ -433,11 +448,11 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
     // 第六步 b：生成切片结构体（&[T] -> struct uya_slice_X），必须在用户结构体之前
     emit_pending_slice_structs(codegen);
     if (codegen->slice_struct_count > 0) {
-        fputs("\n", codegen->output);
+        emitter_lit(codegen->output, "\n");
     }
     // 第六步 b2：生成接口结构体与 vtable 结构体（vtable 常量在函数前向声明之后生成）
     emit_interface_structs_and_vtables(codegen);
-    fputs("\n", codegen->output);
+    emitter_lit(codegen->output, "\n");
     // 第六步 c：生成联合体定义（在结构体之前，因结构体可能含联合体）
     for (int i = 0; i < decl_count; i++) {
         ASTNode *decl = decls[i];
@@ -445,7 +460,7 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
         if (decl->type == AST_USE_STMT || decl->type == AST_MACRO_DECL) continue;
         if (decl->type == AST_UNION_DECL) {
             gen_union_definition(codegen, decl);
-            fputs("\n", codegen->output);
+            emitter_lit(codegen->output, "\n");
         }
     }
     // 第六步 d1：自动生成内置 TypeInfo 结构体（如果用户没有定义且代码中使用了 @mc_type）
@@ -462,19 +477,19 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
         }
         if (!user_defined_typeinfo && !is_struct_defined(codegen, "TypeInfo")) {
             // 生成内置 TypeInfo 结构体
-            fputs("// 内置 TypeInfo 结构体（由 @mc_type 使用）\n", codegen->output);
-            fputs("struct TypeInfo {\n", codegen->output);
-            fputs("    int8_t * name;\n", codegen->output);
-            fputs("    int32_t size;\n", codegen->output);
-            fputs("    int32_t align;\n", codegen->output);
-            fputs("    int32_t kind;\n", codegen->output);
-            fputs("    bool is_integer;\n", codegen->output);
-            fputs("    bool is_float;\n", codegen->output);
-            fputs("    bool is_bool;\n", codegen->output);
-            fputs("    bool is_pointer;\n", codegen->output);
-            fputs("    bool is_array;\n", codegen->output);
-            fputs("    bool is_void;\n", codegen->output);
-            fputs("};\n\n", codegen->output);
+            emitter_lit(codegen->output, "// 内置 TypeInfo 结构体（由 @mc_type 使用）\n");
+            emitter_lit(codegen->output, "struct TypeInfo {\n");
+            emitter_lit(codegen->output, "    int8_t * name;\n");
+            emitter_lit(codegen->output, "    int32_t size;\n");
+            emitter_lit(codegen->output, "    int32_t align;\n");
+            emitter_lit(codegen->output, "    int32_t kind;\n");
+            emitter_lit(codegen->output, "    bool is_integer;\n");
+            emitter_lit(codegen->output, "    bool is_float;\n");
+            emitter_lit(codegen->output, "    bool is_bool;\n");
+            emitter_lit(codegen->output, "    bool is_pointer;\n");
+            emitter_lit(codegen->output, "    bool is_array;\n");
+            emitter_lit(codegen->output, "    bool is_void;\n");
+            emitter_lit(codegen->output, "};\n\n");
             mark_struct_defined(codegen, "TypeInfo");
         }
     }
@@ -488,106 +503,109 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
             // 跳过泛型结构体模板，为单态化实例生成定义
             if (is_generic_struct_c99(decl)) {
                 const char *struct_name = decl->data.struct_decl.name;
-                for (int j = 0; j < codegen->mono_instance_count; j++) {
-                    if (codegen->mono_instances[j].generic_name &&
-                        strcmp(codegen->mono_instances[j].generic_name, struct_name) == 0 &&
-                        !codegen->mono_instances[j].is_function) {
-                        // 跳过包含未解析类型参数的实例（如 Box<T> 而非 Box<i32>）
-                        if (has_unresolved_mono_type_args(decl,
-                            codegen->mono_instances[j].type_args,
-                            codegen->mono_instances[j].type_arg_count)) {
-                            continue;
-                        }
-                        gen_mono_struct_definition(codegen, decl,
-                            codegen->mono_instances[j].type_args,
-                            codegen->mono_instances[j].type_arg_count);
-                        fputs("\n", codegen->output);
+                for (const MonoInstance *inst = mono_table_find_group(codegen->mono_table, struct_name, 0);
+                     inst != NULL; inst = inst->next_in_group) {
+                    // 跳过包含未解析类型参数的实例（如 Box<T> 而非 Box<i32>）
+                    if (has_unresolved_mono_type_args(decl,
+                        inst->type_arg_nodes,
+                        inst->type_arg_count)) {
+                        continue;
                     }
+                    gen_mono_struct_definition(codegen, decl,
+                        inst->type_arg_nodes,
+                        inst->type_arg_count);
+                    emitter_lit(codegen->output, "\n");
                 }
             } else {
                 gen_struct_definition(codegen, decl);
-                fputs("\n", codegen->output);
+                emitter_lit(codegen->output, "\n");
             }
         }
     }
 
     // 第六步 e：生成系统调用辅助函数（@syscall 内置函数支持）
-    fputs("// 系统调用辅助函数（Linux x86-64）\n", codegen->output);
-    fputs("#ifdef __x86_64__\n", codegen->output);
+    emitter_lit(codegen->output, "// 系统调用辅助函数（Linux x86-64）\n");
+    emitter_lit(codegen->output, "#ifdef __x86_64__\n");
     
     // uya_syscall0 - 无参数
-    fputs("static inline long uya_syscall0(long nr) {\n", codegen->output);
-    fputs("    register long rax __asm__(\"rax\") = nr;\n", codegen->output);
-    fputs("    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax) : \"rcx\", \"r11\", \"memory\");\n", codegen->output);
-    fputs("    return rax;\n", codegen->output);
-    fputs("}\n\n", codegen->output);
+    emitter_lit(codegen->output, "static inline long uya_syscall0(long nr) {\n");
+    emitter_lit(codegen->output, "    register long rax __asm__(\"rax\") = nr;\n");
+    emitter_lit(codegen->output, "    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax) : \"rcx\", \"r11\", \"memory\");\n");
+    emitter_lit(codegen->output, "    return rax;\n");
+    emitter_lit(codegen->output, "}\n\n");
     
     // uya_syscall1 - 1 个参数
-    fputs("static inline long uya_syscall1(long nr, long a1) {\n", codegen->output);
-    fputs("    register long rax __asm__(\"rax\") = nr;\n", codegen->output);
-    fputs("    register long rdi __asm__(\"rdi\") = a1;\n", codegen->output);
-    fputs("    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi) : \"rcx\", \"r11\", \"memory\");\n", codegen->output);
-    fputs("    return rax;\n", codegen->output);
-    fputs("}\n\n", codegen->output);
+    emitter_lit(codegen->output, "static inline long uya_syscall1(long nr, long a1) {\n");
+    emitter_lit(codegen->output, "    register long rax __asm__(\"rax\") = nr;\n");
+    emitter_lit(codegen->output, "    register long rdi __asm__(\"rdi\") = a1;\n");
+    emitter_lit(codegen->output, "    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi) : \"rcx\", \"r11\", \"memory\");\n");
+    emitter_lit(codegen->output, "    return rax;\n");
+    emitter_lit(codegen->output, "}\n\n");
     
     // uya_syscall2 - 2 个参数
-    fputs("static inline long uya_syscall2(long nr, long a1, long a2) {\n", codegen->output);
-    fputs("    register long rax __asm__(\"rax\") = nr;\n", codegen->output);
-    fputs("    register long rdi __asm__(\"rdi\") = a1;\n", codegen->output);
-    fputs("    register long rsi __asm__(\"rsi\") = a2;\n", codegen->output);
-    fputs("    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi) : \"rcx\", \"r11\", \"memory\");\n", codegen->output);
-    fputs("    return rax;\n", codegen->output);
-    fputs("}\n\n", codegen->output);
+    emitter_lit(codegen->output, "static inline long uya_syscall2(long nr, long a1, long a2) {\n");
+    emitter_lit(codegen->output, "    register long rax __asm__(\"rax\") = nr;\n");
+    emitter_lit(codegen->output, "    register long rdi __asm__(\"rdi\") = a1;\n");
+    emitter_lit(codegen->output, "    register long rsi __asm__(\"rsi\") = a2;\n");
+    emitter_lit(codegen->output, "    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi) : \"rcx\", \"r11\", \"memory\");\n");
+    emitter_lit(codegen->output, "    return rax;\n");
+    emitter_lit(codegen->output, "}\n\n");
     
     // uya_syscall3 - 3 个参数
-    fputs("static inline long uya_syscall3(long nr, long a1, long a2, long a3) {\n", codegen->output);
-    fputs("    register long rax __asm__(\"rax\") = nr;\n", codegen->output);
-    fputs("    register long rdi __asm__(\"rdi\") = a1;\n", codegen->output);
-    fputs("    register long rsi __asm__(\"rsi\") = a2;\n", codegen->output);
-    fputs("    register long rdx __asm__(\"rdx\") = a3;\n", codegen->output);
-    fputs("    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi), \"r\"(rdx) : \"rcx\", \"r11\", \"memory\");\n", codegen->output);
-    fputs("    return rax;\n", codegen->output);
-    fputs("}\n\n", codegen->output);
+    emitter_lit(codegen->output, "static inline long uya_syscall3(long nr, long a1, long a2, long a3) {\n");
+    emitter_lit(codegen->output, "    register long rax __asm__(\"rax\") = nr;\n");
+    emitter_lit(codegen->output, "    register long rdi __asm__(\"rdi\") = a1;\n");
+    emitter_lit(codegen->output, "    register long rsi __asm__(\"rsi\") = a2;\n");
+    emitter_lit(codegen->output, "    register long rdx __asm__(\"rdx\") = a3;\n");
+    emitter_lit(codegen->output, "    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi), \"r\"(rdx) : \"rcx\", \"r11\", \"memory\");\n");
+    emitter_lit(codegen->output, "    return rax;\n");
+    emitter_lit(codegen->output, "}\n\n");
     
     // uya_syscall4 - 4 个参数
-    fputs("static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {\n", codegen->output);
-    fputs("    register long rax __asm__(\"rax\") = nr;\n", codegen->output);
-    fputs("    register long rdi __asm__(\"rdi\") = a1;\n", codegen->output);
-    fputs("    register long rsi __asm__(\"rsi\") = a2;\n", codegen->output);
-    fputs("    register long rdx __asm__(\"rdx\") = a3;\n", codegen->output);
-    fputs("    register long r10 __asm__(\"r10\") = a4;\n", codegen->output);
-    fputs("    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi), \"r\"(rdx), \"r\"(r10) : \"rcx\", \"r11\", \"memory\");\n", codegen->output);
-    fputs("    return rax;\n", codegen->output);
-    fputs("}\n\n", codegen->output);
+    emitter_lit(codegen->output, "static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {\n");
+    emitter_lit(codegen->output, "    register long rax __asm__(\"rax\") = nr;\n");
+    emitter_lit(codegen->output, "    register long rdi __asm__(\"rdi\") = a1;\n");
+    emitter_lit(codegen->output, "    register long rsi __asm__(\"rsi\") = a2;\n");
+    emitter_lit(codegen->output, "    register long rdx __asm__(\"rdx\") = a3;\n");
+    emitter_lit(codegen->output, "    register long r10 __asm__(\"r10\") = a4;\n");
+    emitter_lit(codegen->output, "    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi), \"r\"(rdx), \"r\"(r10) : \"rcx\", \"r11\", \"memory\");\n");
+    emitter_lit(codegen->output, "    return rax;\n");
+    emitter_lit(codegen->output, "}\n\n");
     
     // uya_syscall5 - 5 个参数
-    fputs("static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {\n", codegen->output);
-    fputs("    register long rax __asm__(\"rax\") = nr;\n", codegen->output);
-    fputs("    register long rdi __asm__(\"rdi\") = a1;\n", codegen->output);
-    fputs("    register long rsi __asm__(\"rsi\") = a2;\n", codegen->output);
-    fputs("    register long rdx __asm__(\"rdx\") = a3;\n", codegen->output);
-    fputs("    register long r10 __asm__(\"r10\") = a4;\n", codegen->output);
-    fputs("    register long r8 __asm__(\"r8\") = a5;\n", codegen->output);
-    fputs("    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi), \"r\"(rdx), \"r\"(r10), \"r\"(r8) : \"rcx\", \"r11\", \"memory\");\n", codegen->output);
-    fputs("    return rax;\n", codegen->output);
-    fputs("}\n\n", codegen->output);
+    emitter_lit(codegen->output, "static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {\n");
+    emitter_lit(codegen->output, "    register long rax __asm__(\"rax\") = nr;\n");
+    emitter_lit(codegen->output, "    register long rdi __asm__(\"rdi\") = a1;\n");
+    emitter_lit(codegen->output, "    register long rsi __asm__(\"rsi\") = a2;\n");
+    emitter_lit(codegen->output, "    register long rdx __asm__(\"rdx\") = a3;\n");
+    emitter_lit(codegen->output, "    register long r10 __asm__(\"r10\") = a4;\n");
+    emitter_lit(codegen->output, "    register long r8 __asm__(\"r8\") = a5;\n");
+    emitter_lit(codegen->output, "    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi), \"r\"(rdx), \"r\"(r10), \"r\"(r8) : \"rcx\", \"r11\", \"memory\");\n");
+    emitter_lit(codegen->output, "    return rax;\n");
+    emitter_lit(codegen->output, "}\n\n");
     
     // uya_syscall6 - 6 个参数
-    fputs("static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {\n", codegen->output);
-    fputs("    register long rax __asm__(\"rax\") = nr;\n", codegen->output);
-    fputs("    register long rdi __asm__(\"rdi\") = a1;\n", codegen->output);
-    fputs("    register long rsi __asm__(\"rsi\") = a2;\n", codegen->output);
-    fputs("    register long rdx __asm__(\"rdx\") = a3;\n", codegen->output);
-    fputs("    register long r10 __asm__(\"r10\") = a4;\n", codegen->output);
-    fputs("    register long r8 __asm__(\"r8\") = a5;\n", codegen->output);
-    fputs("    register long r9 __asm__(\"r9\") = a6;\n", codegen->output);
-    fputs("    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi), \"r\"(rdx), \"r\"(r10), \"r\"(r8), \"r\"(r9) : \"rcx\", \"r11\", \"memory\");\n", codegen->output);
-    fputs("    return rax;\n", codegen->output);
-    fputs("}\n", codegen->output);
-    
-    fputs("#else\n", codegen->output);
-    fputs("#error \"@syscall currently only supports Linux x86-64\"\n", codegen->output);
-    fputs("#endif\n\n", codegen->output);
+    emitter_lit(codegen->output, "static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {\n");
+    emitter_lit(codegen->output, "    register long rax __asm__(\"rax\") = nr;\n");
+    emitter_lit(codegen->output, "    register long rdi __asm__(\"rdi\") = a1;\n");
+    emitter_lit(codegen->output, "    register long rsi __asm__(\"rsi\") = a2;\n");
+    emitter_lit(codegen->output, "    register long rdx __asm__(\"rdx\") = a3;\n");
+    emitter_lit(codegen->output, "    register long r10 __asm__(\"r10\") = a4;\n");
+    emitter_lit(codegen->output, "    register long r8 __asm__(\"r8\") = a5;\n");
+    emitter_lit(codegen->output, "    register long r9 __asm__(\"r9\") = a6;\n");
+    emitter_lit(codegen->output, "    __asm__ volatile(\"syscall\" : \"=r\"(rax) : \"r\"(rax), \"r\"(rdi), \"r\"(rsi), \"r\"(rdx), \"r\"(r10), \"r\"(r8), \"r\"(r9) : \"rcx\", \"r11\", \"memory\");\n");
+    emitter_lit(codegen->output, "    return rax;\n");
+    emitter_lit(codegen->output, "}\n");
+    
+    emitter_lit(codegen->output, "#else\n");
+    emitter_lit(codegen->output, "#error \"@syscall currently only supports Linux x86-64\"\n");
+    emitter_lit(codegen->output, "#endif\n\n");
+    
+    // 第六步 f：安全检查辅助函数（--safety-checks）
+    c99_emit_safety_helpers(codegen);
+
+    time_report_stop(codegen->time_report, "codegen.types", &step_timer);
+    time_report_start(codegen->time_report, &step_timer, codegen->arena);
 
     // 第七步：生成所有函数的前向声明（解决相互递归调用）
     for (int i = 0; i < decl_count; i++) {
@@ -599,14 +617,11 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
             if (is_generic_function_c99(decl)) {
                 // 查找该泛型函数的所有单态化实例
                 const char *fn_name = decl->data.fn_decl.name;
-                for (int j = 0; j < codegen->mono_instance_count; j++) {
-                    if (codegen->mono_instances[j].generic_name &&
-                        strcmp(codegen->mono_instances[j].generic_name, fn_name) == 0 &&
-                        codegen->mono_instances[j].is_function) {
-                        gen_mono_function_prototype(codegen, decl,
-                            codegen->mono_instances[j].type_args,
-                            codegen->mono_instances[j].type_arg_count);
-                    }
+                for (const MonoInstance *inst = mono_table_find_group(codegen->mono_table, fn_name, 1);
+                     inst != NULL; inst = inst->next_in_group) {
+                    gen_mono_function_prototype(codegen, decl,
+                        inst->type_arg_nodes,
+                        inst->type_arg_count);
                 }
             } else {
                 gen_function_prototype(codegen, decl);
@@ -625,43 +640,40 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
             const char *struct_name = decl->data.struct_decl.name;
             // 跳过泛型结构体模板的内部方法，为单态化实例生成方法原型
             if (is_generic_struct_c99(decl)) {
-                for (int k = 0; k < codegen->mono_instance_count; k++) {
-                    if (codegen->mono_instances[k].generic_name &&
-                        strcmp(codegen->mono_instances[k].generic_name, struct_name) == 0 &&
-                        !codegen->mono_instances[k].is_function) {
-                        // 跳过包含未解析类型参数的实例
-                        if (has_unresolved_mono_type_args(decl,
-                            codegen->mono_instances[k].type_args,
-                            codegen->mono_instances[k].type_arg_count)) {
-                            continue;
-                        }
-                        // 为该单态化实例生成方法原型
-                        const char *mono_name = get_mono_struct_name(codegen, struct_name,
-                            codegen->mono_instances[k].type_args,
-                            codegen->mono_instances[k].type_arg_count);
-                        // 设置单态化上下文
-                        TypeParam *saved_tp = codegen->current_type_params;
-                        int saved_tpc = codegen->current_type_param_count;
-                        ASTNode **saved_ta = codegen->current_type_args;
-                        int saved_tac = codegen->current_type_arg_count;
-                        codegen->current_type_params = decl->data.struct_decl.type_params;
-                        codegen->current_type_param_count = decl->data.struct_decl.type_param_count;
-                        codegen->current_type_args = codegen->mono_instances[k].type_args;
-                        codegen->current_type_arg_count = codegen->mono_instances[k].type_arg_count;
-                        
-                        for (int j = 0; j < decl->data.struct_decl.method_count; j++) {
-                            ASTNode *m = decl->data.struct_decl.methods[j];
-                            if (m && m->type == AST_FN_DECL) {
-                                gen_method_prototype(codegen, m, mono_name);
-                            }
+                for (const MonoInstance *inst = mono_table_find_group(codegen->mono_table, struct_name, 0);
+                     inst != NULL; inst = inst->next_in_group) {
+                    // 跳过包含未解析类型参数的实例
+                    if (has_unresolved_mono_type_args(decl,
+                        inst->type_arg_nodes,
+                        inst->type_arg_count)) {
+                        continue;
+                    }
+                    // 为该单态化实例生成方法原型
+                    const char *mono_name = get_mono_struct_name(codegen, struct_name,
+                        inst->type_arg_nodes,
+                        inst->type_arg_count);
+                    // 设置单态化上下文
+                    TypeParam *saved_tp = codegen->current_type_params;
+                    int saved_tpc = codegen->current_type_param_count;
+                    ASTNode **saved_ta = codegen->current_type_args;
+                    int saved_tac = codegen->current_type_arg_count;
+                    codegen->current_type_params = decl->data.struct_decl.type_params;
+                    codegen->current_type_param_count = decl->data.struct_decl.type_param_count;
+                    codegen->current_type_args = inst->type_arg_nodes;
+                    codegen->current_type_arg_count = inst->type_arg_count;
+                    
+                    for (int j = 0; j < decl->data.struct_decl.method_count; j++) {
+                        ASTNode *m = decl->data.struct_decl.methods[j];
+                        if (m && m->type == AST_FN_DECL) {
+                            gen_method_prototype(codegen, m, mono_name);
                         }
-                        
-                        // 恢复上下文
-                        codegen->current_type_params = saved_tp;
-                        codegen->current_type_param_count = saved_tpc;
-                        codegen->current_type_args = saved_ta;
-                        codegen->current_type_arg_count = saved_tac;
                     }
+                    
+                    // 恢复上下文
+                    codegen->current_type_params = saved_tp;
+                    codegen->current_type_param_count = saved_tpc;
+                    codegen->current_type_args = saved_ta;
+                    codegen->current_type_arg_count = saved_tac;
                 }
             } else {
                 for (int j = 0; j < decl->data.struct_decl.method_count; j++) {
@@ -683,7 +695,7 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
     }
     // 第七步 b：生成 vtable 常量（依赖方法前向声明）
     emit_vtable_constants(codegen);
-    fputs("\n", codegen->output);
+    emitter_lit(codegen->output, "\n");
 
     // 第七步 c：收集所有测试语句
     ASTNode *tests[MAX_TESTS];
@@ -716,13 +728,22 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
             if (!test || test->type != AST_TEST_STMT) continue;
             const char *func_name = get_test_function_name(codegen, test->data.test_stmt.description);
             if (func_name) {
-                fprintf(codegen->output, "static void %s(void);\n", func_name);
+                emitter_printf(codegen->output, "static void %s(void);\n", func_name);
             }
         }
-        fprintf(codegen->output, "static void uya_run_tests(void);\n");
-        fputs("\n", codegen->output);
+        emitter_lit(codegen->output, "static void uya_run_tests(void);\n");
+        emitter_lit(codegen->output, "\n");
     }
 
+    time_report_stop(codegen->time_report, "codegen.prototypes", &step_timer);
+    time_report_start(codegen->time_report, &step_timer, codegen->arena);
+
+    // 拆分输出（--split N）：以上内容构成共享头文件，以下定义写入各 .c 文件
+    Emitter *header = codegen->output;
+    if (codegen->split_count > 1) {
+        c99_split_begin(codegen, output_file);
+    }
+    
     // 第八步 a：先生成所有常量（确保在函数之前定义）
     for (int i = 0; i < decl_count; i++) {
         ASTNode *decl = decls[i];
@@ -734,153 +755,36 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
         
         // 只生成常量（const 变量）
         if (decl->type == AST_VAR_DECL && decl->data.var_decl.is_const) {
+            if (codegen->split_count > 1) {
+                // 定义在第 0 个 .c 文件中，头文件中声明
+                Emitter *output = codegen->output;
+                codegen->output = header;
+                gen_global_var_extern(codegen, decl);
+                codegen->output = output;
+            }
             gen_global_var(codegen, decl);
-            fputs("\n", codegen->output);
+            emitter_lit(codegen->output, "\n");
         }
     }
     
     // 第八步 b：生成所有声明（非常量全局变量、函数定义）
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl) continue;
-        
-        // 跳过 use 语句（模块导入，不需要生成代码）
-        if (decl->type == AST_USE_STMT) continue;
-        if (decl->type == AST_MACRO_DECL) continue;  /* 宏不生成代码，编译时已展开 */
-        
-        switch (decl->type) {
-            case AST_UNION_DECL: {
-                const char *union_name = decl->data.union_decl.name;
-                for (int j = 0; j < decl->data.union_decl.method_count; j++) {
-                    ASTNode *m = decl->data.union_decl.methods[j];
-                    if (m && m->type == AST_FN_DECL && m->data.fn_decl.body) {
-                        gen_method_function(codegen, m, union_name);
-                        fputs("\n", codegen->output);
-                    }
-                }
-                break;
-            }
-            case AST_STRUCT_DECL: {
-                const char *struct_name = decl->data.struct_decl.name;
-                // 跳过泛型结构体模板的内部方法，为单态化实例生成方法定义
-                if (is_generic_struct_c99(decl)) {
-                    for (int k = 0; k < codegen->mono_instance_count; k++) {
-                        if (codegen->mono_instances[k].generic_name &&
-                            strcmp(codegen->mono_instances[k].generic_name, struct_name) == 0 &&
-                            !codegen->mono_instances[k].is_function) {
-                            // 跳过包含未解析类型参数的实例
-                            if (has_unresolved_mono_type_args(decl,
-                                codegen->mono_instances[k].type_args,
-                                codegen->mono_instances[k].type_arg_count)) {
-                                continue;
-                            }
-                            // 为该单态化实例生成方法定义
-                            const char *mono_name = get_mono_struct_name(codegen, struct_name,
-                                codegen->mono_instances[k].type_args,
-                                codegen->mono_instances[k].type_arg_count);
-                            // 设置单态化上下文
-                            TypeParam *saved_tp = codegen->current_type_params;
-                            int saved_tpc = codegen->current_type_param_count;
-                            ASTNode **saved_ta = codegen->current_type_args;
-                            int saved_tac = codegen->current_type_arg_count;
-                            codegen->current_type_params = decl->data.struct_decl.type_params;
-                            codegen->current_type_param_count = decl->data.struct_decl.type_param_count;
-                            codegen->current_type_args = codegen->mono_instances[k].type_args;
-                            codegen->current_type_arg_count = codegen->mono_instances[k].type_arg_count;
-                            
-                            for (int j = 0; j < decl->data.struct_decl.method_count; j++) {
-                                ASTNode *m = decl->data.struct_decl.methods[j];
-                                if (m && m->type == AST_FN_DECL && m->data.fn_decl.body) {
-                                    gen_method_function(codegen, m, mono_name);
-                                    fputs("\n", codegen->output);
-                                }
-                            }
-                            
-                            // 恢复上下文
-                            codegen->current_type_params = saved_tp;
-                            codegen->current_type_param_count = saved_tpc;
-                            codegen->current_type_args = saved_ta;
-                            codegen->current_type_arg_count = saved_tac;
-                        }
-                    }
-                } else {
-                    for (int j = 0; j < decl->data.struct_decl.method_count; j++) {
-                        ASTNode *m = decl->data.struct_decl.methods[j];
-                        if (m && m->type == AST_FN_DECL && m->data.fn_decl.body) {
-                            gen_method_function(codegen, m, struct_name);
-                            fputs("\n", codegen->output);
-                        }
-                    }
-                }
-                break;
-            }
-            case AST_ENUM_DECL:
-                // 已在前面生成
-                break;
-            case AST_VAR_DECL:
-                // 常量已在第八步 a 生成，这里只生成非常量变量
-                if (!decl->data.var_decl.is_const) {
-                    gen_global_var(codegen, decl);
-                    fputs("\n", codegen->output);
-                }
-                break;
-            case AST_FN_DECL: {
-                // 特殊处理：main 函数在第九步生成（需要添加测试运行器调用）
-                const char *func_name = decl->data.fn_decl.name;
-                int is_main = (func_name && strcmp(func_name, "main") == 0) ? 1 : 0;
-                if (!is_main) {
-                    // 跳过泛型函数模板，为单态化实例生成定义
-                    if (is_generic_function_c99(decl)) {
-                        for (int j = 0; j < codegen->mono_instance_count; j++) {
-                            if (codegen->mono_instances[j].generic_name &&
-                                strcmp(codegen->mono_instances[j].generic_name, func_name) == 0 &&
-                                codegen->mono_instances[j].is_function) {
-                                gen_mono_function(codegen, decl,
-                                    codegen->mono_instances[j].type_args,
-                                    codegen->mono_instances[j].type_arg_count);
-                                fputs("\n", codegen->output);
-                            }
-                        }
-                    } else {
-                        // 只生成有函数体的定义（外部函数由前向声明处理）
-                        gen_function(codegen, decl);
-                        fputs("\n", codegen->output);
-                    }
-                }
-                break;
-            }
-            case AST_METHOD_BLOCK: {
-                const char *type_name = decl->data.method_block.struct_name ? decl->data.method_block.struct_name : decl->data.method_block.union_name;
-                if (type_name) {
-                    for (int j = 0; j < decl->data.method_block.method_count; j++) {
-                        ASTNode *m = decl->data.method_block.methods[j];
-                        if (m && m->type == AST_FN_DECL && m->data.fn_decl.body) {
-                            gen_method_function(codegen, m, type_name);
-                            fputs("\n", codegen->output);
-                        }
-                    }
-                }
-                break;
-            }
-            case AST_ERROR_DECL:
-                break;
-            case AST_TEST_STMT:
-                // 测试语句在下面统一生成
-                break;
-            // 忽略其他声明类型（暂时）
-            default:
-                break;
-        }
+    // 按声明顺序收集为生成单元，-jN 时并行生成函数定义（输出与串行生成相同）
+    C99CodegenUnit *units = NULL;
+    int unit_count = 0;
+    c99_collect_units(codegen, decls, decl_count, &units, &unit_count);
+    c99_gen_units(codegen, units, unit_count);
+    if (codegen->split_count > 1) {
+        c99_split_units(codegen, header, units, unit_count);
     }
     
     // 第八步 b：生成所有测试函数和测试运行器
     if (test_count > 0) {
         for (int i = 0; i < test_count; i++) {
             gen_test_function(codegen, tests[i]);
-            fputs("\n", codegen->output);
+            emitter_lit(codegen->output, "\n");
         }
         gen_test_runner(codegen, tests, test_count);
-        fputs("\n", codegen->output);
+        emitter_lit(codegen->output, "\n");
     }
     
     // 第九步：生成 main 函数（uya_main），在开始时调用测试运行器
@@ -893,7 +797,7 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
             // 生成 main 函数（重命名为 uya_main）
             emit_line_directive(codegen, decl->line, decl->filename);
             const char *return_c = convert_array_return_type(codegen, decl->data.fn_decl.return_type);
-            fprintf(codegen->output, "%s uya_main(void) {\n", return_c);
+            emitter_printf(codegen->output, "%s uya_main(void) {\n", return_c);
             
             // 保存并设置当前函数的返回类型（用于生成返回语句）
             ASTNode *saved_return_type = codegen->current_function_return_type;
@@ -901,7 +805,7 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
             
             // 如果有测试，在函数体开始处调用测试运行器
             if (test_count > 0) {
-                fprintf(codegen->output, "    uya_run_tests();\n");
+                emitter_lit(codegen->output, "    uya_run_tests();\n");
             }
             
             // 生成原始函数体
@@ -917,12 +821,14 @@ int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *ou
             // 恢复之前的返回类型
             codegen->current_function_return_type = saved_return_type;
             
-            fprintf(codegen->output, "}\n");
+            emitter_lit(codegen->output, "}\n");
             break;
         }
     }
     
     // 如果没有 main 函数，则不生成 uya_main（由测试时的 bridge.c 提供 main() 并调用 uya_main()）
     
+    time_report_stop(codegen->time_report, "codegen.definitions", &step_timer);
+    codegen->output = header;
     return 0;
 }
\ No newline at end of file
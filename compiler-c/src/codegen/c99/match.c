@@ -0,0 +1,262 @@
+#include "internal.h"
+#include <string.h>
+
+// match 的 switch 分派（expr.c 与 stmt.c 共用）
+// 整数/布尔常量、枚举、联合体标签与错误码模式都是编译期整数，可以降级为 C 的 switch，
+// 由 C 编译器生成跳转表或二分查找，而不是逐臂比较的 if-else 链。
+
+// 判断 C 类型能否作为 switch 的控制表达式（整数、布尔与枚举）
+static int c99_is_switchable_c_type(const char *c_type) {
+    if (!c_type) {
+        return 0;
+    }
+    if (strncmp(c_type, "enum ", 5) == 0 || strcmp(c_type, "bool") == 0 ||
+        strcmp(c_type, "char") == 0 || strcmp(c_type, "int") == 0 || strcmp(c_type, "size_t") == 0) {
+        return 1;
+    }
+    size_t len = strlen(c_type);
+    if ((strncmp(c_type, "int", 3) == 0 || strncmp(c_type, "uint", 4) == 0) &&
+        len > 2 && strcmp(c_type + len - 2, "_t") == 0) {
+        return 1;
+    }
+    return 0;
+}
+
+// 判断臂是否为兜底模式（绑定、通配或 else）
+static int c99_match_arm_is_default(const ASTMatchArm *arm) {
+    return arm->kind == MATCH_PAT_BIND || arm->kind == MATCH_PAT_WILDCARD || arm->kind == MATCH_PAT_ELSE;
+}
+
+// 计算臂的 case 值
+// 返回：1 表示得到 case 值，0 表示该臂在 if 链中也不会命中（跳过），-1 表示无法用 switch 分派
+static int c99_match_arm_case_value(C99CodeGenerator *codegen, const ASTMatchArm *arm,
+                                    C99MatchSubject *subject, long long *value) {
+    switch (arm->kind) {
+        case MATCH_PAT_LITERAL: {
+            ASTNode *lit = arm->data.literal.expr;
+            if (!lit) return -1;
+            *subject = C99_MATCH_SUBJECT_VALUE;
+            if (lit->type == AST_NUMBER) {
+                *value = lit->data.number.value;
+                return 1;
+            }
+            if (lit->type == AST_BOOL) {
+                *value = lit->data.bool_literal.value ? 1 : 0;
+                return 1;
+            }
+            return -1;
+        }
+        case MATCH_PAT_ENUM: {
+            ASTNode *enum_decl = find_enum_decl_c99(codegen, arm->data.enum_pat.enum_name);
+            int ev = enum_decl ? find_enum_variant_value(codegen, enum_decl, arm->data.enum_pat.variant_name) : -1;
+            *subject = C99_MATCH_SUBJECT_VALUE;
+            if (ev < 0) return 0;  /* if 链中为 if (0) 占位 */
+            *value = ev;
+            return 1;
+        }
+        case MATCH_PAT_ERROR: {
+            unsigned id = arm->data.error_pat.error_name ? get_or_add_error_id(codegen, arm->data.error_pat.error_name) : 0;
+            if (id == 0) id = 1;
+            *subject = C99_MATCH_SUBJECT_ERROR_ID;
+            *value = id;
+            return 1;
+        }
+        case MATCH_PAT_UNION: {
+            if (!arm->data.union_pat.variant_name) return 0;
+            ASTNode *union_decl = find_union_decl_by_variant_c99(codegen, arm->data.union_pat.variant_name);
+            if (!union_decl) return 0;  /* if 链中不生成该臂 */
+            int idx = find_union_variant_index(union_decl, arm->data.union_pat.variant_name);
+            if (idx < 0) return 0;
+            *subject = C99_MATCH_SUBJECT_TAG;
+            *value = idx;
+            return 1;
+        }
+        default:
+            return -1;
+    }
+}
+
+// 判断两个臂的结果是否为相同的简单值（可合并为一个 case 区间）
+static int c99_match_same_simple_result(const ASTMatchArm *a, const ASTMatchArm *b) {
+    if (a->kind == MATCH_PAT_UNION && a->data.union_pat.var_name && strcmp(a->data.union_pat.var_name, "_") != 0) return 0;
+    if (b->kind == MATCH_PAT_UNION && b->data.union_pat.var_name && strcmp(b->data.union_pat.var_name, "_") != 0) return 0;
+    ASTNode *x = a->result_expr;
+    ASTNode *y = b->result_expr;
+    if (!x || !y || x->type != y->type) return 0;
+    switch (x->type) {
+        case AST_NUMBER:
+            return x->data.number.value == y->data.number.value;
+        case AST_BOOL:
+            return x->data.bool_literal.value == y->data.bool_literal.value;
+        case AST_IDENTIFIER:
+            return x->data.identifier.name && y->data.identifier.name &&
+                   strcmp(x->data.identifier.name, y->data.identifier.name) == 0;
+        default:
+            return 0;
+    }
+}
+
+// 判断节点中是否有作用于外层循环的 break（switch 内的 break 只会跳出 switch）
+static int c99_node_has_loop_break(ASTNode *node) {
+    if (!node) {
+        return 0;
+    }
+    switch (node->type) {
+        case AST_BREAK_STMT:
+            return 1;
+        case AST_WHILE_STMT:
+        case AST_FOR_STMT:
+            return 0;  /* 循环体内的 break 属于该循环 */
+        case AST_BLOCK:
+            for (int i = 0; i < node->data.block.stmt_count; i++) {
+                if (c99_node_has_loop_break(node->data.block.stmts[i])) return 1;
+            }
+            return 0;
+        case AST_IF_STMT:
+            return c99_node_has_loop_break(node->data.if_stmt.condition) ||
+                   c99_node_has_loop_break(node->data.if_stmt.then_branch) ||
+                   c99_node_has_loop_break(node->data.if_stmt.else_branch);
+        case AST_DEFER_STMT:
+            return c99_node_has_loop_break(node->data.defer_stmt.body);
+        case AST_ERRDEFER_STMT:
+            return c99_node_has_loop_break(node->data.errdefer_stmt.body);
+        case AST_VAR_DECL:
+            return c99_node_has_loop_break(node->data.var_decl.init);
+        case AST_RETURN_STMT:
+            return c99_node_has_loop_break(node->data.return_stmt.expr);
+        case AST_ASSIGN:
+            return c99_node_has_loop_break(node->data.assign.dest) ||
+                   c99_node_has_loop_break(node->data.assign.src);
+        case AST_MATCH_EXPR:
+            if (c99_node_has_loop_break(node->data.match_expr.expr)) return 1;
+            for (int i = 0; i < node->data.match_expr.arm_count; i++) {
+                if (c99_node_has_loop_break(node->data.match_expr.arms[i].result_expr)) return 1;
+            }
+            return 0;
+        case AST_CATCH_EXPR:
+            return c99_node_has_loop_break(node->data.catch_expr.operand) ||
+                   c99_node_has_loop_break(node->data.catch_expr.catch_block);
+        case AST_TRY_EXPR:
+            return c99_node_has_loop_break(node->data.try_expr.operand);
+        case AST_BINARY_EXPR:
+            return c99_node_has_loop_break(node->data.binary_expr.left) ||
+                   c99_node_has_loop_break(node->data.binary_expr.right);
+        case AST_UNARY_EXPR:
+            return c99_node_has_loop_break(node->data.unary_expr.operand);
+        case AST_CAST_EXPR:
+            return c99_node_has_loop_break(node->data.cast_expr.expr);
+        case AST_MEMBER_ACCESS:
+            return c99_node_has_loop_break(node->data.member_access.object);
+        case AST_ARRAY_ACCESS:
+            return c99_node_has_loop_break(node->data.array_access.array) ||
+                   c99_node_has_loop_break(node->data.array_access.index);
+        case AST_CALL_EXPR:
+            if (c99_node_has_loop_break(node->data.call_expr.callee)) return 1;
+            for (int i = 0; i < node->data.call_expr.arg_count; i++) {
+                if (c99_node_has_loop_break(node->data.call_expr.args[i])) return 1;
+            }
+            return 0;
+        case AST_STRUCT_INIT:
+            for (int i = 0; i < node->data.struct_init.field_count; i++) {
+                if (c99_node_has_loop_break(node->data.struct_init.field_values[i])) return 1;
+            }
+            return 0;
+        case AST_ARRAY_LITERAL:
+            for (int i = 0; i < node->data.array_literal.element_count; i++) {
+                if (c99_node_has_loop_break(node->data.array_literal.elements[i])) return 1;
+            }
+            return 0;
+        case AST_TUPLE_LITERAL:
+            for (int i = 0; i < node->data.tuple_literal.element_count; i++) {
+                if (c99_node_has_loop_break(node->data.tuple_literal.elements[i])) return 1;
+            }
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+// 判断值是否已被之前的 case 覆盖
+static int c99_match_value_taken(const C99MatchPlan *plan, long long value) {
+    for (int c = 0; c < plan->case_count; c++) {
+        if (value >= plan->cases[c].lo && value <= plan->cases[c].hi) return 1;
+    }
+    return 0;
+}
+
+int c99_plan_match_switch(C99CodeGenerator *codegen, ASTNode *match, const char *m_type, C99MatchPlan *plan) {
+    int arm_count = match->data.match_expr.arm_count;
+    ASTMatchArm *arms = match->data.match_expr.arms;
+    memset(plan, 0, sizeof(C99MatchPlan));
+    plan->default_arm = -1;
+    if (arm_count <= 0) {
+        return 0;
+    }
+
+    // 计算各臂的 case 值（兜底臂之后的臂不可达，不再计算）
+    long long *values = (long long *)arena_alloc(codegen->arena, sizeof(long long) * (size_t)arm_count);
+    int *has_value = (int *)arena_alloc(codegen->arena, sizeof(int) * (size_t)arm_count);
+    plan->cases = (C99MatchCase *)arena_alloc(codegen->arena, sizeof(C99MatchCase) * (size_t)arm_count);
+    if (!values || !has_value || !plan->cases) {
+        return 0;
+    }
+    int have_subject = 0;
+    C99MatchSubject subject = C99_MATCH_SUBJECT_VALUE;
+    int last = arm_count;
+    for (int i = 0; i < arm_count; i++) {
+        if (c99_match_arm_is_default(&arms[i])) {
+            plan->default_arm = i;
+            last = i;
+            break;
+        }
+        C99MatchSubject s = C99_MATCH_SUBJECT_VALUE;
+        int r = c99_match_arm_case_value(codegen, &arms[i], &s, &values[i]);
+        if (r < 0) return 0;
+        if (have_subject && s != subject) return 0;
+        subject = s;
+        have_subject = 1;
+        has_value[i] = r;
+    }
+    if (subject == C99_MATCH_SUBJECT_VALUE && !c99_is_switchable_c_type(m_type)) {
+        return 0;
+    }
+    for (int i = 0; i < arm_count; i++) {
+        if (c99_node_has_loop_break(arms[i].result_expr)) return 0;
+    }
+
+    // 重复的值只保留第一个（与 if 链的命中顺序一致）；
+    // 相邻臂的值连续且结果为相同的简单值时合并为 case lo ... hi
+    for (int i = 0; i < last; i++) {
+        if (!has_value[i] || c99_match_value_taken(plan, values[i])) continue;
+        C99MatchCase *mc = &plan->cases[plan->case_count++];
+        mc->arm = i;
+        mc->lo = values[i];
+        mc->hi = values[i];
+        while (i + 1 < last && has_value[i + 1] && values[i + 1] == mc->hi + 1 &&
+               c99_match_same_simple_result(&arms[mc->arm], &arms[i + 1]) &&
+               !c99_match_value_taken(plan, values[i + 1])) {
+            mc->hi = values[++i];
+        }
+    }
+    if (plan->case_count == 0) {
+        return 0;
+    }
+    plan->subject = subject;
+    return 1;
+}
+
+void c99_format_match_case_label(const C99MatchCase *mc, char *buf, size_t size) {
+    if (mc->lo == mc->hi) {
+        snprintf(buf, size, "case %lld: ", mc->lo);
+    } else {
+        snprintf(buf, size, "case %lld ... %lld: ", mc->lo, mc->hi);
+    }
+}
+
+const char *c99_match_subject_expr(const C99MatchPlan *plan) {
+    switch (plan->subject) {
+        case C99_MATCH_SUBJECT_TAG: return "_uya_m._tag";
+        case C99_MATCH_SUBJECT_ERROR_ID: return "_uya_m.error_id";
+        default: return "_uya_m";
+    }
+}
@@ -0,0 +1,439 @@
+#include "internal.h"
+#include "thread_pool.h"
+#include <string.h>
+
+// 单元输出缓冲区的第一块容量（多数函数的输出不超过几 KB）
+#define C99_UNIT_CHUNK_SIZE 4096
+
+// 生成单元与并行生成（-jN）
+// 函数定义之间只通过以下状态互相影响：
+//   1. 只读的全局表（字符串常量、结构体、切片结构体、枚举、函数声明等，函数体生成时不应再追加）；
+//   2. 全局变量表（按声明顺序追加，函数只能看到它之前的全局变量）；
+//   3. 字符串插值临时变量编号（interp_temp_counter / interp_fill_counter，整个文件递增）；
+//   4. #line 指令的当前行号与文件名（与前一条指令相同时省略）。
+// 并行生成时每个工作线程持有代码生成器的私有副本与私有 Arena，每个单元写入自己的输出缓冲区，
+// 编号从 0 开始、行号状态为空；随后按声明顺序推算串行生成时每个单元的真实起始状态，
+// 只有依赖起始状态（用到了编号或第一条 #line 指令恰好与之前相同）的少数单元用真实状态重新生成，
+// 最后按声明顺序拼接，输出与串行生成逐字节相同。
+// 若有单元向只读全局表追加了条目（生成顺序会影响结果），放弃并行结果，整体回退为串行生成。
+
+// 单元生成前的串行状态
+typedef struct C99UnitState {
+    int temp_counter;               // interp_temp_counter
+    int fill_counter;               // interp_fill_counter
+    int line;                       // current_line
+    const char *filename;           // current_filename
+} C99UnitState;
+
+// 全局表的条目数（用于检测单元是否追加了条目）
+typedef struct C99TableCounts {
+    int string_constant_count;
+    int struct_definition_count;
+    int enum_definition_count;
+    int function_declaration_count;
+    int slice_struct_count;
+} C99TableCounts;
+
+// 并行生成上下文
+typedef struct C99ParallelJobs {
+    C99CodeGenerator *workers;      // 每个工作线程的代码生成器副本
+    C99CodegenUnit *units;          // 全部单元
+    const int *indices;             // 本轮要生成的单元下标
+    const C99UnitState *states;     // 本轮各单元的起始状态（与 indices 对应）
+} C99ParallelJobs;
+
+// 追加一个生成单元
+static void add_unit(C99CodeGenerator *codegen, C99CodegenUnit **units, int *unit_count, int *capacity,
+                     C99UnitKind kind, ASTNode *decl, const char *type_name) {
+    if (*unit_count >= *capacity) {
+        int new_capacity = *capacity > 0 ? *capacity * 2 : 64;
+        C99CodegenUnit *grown = (C99CodegenUnit *)arena_alloc(codegen->arena, sizeof(C99CodegenUnit) * (size_t)new_capacity);
+        if (*unit_count > 0) {
+            memcpy(grown, *units, sizeof(C99CodegenUnit) * (size_t)*unit_count);
+        }
+        *units = grown;
+        *capacity = new_capacity;
+    }
+    C99CodegenUnit *unit = &(*units)[(*unit_count)++];
+    memset(unit, 0, sizeof(*unit));
+    unit->kind = kind;
+    unit->decl = decl;
+    unit->type_name = type_name;
+}
+
+// 按声明顺序收集第八步 b 的生成单元（顺序与串行生成时完全一致）
+void c99_collect_units(C99CodeGenerator *codegen, ASTNode **decls, int decl_count, C99CodegenUnit **units, int *unit_count) {
+    int capacity = 0;
+    *units = NULL;
+    *unit_count = 0;
+
+    for (int i = 0; i < decl_count; i++) {
+        ASTNode *decl = decls[i];
+        if (!decl) continue;
+
+        switch (decl->type) {
+            case AST_UNION_DECL: {
+                const char *union_name = decl->data.union_decl.name;
+                for (int j = 0; j < decl->data.union_decl.method_count; j++) {
+                    ASTNode *m = decl->data.union_decl.methods[j];
+                    if (m && m->type == AST_FN_DECL && m->data.fn_decl.body) {
+                        add_unit(codegen, units, unit_count, &capacity, C99_UNIT_METHOD, m, union_name);
+                    }
+                }
+                break;
+            }
+            case AST_STRUCT_DECL: {
+                const char *struct_name = decl->data.struct_decl.name;
+                // 跳过泛型结构体模板的内部方法，为单态化实例生成方法定义
+                if (is_generic_struct_c99(decl)) {
+                    for (const MonoInstance *inst = mono_table_find_group(codegen->mono_table, struct_name, 0);
+                         inst != NULL; inst = inst->next_in_group) {
+                        // 跳过包含未解析类型参数的实例
+                        if (has_unresolved_mono_type_args(decl,
+                            inst->type_arg_nodes,
+                            inst->type_arg_count)) {
+                            continue;
+                        }
+                        const char *mono_name = get_mono_struct_name(codegen, struct_name,
+                            inst->type_arg_nodes,
+                            inst->type_arg_count);
+                        for (int j = 0; j < decl->data.struct_decl.method_count; j++) {
+                            ASTNode *m = decl->data.struct_decl.methods[j];
+                            if (m && m->type == AST_FN_DECL && m->data.fn_decl.body) {
+                                add_unit(codegen, units, unit_count, &capacity, C99_UNIT_METHOD, m, mono_name);
+                                C99CodegenUnit *unit = &(*units)[*unit_count - 1];
+                                unit->type_params = decl->data.struct_decl.type_params;
+                                unit->type_param_count = decl->data.struct_decl.type_param_count;
+                                unit->type_args = inst->type_arg_nodes;
+                                unit->type_arg_count = inst->type_arg_count;
+                            }
+                        }
+                    }
+                } else {
+                    for (int j = 0; j < decl->data.struct_decl.method_count; j++) {
+                        ASTNode *m = decl->data.struct_decl.methods[j];
+                        if (m && m->type == AST_FN_DECL && m->data.fn_decl.body) {
+                            add_unit(codegen, units, unit_count, &capacity, C99_UNIT_METHOD, m, struct_name);
+                        }
+                    }
+                }
+                break;
+            }
+            case AST_VAR_DECL:
+                // 常量已在第八步 a 生成，这里只生成非常量变量
+                if (!decl->data.var_decl.is_const) {
+                    add_unit(codegen, units, unit_count, &capacity, C99_UNIT_GLOBAL_VAR, decl, NULL);
+                }
+                break;
+            case AST_FN_DECL: {
+                // 特殊处理：main 函数在第九步生成（需要添加测试运行器调用）
+                const char *func_name = decl->data.fn_decl.name;
+                if (func_name && strcmp(func_name, "main") == 0) {
+                    break;
+                }
+                // 跳过泛型函数模板，为单态化实例生成定义
+                if (is_generic_function_c99(decl)) {
+                    for (const MonoInstance *inst = mono_table_find_group(codegen->mono_table, func_name, 1);
+                         inst != NULL; inst = inst->next_in_group) {
+                        add_unit(codegen, units, unit_count, &capacity, C99_UNIT_MONO_FUNCTION, decl, NULL);
+                        C99CodegenUnit *unit = &(*units)[*unit_count - 1];
+                        unit->type_args = inst->type_arg_nodes;
+                        unit->type_arg_count = inst->type_arg_count;
+                    }
+                } else {
+                    // 外部函数（无函数体）由前向声明处理，这里只输出空行
+                    add_unit(codegen, units, unit_count, &capacity, C99_UNIT_FUNCTION, decl, NULL);
+                }
+                break;
+            }
+            case AST_METHOD_BLOCK: {
+                const char *type_name = decl->data.method_block.struct_name ? decl->data.method_block.struct_name : decl->data.method_block.union_name;
+                if (type_name) {
+                    for (int j = 0; j < decl->data.method_block.method_count; j++) {
+                        ASTNode *m = decl->data.method_block.methods[j];
+                        if (m && m->type == AST_FN_DECL && m->data.fn_decl.body) {
+                            add_unit(codegen, units, unit_count, &capacity, C99_UNIT_METHOD, m, type_name);
+                        }
+                    }
+                }
+                break;
+            }
+            // use 语句、宏、枚举（已在前面生成）、错误声明、测试语句（在下面统一生成）等不产生单元
+            default:
+                break;
+        }
+    }
+}
+
+// 生成单个单元（输出到 codegen->output，末尾附加空行）
+void c99_gen_unit(C99CodeGenerator *codegen, const C99CodegenUnit *unit) {
+    switch (unit->kind) {
+        case C99_UNIT_FUNCTION:
+            gen_function(codegen, unit->decl);
+            break;
+        case C99_UNIT_MONO_FUNCTION:
+            gen_mono_function(codegen, unit->decl, unit->type_args, unit->type_arg_count);
+            break;
+        case C99_UNIT_METHOD:
+            if (unit->type_params != NULL) {
+                // 设置单态化上下文
+                TypeParam *saved_tp = codegen->current_type_params;
+                int saved_tpc = codegen->current_type_param_count;
+                ASTNode **saved_ta = codegen->current_type_args;
+                int saved_tac = codegen->current_type_arg_count;
+                codegen->current_type_params = unit->type_params;
+                codegen->current_type_param_count = unit->type_param_count;
+                codegen->current_type_args = unit->type_args;
+                codegen->current_type_arg_count = unit->type_arg_count;
+
+                gen_method_function(codegen, unit->decl, unit->type_name);
+
+                // 恢复上下文
+                codegen->current_type_params = saved_tp;
+                codegen->current_type_param_count = saved_tpc;
+                codegen->current_type_args = saved_ta;
+                codegen->current_type_arg_count = saved_tac;
+            } else {
+                gen_method_function(codegen, unit->decl, unit->type_name);
+            }
+            break;
+        case C99_UNIT_GLOBAL_VAR:
+            gen_global_var(codegen, unit->decl);
+            break;
+    }
+    emitter_lit(codegen->output, "\n");
+}
+
+// 读取当前串行状态
+static C99UnitState unit_state_of(const C99CodeGenerator *codegen) {
+    C99UnitState state;
+    state.temp_counter = codegen->interp_temp_counter;
+    state.fill_counter = codegen->interp_fill_counter;
+    state.line = codegen->current_line;
+    state.filename = codegen->current_filename;
+    return state;
+}
+
+// 读取全局表的条目数
+static C99TableCounts table_counts_of(const C99CodeGenerator *codegen) {
+    C99TableCounts counts;
+    counts.string_constant_count = codegen->string_constant_count;
+    counts.struct_definition_count = codegen->struct_definition_count;
+    counts.enum_definition_count = codegen->enum_definition_count;
+    counts.function_declaration_count = codegen->function_declaration_count;
+    counts.slice_struct_count = codegen->slice_struct_count;
+    return counts;
+}
+
+static int table_counts_equal(const C99TableCounts *a, const C99TableCounts *b) {
+    return a->string_constant_count == b->string_constant_count &&
+           a->struct_definition_count == b->struct_definition_count &&
+           a->enum_definition_count == b->enum_definition_count &&
+           a->function_declaration_count == b->function_declaration_count &&
+           a->slice_struct_count == b->slice_struct_count;
+}
+
+// 从给定起始状态生成单元到单元自己的输出缓冲区，并记录单元对状态的使用情况
+static void gen_unit_isolated(C99CodeGenerator *codegen, C99CodegenUnit *unit, const C99UnitState *start) {
+    emitter_init_sized(&unit->output, codegen->arena, C99_UNIT_CHUNK_SIZE);
+    codegen->output = &unit->output;
+    codegen->interp_temp_counter = start->temp_counter;
+    codegen->interp_fill_counter = start->fill_counter;
+    codegen->current_line = start->line;
+    codegen->current_filename = start->filename;
+    codegen->first_line_directive = 0;
+    codegen->first_line_filename = NULL;
+    codegen->global_variable_count = unit->global_count;
+
+    c99_gen_unit(codegen, unit);
+
+    unit->temp_count = codegen->interp_temp_counter - start->temp_counter;
+    unit->fill_count = codegen->interp_fill_counter - start->fill_counter;
+    unit->first_line = codegen->first_line_directive;
+    unit->first_filename = codegen->first_line_filename;
+    unit->last_line = codegen->current_line;
+    unit->last_filename = codegen->current_filename;
+}
+
+// 单元的输出是否与串行生成时相同（pass_start 为实际使用的起始状态，serial 为串行时的起始状态）
+static int unit_output_valid(const C99CodegenUnit *unit, const C99UnitState *pass_start, const C99UnitState *serial) {
+    if (unit->temp_count > 0 && pass_start->temp_counter != serial->temp_counter) return 0;
+    if (unit->fill_count > 0 && pass_start->fill_counter != serial->fill_counter) return 0;
+    // 第一条 #line 指令：实际起始状态下已输出，串行时若与之前状态相同则会被省略
+    if (unit->first_line > 0 &&
+        (pass_start->line == unit->first_line && pass_start->filename == unit->first_filename) !=
+        (serial->line == unit->first_line && serial->filename == unit->first_filename)) {
+        return 0;
+    }
+    return 1;
+}
+
+// 推进串行状态（单元消耗的编号与结束时的行号状态不依赖起始状态）
+static void unit_state_advance(C99UnitState *state, const C99CodegenUnit *unit) {
+    state->temp_counter += unit->temp_count;
+    state->fill_counter += unit->fill_count;
+    if (unit->first_line > 0) {
+        state->line = unit->last_line;
+        state->filename = unit->last_filename;
+    }
+}
+
+// 线程池任务：在工作线程私有的代码生成器中生成一个单元
+static void parallel_unit_run(void *ctx, int worker, int task) {
+    C99ParallelJobs *jobs = (C99ParallelJobs *)ctx;
+    gen_unit_isolated(&jobs->workers[worker], &jobs->units[jobs->indices[task]], &jobs->states[task]);
+}
+
+// 串行生成全部单元
+// 拆分输出时每个单元写入自己的缓冲区（之后按大小分配到各 .c 文件），并从空的 #line 状态开始，
+// 使单元无论分到哪个文件，第一条 #line 指令都不会因与前一单元相同而被省略
+static void gen_units_serial(C99CodeGenerator *codegen, C99CodegenUnit *units, int unit_count) {
+    Emitter *output = codegen->output;
+    for (int i = 0; i < unit_count; i++) {
+        if (codegen->split_count > 1) {
+            emitter_init_sized(&units[i].output, codegen->arena, C99_UNIT_CHUNK_SIZE);
+            codegen->output = &units[i].output;
+            codegen->current_line = 0;
+            codegen->current_filename = NULL;
+        }
+        c99_gen_unit(codegen, &units[i]);
+    }
+    codegen->output = output;
+}
+
+// 并行生成全部单元
+// 返回：成功返回 0；单元之间存在无法并行的依赖时返回 -1（codegen 状态已恢复，调用者应串行生成）
+static int gen_units_parallel(C99CodeGenerator *codegen, C99CodegenUnit *units, int unit_count) {
+    Emitter *output = codegen->output;
+    C99UnitState initial = unit_state_of(codegen);
+    C99TableCounts tables = table_counts_of(codegen);
+    int initial_global_count = codegen->global_variable_count;
+    int initial_error_count = codegen->error_count;
+    const C99UnitState empty = { 0, 0, 0, NULL };
+
+    // 1. 在主生成器上按顺序生成全局变量单元（全局变量表按声明顺序追加），
+    //    同时记录每个单元生成时可见的全局变量数量
+    for (int i = 0; i < unit_count; i++) {
+        units[i].global_count = codegen->global_variable_count;
+        if (units[i].kind == C99_UNIT_GLOBAL_VAR) {
+            gen_unit_isolated(codegen, &units[i], &empty);
+        }
+    }
+    int final_global_count = codegen->global_variable_count;
+    C99TableCounts counts = table_counts_of(codegen);
+    int failed = !table_counts_equal(&tables, &counts);
+
+    // 2. 其余单元由工作线程从空状态并行生成（每个线程使用代码生成器副本与私有 Arena）
+    int *indices = (int *)arena_alloc(codegen->arena, sizeof(int) * (size_t)unit_count);
+    C99UnitState *states = (C99UnitState *)arena_alloc(codegen->arena, sizeof(C99UnitState) * (size_t)unit_count);
+    int task_count = 0;
+    for (int i = 0; i < unit_count; i++) {
+        if (units[i].kind != C99_UNIT_GLOBAL_VAR) {
+            indices[task_count] = i;
+            states[task_count] = empty;
+            task_count++;
+        }
+    }
+    int worker_count = codegen->jobs < task_count ? codegen->jobs : task_count;
+    if (worker_count > THREAD_POOL_MAX_WORKERS) {
+        worker_count = THREAD_POOL_MAX_WORKERS;
+    }
+    Arena worker_arenas[THREAD_POOL_MAX_WORKERS];
+    C99CodeGenerator *workers = (C99CodeGenerator *)arena_alloc(codegen->arena,
+        sizeof(C99CodeGenerator) * (size_t)(worker_count > 0 ? worker_count : 1));
+    for (int w = 0; w < worker_count; w++) {
+        arena_init(&worker_arenas[w], NULL, 0);
+        memcpy(&workers[w], codegen, sizeof(C99CodeGenerator));
+        workers[w].arena = &worker_arenas[w];
+        workers[w].is_unit_worker = 1;
+    }
+    C99ParallelJobs jobs;
+    jobs.workers = workers;
+    jobs.units = units;
+    jobs.indices = indices;
+    jobs.states = states;
+    if (!failed && task_count > 0) {
+        thread_pool_run(worker_count, task_count, parallel_unit_run, &jobs);
+    }
+
+    // 3. 检查函数体未向只读全局表追加条目（否则生成顺序会影响结果）；
+    //    错误名称表在生成前已按整个程序编号，追加的名称按出现顺序编号，同样依赖生成顺序
+    for (int w = 0; w < worker_count && !failed; w++) {
+        counts = table_counts_of(&workers[w]);
+        if (!table_counts_equal(&tables, &counts) || workers[w].error_count != codegen->error_count) {
+            failed = 1;
+        }
+    }
+    if (failed) {
+        // 恢复状态，由调用者串行生成
+        for (int w = 0; w < worker_count; w++) {
+            arena_reset(&worker_arenas[w]);
+        }
+        codegen->output = output;
+        codegen->interp_temp_counter = initial.temp_counter;
+        codegen->interp_fill_counter = initial.fill_counter;
+        codegen->current_line = initial.line;
+        codegen->current_filename = initial.filename;
+        codegen->global_variable_count = initial_global_count;
+        codegen->error_count = initial_error_count;
+        return -1;
+    }
+
+    // 4. 按声明顺序推算每个单元的串行起始状态，依赖起始状态的单元用真实状态重新生成
+    C99UnitState serial = initial;
+    int rerun_count = 0;
+    for (int i = 0; i < unit_count; i++) {
+        if (codegen->split_count > 1) {
+            // 拆分输出：每个单元从空的 #line 状态开始（与串行拆分生成一致）
+            serial.line = 0;
+            serial.filename = NULL;
+        }
+        if (!unit_output_valid(&units[i], &empty, &serial)) {
+            if (units[i].kind == C99_UNIT_GLOBAL_VAR) {
+                gen_unit_isolated(codegen, &units[i], &serial);
+            } else {
+                indices[rerun_count] = i;
+                states[rerun_count] = serial;
+                rerun_count++;
+            }
+        }
+        unit_state_advance(&serial, &units[i]);
+    }
+    if (rerun_count > 0) {
+        thread_pool_run(worker_count < rerun_count ? worker_count : rerun_count,
+                        rerun_count, parallel_unit_run, &jobs);
+    }
+
+    // 5. 按声明顺序拼接输出（拆分输出时复制到主 Arena，由 c99_split_units 分配到各 .c 文件），
+    //    恢复主生成器的状态为串行生成结束时的状态
+    codegen->output = output;
+    for (int i = 0; i < unit_count; i++) {
+        if (codegen->split_count > 1) {
+            Emitter copy;
+            emitter_init_sized(&copy, codegen->arena, emitter_size(&units[i].output) + 1);
+            emitter_append(&copy, &units[i].output);
+            units[i].output = copy;
+        } else {
+            emitter_append(output, &units[i].output);
+        }
+    }
+    codegen->interp_temp_counter = serial.temp_counter;
+    codegen->interp_fill_counter = serial.fill_counter;
+    codegen->current_line = serial.line;
+    codegen->current_filename = serial.filename;
+    codegen->global_variable_count = final_global_count;
+    for (int w = 0; w < worker_count; w++) {
+        if (workers[w].needs_string_h) {
+            codegen->needs_string_h = 1;
+        }
+        arena_reset(&worker_arenas[w]);
+    }
+    return 0;
+}
+
+// 生成全部单元（-jN 时并行生成，输出与串行生成逐字节相同）
+void c99_gen_units(C99CodeGenerator *codegen, C99CodegenUnit *units, int unit_count) {
+    if (codegen->jobs <= 1 || unit_count <= 1 || gen_units_parallel(codegen, units, unit_count) != 0) {
+        gen_units_serial(codegen, units, unit_count);
+    }
+}
@@ -0,0 +1,2091 @@
+#include "internal.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 区间分析：证明数组/切片下标、除数与整数运算的安全性（--safety-checks / --safety-report）
+// uya.md §14 要求越界访问、除零与整数溢出在编译期证明安全，证明失败处才需要运行时检查。
+//
+// 分析在函数生成之前逐函数完成（并行生成时只读）：
+//   每个整数局部变量（未取地址、未在 defer 中赋值）维护取值区间 [lo, hi] 与
+//   "变量 + off < @len(S)" 形式的长度事实，沿控制流传播：if/while 条件细化两侧分支，
+//   汇合处取并集，循环迭代到不动点（两轮后仍在增长的边界放宽到类型边界，
+//   嵌套过深或超过工作量上限时直接把循环内赋值的变量放宽为类型范围，只分析一轮）。
+//   下标区间落在 [0, 长度) 内、除数区间不含 0、+ - * 的精确结果区间落在运算类型范围内
+//   （有符号除法另需排除 MIN / -1）即已证明，不生成检查。溢出检查失败即终止，
+//   因此运算结果的区间总是截到类型范围内。
+// 无法证明的下标：循环体每轮都无条件执行、下标为归纳变量 ± 常量的访问外提为循环前的
+// 一次范围检查，其余在访问处检查；长度无法确定的（指针等）不检查，只在报告中列出。
+// 同一访问在循环的多轮分析中取最差结果，未被分析到的（不可达代码）不检查。
+
+// 区间端点用 128 位整数：i64/u64 的类型边界是有限值，不与表示饱和的 ±∞ 混淆
+__extension__ typedef __int128 RangeBound;
+
+#define RANGE_POS_INF ((((RangeBound)1 << 126) - 1) * 2 + 1)
+#define RANGE_NEG_INF (-RANGE_POS_INF - 1)
+#define RANGE_MAX_FACTS 4
+#define RANGE_MAX_LOOP_PASSES 16
+#define RANGE_MAX_LOOP_NEST 2
+#define RANGE_WORK_LIMIT 2000000
+
+// 检查点状态（按此顺序取最差）
+enum {
+    RANGE_PROVEN,       // 已证明安全
+    RANGE_HOISTED,      // 外提到循环前检查
+    RANGE_CHECK,        // 在访问处检查
+    RANGE_UNKNOWN       // 长度未知，不检查
+};
+
+enum {
+    RANGE_SITE_INDEX,   // 下标访问
+    RANGE_SITE_DIV,     // 除法/取模
+    RANGE_SITE_OVERFLOW // 整数 + - * 与有符号 MIN / -1 的溢出
+};
+
+typedef struct RangeInterval {
+    RangeBound lo;
+    RangeBound hi;
+} RangeInterval;
+
+// 长度事实：变量 + off < @len(sym)
+typedef struct RangeFact {
+    const char *sym;
+    long long off;
+} RangeFact;
+
+typedef struct RangeVar {
+    const char *name;
+    ASTNode *type;              // 声明类型（NULL 表示未知）
+    int tracked;                // 是否跟踪取值（整数类型、未取地址）
+    RangeInterval iv;
+    int fact_count;
+    RangeFact facts[RANGE_MAX_FACTS];
+} RangeVar;
+
+// 程序点的状态：作用域内变量按声明顺序入栈，块结束时出栈
+typedef struct RangeState {
+    RangeVar *vars;
+    int count;
+    int capacity;
+    int unreachable;
+} RangeState;
+
+typedef struct RangeNames {
+    const char **names;
+    int count;
+    int capacity;
+} RangeNames;
+
+typedef struct RangeLoop {
+    struct RangeLoop *outer;
+    ASTNode *node;
+    int base_count;             // 每轮开始时的变量数（含 for 的循环变量）
+    RangeState brk;             // break 处状态的并集
+    RangeState cont;            // continue 处状态的并集
+    const char *iv_name;        // 可外提检查的归纳变量（NULL 表示不可外提）
+    int iv_unsigned;            // 归纳变量或循环边界是无符号类型（外提检查按 uint64_t 比较）
+    RangeNames changed;         // 循环内赋值或声明的名称
+    int cond_depth;             // 循环体开始时的条件嵌套深度
+} RangeLoop;
+
+typedef struct RangeSite {
+    ASTNode *node;
+    int kind;
+    int status;
+    int always_fails;           // 每次分析都必然越界
+    long long len;              // 下标访问：长度（-1 表示运行时切片长度）
+    ASTNode *loop;              // 外提时所在的循环
+    long long off;              // 外提时下标相对归纳变量的偏移
+    int iv_unsigned;            // 外提时归纳变量或循环边界是无符号类型
+    ASTNode *type;              // 溢出：运算的整数类型
+} RangeSite;
+
+typedef struct RangeContext {
+    C99CodeGenerator *codegen;
+    Arena *scratch;             // 单个函数分析期间的临时内存
+    const char *self_name;      // 方法所属类型名（解析 Self）
+    RangeNames untracked;       // 取过地址或在 defer 中赋值的名称
+    RangeLoop *loop;
+    int loop_depth;
+    int cond_depth;             // 条件执行的嵌套深度（if 分支、&&/|| 右侧等）
+    int quiet;                  // 大于 0 时只求区间，不记录检查点
+    long work;
+    RangeSite *sites;           // 当前函数的检查点（按首次分析顺序）
+    int site_count;
+    int site_capacity;
+    int *site_slots;            // 按节点地址的开放寻址索引（-1 为空）
+    int slot_capacity;
+    ASTNode *type_bool;
+    ASTNode *type_i32;
+    ASTNode *type_usize;
+    // 全程序结果（codegen->arena）
+    C99SafetyCheck *checks;
+    int check_count;
+    int check_capacity;
+    C99SafetyHoist *hoists;
+    int hoist_count;
+    int hoist_capacity;
+    // 报告统计
+    int index_total[4];
+    int div_total[4];
+    int overflow_total[4];
+} RangeContext;
+
+static void range_exec_stmt(RangeContext *ctx, RangeState *s, ASTNode *stmt);
+static RangeInterval range_eval(RangeContext *ctx, RangeState *s, ASTNode *expr);
+static void range_opaque(RangeContext *ctx, RangeState *s, ASTNode *node, int children_only);
+static ASTNode *range_type_of(RangeContext *ctx, RangeState *s, ASTNode *expr);
+
+// ---------- 区间运算（端点饱和到 ±∞） ----------
+
+static RangeInterval range_top(void) {
+    RangeInterval r = { RANGE_NEG_INF, RANGE_POS_INF };
+    return r;
+}
+
+static RangeInterval range_const(long long v) {
+    RangeInterval r = { v, v };
+    return r;
+}
+
+static int range_is_inf(RangeBound v) {
+    return v == RANGE_NEG_INF || v == RANGE_POS_INF;
+}
+
+static RangeBound range_neg(RangeBound v) {
+    if (v == RANGE_NEG_INF) return RANGE_POS_INF;
+    if (v == RANGE_POS_INF) return RANGE_NEG_INF;
+    return -v;
+}
+
+// 饱和加法；-∞ 与 +∞ 相加时返回 conflict
+static RangeBound range_add(RangeBound a, RangeBound b, RangeBound conflict) {
+    if (a == RANGE_NEG_INF || b == RANGE_NEG_INF) {
+        return (a == RANGE_POS_INF || b == RANGE_POS_INF) ? conflict : RANGE_NEG_INF;
+    }
+    if (a == RANGE_POS_INF || b == RANGE_POS_INF) return RANGE_POS_INF;
+    RangeBound r;
+    if (__builtin_add_overflow(a, b, &r)) return a > 0 ? RANGE_POS_INF : RANGE_NEG_INF;
+    return r;
+}
+
+static RangeBound range_mul(RangeBound a, RangeBound b) {
+    if (a == 0 || b == 0) return 0;
+    int negative = (a < 0) != (b < 0);
+    if (range_is_inf(a) || range_is_inf(b)) return negative ? RANGE_NEG_INF : RANGE_POS_INF;
+    RangeBound r;
+    if (__builtin_mul_overflow(a, b, &r) || range_is_inf(r)) return negative ? RANGE_NEG_INF : RANGE_POS_INF;
+    return r;
+}
+
+static RangeBound range_min(RangeBound a, RangeBound b) {
+    return a < b ? a : b;
+}
+
+static RangeBound range_max(RangeBound a, RangeBound b) {
+    return a > b ? a : b;
+}
+
+static RangeInterval range_hull(RangeInterval a, RangeInterval b) {
+    RangeInterval r = { range_min(a.lo, b.lo), range_max(a.hi, b.hi) };
+    return r;
+}
+
+// 四个端点组合的最小/最大值
+static RangeInterval range_corners(RangeBound a, RangeBound b, RangeBound c, RangeBound d) {
+    RangeInterval r = { range_min(range_min(a, b), range_min(c, d)), range_max(range_max(a, b), range_max(c, d)) };
+    return r;
+}
+
+static int range_within(RangeInterval v, RangeInterval bound) {
+    return v.lo >= bound.lo && v.hi <= bound.hi;
+}
+
+// ---------- 类型 ----------
+
+// 整数类型的取值范围与位宽（bits 为 0 表示不是整数类型）
+static int range_int_info(const char *name, RangeInterval *bounds, int *is_unsigned) {
+    static const struct { const char *name; RangeBound lo; RangeBound hi; int bits; int is_unsigned; } ints[] = {
+        { "i8", -128, 127, 8, 0 },
+        { "i16", -32768, 32767, 16, 0 },
+        { "i32", -2147483647LL - 1, 2147483647LL, 32, 0 },
+        { "i64", LLONG_MIN, LLONG_MAX, 64, 0 },
+        { "u8", 0, 255, 8, 1 },
+        { "byte", 0, 255, 8, 1 },
+        { "u16", 0, 65535, 16, 1 },
+        { "u32", 0, 4294967295LL, 32, 1 },
+        { "u64", 0, ULLONG_MAX, 64, 1 },
+        { "usize", 0, ULLONG_MAX, 64, 1 },
+        { "bool", 0, 1, 1, 1 },
+    };
+    if (!name) return 0;
+    for (size_t i = 0; i < sizeof(ints) / sizeof(ints[0]); i++) {
+        if (strcmp(ints[i].name, name) == 0) {
+            if (bounds) {
+                bounds->lo = ints[i].lo;
+                bounds->hi = ints[i].hi;
+            }
+            if (is_unsigned) *is_unsigned = ints[i].is_unsigned;
+            return ints[i].bits;
+        }
+    }
+    return 0;
+}
+
+// 展开类型别名
+static ASTNode *range_resolve_type(RangeContext *ctx, ASTNode *type) {
+    for (int depth = 0; type && depth < 16; depth++) {
+        if (type->type != AST_TYPE_NAMED || type->data.type_named.type_arg_count > 0 ||
+            range_int_info(type->data.type_named.name, NULL, NULL)) {
+            return type;
+        }
+        ASTNode *alias = ast_find_decl(ctx->codegen->program_node, DECL_KEY_TYPE_ALIAS, type->data.type_named.name);
+        if (!alias || alias->type != AST_TYPE_ALIAS || !alias->data.type_alias.target_type) return type;
+        type = alias->data.type_alias.target_type;
+    }
+    return type;
+}
+
+// 整数类型的位宽，写入取值范围（不是整数类型时返回 0）
+static int range_type_bounds(RangeContext *ctx, ASTNode *type, RangeInterval *bounds, int *is_unsigned) {
+    type = range_resolve_type(ctx, type);
+    if (!type || type->type != AST_TYPE_NAMED || type->data.type_named.type_arg_count > 0) return 0;
+    return range_int_info(type->data.type_named.name, bounds, is_unsigned);
+}
+
+// 取值超出类型范围时按回绕处理（结果为整个类型范围）
+static RangeInterval range_clamp(RangeContext *ctx, RangeInterval v, ASTNode *type) {
+    RangeInterval bounds;
+    if (!range_type_bounds(ctx, type, &bounds, NULL)) return v;
+    return range_within(v, bounds) ? v : bounds;
+}
+
+static RangeInterval range_type_interval(RangeContext *ctx, ASTNode *type) {
+    RangeInterval bounds;
+    if (!range_type_bounds(ctx, type, &bounds, NULL)) return range_top();
+    return bounds;
+}
+
+// 二元算术的运算类型：两侧中较宽者（同宽时无符号优先）；窄于 32 位的按 C 的整数提升为 i32
+static ASTNode *range_arith_type(RangeContext *ctx, ASTNode *left, ASTNode *right) {
+    int lu = 0, ru = 0;
+    int lb = range_type_bounds(ctx, left, NULL, &lu);
+    int rb = range_type_bounds(ctx, right, NULL, &ru);
+    ASTNode *type = left;
+    int bits = lb;
+    if (!lb || (rb && (rb > lb || (rb == lb && ru && !lu)))) {
+        type = right;
+        bits = rb;
+    }
+    if (!bits) return NULL;
+    return bits < 32 ? ctx->type_i32 : type;
+}
+
+// 需要溢出检查的运算类型：两侧为同一整数类型，或一侧为整数类型、另一侧为字面量（不含 bool）
+static ASTNode *range_overflow_type(RangeContext *ctx, ASTNode *left, ASTNode *lt, ASTNode *right, ASTNode *rt,
+                                    RangeInterval *bounds, int *is_unsigned) {
+    lt = range_resolve_type(ctx, lt);
+    rt = range_resolve_type(ctx, rt);
+    int lb = range_type_bounds(ctx, lt, NULL, NULL);
+    int rb = range_type_bounds(ctx, rt, NULL, NULL);
+    ASTNode *type = NULL;
+    if (lb > 1 && rb > 1) {
+        if (strcmp(lt->data.type_named.name, rt->data.type_named.name) == 0) type = lt;
+    } else if (lb > 1 && right->type == AST_NUMBER) {
+        type = lt;
+    } else if (rb > 1 && left->type == AST_NUMBER) {
+        type = rt;
+    }
+    if (type) range_type_bounds(ctx, type, bounds, is_unsigned);
+    return type;
+}
+
+// 编译期常量求值（数组长度、全局常量）
+static int range_const_eval(RangeContext *ctx, ASTNode *expr, long long *out, int depth) {
+    if (!expr || depth > 16) return 0;
+    switch (expr->type) {
+        case AST_NUMBER:
+            *out = expr->data.number.value;
+            return 1;
+        case AST_UNARY_EXPR: {
+            long long v;
+            if (expr->data.unary_expr.op != TOKEN_MINUS ||
+                !range_const_eval(ctx, expr->data.unary_expr.operand, &v, depth + 1) || range_is_inf(v)) {
+                return 0;
+            }
+            *out = -v;
+            return 1;
+        }
+        case AST_CAST_EXPR:
+            return range_const_eval(ctx, expr->data.cast_expr.expr, out, depth + 1);
+        case AST_IDENTIFIER: {
+            ASTNode *decl = ast_find_decl(ctx->codegen->program_node, DECL_KEY_VAR, expr->data.identifier.name);
+            if (!decl || decl->type != AST_VAR_DECL || !decl->data.var_decl.is_const) return 0;
+            return range_const_eval(ctx, decl->data.var_decl.init, out, depth + 1);
+        }
+        case AST_BINARY_EXPR: {
+            long long a, b, r;
+            if (!range_const_eval(ctx, expr->data.binary_expr.left, &a, depth + 1) ||
+                !range_const_eval(ctx, expr->data.binary_expr.right, &b, depth + 1)) {
+                return 0;
+            }
+            switch (expr->data.binary_expr.op) {
+                case TOKEN_PLUS:
+                    if (__builtin_add_overflow(a, b, &r)) return 0;
+                    break;
+                case TOKEN_MINUS:
+                    if (__builtin_sub_overflow(a, b, &r)) return 0;
+                    break;
+                case TOKEN_ASTERISK:
+                    if (__builtin_mul_overflow(a, b, &r)) return 0;
+                    break;
+                case TOKEN_SLASH:
+                    if (b == 0 || (a == LLONG_MIN && b == -1)) return 0;
+                    r = a / b;
+                    break;
+                case TOKEN_PERCENT:
+                    if (b == 0 || (a == LLONG_MIN && b == -1)) return 0;
+                    r = a % b;
+                    break;
+                default:
+                    return 0;
+            }
+            if (range_is_inf(r)) return 0;
+            *out = r;
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+// ---------- 名称集合 ----------
+
+static int range_names_has(const RangeNames *names, const char *name) {
+    if (!name) return 0;
+    for (int i = 0; i < names->count; i++) {
+        if (strcmp(names->names[i], name) == 0) return 1;
+    }
+    return 0;
+}
+
+static void range_names_add(RangeContext *ctx, RangeNames *names, const char *name) {
+    if (!name || range_names_has(names, name)) return;
+    if (names->count >= names->capacity) {
+        int new_capacity = names->capacity > 0 ? names->capacity * 2 : 8;
+        const char **grown = (const char **)arena_alloc(ctx->scratch, sizeof(const char *) * (size_t)new_capacity);
+        if (names->count > 0) memcpy(grown, names->names, sizeof(const char *) * (size_t)names->count);
+        names->names = grown;
+        names->capacity = new_capacity;
+    }
+    names->names[names->count++] = name;
+}
+
+// 赋值目标的根变量（a.b[i].c = ... 中的 a）
+static const char *range_root_name(ASTNode *dest) {
+    while (dest) {
+        if (dest->type == AST_IDENTIFIER) return dest->data.identifier.name;
+        if (dest->type == AST_MEMBER_ACCESS) dest = dest->data.member_access.object;
+        else if (dest->type == AST_ARRAY_ACCESS) dest = dest->data.array_access.array;
+        else if (dest->type == AST_UNARY_EXPR) dest = dest->data.unary_expr.operand;
+        else return NULL;
+    }
+    return NULL;
+}
+
+typedef struct RangeCollect {
+    RangeContext *ctx;
+    RangeNames *assigned;       // 赋值的根变量名（可为 NULL）
+    RangeNames *declared;       // 声明的名称（可为 NULL）
+    RangeNames *addressed;      // 取地址的名称（可为 NULL）
+    int in_defer;
+} RangeCollect;
+
+static void range_collect_visit(ASTNode *node, void *data) {
+    RangeCollect *c = (RangeCollect *)data;
+    RangeContext *ctx = c->ctx;
+    switch (node->type) {
+        case AST_ASSIGN:
+            if (c->assigned) range_names_add(ctx, c->assigned, range_root_name(node->data.assign.dest));
+            break;
+        case AST_VAR_DECL:
+            if (c->declared) range_names_add(ctx, c->declared, node->data.var_decl.name);
+            break;
+        case AST_DESTRUCTURE_DECL:
+            for (int i = 0; c->declared && i < node->data.destructure_decl.name_count; i++) {
+                range_names_add(ctx, c->declared, node->data.destructure_decl.names[i]);
+            }
+            break;
+        case AST_FOR_STMT:
+            if (c->declared) range_names_add(ctx, c->declared, node->data.for_stmt.var_name);
+            break;
+        case AST_CATCH_EXPR:
+            if (c->declared) range_names_add(ctx, c->declared, node->data.catch_expr.err_name);
+            break;
+        case AST_MATCH_EXPR:
+            for (int i = 0; c->declared && i < node->data.match_expr.arm_count; i++) {
+                ASTMatchArm *arm = &node->data.match_expr.arms[i];
+                if (arm->kind == MATCH_PAT_BIND) range_names_add(ctx, c->declared, arm->data.bind.var_name);
+                if (arm->kind == MATCH_PAT_UNION) range_names_add(ctx, c->declared, arm->data.union_pat.var_name);
+            }
+            break;
+        case AST_UNARY_EXPR:
+            if (c->addressed && node->data.unary_expr.op == TOKEN_AMPERSAND) {
+                range_names_add(ctx, c->addressed, range_root_name(node->data.unary_expr.operand));
+            }
+            break;
+        case AST_DEFER_STMT:
+        case AST_ERRDEFER_STMT:
+            // 函数级收集：defer 中赋值的变量在作用域结束时才改变，不跟踪其取值
+            if (c->addressed && !c->in_defer) {
+                RangeNames *saved = c->assigned;
+                c->assigned = c->addressed;
+                c->in_defer = 1;
+                ast_for_each_child(node, range_collect_visit, c);
+                c->in_defer = 0;
+                c->assigned = saved;
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+    ast_for_each_child(node, range_collect_visit, c);
+}
+
+static void range_collect(RangeContext *ctx, ASTNode *node, RangeNames *assigned, RangeNames *declared) {
+    RangeCollect c;
+    memset(&c, 0, sizeof(c));
+    c.ctx = ctx;
+    c.assigned = assigned;
+    c.declared = declared;
+    if (node) range_collect_visit(node, &c);
+}
+
+// 子树中是否包含指定种类的节点
+typedef struct RangeFind {
+    const ASTNodeType *types;
+    int type_count;
+    int found;
+} RangeFind;
+
+static void range_find_visit(ASTNode *node, void *data) {
+    RangeFind *f = (RangeFind *)data;
+    for (int i = 0; i < f->type_count; i++) {
+        if (node->type == f->types[i]) {
+            f->found = 1;
+            return;
+        }
+    }
+    // 有终止值的 for 范围循环必然结束，其他嵌套循环按可能不结束处理
+    if (node->type == AST_WHILE_STMT || (node->type == AST_FOR_STMT &&
+        (!node->data.for_stmt.is_range || !node->data.for_stmt.range_end))) {
+        for (int i = 0; i < f->type_count; i++) {
+            if (f->types[i] == AST_WHILE_STMT) {
+                f->found = 1;
+                return;
+            }
+        }
+    }
+    if (!f->found) ast_for_each_child(node, range_find_visit, f);
+}
+
+static int range_contains(ASTNode *node, const ASTNodeType *types, int type_count) {
+    RangeFind f = { types, type_count, 0 };
+    if (node) range_find_visit(node, &f);
+    return f.found;
+}
+
+// ---------- 状态 ----------
+
+static void range_state_init(RangeState *s) {
+    memset(s, 0, sizeof(*s));
+}
+
+static void range_state_unreachable(RangeState *s) {
+    range_state_init(s);
+    s->unreachable = 1;
+}
+
+static RangeState range_state_copy(RangeContext *ctx, const RangeState *src) {
+    RangeState s = *src;
+    s.capacity = src->count + 8;
+    s.vars = (RangeVar *)arena_alloc(ctx->scratch, sizeof(RangeVar) * (size_t)s.capacity);
+    if (src->count > 0) memcpy(s.vars, src->vars, sizeof(RangeVar) * (size_t)src->count);
+    return s;
+}
+
+static RangeVar *range_push(RangeContext *ctx, RangeState *s, const char *name, ASTNode *type) {
+    if (s->count >= s->capacity) {
+        RangeState grown = range_state_copy(ctx, s);
+        *s = grown;
+    }
+    RangeVar *v = &s->vars[s->count++];
+    memset(v, 0, sizeof(*v));
+    v->name = name;
+    v->type = type;
+    v->iv = range_type_interval(ctx, type);
+    v->tracked = range_type_bounds(ctx, type, NULL, NULL) > 0 && !range_names_has(&ctx->untracked, name);
+    return v;
+}
+
+static RangeVar *range_find(RangeState *s, const char *name) {
+    if (!name) return NULL;
+    for (int i = s->count - 1; i >= 0; i--) {
+        if (strcmp(s->vars[i].name, name) == 0) return &s->vars[i];
+    }
+    return NULL;
+}
+
+static void range_truncate(RangeState *s, int count) {
+    if (s->count > count) s->count = count;
+}
+
+static void range_clear_facts(RangeVar *v) {
+    v->fact_count = 0;
+}
+
+// 名称改变绑定（重新声明、赋值）后，引用它的长度事实失效
+static void range_kill_sym(RangeState *s, const char *name) {
+    if (!name) return;
+    for (int i = 0; i < s->count; i++) {
+        RangeVar *v = &s->vars[i];
+        int k = 0;
+        for (int f = 0; f < v->fact_count; f++) {
+            if (strcmp(v->facts[f].sym, name) != 0) v->facts[k++] = v->facts[f];
+        }
+        v->fact_count = k;
+    }
+}
+
+static void range_add_fact(RangeVar *v, const char *sym, long long off) {
+    for (int f = 0; f < v->fact_count; f++) {
+        if (strcmp(v->facts[f].sym, sym) == 0) {
+            if (off > v->facts[f].off) v->facts[f].off = off;
+            return;
+        }
+    }
+    if (v->fact_count < RANGE_MAX_FACTS) {
+        v->facts[v->fact_count].sym = sym;
+        v->facts[v->fact_count].off = off;
+        v->fact_count++;
+    }
+}
+
+static void range_havoc_var(RangeContext *ctx, RangeVar *v) {
+    v->iv = range_type_interval(ctx, v->type);
+    range_clear_facts(v);
+}
+
+static void range_havoc(RangeContext *ctx, RangeState *s, const RangeNames *names) {
+    for (int i = 0; i < names->count; i++) {
+        for (int j = 0; j < s->count; j++) {
+            if (strcmp(s->vars[j].name, names->names[i]) == 0) range_havoc_var(ctx, &s->vars[j]);
+        }
+        range_kill_sym(s, names->names[i]);
+    }
+}
+
+static void range_havoc_all(RangeContext *ctx, RangeState *s) {
+    for (int i = 0; i < s->count; i++) range_havoc_var(ctx, &s->vars[i]);
+}
+
+// 控制流汇合：公共前缀上的变量取区间并集与长度事实交集
+static RangeState range_join(RangeContext *ctx, const RangeState *a, const RangeState *b) {
+    if (a->unreachable) return range_state_copy(ctx, b);
+    if (b->unreachable) return range_state_copy(ctx, a);
+    RangeState r = range_state_copy(ctx, a);
+    int n = a->count < b->count ? a->count : b->count;
+    for (int i = 0; i < n; i++) {
+        if (strcmp(a->vars[i].name, b->vars[i].name) != 0) {
+            n = i;
+            break;
+        }
+        RangeVar *v = &r.vars[i];
+        const RangeVar *w = &b->vars[i];
+        v->tracked = v->tracked && w->tracked;
+        v->iv = range_hull(v->iv, w->iv);
+        int k = 0;
+        for (int f = 0; f < v->fact_count; f++) {
+            for (int g = 0; g < w->fact_count; g++) {
+                if (strcmp(v->facts[f].sym, w->facts[g].sym) == 0) {
+                    v->facts[k].sym = v->facts[f].sym;
+                    v->facts[k].off = range_min(v->facts[f].off, w->facts[g].off);
+                    k++;
+                    break;
+                }
+            }
+        }
+        v->fact_count = k;
+    }
+    r.count = n;
+    return r;
+}
+
+static void range_join_into(RangeContext *ctx, RangeState *acc, const RangeState *s, int count) {
+    RangeState t = range_state_copy(ctx, s);
+    range_truncate(&t, count);
+    *acc = range_join(ctx, acc, &t);
+}
+
+static int range_state_equal(const RangeState *a, const RangeState *b) {
+    if (a->unreachable != b->unreachable || a->count != b->count) return 0;
+    for (int i = 0; i < a->count; i++) {
+        const RangeVar *v = &a->vars[i];
+        const RangeVar *w = &b->vars[i];
+        if (v->tracked != w->tracked || v->iv.lo != w->iv.lo || v->iv.hi != w->iv.hi ||
+            v->fact_count != w->fact_count) {
+            return 0;
+        }
+        for (int f = 0; f < v->fact_count; f++) {
+            if (strcmp(v->facts[f].sym, w->facts[f].sym) != 0 || v->facts[f].off != w->facts[f].off) return 0;
+        }
+    }
+    return 1;
+}
+
+// 放宽：比上一轮增长的边界直接取类型边界，减小的长度事实偏移直接丢弃
+static void range_widen(RangeContext *ctx, const RangeState *old, RangeState *next) {
+    if (old->unreachable) return;
+    int n = old->count < next->count ? old->count : next->count;
+    for (int i = 0; i < n; i++) {
+        RangeVar *v = &next->vars[i];
+        const RangeVar *w = &old->vars[i];
+        RangeInterval bounds = range_type_interval(ctx, v->type);
+        if (v->iv.lo < w->iv.lo) v->iv.lo = bounds.lo;
+        if (v->iv.hi > w->iv.hi) v->iv.hi = bounds.hi;
+        int k = 0;
+        for (int f = 0; f < v->fact_count; f++) {
+            int keep = 0;
+            for (int g = 0; g < w->fact_count; g++) {
+                if (strcmp(v->facts[f].sym, w->facts[g].sym) == 0 && v->facts[f].off >= w->facts[g].off) keep = 1;
+            }
+            if (keep) v->facts[k++] = v->facts[f];
+        }
+        v->fact_count = k;
+    }
+}
+
+// ---------- 检查点记录 ----------
+
+// 同一节点可有多个检查点（除法的除零与溢出），按 (节点, 种类) 索引
+static size_t range_site_hash(ASTNode *node, int kind, int capacity) {
+    return (((size_t)(uintptr_t)node >> 3) + (size_t)kind) & (size_t)(capacity - 1);
+}
+
+static RangeSite *range_site(RangeContext *ctx, ASTNode *node, int kind) {
+    if (ctx->site_count * 2 >= ctx->slot_capacity) {
+        int new_capacity = ctx->slot_capacity > 0 ? ctx->slot_capacity * 2 : 64;
+        int *slots = (int *)arena_alloc(ctx->scratch, sizeof(int) * (size_t)new_capacity);
+        for (int i = 0; i < new_capacity; i++) slots[i] = -1;
+        for (int i = 0; i < ctx->site_count; i++) {
+            size_t h = range_site_hash(ctx->sites[i].node, ctx->sites[i].kind, new_capacity);
+            while (slots[h] >= 0) h = (h + 1) & (size_t)(new_capacity - 1);
+            slots[h] = i;
+        }
+        ctx->site_slots = slots;
+        ctx->slot_capacity = new_capacity;
+    }
+    size_t h = range_site_hash(node, kind, ctx->slot_capacity);
+    while (ctx->site_slots[h] >= 0) {
+        RangeSite *site = &ctx->sites[ctx->site_slots[h]];
+        if (site->node == node && site->kind == kind) return site;
+        h = (h + 1) & (size_t)(ctx->slot_capacity - 1);
+    }
+    if (ctx->site_count >= ctx->site_capacity) {
+        int new_capacity = ctx->site_capacity > 0 ? ctx->site_capacity * 2 : 32;
+        RangeSite *sites = (RangeSite *)arena_alloc(ctx->scratch, sizeof(RangeSite) * (size_t)new_capacity);
+        if (ctx->site_count > 0) memcpy(sites, ctx->sites, sizeof(RangeSite) * (size_t)ctx->site_count);
+        ctx->sites = sites;
+        ctx->site_capacity = new_capacity;
+    }
+    RangeSite *site = &ctx->sites[ctx->site_count];
+    memset(site, 0, sizeof(*site));
+    site->node = node;
+    site->kind = kind;
+    site->status = RANGE_PROVEN;
+    site->always_fails = 1;
+    site->len = -1;
+    ctx->site_slots[h] = ctx->site_count++;
+    return site;
+}
+
+static void range_record(RangeContext *ctx, ASTNode *node, int kind, int status, int fails,
+                         long long len, ASTNode *loop, long long off) {
+    if (ctx->quiet) return;
+    RangeSite *site = range_site(ctx, node, kind);
+    if (status > site->status) site->status = status;
+    if (!fails) site->always_fails = 0;
+    site->len = len;
+    if (status == RANGE_HOISTED) {
+        site->loop = loop;
+        site->off = off;
+    }
+}
+
+static void range_record_overflow(RangeContext *ctx, ASTNode *node, ASTNode *type, int proven, int fails) {
+    if (ctx->quiet) return;
+    range_record(ctx, node, RANGE_SITE_OVERFLOW, proven ? RANGE_PROVEN : RANGE_CHECK, fails, -1, NULL, 0);
+    range_site(ctx, node, RANGE_SITE_OVERFLOW)->type = type;
+}
+
+// ---------- 表达式 ----------
+
+// 下标是否为"变量 ± 常量"形式
+static int range_index_form(RangeContext *ctx, ASTNode *expr, const char **name, long long *off) {
+    if (!expr) return 0;
+    if (expr->type == AST_IDENTIFIER) {
+        *name = expr->data.identifier.name;
+        *off = 0;
+        return 1;
+    }
+    if (expr->type == AST_BINARY_EXPR &&
+        (expr->data.binary_expr.op == TOKEN_PLUS || expr->data.binary_expr.op == TOKEN_MINUS) &&
+        expr->data.binary_expr.left && expr->data.binary_expr.left->type == AST_IDENTIFIER) {
+        long long c;
+        if (!range_const_eval(ctx, expr->data.binary_expr.right, &c, 0)) return 0;
+        *name = expr->data.binary_expr.left->data.identifier.name;
+        *off = expr->data.binary_expr.op == TOKEN_PLUS ? c : -c;
+        return 1;
+    }
+    return 0;
+}
+
+// 不含副作用、可再次求值的位置（标识符及其字段）
+static int range_is_place(ASTNode *expr) {
+    while (expr && expr->type == AST_MEMBER_ACCESS && !expr->data.member_access.is_module_access) {
+        expr = expr->data.member_access.object;
+    }
+    return expr && expr->type == AST_IDENTIFIER;
+}
+
+static ASTNode *range_field_type(RangeContext *ctx, ASTNode *object_type, const char *field) {
+    ASTNode *type = range_resolve_type(ctx, object_type);
+    if (type && type->type == AST_TYPE_POINTER) type = range_resolve_type(ctx, type->data.type_pointer.pointed_type);
+    if (!type || type->type != AST_TYPE_NAMED || type->data.type_named.type_arg_count > 0 || !field) return NULL;
+    const char *name = type->data.type_named.name;
+    if (name && strcmp(name, "Self") == 0) name = ctx->self_name;
+    ASTNode *decl = name ? find_struct_decl_c99(ctx->codegen, name) : NULL;
+    if (!decl || decl->data.struct_decl.type_param_count > 0) return NULL;
+    for (int i = 0; i < decl->data.struct_decl.field_count; i++) {
+        ASTNode *f = decl->data.struct_decl.fields[i];
+        if (f && f->type == AST_VAR_DECL && f->data.var_decl.name && strcmp(f->data.var_decl.name, field) == 0) {
+            return f->data.var_decl.type;
+        }
+    }
+    return NULL;
+}
+
+// 表达式的类型节点（由声明推出，无法确定时为 NULL）
+static ASTNode *range_type_of(RangeContext *ctx, RangeState *s, ASTNode *expr) {
+    if (!expr) return NULL;
+    switch (expr->type) {
+        case AST_IDENTIFIER: {
+            RangeVar *v = range_find(s, expr->data.identifier.name);
+            if (v) return v->type;
+            ASTNode *decl = ast_find_decl(ctx->codegen->program_node, DECL_KEY_VAR, expr->data.identifier.name);
+            return (decl && decl->type == AST_VAR_DECL) ? decl->data.var_decl.type : NULL;
+        }
+        case AST_MEMBER_ACCESS: {
+            if (expr->data.member_access.is_module_access) {
+                ASTNode *decl = ast_find_decl(ctx->codegen->program_node, DECL_KEY_VAR, expr->data.member_access.field_name);
+                return (decl && decl->type == AST_VAR_DECL) ? decl->data.var_decl.type : NULL;
+            }
+            return range_field_type(ctx, range_type_of(ctx, s, expr->data.member_access.object),
+                                    expr->data.member_access.field_name);
+        }
+        case AST_ARRAY_ACCESS: {
+            ASTNode *type = range_resolve_type(ctx, range_type_of(ctx, s, expr->data.array_access.array));
+            if (type && type->type == AST_TYPE_ARRAY) return type->data.type_array.element_type;
+            if (type && type->type == AST_TYPE_SLICE) return type->data.type_slice.element_type;
+            return NULL;
+        }
+        case AST_CAST_EXPR:
+            return expr->data.cast_expr.is_force_cast ? NULL : expr->data.cast_expr.target_type;
+        case AST_LEN:
+            return ctx->type_usize;
+        case AST_CALL_EXPR: {
+            ASTNode *callee = expr->data.call_expr.callee;
+            if (!callee || callee->type != AST_IDENTIFIER || expr->data.call_expr.type_arg_count > 0) return NULL;
+            ASTNode *fn = ast_find_decl(ctx->codegen->program_node, DECL_KEY_FN, callee->data.identifier.name);
+            if (!fn || fn->type != AST_FN_DECL || fn->data.fn_decl.type_param_count > 0) return NULL;
+            return fn->data.fn_decl.return_type;
+        }
+        case AST_UNARY_EXPR: {
+            int op = expr->data.unary_expr.op;
+            if (op == TOKEN_EXCLAMATION) return ctx->type_bool;
+            if (op == TOKEN_MINUS || op == TOKEN_TILDE || op == TOKEN_PLUS) {
+                return range_type_of(ctx, s, expr->data.unary_expr.operand);
+            }
+            if (op == TOKEN_ASTERISK) {
+                ASTNode *type = range_resolve_type(ctx, range_type_of(ctx, s, expr->data.unary_expr.operand));
+                return (type && type->type == AST_TYPE_POINTER) ? type->data.type_pointer.pointed_type : NULL;
+            }
+            return NULL;
+        }
+        case AST_BINARY_EXPR: {
+            int op = expr->data.binary_expr.op;
+            if (op == TOKEN_EQUAL || op == TOKEN_NOT_EQUAL || op == TOKEN_LESS || op == TOKEN_GREATER ||
+                op == TOKEN_LESS_EQUAL || op == TOKEN_GREATER_EQUAL || op == TOKEN_LOGICAL_AND ||
+                op == TOKEN_LOGICAL_OR) {
+                return ctx->type_bool;
+            }
+            ASTNode *left = range_type_of(ctx, s, expr->data.binary_expr.left);
+            return left ? left : range_type_of(ctx, s, expr->data.binary_expr.right);
+        }
+        case AST_BOOL:
+            return ctx->type_bool;
+        default:
+            return NULL;
+    }
+}
+
+static int range_is_float_type(RangeContext *ctx, ASTNode *type) {
+    type = range_resolve_type(ctx, type);
+    return type && type->type == AST_TYPE_NAMED && type->data.type_named.name &&
+           (strcmp(type->data.type_named.name, "f32") == 0 || strcmp(type->data.type_named.name, "f64") == 0);
+}
+
+// 下标访问的长度：返回 1 为编译期常量（写入 *len），0 为运行时切片长度，-1 为无法确定
+static int range_index_len(RangeContext *ctx, RangeState *s, ASTNode *array, long long *len) {
+    ASTNode *type = range_resolve_type(ctx, range_type_of(ctx, s, array));
+    *len = -1;
+    if (type && type->type == AST_TYPE_ARRAY) {
+        return (range_const_eval(ctx, type->data.type_array.size_expr, len, 0) && *len >= 0) ? 1 : -1;
+    }
+    if (type && type->type == AST_TYPE_SLICE) {
+        if (type->data.type_slice.size_expr) {
+            return (range_const_eval(ctx, type->data.type_slice.size_expr, len, 0) && *len >= 0) ? 1 : -1;
+        }
+        *len = -1;
+        return range_is_place(array) ? 0 : -1;
+    }
+    return -1;
+}
+
+static void range_eval_index(RangeContext *ctx, RangeState *s, ASTNode *expr) {
+    ASTNode *array = expr->data.array_access.array;
+    ASTNode *index = expr->data.array_access.index;
+    range_eval(ctx, s, array);
+    RangeInterval iv = range_eval(ctx, s, index);
+    if (ctx->quiet) return;
+
+    long long len;
+    int shape = range_index_len(ctx, s, array, &len);
+    if (shape < 0) {
+        range_record(ctx, expr, RANGE_SITE_INDEX, RANGE_UNKNOWN, 0, -1, NULL, 0);
+        return;
+    }
+    const char *name = NULL;
+    long long off = 0;
+    int has_form = range_index_form(ctx, index, &name, &off);
+    int proven = 0, fails = 0;
+    if (shape > 0) {
+        proven = iv.lo >= 0 && iv.hi < len;
+        fails = iv.hi < 0 || iv.lo >= len;
+    } else if (iv.lo >= 0 && has_form && array->type == AST_IDENTIFIER) {
+        RangeVar *v = range_find(s, name);
+        for (int f = 0; v && v->tracked && f < v->fact_count; f++) {
+            if (strcmp(v->facts[f].sym, array->data.identifier.name) == 0 && v->facts[f].off >= off) proven = 1;
+        }
+    }
+    if (proven) {
+        range_record(ctx, expr, RANGE_SITE_INDEX, RANGE_PROVEN, 0, len, NULL, 0);
+        return;
+    }
+
+    // 外提：最内层循环可外提、本轮无条件执行、下标为归纳变量 ± 常量、长度在循环内不变
+    RangeLoop *loop = ctx->loop;
+    if (loop && loop->iv_name && ctx->cond_depth == loop->cond_depth && has_form && !fails &&
+        strcmp(name, loop->iv_name) == 0 &&
+        (shape > 0 || (array->type == AST_IDENTIFIER &&
+                       !range_names_has(&loop->changed, array->data.identifier.name)))) {
+        range_record(ctx, expr, RANGE_SITE_INDEX, RANGE_HOISTED, 0, len, loop->node, off);
+        if (!ctx->quiet) range_site(ctx, expr, RANGE_SITE_INDEX)->iv_unsigned = loop->iv_unsigned;
+        return;
+    }
+    range_record(ctx, expr, RANGE_SITE_INDEX, RANGE_CHECK, fails, len, NULL, 0);
+}
+
+// 条件表达式中可能不执行的右侧：在左侧细化后的状态下分析
+static void range_refine(RangeContext *ctx, RangeState *s, ASTNode *cond, int truth);
+
+static RangeInterval range_eval_binary(RangeContext *ctx, RangeState *s, ASTNode *expr) {
+    int op = expr->data.binary_expr.op;
+    ASTNode *left = expr->data.binary_expr.left;
+    ASTNode *right = expr->data.binary_expr.right;
+
+    if (op == TOKEN_LOGICAL_AND || op == TOKEN_LOGICAL_OR) {
+        range_eval(ctx, s, left);
+        RangeState r = range_state_copy(ctx, s);
+        ctx->quiet++;
+        range_refine(ctx, &r, left, op == TOKEN_LOGICAL_AND);
+        ctx->quiet--;
+        if (!r.unreachable) {
+            ctx->cond_depth++;
+            range_eval(ctx, &r, right);
+            ctx->cond_depth--;
+        }
+        RangeInterval b = { 0, 1 };
+        return b;
+    }
+
+    RangeInterval a = range_eval(ctx, s, left);
+    RangeInterval b = range_eval(ctx, s, right);
+    RangeInterval r = range_top();
+    ASTNode *lt = range_type_of(ctx, s, left);
+    ASTNode *rt = range_type_of(ctx, s, right);
+    switch (op) {
+        case TOKEN_PLUS:
+            r.lo = range_add(a.lo, b.lo, RANGE_NEG_INF);
+            r.hi = range_add(a.hi, b.hi, RANGE_POS_INF);
+            break;
+        case TOKEN_MINUS:
+            r.lo = range_add(a.lo, range_neg(b.hi), RANGE_NEG_INF);
+            r.hi = range_add(a.hi, range_neg(b.lo), RANGE_POS_INF);
+            break;
+        case TOKEN_ASTERISK:
+            r = range_corners(range_mul(a.lo, b.lo), range_mul(a.lo, b.hi), range_mul(a.hi, b.lo), range_mul(a.hi, b.hi));
+            break;
+        case TOKEN_SLASH:
+        case TOKEN_PERCENT: {
+            int nonzero = b.lo > 0 || b.hi < 0;
+            int is_int = op == TOKEN_PERCENT || right->type == AST_NUMBER ||
+                         range_type_bounds(ctx, rt, NULL, NULL) || range_type_bounds(ctx, lt, NULL, NULL);
+            if (is_int && !range_is_float_type(ctx, lt) && !range_is_float_type(ctx, rt)) {
+                range_record(ctx, expr, RANGE_SITE_DIV, nonzero ? RANGE_PROVEN : RANGE_CHECK,
+                             b.lo == 0 && b.hi == 0, -1, NULL, 0);
+            }
+            if (!nonzero) break;
+            if (op == TOKEN_SLASH) {
+                if (!range_is_inf(a.lo) && !range_is_inf(a.hi) && !range_is_inf(b.lo) && !range_is_inf(b.hi)) {
+                    r = range_corners(a.lo / b.lo, a.lo / b.hi, a.hi / b.lo, a.hi / b.hi);
+                }
+            } else {
+                RangeBound m = range_max(range_neg(b.lo), b.hi);
+                m = range_max(m, range_max(b.lo, range_neg(b.hi)));
+                if (!range_is_inf(m)) m = m - 1;
+                if (a.lo >= 0) {
+                    r.lo = 0;
+                    r.hi = range_min(a.hi, m);
+                } else if (a.hi <= 0) {
+                    r.lo = range_max(a.lo, range_neg(m));
+                    r.hi = 0;
+                } else {
+                    r.lo = range_neg(m);
+                    r.hi = m;
+                }
+            }
+            break;
+        }
+        case TOKEN_AMPERSAND:
+            if (a.lo >= 0 && b.lo >= 0) {
+                r.lo = 0;
+                r.hi = range_min(a.hi, b.hi);
+            } else if (a.lo >= 0 || b.lo >= 0) {
+                r.lo = 0;
+                r.hi = a.lo >= 0 ? a.hi : b.hi;
+            }
+            break;
+        case TOKEN_RSHIFT:
+            if (a.lo >= 0) {
+                r.lo = 0;
+                r.hi = a.hi;
+                if (b.lo == b.hi && b.lo >= 0 && b.lo < 63) {
+                    r.lo = a.lo >> b.lo;
+                    if (a.hi != RANGE_POS_INF) r.hi = a.hi >> b.lo;
+                }
+            }
+            break;
+        case TOKEN_EQUAL:
+        case TOKEN_NOT_EQUAL:
+        case TOKEN_LESS:
+        case TOKEN_GREATER:
+        case TOKEN_LESS_EQUAL:
+        case TOKEN_GREATER_EQUAL:
+            r.lo = 0;
+            r.hi = 1;
+            return r;
+        default:
+            break;
+    }
+    if (op == TOKEN_PLUS || op == TOKEN_MINUS || op == TOKEN_ASTERISK || op == TOKEN_SLASH || op == TOKEN_PERCENT) {
+        RangeInterval bounds;
+        int is_unsigned = 0;
+        ASTNode *ovf_type = range_overflow_type(ctx, left, lt, right, rt, &bounds, &is_unsigned);
+        if (ovf_type) {
+            if (op == TOKEN_SLASH || op == TOKEN_PERCENT) {
+                // 只有有符号的 MIN / -1 会溢出（MIN % -1 在 C 中同样是未定义行为）
+                if (!is_unsigned) {
+                    int may = a.lo <= bounds.lo && b.lo <= -1 && b.hi >= -1;
+                    range_record_overflow(ctx, expr, ovf_type, !may,
+                                          a.lo == a.hi && a.lo == bounds.lo && b.lo == -1 && b.hi == -1);
+                }
+            } else {
+                int fits = !range_is_inf(r.lo) && !range_is_inf(r.hi) && range_within(r, bounds);
+                range_record_overflow(ctx, expr, ovf_type, fits, r.lo > bounds.hi || r.hi < bounds.lo);
+            }
+            // 溢出时运行时检查失败，结果总在类型范围内
+            RangeInterval v = { range_max(r.lo, bounds.lo), range_min(r.hi, bounds.hi) };
+            return v.lo <= v.hi ? v : bounds;
+        }
+    }
+    ASTNode *type = range_arith_type(ctx, lt, rt);
+    if (!type) return r;
+    if (op == TOKEN_PLUS_PERCENT || op == TOKEN_MINUS_PERCENT || op == TOKEN_ASTERISK_PERCENT ||
+        op == TOKEN_PLUS_PIPE || op == TOKEN_MINUS_PIPE || op == TOKEN_ASTERISK_PIPE) {
+        return range_type_interval(ctx, type);
+    }
+    return range_clamp(ctx, r, type);
+}
+
+static RangeInterval range_eval(RangeContext *ctx, RangeState *s, ASTNode *expr) {
+    if (!expr || s->unreachable) return range_top();
+    switch (expr->type) {
+        case AST_NUMBER:
+            return range_const(expr->data.number.value);
+        case AST_BOOL:
+            return range_const(expr->data.bool_literal.value ? 1 : 0);
+        case AST_IDENTIFIER: {
+            RangeVar *v = range_find(s, expr->data.identifier.name);
+            if (v) return v->tracked ? v->iv : range_type_interval(ctx, v->type);
+            long long c;
+            if (range_const_eval(ctx, expr, &c, 0)) return range_const(c);
+            return range_type_interval(ctx, range_type_of(ctx, s, expr));
+        }
+        case AST_BINARY_EXPR:
+            return range_eval_binary(ctx, s, expr);
+        case AST_UNARY_EXPR: {
+            int op = expr->data.unary_expr.op;
+            RangeInterval v = range_eval(ctx, s, expr->data.unary_expr.operand);
+            if (op == TOKEN_EXCLAMATION) {
+                RangeInterval b = { 0, 1 };
+                return b;
+            }
+            if (op == TOKEN_MINUS) {
+                RangeInterval r = { range_neg(v.hi), range_neg(v.lo) };
+                ASTNode *type = range_arith_type(ctx, range_type_of(ctx, s, expr->data.unary_expr.operand), NULL);
+                return type ? range_clamp(ctx, r, type) : r;
+            }
+            if (op == TOKEN_PLUS) return v;
+            return range_type_interval(ctx, range_type_of(ctx, s, expr));
+        }
+        case AST_CAST_EXPR: {
+            RangeInterval v = range_eval(ctx, s, expr->data.cast_expr.expr);
+            if (expr->data.cast_expr.is_force_cast) return range_top();
+            RangeInterval bounds;
+            if (!range_type_bounds(ctx, expr->data.cast_expr.target_type, &bounds, NULL)) return range_top();
+            if (range_is_float_type(ctx, range_type_of(ctx, s, expr->data.cast_expr.expr))) return bounds;
+            return range_within(v, bounds) ? v : bounds;
+        }
+        case AST_LEN: {
+            long long len;
+            if (range_index_len(ctx, s, expr->data.len_expr.array, &len) > 0) return range_const(len);
+            return range_type_interval(ctx, ctx->type_usize);
+        }
+        case AST_ARRAY_ACCESS:
+            range_eval_index(ctx, s, expr);
+            return range_type_interval(ctx, range_type_of(ctx, s, expr));
+        case AST_MEMBER_ACCESS:
+            if (!expr->data.member_access.is_module_access) range_eval(ctx, s, expr->data.member_access.object);
+            return range_type_interval(ctx, range_type_of(ctx, s, expr));
+        case AST_CALL_EXPR: {
+            ASTNode *callee = expr->data.call_expr.callee;
+            if (callee && callee->type != AST_IDENTIFIER) range_eval(ctx, s, callee);
+            for (int i = 0; i < expr->data.call_expr.arg_count; i++) range_eval(ctx, s, expr->data.call_expr.args[i]);
+            return range_type_interval(ctx, range_type_of(ctx, s, expr));
+        }
+        case AST_SLICE_EXPR:
+            range_eval(ctx, s, expr->data.slice_expr.base);
+            range_eval(ctx, s, expr->data.slice_expr.start_expr);
+            range_eval(ctx, s, expr->data.slice_expr.len_expr);
+            return range_top();
+        case AST_STRUCT_INIT:
+            for (int i = 0; i < expr->data.struct_init.field_count; i++) {
+                range_eval(ctx, s, expr->data.struct_init.field_values[i]);
+            }
+            return range_top();
+        case AST_ARRAY_LITERAL:
+            for (int i = 0; i < expr->data.array_literal.element_count; i++) {
+                range_eval(ctx, s, expr->data.array_literal.elements[i]);
+            }
+            return range_top();
+        case AST_TUPLE_LITERAL:
+            for (int i = 0; i < expr->data.tuple_literal.element_count; i++) {
+                range_eval(ctx, s, expr->data.tuple_literal.elements[i]);
+            }
+            return range_top();
+        case AST_TRY_EXPR:
+            range_eval(ctx, s, expr->data.try_expr.operand);
+            return range_top();
+        case AST_AWAIT_EXPR:
+            range_eval(ctx, s, expr->data.await_expr.operand);
+            return range_top();
+        case AST_SYSCALL:
+            for (int i = 0; i < expr->data.syscall.arg_count; i++) range_eval(ctx, s, expr->data.syscall.args[i]);
+            return range_top();
+        case AST_CATCH_EXPR:
+            range_eval(ctx, s, expr->data.catch_expr.operand);
+            range_opaque(ctx, s, expr->data.catch_expr.catch_block, 0);
+            return range_top();
+        case AST_MATCH_EXPR:
+            range_eval(ctx, s, expr->data.match_expr.expr);
+            for (int i = 0; i < expr->data.match_expr.arm_count; i++) {
+                range_opaque(ctx, s, expr->data.match_expr.arms[i].result_expr, 0);
+            }
+            return range_top();
+        case AST_SIZEOF:
+        case AST_ALIGNOF:
+        case AST_FLOAT:
+        case AST_STRING:
+        case AST_INT_LIMIT:
+        case AST_ERROR_VALUE:
+        case AST_UNDERSCORE:
+        case AST_PARAMS:
+        case AST_SRC_NAME:
+        case AST_SRC_PATH:
+        case AST_SRC_LINE:
+        case AST_SRC_COL:
+        case AST_FUNC_NAME:
+            return range_top();
+        default:
+            // 其他表达式（字符串插值、宏等）：逐个子节点保守分析
+            range_opaque(ctx, s, expr, 1);
+            return range_top();
+    }
+}
+
+// ---------- 条件细化 ----------
+
+static int range_negate_op(int op) {
+    switch (op) {
+        case TOKEN_LESS: return TOKEN_GREATER_EQUAL;
+        case TOKEN_LESS_EQUAL: return TOKEN_GREATER;
+        case TOKEN_GREATER: return TOKEN_LESS_EQUAL;
+        case TOKEN_GREATER_EQUAL: return TOKEN_LESS;
+        case TOKEN_EQUAL: return TOKEN_NOT_EQUAL;
+        case TOKEN_NOT_EQUAL: return TOKEN_EQUAL;
+        default: return op;
+    }
+}
+
+static int range_swap_op(int op) {
+    switch (op) {
+        case TOKEN_LESS: return TOKEN_GREATER;
+        case TOKEN_LESS_EQUAL: return TOKEN_GREATER_EQUAL;
+        case TOKEN_GREATER: return TOKEN_LESS;
+        case TOKEN_GREATER_EQUAL: return TOKEN_LESS_EQUAL;
+        default: return op;
+    }
+}
+
+// 由 "left op other" 成立细化 left（变量 ± 常量）的区间与长度事实
+static void range_refine_side(RangeContext *ctx, RangeState *s, ASTNode *left, int op, ASTNode *other, RangeInterval b) {
+    const char *name;
+    long long off;
+    if (!range_index_form(ctx, left, &name, &off)) return;
+    RangeVar *v = range_find(s, name);
+    if (!v || !v->tracked) return;
+    // other 的取值不超出其类型范围：v < other 时 v + 1 不会超过类型最大值
+    RangeInterval other_bounds;
+    if (other && range_type_bounds(ctx, range_type_of(ctx, s, other), &other_bounds, NULL) &&
+        b.lo <= other_bounds.hi && b.hi >= other_bounds.lo) {
+        b.lo = range_max(b.lo, other_bounds.lo);
+        b.hi = range_min(b.hi, other_bounds.hi);
+    }
+    // left 为 v + off 时要求运算不回绕，才能把条件移项到 v 上
+    if (off != 0) {
+        RangeInterval shifted = { range_add(v->iv.lo, off, RANGE_NEG_INF), range_add(v->iv.hi, off, RANGE_POS_INF) };
+        ASTNode *type = range_arith_type(ctx, v->type, NULL);
+        RangeInterval bounds;
+        if (!type || !range_type_bounds(ctx, type, &bounds, NULL) || !range_within(shifted, bounds)) return;
+        b.lo = range_add(b.lo, range_neg(off), RANGE_NEG_INF);
+        b.hi = range_add(b.hi, range_neg(off), RANGE_POS_INF);
+    }
+    RangeInterval *iv = &v->iv;
+    switch (op) {
+        case TOKEN_LESS:
+            if (b.hi != RANGE_POS_INF) iv->hi = range_min(iv->hi, b.hi - 1);
+            break;
+        case TOKEN_LESS_EQUAL:
+            iv->hi = range_min(iv->hi, b.hi);
+            break;
+        case TOKEN_GREATER:
+            if (b.lo != RANGE_NEG_INF) iv->lo = range_max(iv->lo, b.lo + 1);
+            break;
+        case TOKEN_GREATER_EQUAL:
+            iv->lo = range_max(iv->lo, b.lo);
+            break;
+        case TOKEN_EQUAL:
+            iv->lo = range_max(iv->lo, b.lo);
+            iv->hi = range_min(iv->hi, b.hi);
+            break;
+        case TOKEN_NOT_EQUAL:
+            if (b.lo == b.hi && !range_is_inf(b.lo)) {
+                if (iv->lo == b.lo) iv->lo++;
+                else if (iv->hi == b.lo) iv->hi--;
+            }
+            break;
+        default:
+            break;
+    }
+    if (iv->lo > iv->hi) {
+        s->unreachable = 1;
+        return;
+    }
+    // v + off < @len(S)  或  v + off <= @len(S) - 1 的等价形式 v + off <= @len(S)（此时只能得到 off - 1）
+    if (other && other->type == AST_LEN && other->data.len_expr.array &&
+        other->data.len_expr.array->type == AST_IDENTIFIER) {
+        const char *sym = other->data.len_expr.array->data.identifier.name;
+        if (op == TOKEN_LESS) range_add_fact(v, sym, off);
+        else if (op == TOKEN_LESS_EQUAL && off > LLONG_MIN + 1) range_add_fact(v, sym, off - 1);
+    }
+}
+
+static void range_refine(RangeContext *ctx, RangeState *s, ASTNode *cond, int truth) {
+    if (!cond || s->unreachable) return;
+    switch (cond->type) {
+        case AST_BOOL:
+            if ((cond->data.bool_literal.value != 0) != truth) s->unreachable = 1;
+            return;
+        case AST_UNARY_EXPR:
+            if (cond->data.unary_expr.op == TOKEN_EXCLAMATION) range_refine(ctx, s, cond->data.unary_expr.operand, !truth);
+            return;
+        case AST_BINARY_EXPR:
+            break;
+        default:
+            return;
+    }
+    int op = cond->data.binary_expr.op;
+    ASTNode *left = cond->data.binary_expr.left;
+    ASTNode *right = cond->data.binary_expr.right;
+    if (op == TOKEN_LOGICAL_AND || op == TOKEN_LOGICAL_OR) {
+        int both = (op == TOKEN_LOGICAL_AND) == truth;
+        if (both) {
+            // a && b 成立 / a || b 不成立：两侧都按同一真值细化
+            range_refine(ctx, s, left, truth);
+            range_refine(ctx, s, right, truth);
+            return;
+        }
+        RangeState a = range_state_copy(ctx, s);
+        range_refine(ctx, &a, left, truth);
+        RangeState b = range_state_copy(ctx, s);
+        range_refine(ctx, &b, left, !truth);
+        range_refine(ctx, &b, right, truth);
+        *s = range_join(ctx, &a, &b);
+        return;
+    }
+    if (op != TOKEN_LESS && op != TOKEN_LESS_EQUAL && op != TOKEN_GREATER && op != TOKEN_GREATER_EQUAL &&
+        op != TOKEN_EQUAL && op != TOKEN_NOT_EQUAL) {
+        return;
+    }
+    if (!truth) op = range_negate_op(op);
+    ctx->quiet++;
+    RangeInterval a = range_eval(ctx, s, left);
+    RangeInterval b = range_eval(ctx, s, right);
+    ctx->quiet--;
+    range_refine_side(ctx, s, left, op, right, b);
+    if (!s->unreachable) range_refine_side(ctx, s, right, range_swap_op(op), left, a);
+}
+
+// ---------- 语句 ----------
+
+// 保守分析一个区域（children_only 时只分析子节点）：区域内赋值的变量先放宽，区域内声明的名称遮蔽外层变量
+static void range_walk_visit(ASTNode *node, void *data);
+
+typedef struct RangeWalk {
+    RangeContext *ctx;
+    RangeState *state;
+} RangeWalk;
+
+static void range_walk_visit(ASTNode *node, void *data) {
+    RangeWalk *w = (RangeWalk *)data;
+    switch (node->type) {
+        case AST_VAR_DECL:
+        case AST_DESTRUCTURE_DECL:
+        case AST_ASSIGN:
+        case AST_IF_STMT:
+        case AST_WHILE_STMT:
+        case AST_FOR_STMT:
+        case AST_BLOCK:
+        case AST_RETURN_STMT:
+        case AST_DEFER_STMT:
+        case AST_ERRDEFER_STMT:
+        case AST_BREAK_STMT:
+        case AST_CONTINUE_STMT:
+            ast_for_each_child(node, range_walk_visit, w);
+            break;
+        default:
+            range_eval(w->ctx, w->state, node);
+            break;
+    }
+}
+
+static void range_opaque(RangeContext *ctx, RangeState *s, ASTNode *node, int children_only) {
+    if (!node || s->unreachable) return;
+    RangeNames assigned = { NULL, 0, 0 };
+    RangeNames declared = { NULL, 0, 0 };
+    range_collect(ctx, node, &assigned, &declared);
+    range_havoc(ctx, s, &assigned);
+
+    RangeState w = range_state_copy(ctx, s);
+    for (int i = 0; i < declared.count; i++) {
+        RangeVar *v = range_push(ctx, &w, declared.names[i], NULL);
+        v->tracked = 0;
+        range_kill_sym(&w, declared.names[i]);
+    }
+    RangeWalk walk = { ctx, &w };
+    ctx->cond_depth++;
+    if (children_only) ast_for_each_child(node, range_walk_visit, &walk);
+    else range_walk_visit(node, &walk);
+    ctx->cond_depth--;
+
+    if (ctx->loop) {
+        static const ASTNodeType brk[] = { AST_BREAK_STMT };
+        static const ASTNodeType cont[] = { AST_CONTINUE_STMT };
+        if (range_contains(node, brk, 1)) range_join_into(ctx, &ctx->loop->brk, s, ctx->loop->base_count);
+        if (range_contains(node, cont, 1)) range_join_into(ctx, &ctx->loop->cont, s, ctx->loop->base_count);
+    }
+}
+
+// 表达式在循环内不变且可在循环前再次求值（不含调用与下标）
+static int range_invariant(ASTNode *expr, const RangeNames *changed) {
+    if (!expr) return 0;
+    switch (expr->type) {
+        case AST_NUMBER:
+            return 1;
+        case AST_IDENTIFIER:
+            return !range_names_has(changed, expr->data.identifier.name);
+        case AST_LEN:
+            return expr->data.len_expr.array && expr->data.len_expr.array->type == AST_IDENTIFIER &&
+                   !range_names_has(changed, expr->data.len_expr.array->data.identifier.name);
+        case AST_CAST_EXPR:
+            return !expr->data.cast_expr.is_force_cast && range_invariant(expr->data.cast_expr.expr, changed);
+        case AST_BINARY_EXPR: {
+            int op = expr->data.binary_expr.op;
+            return (op == TOKEN_PLUS || op == TOKEN_MINUS || op == TOKEN_ASTERISK) &&
+                   range_invariant(expr->data.binary_expr.left, changed) &&
+                   range_invariant(expr->data.binary_expr.right, changed);
+        }
+        default:
+            return 0;
+    }
+}
+
+// 判断循环能否把下标检查外提：每轮从头执行到尾（无跳出、调用与可能不结束的内层循环），
+// 归纳变量每轮恰好加 1（while i < E { ...; i = i + 1; } 或 for start..end |i|）
+static const char *range_hoist_iv(RangeContext *ctx, RangeState *s, ASTNode *loop, const RangeNames *changed) {
+    static const ASTNodeType exits[] = {
+        AST_BREAK_STMT, AST_CONTINUE_STMT, AST_RETURN_STMT, AST_TRY_EXPR, AST_CATCH_EXPR, AST_AWAIT_EXPR,
+        AST_CALL_EXPR, AST_MACRO_CALL, AST_SYSCALL, AST_DEFER_STMT, AST_ERRDEFER_STMT, AST_WHILE_STMT
+    };
+    if (loop->type == AST_FOR_STMT) {
+        const char *name = loop->data.for_stmt.var_name;
+        if (!loop->data.for_stmt.is_range || !loop->data.for_stmt.range_end || !name ||
+            range_names_has(changed, name)) {
+            return NULL;
+        }
+        // 检查在循环变量初始化之后生成，需要变量被跟踪（整数且未取地址）
+        if (range_names_has(&ctx->untracked, name)) return NULL;
+        return range_contains(loop->data.for_stmt.body, exits, (int)(sizeof(exits) / sizeof(exits[0]))) ? NULL : name;
+    }
+
+    ASTNode *cond = loop->data.while_stmt.condition;
+    ASTNode *body = loop->data.while_stmt.body;
+    if (!cond || cond->type != AST_BINARY_EXPR || !body || body->type != AST_BLOCK || body->data.block.stmt_count == 0) {
+        return NULL;
+    }
+    int op = cond->data.binary_expr.op;
+    ASTNode *iv = cond->data.binary_expr.left;
+    if ((op != TOKEN_LESS && op != TOKEN_LESS_EQUAL) || !iv || iv->type != AST_IDENTIFIER ||
+        !range_invariant(cond->data.binary_expr.right, changed)) {
+        return NULL;
+    }
+    const char *name = iv->data.identifier.name;
+    RangeVar *v = range_find(s, name);
+    if (!v || !v->tracked) return NULL;
+
+    ASTNode *last = body->data.block.stmts[body->data.block.stmt_count - 1];
+    if (!last || last->type != AST_ASSIGN || !last->data.assign.dest || last->data.assign.dest->type != AST_IDENTIFIER ||
+        strcmp(last->data.assign.dest->data.identifier.name, name) != 0) {
+        return NULL;
+    }
+    ASTNode *src = last->data.assign.src;
+    const char *step_name;
+    long long step;
+    if (!src || src->type != AST_BINARY_EXPR || !range_index_form(ctx, src, &step_name, &step) ||
+        strcmp(step_name, name) != 0 || step != 1) {
+        return NULL;
+    }
+    // 归纳变量只在最后一条语句赋值、不在循环内重新声明
+    RangeNames assigned = { NULL, 0, 0 };
+    RangeNames declared = { NULL, 0, 0 };
+    for (int i = 0; i < body->data.block.stmt_count - 1; i++) {
+        range_collect(ctx, body->data.block.stmts[i], &assigned, &declared);
+    }
+    if (range_names_has(&assigned, name) || range_names_has(&declared, name)) return NULL;
+    if (range_contains(body, exits, (int)(sizeof(exits) / sizeof(exits[0])))) return NULL;
+    return name;
+}
+
+// 一轮循环：从 state（每轮开始时的状态）执行条件与循环体，结果为回到循环头的状态
+static void range_loop_pass(RangeContext *ctx, RangeState *state, ASTNode *loop, RangeLoop *L,
+                            RangeInterval start, RangeInterval end) {
+    range_state_unreachable(&L->brk);
+    range_state_unreachable(&L->cont);
+    ASTNode *body;
+    if (loop->type == AST_WHILE_STMT) {
+        ctx->cond_depth++;
+        range_eval(ctx, state, loop->data.while_stmt.condition);
+        ctx->cond_depth--;
+        range_refine(ctx, state, loop->data.while_stmt.condition, 1);
+        body = loop->data.while_stmt.body;
+    } else {
+        body = loop->data.for_stmt.body;
+        const char *name = loop->data.for_stmt.var_name;
+        if (loop->data.for_stmt.is_range) {
+            if (name) {
+                ASTNode *type = range_type_of(ctx, state, loop->data.for_stmt.range_start);
+                if (!type) type = range_type_of(ctx, state, loop->data.for_stmt.range_end);
+                if (!range_type_bounds(ctx, type, NULL, NULL)) type = ctx->type_i32;
+                RangeVar *v = range_push(ctx, state, name, type);
+                range_kill_sym(state, name);
+                if (v->tracked) {
+                    RangeInterval iv = { start.lo, loop->data.for_stmt.range_end ? end.hi : RANGE_POS_INF };
+                    if (loop->data.for_stmt.range_end && iv.hi != RANGE_POS_INF) iv.hi--;
+                    v->iv = range_clamp(ctx, iv, type);
+                    if (v->iv.lo > v->iv.hi) state->unreachable = 1;
+                    ASTNode *e = loop->data.for_stmt.range_end;
+                    if (e && e->type == AST_LEN && e->data.len_expr.array &&
+                        e->data.len_expr.array->type == AST_IDENTIFIER) {
+                        range_add_fact(v, e->data.len_expr.array->data.identifier.name, 0);
+                    }
+                }
+            }
+        } else if (name) {
+            ASTNode *type = NULL;
+            if (!loop->data.for_stmt.is_ref) {
+                ASTNode *array_type = range_resolve_type(ctx, range_type_of(ctx, state, loop->data.for_stmt.array));
+                if (array_type && array_type->type == AST_TYPE_ARRAY) type = array_type->data.type_array.element_type;
+                if (array_type && array_type->type == AST_TYPE_SLICE) type = array_type->data.type_slice.element_type;
+            }
+            RangeVar *v = range_push(ctx, state, name, type);
+            v->tracked = v->tracked && !loop->data.for_stmt.is_ref;
+            range_kill_sym(state, name);
+        }
+    }
+    L->base_count = state->count;
+    L->cond_depth = ctx->cond_depth;
+    range_exec_stmt(ctx, state, body);
+    range_truncate(state, L->base_count);
+    *state = range_join(ctx, state, &L->cont);
+}
+
+static void range_exec_loop(RangeContext *ctx, RangeState *s, ASTNode *loop) {
+    RangeLoop L;
+    memset(&L, 0, sizeof(L));
+    L.outer = ctx->loop;
+    L.node = loop;
+    int outer_count = s->count;
+
+    // for 范围的起止值只求一次
+    RangeInterval start = range_top(), end = range_top();
+    if (loop->type == AST_FOR_STMT) {
+        if (loop->data.for_stmt.is_range) {
+            start = range_eval(ctx, s, loop->data.for_stmt.range_start);
+            end = range_eval(ctx, s, loop->data.for_stmt.range_end);
+        } else {
+            range_eval(ctx, s, loop->data.for_stmt.array);
+        }
+    }
+    if (s->unreachable) return;
+
+    RangeNames assigned = { NULL, 0, 0 };
+    range_collect(ctx, loop->type == AST_WHILE_STMT ? loop->data.while_stmt.condition : NULL, &assigned, NULL);
+    range_collect(ctx, loop->type == AST_WHILE_STMT ? loop->data.while_stmt.body : loop->data.for_stmt.body,
+                  &assigned, &L.changed);
+    for (int i = 0; i < assigned.count; i++) range_names_add(ctx, &L.changed, assigned.names[i]);
+    L.iv_name = range_hoist_iv(ctx, s, loop, &L.changed);
+    if (L.iv_name) {
+        int first_unsigned = 0, end_unsigned = 0;
+        if (loop->type == AST_FOR_STMT) {
+            range_type_bounds(ctx, range_type_of(ctx, s, loop->data.for_stmt.range_start), NULL, &first_unsigned);
+            range_type_bounds(ctx, range_type_of(ctx, s, loop->data.for_stmt.range_end), NULL, &end_unsigned);
+        } else {
+            ASTNode *cond = loop->data.while_stmt.condition;
+            range_type_bounds(ctx, range_type_of(ctx, s, cond->data.binary_expr.left), NULL, &first_unsigned);
+            range_type_bounds(ctx, range_type_of(ctx, s, cond->data.binary_expr.right), NULL, &end_unsigned);
+        }
+        L.iv_unsigned = first_unsigned || end_unsigned;
+    }
+
+    RangeState entry = range_state_copy(ctx, s);
+    RangeState head = range_state_copy(ctx, s);
+    int havoc = ctx->loop_depth >= RANGE_MAX_LOOP_NEST || ctx->work > RANGE_WORK_LIMIT;
+    if (havoc) range_havoc(ctx, &head, &assigned);
+
+    ctx->loop = &L;
+    ctx->loop_depth++;
+    for (int pass = 0;; pass++) {
+        RangeState state = range_state_copy(ctx, &head);
+        range_loop_pass(ctx, &state, loop, &L, start, end);
+        if (havoc) break;
+        RangeState next = range_join(ctx, &entry, &state);
+        if (pass >= 2) range_widen(ctx, &head, &next);
+        if (range_state_equal(&next, &head)) break;
+        head = next;
+        if (pass >= RANGE_MAX_LOOP_PASSES) {
+            // 未收敛：放宽循环内赋值的变量再分析一轮
+            head = range_state_copy(ctx, &entry);
+            range_havoc(ctx, &head, &assigned);
+            havoc = 1;
+        }
+    }
+    ctx->loop_depth--;
+    ctx->loop = L.outer;
+
+    // 循环出口：条件不成立（while）或范围结束（for）与各 break 处的并集
+    RangeState exit_state = range_state_copy(ctx, &head);
+    if (loop->type == AST_WHILE_STMT) {
+        ctx->quiet++;
+        range_refine(ctx, &exit_state, loop->data.while_stmt.condition, 0);
+        ctx->quiet--;
+    } else if (loop->data.for_stmt.is_range && !loop->data.for_stmt.range_end) {
+        range_state_unreachable(&exit_state);
+    }
+    range_truncate(&exit_state, outer_count);
+    *s = range_join(ctx, &exit_state, &L.brk);
+    range_truncate(s, outer_count);
+}
+
+static void range_exec_var_decl(RangeContext *ctx, RangeState *s, ASTNode *decl) {
+    ASTNode *init = decl->data.var_decl.init;
+    RangeInterval v = init ? range_eval(ctx, s, init) : range_top();
+    ASTNode *type = decl->data.var_decl.type;
+    if (!type && init) type = init->type == AST_NUMBER ? ctx->type_i32 : range_type_of(ctx, s, init);
+    RangeVar *var = range_push(ctx, s, decl->data.var_decl.name, type);
+    range_kill_sym(s, decl->data.var_decl.name);
+    if (var->tracked && init) var->iv = range_clamp(ctx, v, type);
+}
+
+static void range_exec_assign(RangeContext *ctx, RangeState *s, ASTNode *stmt) {
+    ASTNode *dest = stmt->data.assign.dest;
+    ASTNode *src = stmt->data.assign.src;
+    if (!dest || dest->type != AST_IDENTIFIER) {
+        range_eval(ctx, s, dest);
+        range_eval(ctx, s, src);
+        range_kill_sym(s, range_root_name(dest));
+        return;
+    }
+    const char *name = dest->data.identifier.name;
+    RangeInterval v = range_eval(ctx, s, src);
+    RangeVar *var = range_find(s, name);
+    if (var && var->tracked) {
+        // x = x ± c（未回绕）时长度事实随之平移，其他赋值使事实失效
+        const char *step_name;
+        long long step;
+        RangeInterval bounds;
+        if (src && src->type == AST_BINARY_EXPR && range_index_form(ctx, src, &step_name, &step) &&
+            strcmp(step_name, name) == 0 && range_type_bounds(ctx, var->type, &bounds, NULL) &&
+            range_within(v, bounds)) {
+            for (int f = 0; f < var->fact_count; f++) {
+                RangeBound off = range_add(var->facts[f].off, range_neg(step), RANGE_NEG_INF);
+                var->facts[f].off = (long long)range_max(range_min(off, LLONG_MAX), LLONG_MIN);
+            }
+        } else {
+            range_clear_facts(var);
+        }
+        var->iv = range_clamp(ctx, v, var->type);
+    }
+    range_kill_sym(s, name);
+}
+
+static void range_exec_stmt(RangeContext *ctx, RangeState *s, ASTNode *stmt) {
+    if (!stmt || s->unreachable) return;
+    ctx->work++;
+    switch (stmt->type) {
+        case AST_BLOCK: {
+            int base = s->count;
+            for (int i = 0; i < stmt->data.block.stmt_count; i++) range_exec_stmt(ctx, s, stmt->data.block.stmts[i]);
+            range_truncate(s, base);
+            break;
+        }
+        case AST_VAR_DECL:
+            range_exec_var_decl(ctx, s, stmt);
+            break;
+        case AST_DESTRUCTURE_DECL:
+            range_eval(ctx, s, stmt->data.destructure_decl.init);
+            for (int i = 0; i < stmt->data.destructure_decl.name_count; i++) {
+                RangeVar *v = range_push(ctx, s, stmt->data.destructure_decl.names[i], NULL);
+                v->tracked = 0;
+                range_kill_sym(s, stmt->data.destructure_decl.names[i]);
+            }
+            break;
+        case AST_ASSIGN:
+            range_exec_assign(ctx, s, stmt);
+            break;
+        case AST_IF_STMT: {
+            ASTNode *cond = stmt->data.if_stmt.condition;
+            range_eval(ctx, s, cond);
+            RangeState t = range_state_copy(ctx, s);
+            RangeState e = range_state_copy(ctx, s);
+            range_refine(ctx, &t, cond, 1);
+            range_refine(ctx, &e, cond, 0);
+            ctx->cond_depth++;
+            range_exec_stmt(ctx, &t, stmt->data.if_stmt.then_branch);
+            range_exec_stmt(ctx, &e, stmt->data.if_stmt.else_branch);
+            ctx->cond_depth--;
+            int count = s->count;
+            *s = range_join(ctx, &t, &e);
+            if (!s->unreachable) range_truncate(s, count);
+            break;
+        }
+        case AST_WHILE_STMT:
+        case AST_FOR_STMT:
+            range_exec_loop(ctx, s, stmt);
+            break;
+        case AST_BREAK_STMT:
+            if (ctx->loop) range_join_into(ctx, &ctx->loop->brk, s, ctx->loop->base_count);
+            s->unreachable = 1;
+            break;
+        case AST_CONTINUE_STMT:
+            if (ctx->loop) range_join_into(ctx, &ctx->loop->cont, s, ctx->loop->base_count);
+            s->unreachable = 1;
+            break;
+        case AST_RETURN_STMT:
+            range_eval(ctx, s, stmt->data.return_stmt.expr);
+            s->unreachable = 1;
+            break;
+        case AST_DEFER_STMT:
+        case AST_ERRDEFER_STMT: {
+            // 在作用域结束时执行，此时变量取值未知
+            RangeState w = range_state_copy(ctx, s);
+            range_havoc_all(ctx, &w);
+            RangeLoop *saved = ctx->loop;
+            ctx->loop = NULL;
+            range_opaque(ctx, &w, stmt->type == AST_DEFER_STMT ? stmt->data.defer_stmt.body : stmt->data.errdefer_stmt.body, 0);
+            ctx->loop = saved;
+            break;
+        }
+        case AST_EXPR_STMT:
+        case AST_TEST_STMT:
+            break;
+        default:
+            range_eval(ctx, s, stmt);
+            break;
+    }
+}
+
+// ---------- 函数 ----------
+
+static void range_add_check(RangeContext *ctx, RangeSite *site) {
+    Arena *arena = ctx->codegen->arena;
+    if (ctx->check_count >= ctx->check_capacity) {
+        int new_capacity = ctx->check_capacity > 0 ? ctx->check_capacity * 2 : 64;
+        C99SafetyCheck *checks = (C99SafetyCheck *)arena_alloc(arena, sizeof(C99SafetyCheck) * (size_t)new_capacity);
+        if (ctx->check_count > 0) memcpy(checks, ctx->checks, sizeof(C99SafetyCheck) * (size_t)ctx->check_count);
+        ctx->checks = checks;
+        ctx->check_capacity = new_capacity;
+    }
+    C99SafetyCheck *c = &ctx->checks[ctx->check_count++];
+    c->node = site->node;
+    c->len = site->len;
+    c->zero_divisor = site->kind == RANGE_SITE_DIV;
+    c->overflow_type = site->kind == RANGE_SITE_OVERFLOW ? site->type : NULL;
+}
+
+// 同一循环、同一长度来源的外提检查合并为一个，偏移取范围
+static void range_add_hoist(RangeContext *ctx, RangeSite *site) {
+    for (int i = 0; i < ctx->hoist_count; i++) {
+        C99SafetyHoist *h = &ctx->hoists[i];
+        if (h->loop != site->loop || h->len != site->len) continue;
+        if (h->len < 0 && strcmp(h->site->data.array_access.array->data.identifier.name,
+                                 site->node->data.array_access.array->data.identifier.name) != 0) {
+            continue;
+        }
+        if (site->off < h->lo_off) h->lo_off = site->off;
+        if (site->off > h->hi_off) h->hi_off = site->off;
+        return;
+    }
+    Arena *arena = ctx->codegen->arena;
+    if (ctx->hoist_count >= ctx->hoist_capacity) {
+        int new_capacity = ctx->hoist_capacity > 0 ? ctx->hoist_capacity * 2 : 16;
+        C99SafetyHoist *hoists = (C99SafetyHoist *)arena_alloc(arena, sizeof(C99SafetyHoist) * (size_t)new_capacity);
+        if (ctx->hoist_count > 0) memcpy(hoists, ctx->hoists, sizeof(C99SafetyHoist) * (size_t)ctx->hoist_count);
+        ctx->hoists = hoists;
+        ctx->hoist_capacity = new_capacity;
+    }
+    C99SafetyHoist *h = &ctx->hoists[ctx->hoist_count++];
+    h->loop = site->loop;
+    h->site = site->node;
+    h->len = site->len;
+    h->lo_off = site->off;
+    h->hi_off = site->off;
+    h->is_unsigned = site->iv_unsigned;
+}
+
+static void range_report_site(const RangeSite *site) {
+    const char *file = site->node->filename ? site->node->filename : "<unknown>";
+    static const char *const whats[] = { "下标访问", "除法/取模", "整数运算" };
+    static const char *const failures[] = { "越界", "除以零", "溢出" };
+    const char *what = whats[site->kind];
+    switch (site->status) {
+        case RANGE_HOISTED:
+            fprintf(stderr, "%s:%d: %s：检查外提到第 %d 行的循环之前\n", file, site->node->line, what, site->loop->line);
+            break;
+        case RANGE_CHECK:
+            if (site->always_fails) {
+                fprintf(stderr, "%s:%d: %s：必然%s（运行时检查）\n", file, site->node->line, what,
+                        failures[site->kind]);
+            } else {
+                fprintf(stderr, "%s:%d: %s：运行时检查\n", file, site->node->line, what);
+            }
+            break;
+        case RANGE_UNKNOWN:
+            fprintf(stderr, "%s:%d: %s：长度未知，未检查\n", file, site->node->line, what);
+            break;
+        default:
+            break;
+    }
+}
+
+static void range_analyze_fn(RangeContext *ctx, ASTNode **params, int param_count, ASTNode *body, const char *self_name) {
+    if (!body) return;
+    C99CodeGenerator *codegen = ctx->codegen;
+    arena_reset(ctx->scratch);
+    ctx->self_name = self_name;
+    ctx->loop = NULL;
+    ctx->loop_depth = 0;
+    ctx->cond_depth = 0;
+    ctx->quiet = 0;
+    ctx->work = 0;
+    ctx->sites = NULL;
+    ctx->site_count = 0;
+    ctx->site_capacity = 0;
+    ctx->site_slots = NULL;
+    ctx->slot_capacity = 0;
+    memset(&ctx->untracked, 0, sizeof(ctx->untracked));
+
+    RangeCollect c;
+    memset(&c, 0, sizeof(c));
+    c.ctx = ctx;
+    c.addressed = &ctx->untracked;
+    range_collect_visit(body, &c);
+
+    RangeState s;
+    range_state_init(&s);
+    for (int i = 0; i < param_count; i++) {
+        ASTNode *param = params[i];
+        if (param && param->type == AST_VAR_DECL && param->data.var_decl.name) {
+            range_push(ctx, &s, param->data.var_decl.name, param->data.var_decl.type);
+        }
+    }
+    range_exec_stmt(ctx, &s, body);
+
+    for (int i = 0; i < ctx->site_count; i++) {
+        RangeSite *site = &ctx->sites[i];
+        int *totals = site->kind == RANGE_SITE_INDEX ? ctx->index_total
+                      : site->kind == RANGE_SITE_DIV ? ctx->div_total : ctx->overflow_total;
+        totals[site->status]++;
+        if (site->status == RANGE_CHECK) range_add_check(ctx, site);
+        if (site->status == RANGE_HOISTED) range_add_hoist(ctx, site);
+        if (codegen->safety_report) range_report_site(site);
+    }
+}
+
+static int range_compare_checks(const void *a, const void *b) {
+    uintptr_t x = (uintptr_t)((const C99SafetyCheck *)a)->node;
+    uintptr_t y = (uintptr_t)((const C99SafetyCheck *)b)->node;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// 排序后同一除法节点的除零与溢出检查相邻，合并为一项
+static int range_merge_checks(C99SafetyCheck *checks, int count) {
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+        if (n > 0 && checks[n - 1].node == checks[i].node) {
+            checks[n - 1].zero_divisor |= checks[i].zero_divisor;
+            if (checks[i].overflow_type) checks[n - 1].overflow_type = checks[i].overflow_type;
+            continue;
+        }
+        checks[n++] = checks[i];
+    }
+    return n;
+}
+
+static int range_compare_hoists(const void *a, const void *b) {
+    uintptr_t x = (uintptr_t)((const C99SafetyHoist *)a)->loop;
+    uintptr_t y = (uintptr_t)((const C99SafetyHoist *)b)->loop;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+static int range_is_generic_type(C99CodeGenerator *codegen, const char *name) {
+    ASTNode *decl = name ? find_struct_decl_c99(codegen, name) : NULL;
+    return decl && decl->data.struct_decl.type_param_count > 0;
+}
+
+static void range_analyze_method(RangeContext *ctx, ASTNode *fn, const char *self_name) {
+    if (!fn || fn->type != AST_FN_DECL || fn->data.fn_decl.type_param_count > 0 || fn->data.fn_decl.is_async) return;
+    range_analyze_fn(ctx, fn->data.fn_decl.params, fn->data.fn_decl.param_count, fn->data.fn_decl.body, self_name);
+}
+
+static ASTNode *range_named_type(C99CodeGenerator *codegen, const char *name) {
+    ASTNode *type = ast_new_node(AST_TYPE_NAMED, 0, 0, codegen->arena, NULL);
+    type->data.type_named.name = name;
+    return type;
+}
+
+void c99_analyze_safety(C99CodeGenerator *codegen) {
+    codegen->safety_check_sites = NULL;
+    codegen->safety_check_count = 0;
+    codegen->safety_hoists = NULL;
+    codegen->safety_hoist_count = 0;
+    if ((!codegen->safety_checks && !codegen->safety_report) || !codegen->program_node) return;
+
+    Arena scratch;
+    arena_init(&scratch, NULL, 0);
+    RangeContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.codegen = codegen;
+    ctx.scratch = &scratch;
+    ctx.type_bool = range_named_type(codegen, "bool");
+    ctx.type_i32 = range_named_type(codegen, "i32");
+    ctx.type_usize = range_named_type(codegen, "usize");
+
+    ASTNode **decls = codegen->program_node->data.program.decls;
+    int decl_count = codegen->program_node->data.program.decl_count;
+    for (int i = 0; i < decl_count; i++) {
+        ASTNode *decl = decls[i];
+        if (!decl) continue;
+        switch (decl->type) {
+            case AST_FN_DECL:
+                range_analyze_method(&ctx, decl, NULL);
+                break;
+            case AST_STRUCT_DECL:
+                if (decl->data.struct_decl.type_param_count > 0) break;
+                for (int j = 0; j < decl->data.struct_decl.method_count; j++) {
+                    range_analyze_method(&ctx, decl->data.struct_decl.methods[j], decl->data.struct_decl.name);
+                }
+                break;
+            case AST_UNION_DECL:
+                for (int j = 0; j < decl->data.union_decl.method_count; j++) {
+                    range_analyze_method(&ctx, decl->data.union_decl.methods[j], decl->data.union_decl.name);
+                }
+                break;
+            case AST_METHOD_BLOCK: {
+                const char *type_name = decl->data.method_block.struct_name ? decl->data.method_block.struct_name
+                                                                           : decl->data.method_block.union_name;
+                if (range_is_generic_type(codegen, decl->data.method_block.struct_name)) break;
+                for (int j = 0; j < decl->data.method_block.method_count; j++) {
+                    range_analyze_method(&ctx, decl->data.method_block.methods[j], type_name);
+                }
+                break;
+            }
+            case AST_TEST_STMT:
+                range_analyze_fn(&ctx, NULL, 0, decl->data.test_stmt.body, NULL);
+                break;
+            default:
+                break;
+        }
+    }
+    arena_reset(&scratch);
+
+    if (codegen->safety_report) {
+        fprintf(stderr, "安全检查：下标访问 %d 处（已证明 %d，循环外提 %d，运行时检查 %d，长度未知 %d），"
+                "除法/取模 %d 处（已证明 %d，运行时检查 %d），整数运算 %d 处（已证明 %d，运行时检查 %d）\n",
+                ctx.index_total[0] + ctx.index_total[1] + ctx.index_total[2] + ctx.index_total[3],
+                ctx.index_total[RANGE_PROVEN], ctx.index_total[RANGE_HOISTED], ctx.index_total[RANGE_CHECK],
+                ctx.index_total[RANGE_UNKNOWN], ctx.div_total[RANGE_PROVEN] + ctx.div_total[RANGE_CHECK],
+                ctx.div_total[RANGE_PROVEN], ctx.div_total[RANGE_CHECK],
+                ctx.overflow_total[RANGE_PROVEN] + ctx.overflow_total[RANGE_CHECK],
+                ctx.overflow_total[RANGE_PROVEN], ctx.overflow_total[RANGE_CHECK]);
+    }
+    if (!codegen->safety_checks) return;
+    if (ctx.check_count > 0) {
+        qsort(ctx.checks, (size_t)ctx.check_count, sizeof(C99SafetyCheck), range_compare_checks);
+        ctx.check_count = range_merge_checks(ctx.checks, ctx.check_count);
+    }
+    if (ctx.hoist_count > 0) qsort(ctx.hoists, (size_t)ctx.hoist_count, sizeof(C99SafetyHoist), range_compare_hoists);
+    codegen->safety_check_sites = ctx.checks;
+    codegen->safety_check_count = ctx.check_count;
+    codegen->safety_hoists = ctx.hoists;
+    codegen->safety_hoist_count = ctx.hoist_count;
+}
+
+// ---------- 生成 ----------
+
+static const C99SafetyCheck *range_find_check(C99CodeGenerator *codegen, ASTNode *node) {
+    if (!codegen->safety_checks || codegen->safety_check_count == 0) return NULL;
+    C99SafetyCheck key;
+    memset(&key, 0, sizeof(key));
+    key.node = node;
+    return (const C99SafetyCheck *)bsearch(&key, codegen->safety_check_sites, (size_t)codegen->safety_check_count,
+                                           sizeof(C99SafetyCheck), range_compare_checks);
+}
+
+static void range_emit_location(C99CodeGenerator *codegen, ASTNode *node) {
+    emitter_putc(codegen->output, '"');
+    escape_string_for_c(codegen->output, node->filename ? node->filename : "<unknown>");
+    emitter_printf(codegen->output, ":%d\"", node->line);
+}
+
+// 切片下标访问的运行时长度（slice_access 同 c99_gen_index_expr）
+static int range_emit_slice_len(C99CodeGenerator *codegen, ASTNode *array, int slice_access) {
+    if (slice_access == 2) {
+        gen_expr(codegen, array);
+        emitter_lit(codegen->output, "->len");
+        return 1;
+    }
+    if (slice_access == 1) {
+        emitter_putc(codegen->output, '(');
+        gen_expr(codegen, array);
+        emitter_lit(codegen->output, ").len");
+        return 1;
+    }
+    return 0;
+}
+
+void c99_gen_index_expr(C99CodeGenerator *codegen, ASTNode *access, int slice_access) {
+    ASTNode *index = access->data.array_access.index;
+    const C99SafetyCheck *check = range_find_check(codegen, access);
+    if (!check || (check->len < 0 && slice_access == 0)) {
+        gen_expr(codegen, index);
+        return;
+    }
+    emitter_lit(codegen->output, "uya_bounds_check((size_t)(");
+    gen_expr(codegen, index);
+    emitter_lit(codegen->output, "), ");
+    if (check->len >= 0) {
+        emitter_printf(codegen->output, "%lld", check->len);
+    } else {
+        range_emit_slice_len(codegen, access->data.array_access.array, slice_access);
+    }
+    emitter_lit(codegen->output, ", ");
+    range_emit_location(codegen, access);
+    emitter_putc(codegen->output, ')');
+}
+
+// 有符号整数类型的最小值（对应 <stdint.h> 的宏）
+static const char *range_min_macro(ASTNode *type) {
+    const char *name = type->data.type_named.name;
+    if (strcmp(name, "i8") == 0) return "INT8_MIN";
+    if (strcmp(name, "i16") == 0) return "INT16_MIN";
+    if (strcmp(name, "i32") == 0) return "INT32_MIN";
+    return "INT64_MIN";
+}
+
+int c99_gen_checked_arith(C99CodeGenerator *codegen, ASTNode *binary) {
+    const C99SafetyCheck *check = range_find_check(codegen, binary);
+    if (!check) return 0;
+    int op = binary->data.binary_expr.op;
+    ASTNode *left = binary->data.binary_expr.left;
+    ASTNode *right = binary->data.binary_expr.right;
+    if (op == TOKEN_SLASH || op == TOKEN_PERCENT) {
+        // 两侧各求值一次，先检查除数再运算
+        emitter_lit(codegen->output, "({ __auto_type _uya_a = (");
+        gen_expr(codegen, left);
+        emitter_lit(codegen->output, "); __auto_type _uya_d = (");
+        gen_expr(codegen, right);
+        emitter_lit(codegen->output, "); ");
+        if (check->zero_divisor) {
+            emitter_lit(codegen->output, "if (_uya_d == 0) uya_safety_fail(\"除数为零\", ");
+            range_emit_location(codegen, binary);
+            emitter_lit(codegen->output, "); ");
+        }
+        if (check->overflow_type) {
+            emitter_printf(codegen->output, "if (_uya_d == -1 && _uya_a == %s) uya_safety_fail(\"整数溢出\", ",
+                           range_min_macro(check->overflow_type));
+            range_emit_location(codegen, binary);
+            emitter_lit(codegen->output, "); ");
+        }
+        emitter_puts(codegen->output, op == TOKEN_SLASH ? "_uya_a / _uya_d; })" : "_uya_a % _uya_d; })");
+        return 1;
+    }
+    if (!check->overflow_type) return 0;
+    const char *type_c = c99_type_to_c(codegen, check->overflow_type);
+    const char *builtin = op == TOKEN_PLUS ? "add" : (op == TOKEN_MINUS ? "sub" : "mul");
+    emitter_printf(codegen->output, "({ %s _uya_r; if (__builtin_%s_overflow(", type_c, builtin);
+    gen_expr(codegen, left);
+    emitter_lit(codegen->output, ", ");
+    gen_expr(codegen, right);
+    emitter_lit(codegen->output, ", &_uya_r)) uya_safety_fail(\"整数溢出\", ");
+    range_emit_location(codegen, binary);
+    emitter_lit(codegen->output, "); _uya_r; })");
+    return 1;
+}
+
+void c99_gen_loop_hoists(C99CodeGenerator *codegen, ASTNode *loop) {
+    if (!codegen->safety_checks || codegen->safety_hoist_count == 0) return;
+    int lo = 0, hi = codegen->safety_hoist_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if ((uintptr_t)codegen->safety_hoists[mid].loop < (uintptr_t)loop) lo = mid + 1;
+        else hi = mid;
+    }
+    for (int i = lo; i < codegen->safety_hoist_count && codegen->safety_hoists[i].loop == loop; i++) {
+        const C99SafetyHoist *h = &codegen->safety_hoists[i];
+        ASTNode *array = h->site->data.array_access.array;
+        // 无符号归纳变量按 uint64_t 传入，超过 INT64_MAX 的边界不能转为负数
+        const char *cast = h->is_unsigned ? "(uint64_t)" : "(int64_t)";
+        c99_emit(codegen, h->is_unsigned ? "uya_bounds_hoist_u(%s(" : "uya_bounds_hoist(%s(", cast);
+        if (loop->type == AST_WHILE_STMT) {
+            ASTNode *cond = loop->data.while_stmt.condition;
+            gen_expr(codegen, cond->data.binary_expr.left);
+            emitter_printf(codegen->output, "), %s(", cast);
+            gen_expr(codegen, cond->data.binary_expr.right);
+            emitter_puts(codegen->output, cond->data.binary_expr.op == TOKEN_LESS_EQUAL ? "), 1, " : "), 0, ");
+        } else {
+            emitter_puts(codegen->output, get_safe_c_identifier(codegen, loop->data.for_stmt.var_name));
+            emitter_printf(codegen->output, "), %s_uya_end, 0, ", cast);
+        }
+        emitter_printf(codegen->output, "%lld, %lld, ", h->lo_off, h->hi_off);
+        if (h->len >= 0) {
+            emitter_printf(codegen->output, "%lld", h->len);
+        } else {
+            const char *type_c = get_identifier_type_c(codegen, array);
+            int slice_access = (type_c && strstr(type_c, "uya_slice_")) ? (is_identifier_pointer_type(codegen, array) ? 2 : 1) : 0;
+            if (!range_emit_slice_len(codegen, array, slice_access)) emitter_lit(codegen->output, "SIZE_MAX");
+        }
+        emitter_lit(codegen->output, ", ");
+        range_emit_location(codegen, h->site);
+        emitter_lit(codegen->output, ");\n");
+    }
+}
+
+void c99_emit_safety_helpers(C99CodeGenerator *codegen) {
+    if (!codegen->safety_checks) return;
+    emitter_lit(codegen->output, "// 安全检查辅助函数（--safety-checks）\n");
+    emitter_lit(codegen->output, "static void uya_safety_fail(const char *msg, const char *loc) __attribute__((noreturn, cold, noinline));\n");
+    emitter_lit(codegen->output, "static void uya_safety_fail(const char *msg, const char *loc) {\n");
+    emitter_lit(codegen->output, "#ifdef __x86_64__\n");
+    emitter_lit(codegen->output, "    const char *parts[4] = { loc, \": \", msg, \"\\n\" };\n");
+    emitter_lit(codegen->output, "    for (int i = 0; i < 4; i++) {\n");
+    emitter_lit(codegen->output, "        long n = 0;\n");
+    emitter_lit(codegen->output, "        while (parts[i][n]) n++;\n");
+    emitter_lit(codegen->output, "        uya_syscall3(1, 2, (long)parts[i], n);\n");
+    emitter_lit(codegen->output, "    }\n");
+    emitter_lit(codegen->output, "#else\n");
+    emitter_lit(codegen->output, "    (void)msg; (void)loc;\n");
+    emitter_lit(codegen->output, "#endif\n");
+    emitter_lit(codegen->output, "    __builtin_trap();\n");
+    emitter_lit(codegen->output, "}\n\n");
+    emitter_lit(codegen->output, "static inline size_t uya_bounds_check(size_t i, size_t len, const char *loc) {\n");
+    emitter_lit(codegen->output, "    if (__builtin_expect(i >= len, 0)) uya_safety_fail(\"下标越界\", loc);\n");
+    emitter_lit(codegen->output, "    return i;\n");
+    emitter_lit(codegen->output, "}\n\n");
+    emitter_lit(codegen->output, "// 循环 first..end（inclusive 为 0 时不含 end）中访问的下标为 i + lo_off .. i + hi_off\n");
+    emitter_lit(codegen->output, "static inline void uya_bounds_hoist(int64_t first, int64_t end, int inclusive, int64_t lo_off, int64_t hi_off, size_t len, const char *loc) {\n");
+    emitter_lit(codegen->output, "    if (inclusive ? end < first : end <= first) return;\n");
+    emitter_lit(codegen->output, "    uint64_t last = (uint64_t)end - (inclusive ? 0 : 1);\n");
+    emitter_lit(codegen->output, "    if (first < -lo_off || last + (uint64_t)hi_off >= (uint64_t)len) uya_safety_fail(\"下标越界\", loc);\n");
+    emitter_lit(codegen->output, "}\n\n");
+    emitter_lit(codegen->output, "// 无符号归纳变量：first 与 end 按 uint64_t 比较，下标计算不回绕\n");
+    emitter_lit(codegen->output, "static inline void uya_bounds_hoist_u(uint64_t first, uint64_t end, int inclusive, int64_t lo_off, int64_t hi_off, size_t len, const char *loc) {\n");
+    emitter_lit(codegen->output, "    if (inclusive ? end < first : end <= first) return;\n");
+    emitter_lit(codegen->output, "    uint64_t last = end - (inclusive ? 0 : 1);\n");
+    emitter_lit(codegen->output, "    if ((lo_off < 0 && first < (uint64_t)-lo_off) ||\n");
+    emitter_lit(codegen->output, "        (hi_off >= 0 ? last >= (uint64_t)len || (uint64_t)hi_off >= (uint64_t)len - last\n");
+    emitter_lit(codegen->output, "                     : last - (uint64_t)-hi_off >= (uint64_t)len)) uya_safety_fail(\"下标越界\", loc);\n");
+    emitter_lit(codegen->output, "}\n\n");
+}
@@ -0,0 +1,86 @@
+#include "internal.h"
+#include <string.h>
+
+// 拆分输出（--split N）
+// 生成的代码分为一个共享头文件和 N 个 .c 文件，使 C 编译器可以并行编译各文件后再链接：
+//   头文件：第一步到第七步的全部内容（类型定义、函数原型、vtable、字符串常量、内联辅助函数等，
+//           均为声明或 static 定义，可被多个文件包含），以及常量与全局变量的 extern 声明；
+//   .c 文件：各自包含头文件，函数与全局变量定义按声明顺序连续分配，各文件输出量大致相同；
+//           第 0 个文件（即 -o 指定的输出文件）另外包含常量定义、测试函数与 uya_main。
+
+// 拆分输出的文件路径
+int c99_split_output_path(char *buf, size_t size, const char *output_file, int index) {
+    if (!buf || size == 0 || !output_file) {
+        return -1;
+    }
+    // 去掉 .c 后缀作为基础名
+    size_t base_len = strlen(output_file);
+    if (base_len >= 2 && output_file[base_len - 2] == '.' && output_file[base_len - 1] == 'c') {
+        base_len -= 2;
+    }
+    int n;
+    if (index < 0) {
+        n = snprintf(buf, size, "%.*s.h", (int)base_len, output_file);
+    } else if (index == 0) {
+        n = snprintf(buf, size, "%s", output_file);
+    } else {
+        n = snprintf(buf, size, "%.*s_%d.c", (int)base_len, output_file, index);
+    }
+    return (n < 0 || (size_t)n >= size) ? -1 : 0;
+}
+
+// 开始拆分输出：分配各 .c 文件的缓冲区并写入 #include，之后的定义输出到第 0 个文件
+void c99_split_begin(C99CodeGenerator *codegen, const char *output_file) {
+    char header_path[1024];
+    const char *header_name = "uya_output.h";
+    if (c99_split_output_path(header_path, sizeof(header_path), output_file, -1) == 0) {
+        // 各文件与头文件位于同一目录，只需包含文件名
+        const char *slash = strrchr(header_path, '/');
+        header_name = slash ? slash + 1 : header_path;
+    }
+
+    codegen->split_outputs = (Emitter *)arena_alloc(codegen->arena, sizeof(Emitter) * (size_t)codegen->split_count);
+    for (int i = 0; i < codegen->split_count; i++) {
+        emitter_init(&codegen->split_outputs[i], codegen->arena);
+        emitter_printf(&codegen->split_outputs[i], "// C99 代码由 Uya Mini 编译器生成（拆分输出 %d/%d）\n", i + 1, codegen->split_count);
+        emitter_printf(&codegen->split_outputs[i], "#include \"%s\"\n\n", header_name);
+    }
+    codegen->output = &codegen->split_outputs[0];
+    // 头文件与各 .c 文件的 #line 状态各自独立
+    codegen->current_line = 0;
+    codegen->current_filename = NULL;
+}
+
+// 将第八步 b 的生成单元按输出大小连续分配到各 .c 文件，并在头文件中声明全局变量
+void c99_split_units(C99CodeGenerator *codegen, Emitter *header, C99CodegenUnit *units, int unit_count) {
+    size_t total = 0;
+    for (int i = 0; i < unit_count; i++) {
+        total += emitter_size(&units[i].output);
+    }
+
+    // 全局变量的 extern 声明（定义所在的文件之外的函数也可能引用）
+    Emitter *output = codegen->output;
+    codegen->output = header;
+    for (int i = 0; i < unit_count; i++) {
+        if (units[i].kind == C99_UNIT_GLOBAL_VAR) {
+            gen_global_var_extern(codegen, units[i].decl);
+        }
+    }
+    codegen->output = output;
+
+    // 按累计大小切分：第 k 个文件在累计输出超过 total * (k + 1) / split_count 后结束
+    int shard = 0;
+    size_t written = 0;
+    for (int i = 0; i < unit_count; i++) {
+        size_t size = emitter_size(&units[i].output);
+        emitter_append(&codegen->split_outputs[shard], &units[i].output);
+        written += size;
+        while (shard < codegen->split_count - 1 &&
+               written * (size_t)codegen->split_count >= total * (size_t)(shard + 1)) {
+            shard++;
+        }
+    }
+    // 其后的测试函数与 uya_main 写入第 0 个文件，从空的 #line 状态开始
+    codegen->current_line = 0;
+    codegen->current_filename = NULL;
+}
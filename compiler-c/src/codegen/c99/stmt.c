@@ -13,7 +13,7 @@ static void emit_current_block_drops(C99CodeGenerator *codegen) {
         const char *var_safe = codegen->drop_var_safe[d][i];
         if (!drop_c || !var_safe) continue;
         c99_emit(codegen, "/* drop */ ");
-        fprintf(codegen->output, "%s(%s);\n", drop_c, var_safe);
+        emitter_printf(codegen->output, "%s(%s);\n", drop_c, var_safe);
     }
 }
 
@@ -34,7 +34,7 @@ static void emit_drop_cleanup(C99CodeGenerator *codegen, ASTNode **stmts, int st
         const char *var_safe = get_safe_c_identifier(codegen, n->data.var_decl.name);
         if (!drop_c || !var_safe) continue;
         c99_emit(codegen, "/* drop */ ");
-        fprintf(codegen->output, "%s(%s);\n", drop_c, var_safe);
+        emitter_printf(codegen->output, "%s(%s);\n", drop_c, var_safe);
     }
 }
 
@@ -61,6 +61,66 @@ static void emit_defer_cleanup(C99CodeGenerator *codegen, int emit_errdefer) {
     }
 }
 
+/* 输出语句形式 match 的一个臂：head 为同一行的前缀（"else if (...) " 或 "case v: "），
+ * 之后是臂体；有绑定（变量绑定、联合体载荷）或兜底臂时臂体包在 { } 中 */
+static void gen_match_arm_stmt(C99CodeGenerator *codegen, ASTMatchArm *arm, const char *m_type, const char *head) {
+    ASTNode *result = arm->result_expr;
+    if (arm->kind == MATCH_PAT_BIND || arm->kind == MATCH_PAT_WILDCARD || arm->kind == MATCH_PAT_ELSE) {
+        const char *v = arm->kind == MATCH_PAT_BIND ? get_safe_c_identifier(codegen, arm->data.bind.var_name) : NULL;
+        if (v) c99_emit(codegen, "%s{ %s %s = _uya_m;\n", head, m_type, v);
+        else c99_emit(codegen, "%s{\n", head);
+        codegen->indent_level++;
+        if (result->type == AST_BLOCK)
+            gen_stmt(codegen, result);
+        else {
+            gen_expr(codegen, result);
+            emitter_lit(codegen->output, ";\n");
+        }
+        codegen->indent_level--;
+        c99_emit(codegen, "}\n");
+        return;
+    }
+    const char *bind = NULL;
+    const char *vname = NULL;
+    const char *vtype = "int";
+    if (arm->kind == MATCH_PAT_UNION && arm->data.union_pat.var_name && strcmp(arm->data.union_pat.var_name, "_") != 0) {
+        ASTNode *union_decl = find_union_decl_by_variant_c99(codegen, arm->data.union_pat.variant_name);
+        int idx = union_decl ? find_union_variant_index(union_decl, arm->data.union_pat.variant_name) : -1;
+        vname = get_safe_c_identifier(codegen, arm->data.union_pat.variant_name);
+        if (idx >= 0 && vname) {
+            ASTNode *vnode = union_decl->data.union_decl.variants[idx];
+            if (vnode && vnode->type == AST_VAR_DECL && vnode->data.var_decl.type)
+                vtype = c99_type_to_c(codegen, vnode->data.var_decl.type);
+            bind = get_safe_c_identifier(codegen, arm->data.union_pat.var_name);
+        }
+    }
+    if (bind) {
+        c99_emit(codegen, "%s{\n", head);
+        codegen->indent_level++;
+        c99_emit(codegen, "%s %s = _uya_m.u.%s;\n", vtype, bind, vname);
+        if (result->type == AST_BLOCK) {
+            gen_stmt(codegen, result);
+            codegen->indent_level--;
+            c99_emit(codegen, "}\n");
+        } else {
+            gen_expr(codegen, result);
+            emitter_lit(codegen->output, ";\n");
+            codegen->indent_level--;
+            c99_emit(codegen, "}\n");
+        }
+    } else if (result->type == AST_BLOCK) {
+        c99_emit(codegen, "%s{\n", head);
+        codegen->indent_level++;
+        gen_stmt(codegen, result);
+        codegen->indent_level--;
+        c99_emit(codegen, "}\n");
+    } else {
+        c99_emit(codegen, "%s", head);
+        gen_expr(codegen, result);
+        emitter_lit(codegen->output, ";\n");
+    }
+}
+
 void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
     if (!stmt) return;
     
@@ -82,7 +142,7 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
             if (dest->type == AST_UNDERSCORE) {
                 c99_emit(codegen, "(void)(");
                 gen_expr(codegen, src);
-                fputs(");\n", codegen->output);
+                emitter_lit(codegen->output, ");\n");
                 break;
             }
             
@@ -92,7 +152,7 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                 const char *var_name = dest->data.identifier.name;
                 // 检查局部变量
                 for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-                    if (strcmp(codegen->local_variables[i].name, var_name) == 0) {
+                    if (INTERN_STR_EQ(codegen->local_variables[i].name, var_name)) {
                         const char *type_c = codegen->local_variables[i].type_c;
                         if (type_c && strchr(type_c, '[') != NULL) {
                             is_array_assign = 1;
@@ -103,7 +163,7 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                 // 检查全局变量
                 if (!is_array_assign) {
                     for (int i = 0; i < codegen->global_variable_count; i++) {
-                        if (strcmp(codegen->global_variables[i].name, var_name) == 0) {
+                        if (INTERN_STR_EQ(codegen->global_variables[i].name, var_name)) {
                             const char *type_c = codegen->global_variables[i].type_c;
                             if (type_c && strchr(type_c, '[') != NULL) {
                                 is_array_assign = 1;
@@ -118,17 +178,17 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                 // 数组赋值：使用 __uya_memcpy
                 c99_emit(codegen, "__uya_memcpy(");
                 gen_expr(codegen, dest);
-                fputs(", ", codegen->output);
+                emitter_lit(codegen->output, ", ");
                 gen_expr(codegen, src);
-                fputs(", sizeof(", codegen->output);
+                emitter_lit(codegen->output, ", sizeof(");
                 gen_expr(codegen, dest);
-                fputs("));\n", codegen->output);
+                emitter_lit(codegen->output, "));\n");
             } else {
                 // 检查目标是否为原子类型
                 int is_atomic_assign = 0;
                 const char *dest_type_c = NULL;
                 if (dest->type == AST_IDENTIFIER) {
-                    dest_type_c = get_identifier_type_c(codegen, dest->data.identifier.name);
+                    dest_type_c = get_identifier_type_c(codegen, dest);
                     if (dest_type_c && strstr(dest_type_c, "_Atomic") != NULL) {
                         is_atomic_assign = 1;
                     }
@@ -170,48 +230,48 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                         // 硬件支持的原子操作：+= 和 -=
                         if (compound_op == TOKEN_PLUS) {
                             if (safe_name && *safe_name) {
-                                fprintf(codegen->output, "__atomic_fetch_add(&%s, ", safe_name);
+                                emitter_printf(codegen->output, "__atomic_fetch_add(&%s, ", safe_name);
                             } else {
-                                fputs("__atomic_fetch_add(&", codegen->output);
+                                emitter_lit(codegen->output, "__atomic_fetch_add(&");
                                 gen_expr(codegen, dest);
-                                fputs(", ", codegen->output);
+                                emitter_lit(codegen->output, ", ");
                             }
                             gen_expr(codegen, compound_right);
-                            fputs(", __ATOMIC_SEQ_CST);\n", codegen->output);
+                            emitter_lit(codegen->output, ", __ATOMIC_SEQ_CST);\n");
                         } else if (compound_op == TOKEN_MINUS) {
                             if (safe_name && *safe_name) {
-                                fprintf(codegen->output, "__atomic_fetch_sub(&%s, ", safe_name);
+                                emitter_printf(codegen->output, "__atomic_fetch_sub(&%s, ", safe_name);
                             } else {
-                                fputs("__atomic_fetch_sub(&", codegen->output);
+                                emitter_lit(codegen->output, "__atomic_fetch_sub(&");
                                 gen_expr(codegen, dest);
-                                fputs(", ", codegen->output);
+                                emitter_lit(codegen->output, ", ");
                             }
                             gen_expr(codegen, compound_right);
-                            fputs(", __ATOMIC_SEQ_CST);\n", codegen->output);
+                            emitter_lit(codegen->output, ", __ATOMIC_SEQ_CST);\n");
                         } else {
                             // *=, /=, %= 需要使用 compare-and-swap 循环（软件实现）
                             // 为了简化，先回退到普通原子 store（后续可以优化）
                             if (safe_name && *safe_name) {
-                                fprintf(codegen->output, "__atomic_store_n(&%s, ", safe_name);
+                                emitter_printf(codegen->output, "__atomic_store_n(&%s, ", safe_name);
                             } else {
-                                fputs("__atomic_store_n(&", codegen->output);
+                                emitter_lit(codegen->output, "__atomic_store_n(&");
                                 gen_expr(codegen, dest);
-                                fputs(", ", codegen->output);
+                                emitter_lit(codegen->output, ", ");
                             }
                             gen_expr(codegen, src);
-                            fputs(", __ATOMIC_SEQ_CST);\n", codegen->output);
+                            emitter_lit(codegen->output, ", __ATOMIC_SEQ_CST);\n");
                         }
                     } else {
                         // 原子赋值：生成原子 store
                         if (safe_name && *safe_name) {
-                            fprintf(codegen->output, "__atomic_store_n(&%s, ", safe_name);
+                            emitter_printf(codegen->output, "__atomic_store_n(&%s, ", safe_name);
                         } else {
-                            fputs("__atomic_store_n(&", codegen->output);
+                            emitter_lit(codegen->output, "__atomic_store_n(&");
                             gen_expr(codegen, dest);
-                            fputs(", ", codegen->output);
+                            emitter_lit(codegen->output, ", ");
                         }
                         gen_expr(codegen, src);
-                        fputs(", __ATOMIC_SEQ_CST);\n", codegen->output);
+                        emitter_lit(codegen->output, ", __ATOMIC_SEQ_CST);\n");
                     }
                 } else {
                     // 普通赋值（self.field 作为左端时需 cast，以支持 const self 参数）
@@ -219,9 +279,9 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                     codegen->emitting_assign_lhs = 1;
                     gen_expr(codegen, dest);
                     codegen->emitting_assign_lhs = 0;
-                    fputs(" = ", codegen->output);
+                    emitter_lit(codegen->output, " = ");
                     gen_expr(codegen, src);
-                    fputs(";\n", codegen->output);
+                    emitter_lit(codegen->output, ";\n");
                 }
             }
             break;
@@ -243,15 +303,9 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                 unsigned id = expr->data.error_value.name ? get_or_add_error_id(codegen, expr->data.error_value.name) : 0;
                 if (id == 0) { id = 1; }
                 const char *ret_c = c99_type_to_c(codegen, return_type);
-                int is_void = (return_type->data.type_error_union.payload_type &&
-                    return_type->data.type_error_union.payload_type->type == AST_TYPE_NAMED &&
-                    return_type->data.type_error_union.payload_type->data.type_named.name &&
-                    strcmp(return_type->data.type_error_union.payload_type->data.type_named.name, "void") == 0);
-                if (is_void) {
-                    c99_emit(codegen, "return (%s){ .error_id = %uU };\n", ret_c, id);
-                } else {
-                    c99_emit(codegen, "return (%s){ .error_id = %uU, .value = 0 };\n", ret_c, id);
-                }
+                /* 只初始化 error_id，value（若有）按 C 的规则零初始化，结构体等 payload 无需嵌套花括号；
+                   紧凑布局的 !&T 中 value 与 error_id 共用存储，也只能初始化 error_id */
+                c99_emit(codegen, "return (%s){ .error_id = %uU };\n", ret_c, id);
                 break;
             }
             
@@ -295,7 +349,7 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                     gen_array_wrapper_struct(codegen, return_type, struct_name);
                     c99_emit(codegen, "%s _uya_ret = (struct %s) { .data = ", ret_c, struct_name);
                     if (expr->type == AST_ARRAY_LITERAL) {
-                        fputc('{', codegen->output);
+                        emitter_putc(codegen->output, '{');
                         ASTNode **elements = expr->data.array_literal.elements;
                         int element_count = expr->data.array_literal.element_count;
                         ASTNode *repeat_count_expr = expr->data.array_literal.repeat_count_expr;
@@ -303,27 +357,27 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                             int n = eval_const_expr(codegen, repeat_count_expr);
                             if (n <= 0) n = 1;
                             for (int i = 0; i < n; i++) {
-                                if (i > 0) fputs(", ", codegen->output);
+                                if (i > 0) emitter_lit(codegen->output, ", ");
                                 gen_expr(codegen, elements[0]);
                             }
                         } else if (element_count > 0) {
                             for (int i = 0; i < element_count; i++) {
-                                if (i > 0) fputs(", ", codegen->output);
+                                if (i > 0) emitter_lit(codegen->output, ", ");
                                 gen_expr(codegen, elements[i]);
                             }
                         } else {
                             /* 空数组字面量：生成 0 避免 ISO C 警告 */
-                            fputs("0", codegen->output);
+                            emitter_lit(codegen->output, "0");
                         }
-                        fputc('}', codegen->output);
+                        emitter_putc(codegen->output, '}');
                     } else {
                         gen_expr(codegen, expr);
                     }
-                    fputs(" };\n", codegen->output);
+                    emitter_lit(codegen->output, " };\n");
                 } else {
                     c99_emit(codegen, "%s _uya_ret = ", ret_c);
                     gen_expr(codegen, expr);
-                    fputs(";\n", codegen->output);
+                    emitter_lit(codegen->output, ";\n");
                 }
             } else {
                 if (return_type && return_type->type == AST_TYPE_ERROR_UNION && expr && expr->type != AST_ERROR_VALUE) {
@@ -350,13 +404,17 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                         // 如果表达式本身就是错误联合类型，直接返回
                         c99_emit(codegen, "%s _uya_ret = ", ret_c);
                         gen_expr(codegen, expr);
-                        fputs(";\n", codegen->output);
+                        emitter_lit(codegen->output, ";\n");
                     } else if (payload_void) {
                         c99_emit(codegen, "%s _uya_ret = (%s){ .error_id = 0 };\n", ret_c, ret_c);
+                    } else if (c99_error_union_is_niche(ret_c)) {
+                        c99_emit(codegen, "%s _uya_ret = (%s){ .value = ", ret_c, ret_c);
+                        gen_expr(codegen, expr);
+                        emitter_lit(codegen->output, " };\n");
                     } else {
                         c99_emit(codegen, "%s _uya_ret = (%s){ .error_id = 0, .value = ", ret_c, ret_c);
                         gen_expr(codegen, expr);
-                        fputs(" };\n", codegen->output);
+                        emitter_lit(codegen->output, " };\n");
                     }
                 } else if (!is_void && expr) {
                     // 对于泛型结构体实例化的返回类型，如果表达式是结构体初始化，使用返回类型的 C 类型名称
@@ -383,18 +441,18 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                         const char **field_names = expr->data.struct_init.field_names;
                         ASTNode **field_values = expr->data.struct_init.field_values;
                         
-                        fprintf(codegen->output, "(struct %s){", struct_name_for_init);
+                        emitter_printf(codegen->output, "(struct %s){", struct_name_for_init);
                         for (int i = 0; i < field_count; i++) {
                             const char *safe_field_name = get_safe_c_identifier(codegen, field_names[i]);
-                            fprintf(codegen->output, ".%s = ", safe_field_name);
+                            emitter_printf(codegen->output, ".%s = ", safe_field_name);
                             gen_expr(codegen, field_values[i]);
-                            if (i < field_count - 1) fputs(", ", codegen->output);
+                            if (i < field_count - 1) emitter_lit(codegen->output, ", ");
                         }
-                        fputc('}', codegen->output);
+                        emitter_putc(codegen->output, '}');
                     } else {
                         gen_expr(codegen, expr);
                     }
-                    fputs(";\n", codegen->output);
+                    emitter_lit(codegen->output, ";\n");
                 } else if (!is_void) {
                     c99_emit(codegen, "%s _uya_ret = 0;\n", ret_c);
                 }
@@ -474,12 +532,12 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                 const char *safe_name = get_safe_c_identifier(codegen, names[i]);
                 if (!safe_name) continue;
                 if (is_const) {
-                    fprintf(codegen->output, "const %s %s = ", elem_type_c, safe_name);
+                    emitter_printf(codegen->output, "const %s %s = ", elem_type_c, safe_name);
                 } else {
-                    fprintf(codegen->output, "%s %s = ", elem_type_c, safe_name);
+                    emitter_printf(codegen->output, "%s %s = ", elem_type_c, safe_name);
                 }
                 gen_expr(codegen, init);
-                fprintf(codegen->output, ".f%d;\n", i);
+                emitter_printf(codegen->output, ".f%d;\n", i);
                 /* 注册局部变量供后续引用 */
                 if (codegen->local_variable_count < C99_MAX_LOCAL_VARS) {
                     const char *type_to_store = elem_type_c;
@@ -547,9 +605,9 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                         
                         // 生成数组声明：const base_type var_name dimensions（字符串插值初始化时不加 const 以便填充）
                         if (emit_const) {
-                            fprintf(codegen->output, "const %s %s%s", base_type, var_name, dimensions);
+                            emitter_printf(codegen->output, "const %s %s%s", base_type, var_name, dimensions);
                         } else {
-                            fprintf(codegen->output, "%s %s%s", base_type, var_name, dimensions);
+                            emitter_printf(codegen->output, "%s %s%s", base_type, var_name, dimensions);
                         }
                         type_c = NULL; // 已处理，避免后续重复输出
                     }
@@ -603,14 +661,16 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                                 if (operand_is_err_union) {
                                     const char *union_c = operand_union_c;
                                     c99_emit_indent(codegen);
-                                    fprintf(codegen->output, "%s _uya_catch_tmp = ", union_c);
+                                    emitter_printf(codegen->output, "%s _uya_catch_tmp = ", union_c);
                                     gen_expr(codegen, operand);
-                                    fputs("; if (_uya_catch_tmp.error_id != 0) {\n", codegen->output);
+                                    emitter_lit(codegen->output, "; if (");
+                                    c99_emit_error_test(codegen, union_c, "_uya_catch_tmp");
+                                    emitter_lit(codegen->output, ") {\n");
                                     codegen->indent_level++;
                                     if (err_name) {
                                         const char *safe = get_safe_c_identifier(codegen, err_name);
                                         c99_emit_indent(codegen);
-                                        fprintf(codegen->output, "%s %s = _uya_catch_tmp;\n", union_c, safe);
+                                        emitter_printf(codegen->output, "%s %s = _uya_catch_tmp;\n", union_c, safe);
                                     }
                                     for (int i = 0; i < block->data.block.stmt_count; i++) {
                                         ASTNode *s = block->data.block.stmts[i];
@@ -619,16 +679,16 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                                     }
                                     codegen->indent_level--;
                                     c99_emit_indent(codegen);
-                                    fputs("}\n", codegen->output);
+                                    emitter_lit(codegen->output, "}\n");
                                     return;  // void 类型变量不需要存储到变量表
                                 }
                             }
                         }
                         // 普通情况：生成 (void)(expr);
                         c99_emit_indent(codegen);
-                        fputs("(void)(", codegen->output);
+                        emitter_lit(codegen->output, "(void)(");
                         gen_expr(codegen, init_expr);
-                        fputs(");\n", codegen->output);
+                        emitter_lit(codegen->output, ");\n");
                     }
                     return;  // void 类型变量不需要存储到变量表
                 }
@@ -645,7 +705,7 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                             // 需要生成：T (* const var_name)[N]
                             size_t prefix_len = open_paren - type_c;
                             size_t suffix_len = strlen(bracket);
-                            fprintf(codegen->output, "%.*s(* const %s)%.*s", 
+                            emitter_printf(codegen->output, "%.*s(* const %s)%.*s", 
                                     (int)prefix_len, type_c, var_name, (int)suffix_len, bracket);
                             // 存储类型字符串：T (* const)[N]（用于变量表）
                             size_t total_len = prefix_len + suffix_len + 10; // "(* const)" + null
@@ -733,18 +793,18 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                 if (is_params_init) {
                     ASTNode **params = codegen->current_function_decl->data.fn_decl.params;
                     int n = codegen->current_function_decl->data.fn_decl.param_count;
-                    fputs(" = {", codegen->output);
+                    emitter_lit(codegen->output, " = {");
                     for (int i = 0; i < n; i++) {
-                        fprintf(codegen->output, ".f%d = ", i);
+                        emitter_printf(codegen->output, ".f%d = ", i);
                         if (params[i] && params[i]->type == AST_VAR_DECL && params[i]->data.var_decl.name) {
                             const char *pname = get_safe_c_identifier(codegen, params[i]->data.var_decl.name);
-                            fprintf(codegen->output, "%s", pname);
+                            emitter_puts(codegen->output, pname);
                         } else {
-                            fputs("0", codegen->output);
+                            emitter_lit(codegen->output, "0");
                         }
-                        if (i < n - 1) fputs(", ", codegen->output);
+                        if (i < n - 1) emitter_lit(codegen->output, ", ");
                     }
-                    fputs("};\n", codegen->output);
+                    emitter_lit(codegen->output, "};\n");
                 }
                 // 检查是否是空结构体初始化（field_count == 0）
                 // 如果是，改为手动初始化，避免 gcc 生成错误的 memset 调用
@@ -808,7 +868,7 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                 if (is_empty_struct_init) {
                     // 空结构体初始化：C 中空结构体有占位字段 _empty，需零初始化
                     // 先完成变量声明（不包含初始化）
-                    fputs(";\n", codegen->output);
+                    emitter_lit(codegen->output, ";\n");
                     
                     // 获取结构体定义中的所有字段（AST 中空结构体 field_count 为 0）
                     ASTNode *struct_decl = struct_decl_for_empty_init;
@@ -834,9 +894,9 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                             // 如果有默认值，使用默认值
                             if (default_value) {
                                 c99_emit_indent(codegen);
-                                fprintf(codegen->output, "%s.%s = ", var_name, field_name);
+                                emitter_printf(codegen->output, "%s.%s = ", var_name, field_name);
                                 gen_expr(codegen, default_value);
-                                fputs(";\n", codegen->output);
+                                emitter_lit(codegen->output, ";\n");
                             } else {
                                 // 根据字段类型生成初始化代码
                                 if (field_type->type == AST_TYPE_POINTER) {
@@ -861,28 +921,28 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                 } else if (is_array_from_function) {
                     // 从函数调用接收数组：需要从包装结构体中提取
                     // 先完成变量声明（不包含初始化）
-                    fputs(";\n", codegen->output);
+                    emitter_lit(codegen->output, ";\n");
                     // 然后使用 __uya_memcpy 从结构体中提取数组
                     c99_emit(codegen, "__uya_memcpy(");
                     c99_emit(codegen, "%s", var_name);
-                    fputs(", ", codegen->output);
+                    emitter_lit(codegen->output, ", ");
                     gen_expr(codegen, init_expr);
-                    fputs(".data, sizeof(", codegen->output);
+                    emitter_lit(codegen->output, ".data, sizeof(");
                     c99_emit(codegen, "%s", var_name);
-                    fputs("));\n", codegen->output);
+                    emitter_lit(codegen->output, "));\n");
                 } else if (is_string_interp_init) {
-                    fputs(";\n", codegen->output);
+                    emitter_lit(codegen->output, ";\n");
                     c99_emit_string_interp_fill(codegen, init_expr, var_name);
                 } else if (needs_memcpy) {
                     // 数组初始化：使用__uya_memcpy
-                    fputs(";\n", codegen->output);
+                    emitter_lit(codegen->output, ";\n");
                     c99_emit_indent(codegen);
-                    fprintf(codegen->output, "__uya_memcpy(%s, ", var_name);
+                    emitter_printf(codegen->output, "__uya_memcpy(%s, ", var_name);
                     gen_expr(codegen, init_expr);
-                    fprintf(codegen->output, ", sizeof(%s));\n", var_name);
+                    emitter_printf(codegen->output, ", sizeof(%s));\n", var_name);
                 } else if (struct_init_needs_memcpy) {
                     // 结构体初始化包含数组字段：先声明变量，然后使用复合字面量初始化非数组字段，最后用memcpy复制数组字段
-                    fputs(" = ", codegen->output);
+                    emitter_lit(codegen->output, " = ");
                     
                     // 生成复合字面量，但数组字段使用空初始化
                     // 对于泛型结构体实例化，使用变量类型的 C 类型名称
@@ -909,25 +969,25 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                     const char **field_names = init_expr->data.struct_init.field_names;
                     ASTNode **field_values = init_expr->data.struct_init.field_values;
                     
-                    fprintf(codegen->output, "(struct %s){", struct_name_for_init);
+                    emitter_printf(codegen->output, "(struct %s){", struct_name_for_init);
                     for (int i = 0; i < field_count; i++) {
                         const char *safe_field_name = get_safe_c_identifier(codegen, field_names[i]);
                         ASTNode *field_type = find_struct_field_type(codegen, struct_decl, field_names[i]);
                         ASTNode *field_value = field_values[i];
                         
-                        fprintf(codegen->output, ".%s = ", safe_field_name);
+                        emitter_printf(codegen->output, ".%s = ", safe_field_name);
                         
                         // 如果是数组字段且初始化值是标识符，使用空初始化（后续用memcpy填充）
                         if (field_type && field_type->type == AST_TYPE_ARRAY && 
                             field_value && field_value->type == AST_IDENTIFIER) {
-                            fputs("{0}", codegen->output);  /* 使用 {0} 避免 ISO C 警告 */
+                            emitter_lit(codegen->output, "{0}");  /* 使用 {0} 避免 ISO C 警告 */
                         } else {
                             gen_expr(codegen, field_value);
                         }
                         
-                        if (i < field_count - 1) fputs(", ", codegen->output);
+                        if (i < field_count - 1) emitter_lit(codegen->output, ", ");
                     }
-                    fputs("};\n", codegen->output);
+                    emitter_lit(codegen->output, "};\n");
                     
                     // 使用memcpy复制数组字段
                     for (int i = 0; i < field_count; i++) {
@@ -949,21 +1009,21 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                     int n = init_expr->data.tuple_literal.element_count;
                     ASTNode **elements = init_expr->data.tuple_literal.elements;
                     if (n > 0 && elements) {
-                        fputs(" = { ", codegen->output);
+                        emitter_lit(codegen->output, " = { ");
                         for (int i = 0; i < n; i++) {
-                            fprintf(codegen->output, ".f%d = ", i);
+                            emitter_printf(codegen->output, ".f%d = ", i);
                             gen_expr(codegen, elements[i]);
-                            if (i < n - 1) fputs(", ", codegen->output);
+                            if (i < n - 1) emitter_lit(codegen->output, ", ");
                         }
-                        fputs(" };\n", codegen->output);
+                        emitter_lit(codegen->output, " };\n");
                     } else {
-                        fputs(" = ", codegen->output);
+                        emitter_lit(codegen->output, " = ");
                         gen_expr(codegen, init_expr);
-                        fputs(";\n", codegen->output);
+                        emitter_lit(codegen->output, ";\n");
                     }
                 } else if (!is_params_init) {
                     // 普通初始化（@params 已在上方单独处理）
-                    fputs(" = ", codegen->output);
+                    emitter_lit(codegen->output, " = ");
                     
                     // 对于泛型结构体实例化的结构体初始化，使用变量类型的 C 类型名称
                     if (init_expr->type == AST_STRUCT_INIT && 
@@ -985,14 +1045,14 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                             const char **field_names = init_expr->data.struct_init.field_names;
                             ASTNode **field_values = init_expr->data.struct_init.field_values;
                             
-                            fprintf(codegen->output, "(struct %s){", struct_name_for_init);
+                            emitter_printf(codegen->output, "(struct %s){", struct_name_for_init);
                             for (int i = 0; i < field_count; i++) {
                                 const char *safe_field_name = get_safe_c_identifier(codegen, field_names[i]);
-                                fprintf(codegen->output, ".%s = ", safe_field_name);
+                                emitter_printf(codegen->output, ".%s = ", safe_field_name);
                                 gen_expr(codegen, field_values[i]);
-                                if (i < field_count - 1) fputs(", ", codegen->output);
+                                if (i < field_count - 1) emitter_lit(codegen->output, ", ");
                             }
-                            fputc('}', codegen->output);
+                            emitter_putc(codegen->output, '}');
                         } else {
                             // 回退到普通处理
                             gen_expr(codegen, init_expr);
@@ -1000,10 +1060,10 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                     } else {
                         gen_expr(codegen, init_expr);
                     }
-                    fputs(";\n", codegen->output);
+                    emitter_lit(codegen->output, ";\n");
                 }
             } else {
-                fputs(";\n", codegen->output);
+                emitter_lit(codegen->output, ";\n");
             }
             if (codegen->current_drop_scope >= 0 && var_type && var_type->type == AST_TYPE_NAMED &&
                 var_type->data.type_named.name && type_has_drop_c99(codegen, var_type->data.type_named.name) &&
@@ -1024,28 +1084,29 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
             
             c99_emit(codegen, "if (");
             gen_expr(codegen, condition);
-            fputs(") {\n", codegen->output);
+            emitter_lit(codegen->output, ") {\n");
             codegen->indent_level++;
             gen_stmt(codegen, then_branch);
             codegen->indent_level--;
             c99_emit(codegen, "}");
             if (else_branch) {
-                fputs(" else {\n", codegen->output);
+                emitter_lit(codegen->output, " else {\n");
                 codegen->indent_level++;
                 gen_stmt(codegen, else_branch);
                 codegen->indent_level--;
                 c99_emit(codegen, "}");
             }
-            fputs("\n", codegen->output);
+            emitter_lit(codegen->output, "\n");
             break;
         }
         case AST_WHILE_STMT: {
             ASTNode *condition = stmt->data.while_stmt.condition;
             ASTNode *body = stmt->data.while_stmt.body;
             
+            c99_gen_loop_hoists(codegen, stmt);
             c99_emit(codegen, "while (");
             gen_expr(codegen, condition);
-            fputs(") {\n", codegen->output);
+            emitter_lit(codegen->output, ") {\n");
             codegen->indent_level++;
             gen_stmt(codegen, body);
             codegen->indent_level--;
@@ -1072,6 +1133,7 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                         c99_emit(codegen, "%s _uya_end = ", range_type_c);
                         gen_expr(codegen, end_expr);
                         c99_emit(codegen, ";\n");
+                        c99_gen_loop_hoists(codegen, stmt);
                         c99_emit(codegen, "for (; %s < _uya_end; %s++) {\n", var_name, var_name);
                     } else {
                         c99_emit(codegen, "%s _uya_s = ", range_type_c);
@@ -1236,81 +1298,56 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
             codegen->indent_level++;
             c99_emit(codegen, "%s _uya_m = ", m_type);
             gen_expr(codegen, match_expr);
-            fputs(";\n", codegen->output);
+            emitter_lit(codegen->output, ";\n");
+            C99MatchPlan plan;
+            if (c99_plan_match_switch(codegen, stmt, m_type, &plan)) {
+                /* 常量/枚举/联合体标签/错误码模式：switch 分派 */
+                c99_emit(codegen, "switch (%s) {\n", c99_match_subject_expr(&plan));
+                codegen->indent_level++;
+                for (int c = 0; c < plan.case_count; c++) {
+                    char label[64];
+                    c99_format_match_case_label(&plan.cases[c], label, sizeof(label));
+                    gen_match_arm_stmt(codegen, &stmt->data.match_expr.arms[plan.cases[c].arm], m_type, label);
+                    c99_emit(codegen, "break;\n");
+                }
+                if (plan.default_arm >= 0) {
+                    gen_match_arm_stmt(codegen, &stmt->data.match_expr.arms[plan.default_arm], m_type, "default: ");
+                    c99_emit(codegen, "break;\n");
+                }
+                codegen->indent_level--;
+                c99_emit(codegen, "}\n");
+                codegen->indent_level--;
+                c99_emit(codegen, "}\n");
+                break;
+            }
             int first = 1;
             for (int i = 0; i < stmt->data.match_expr.arm_count; i++) {
                 ASTMatchArm *arm = &stmt->data.match_expr.arms[i];
                 const char *prefix = first ? "" : "else ";
+                char head[96];
                 first = 0;
                 if (arm->kind == MATCH_PAT_LITERAL && arm->data.literal.expr) {
                     if (arm->data.literal.expr->type == AST_NUMBER) {
-                        c99_emit(codegen, "%sif (_uya_m == %d) ", prefix, arm->data.literal.expr->data.number.value);
+                        snprintf(head, sizeof(head), "%sif (_uya_m == %d) ", prefix, arm->data.literal.expr->data.number.value);
                     } else if (arm->data.literal.expr->type == AST_BOOL) {
-                        c99_emit(codegen, "%sif (_uya_m == %s) ", prefix, arm->data.literal.expr->data.bool_literal.value ? "1" : "0");
-                    }
-                    if (arm->result_expr->type == AST_BLOCK) {
-                        fputs("{\n", codegen->output);
-                        codegen->indent_level++;
-                        gen_stmt(codegen, arm->result_expr);
-                        codegen->indent_level--;
-                        c99_emit(codegen, "}\n");
+                        snprintf(head, sizeof(head), "%sif (_uya_m == %s) ", prefix, arm->data.literal.expr->data.bool_literal.value ? "1" : "0");
                     } else {
-                        gen_expr(codegen, arm->result_expr);
-                        fputs(";\n", codegen->output);
+                        snprintf(head, sizeof(head), "%s", "");
                     }
+                    gen_match_arm_stmt(codegen, arm, m_type, head);
                 } else if (arm->kind == MATCH_PAT_ENUM) {
                     ASTNode *enum_decl = find_enum_decl_c99(codegen, arm->data.enum_pat.enum_name);
                     int ev = enum_decl ? find_enum_variant_value(codegen, enum_decl, arm->data.enum_pat.variant_name) : -1;
-                    if (ev >= 0) c99_emit(codegen, "%sif (_uya_m == %d) ", prefix, ev);
-                    else c99_emit(codegen, "%sif (0) ", prefix);
-                    if (arm->result_expr->type == AST_BLOCK) {
-                        fputs("{\n", codegen->output);
-                        codegen->indent_level++;
-                        gen_stmt(codegen, arm->result_expr);
-                        codegen->indent_level--;
-                        c99_emit(codegen, "}\n");
-                    } else {
-                        gen_expr(codegen, arm->result_expr);
-                        fputs(";\n", codegen->output);
-                    }
-                } else if (arm->kind == MATCH_PAT_BIND) {
-                    const char *v = get_safe_c_identifier(codegen, arm->data.bind.var_name);
-                    if (v) c99_emit(codegen, "%s{ %s %s = _uya_m;\n", prefix, m_type, v);
-                    else c99_emit(codegen, "%s{\n", prefix);
-                    codegen->indent_level++;
-                    if (arm->result_expr->type == AST_BLOCK)
-                        gen_stmt(codegen, arm->result_expr);
-                    else {
-                        gen_expr(codegen, arm->result_expr);
-                        fputs(";\n", codegen->output);
-                    }
-                    codegen->indent_level--;
-                    c99_emit(codegen, "}\n");
-                } else if (arm->kind == MATCH_PAT_WILDCARD || arm->kind == MATCH_PAT_ELSE) {
-                    c99_emit(codegen, "%s{\n", prefix);
-                    codegen->indent_level++;
-                    if (arm->result_expr->type == AST_BLOCK)
-                        gen_stmt(codegen, arm->result_expr);
-                    else {
-                        gen_expr(codegen, arm->result_expr);
-                        fputs(";\n", codegen->output);
-                    }
-                    codegen->indent_level--;
-                    c99_emit(codegen, "}\n");
+                    if (ev >= 0) snprintf(head, sizeof(head), "%sif (_uya_m == %d) ", prefix, ev);
+                    else snprintf(head, sizeof(head), "%sif (0) ", prefix);
+                    gen_match_arm_stmt(codegen, arm, m_type, head);
+                } else if (arm->kind == MATCH_PAT_BIND || arm->kind == MATCH_PAT_WILDCARD || arm->kind == MATCH_PAT_ELSE) {
+                    gen_match_arm_stmt(codegen, arm, m_type, prefix);
                 } else if (arm->kind == MATCH_PAT_ERROR) {
                     unsigned id = arm->data.error_pat.error_name ? get_or_add_error_id(codegen, arm->data.error_pat.error_name) : 0;
                     if (id == 0) id = 1;
-                    c99_emit(codegen, "%sif (_uya_m.error_id == %uU) ", prefix, id);
-                    if (arm->result_expr->type == AST_BLOCK) {
-                        fputs("{\n", codegen->output);
-                        codegen->indent_level++;
-                        gen_stmt(codegen, arm->result_expr);
-                        codegen->indent_level--;
-                        c99_emit(codegen, "}\n");
-                    } else {
-                        gen_expr(codegen, arm->result_expr);
-                        fputs(";\n", codegen->output);
-                    }
+                    snprintf(head, sizeof(head), "%sif (_uya_m.error_id == %uU) ", prefix, id);
+                    gen_match_arm_stmt(codegen, arm, m_type, head);
                 } else if (arm->kind == MATCH_PAT_UNION && arm->data.union_pat.variant_name) {
                     ASTNode *union_decl = find_union_decl_by_variant_c99(codegen, arm->data.union_pat.variant_name);
                     if (union_decl) {
@@ -1318,26 +1355,8 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
                         const char *uname = get_safe_c_identifier(codegen, union_decl->data.union_decl.name);
                         const char *vname = get_safe_c_identifier(codegen, arm->data.union_pat.variant_name);
                         if (idx >= 0 && uname && vname) {
-                            ASTNode *vnode = union_decl->data.union_decl.variants[idx];
-                            const char *vtype = (vnode && vnode->type == AST_VAR_DECL && vnode->data.var_decl.type) ? c99_type_to_c(codegen, vnode->data.var_decl.type) : "int";
-                            const char *bind = (arm->data.union_pat.var_name && strcmp(arm->data.union_pat.var_name, "_") != 0) ? get_safe_c_identifier(codegen, arm->data.union_pat.var_name) : NULL;
-                            if (bind) {
-                                c99_emit(codegen, "%sif (_uya_m._tag == %d) {\n", prefix, idx);
-                                codegen->indent_level++;
-                                c99_emit(codegen, "%s %s = _uya_m.u.%s;\n", vtype, bind, vname);
-                            } else {
-                                c99_emit(codegen, "%sif (_uya_m._tag == %d) ", prefix, idx);
-                            }
-                            if (arm->result_expr->type == AST_BLOCK) {
-                                if (!bind) { fputs("{\n", codegen->output); codegen->indent_level++; }
-                                gen_stmt(codegen, arm->result_expr);
-                                if (!bind) codegen->indent_level--;
-                                c99_emit(codegen, "}\n");
-                            } else {
-                                gen_expr(codegen, arm->result_expr);
-                                fputs(";\n", codegen->output);
-                                if (bind) { codegen->indent_level--; c99_emit(codegen, "}\n"); }
-                            }
+                            snprintf(head, sizeof(head), "%sif (_uya_m._tag == %d) ", prefix, idx);
+                            gen_match_arm_stmt(codegen, arm, m_type, head);
                         }
                     }
                 }
@@ -1361,7 +1380,7 @@ void gen_stmt(C99CodeGenerator *codegen, ASTNode *stmt) {
             if (stmt->type >= AST_BINARY_EXPR && stmt->type <= AST_SYSCALL) {
                 c99_emit(codegen, "");
                 gen_expr(codegen, stmt);
-                fputs(";\n", codegen->output);
+                emitter_lit(codegen->output, ";\n");
             }
             // 忽略其他语句
             break;
@@ -68,20 +68,10 @@ int struct_implements_interface_c99(C99CodeGenerator *codegen, const char *struc
 
 // 查找接口声明
 ASTNode *find_interface_decl_c99(C99CodeGenerator *codegen, const char *interface_name) {
-    if (!codegen || !interface_name || !codegen->program_node) {
+    if (!codegen || !interface_name) {
         return NULL;
     }
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl || decl->type != AST_INTERFACE_DECL) continue;
-        const char *decl_name = decl->data.interface_decl.name;
-        if (decl_name && strcmp(decl_name, interface_name) == 0) {
-            return decl;
-        }
-    }
-    return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_INTERFACE, interface_name);
 }
 
 // 递归收集接口（包括组合接口）的所有方法签名
@@ -128,57 +118,22 @@ static int collect_interface_method_sigs(C99CodeGenerator *codegen, const char *
 
 // 查找结构体声明
 ASTNode *find_struct_decl_c99(C99CodeGenerator *codegen, const char *struct_name) {
-    if (!codegen || !struct_name || !codegen->program_node) {
+    if (!codegen || !struct_name) {
         return NULL;
     }
-    
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl || decl->type != AST_STRUCT_DECL) {
-            continue;
-        }
-        
-        const char *decl_name = decl->data.struct_decl.name;
-        if (decl_name && strcmp(decl_name, struct_name) == 0) {
-            return decl;
-        }
-    }
-    
-    return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_STRUCT, struct_name);
 }
 
 // 查找联合体声明
 ASTNode *find_union_decl_c99(C99CodeGenerator *codegen, const char *union_name) {
-    if (!codegen || !union_name || !codegen->program_node) {
-        return NULL;
-    }
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl || decl->type != AST_UNION_DECL) continue;
-        const char *decl_name = decl->data.union_decl.name;
-        if (decl_name && strcmp(decl_name, union_name) == 0) {
-            return decl;
-        }
-    }
-    return NULL;
+    if (!codegen || !union_name) return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_UNION, union_name);
 }
 
 // 根据变体名查找包含该变体的联合体声明（用于 match 代码生成）
 ASTNode *find_union_decl_by_variant_c99(C99CodeGenerator *codegen, const char *variant_name) {
-    if (!codegen || !codegen->program_node || !variant_name) return NULL;
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (!decl || decl->type != AST_UNION_DECL) continue;
-        if (find_union_variant_index(decl, variant_name) >= 0) return decl;
-    }
-    return NULL;
+    if (!codegen || !variant_name) return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_UNION_VARIANT, variant_name);
 }
 
 // 根据 C 类型后缀（如 "uya_tagged_IntOrFloat"）查找联合体声明
@@ -449,14 +404,14 @@ void emit_interface_structs_and_vtables(C99CodeGenerator *codegen) {
             const char *ret_c = convert_array_return_type(codegen, msig->data.fn_decl.return_type);
             const char *mname = get_safe_c_identifier(codegen, msig->data.fn_decl.name);
             int pc = msig->data.fn_decl.param_count;
-            fprintf(codegen->output, "%*s%s (*%s)(void *self", codegen->indent_level * 4, "", ret_c, mname);
+            emitter_printf(codegen->output, "%*s%s (*%s)(void *self", codegen->indent_level * 4, "", ret_c, mname);
             for (int k = 1; k < pc && msig->data.fn_decl.params; k++) {
                 ASTNode *p = msig->data.fn_decl.params[k];
                 if (!p || p->type != AST_VAR_DECL) continue;
                 const char *pt_c = c99_type_to_c(codegen, p->data.var_decl.type);
-                fprintf(codegen->output, ", %s", pt_c);
+                emitter_printf(codegen->output, ", %s", pt_c);
             }
-            fputs(");\n", codegen->output);
+            emitter_lit(codegen->output, ");\n");
         }
         codegen->indent_level--;
         c99_emit(codegen, "};\n");
@@ -488,7 +443,7 @@ void emit_vtable_constants(C99CodeGenerator *codegen) {
             int sig_count = 0;
             collect_interface_method_sigs(codegen, iface_name, all_sigs, 128, &sig_count);
             
-            fprintf(codegen->output, "static const struct uya_vtable_%s uya_vtable_%s_%s = { ",
+            emitter_printf(codegen->output, "static const struct uya_vtable_%s uya_vtable_%s_%s = { ",
                     safe_iface, safe_iface, safe_struct);
             for (int k = 0; k < sig_count; k++) {
                 ASTNode *msig = all_sigs[k];
@@ -498,24 +453,24 @@ void emit_vtable_constants(C99CodeGenerator *codegen) {
                 ASTNode *impl = find_method_in_struct_c99(codegen, struct_name, mname);
                 if (!impl) continue;
                 const char *cname = get_method_c_name(codegen, struct_name, mname);
-                if (k > 0) fputs(", ", codegen->output);
+                if (k > 0) emitter_lit(codegen->output, ", ");
                 /* 函数指针转换 (S*)->(void*) 以匹配 vtable 签名 */
                 if (cname) {
                     const char *ret_c = convert_array_return_type(codegen, msig->data.fn_decl.return_type);
                     int pc = msig->data.fn_decl.param_count;
-                    fprintf(codegen->output, "(%s (*)(void *self", ret_c);
+                    emitter_printf(codegen->output, "(%s (*)(void *self", ret_c);
                     for (int ki = 1; ki < pc && msig->data.fn_decl.params; ki++) {
                         ASTNode *pk = msig->data.fn_decl.params[ki];
                         if (pk && pk->type == AST_VAR_DECL) {
-                            fprintf(codegen->output, ", %s", c99_type_to_c(codegen, pk->data.var_decl.type));
+                            emitter_printf(codegen->output, ", %s", c99_type_to_c(codegen, pk->data.var_decl.type));
                         }
                     }
-                    fprintf(codegen->output, "))&%s", cname);
+                    emitter_printf(codegen->output, "))&%s", cname);
                 } else {
-                    fputs("NULL", codegen->output);
+                    emitter_lit(codegen->output, "NULL");
                 }
             }
-            fputs(" };\n", codegen->output);
+            emitter_lit(codegen->output, " };\n");
         }
     }
 }
@@ -672,19 +627,7 @@ static const char *c99_mono_struct_type_to_c(C99CodeGenerator *codegen, ASTNode
 
 // 辅助函数：在程序 AST 中查找结构体声明
 static ASTNode *find_struct_decl_in_program(C99CodeGenerator *codegen, const char *struct_name) {
-    if (!codegen->program_node || codegen->program_node->type != AST_PROGRAM) {
-        return NULL;
-    }
-    ASTNode **decls = codegen->program_node->data.program.decls;
-    int decl_count = codegen->program_node->data.program.decl_count;
-    for (int i = 0; i < decl_count; i++) {
-        ASTNode *decl = decls[i];
-        if (decl && decl->type == AST_STRUCT_DECL && decl->data.struct_decl.name &&
-            strcmp(decl->data.struct_decl.name, struct_name) == 0) {
-            return decl;
-        }
-    }
-    return NULL;
+    return ast_find_decl(codegen->program_node, DECL_KEY_STRUCT, struct_name);
 }
 
 // 辅助函数：先生成嵌套泛型依赖的结构体（递归处理）
@@ -725,7 +668,7 @@ static void ensure_nested_generic_struct_defined(C99CodeGenerator *codegen, ASTN
             gen_mono_struct_definition(codegen, nested_struct_decl,
                 resolved_type->data.type_named.type_args,
                 resolved_type->data.type_named.type_arg_count);
-            fputs("\n", codegen->output);
+            emitter_lit(codegen->output, "\n");
         }
     }
 }
@@ -439,12 +439,18 @@ const char *c99_type_to_c(C99CodeGenerator *codegen, ASTNode *type_node) {
         }
         
         case AST_TYPE_ERROR_UNION: {
-            /* 错误联合类型 !T -> struct { uint32_t error_id; T value; } */
+            /* 错误联合类型 !T -> struct { uint32_t error_id; T value; }
+             * 紧凑布局（--error-abi=compact）：error_id 为 uint16_t（errno 与命名错误都小于 65536），
+             * !&T 的 error_id 与引用共用一个机器字（错误为 [1, C99_ERROR_NICHE_LIMIT) 内的低地址），
+             * 只占一个寄存器；不超过 16 字节的 !T 仍按 x86-64 SysV 由寄存器对返回，更大的由调用者传入返回地址 */
             ASTNode *payload_node = type_node->data.type_error_union.payload_type;
             if (!payload_node) return "void";
             const char *payload_c = c99_type_to_c(codegen, payload_node);
             int is_void = (payload_node->type == AST_TYPE_NAMED && payload_node->data.type_named.name &&
                 strcmp(payload_node->data.type_named.name, "void") == 0);
+            int is_niche = codegen->compact_error_abi && payload_node->type == AST_TYPE_POINTER &&
+                !payload_node->data.type_pointer.is_ffi_pointer;
+            const char *tag_c = codegen->compact_error_abi ? "uint16_t" : "uint32_t";
             char struct_name_buf[128];
             if (is_void) {
                 snprintf(struct_name_buf, sizeof(struct_name_buf), "err_union_void");
@@ -456,17 +462,23 @@ const char *c99_type_to_c(C99CodeGenerator *codegen, ASTNode *type_node) {
                         safe[j++] = *p;
                 }
                 safe[j] = '\0';
-                snprintf(struct_name_buf, sizeof(struct_name_buf), "err_union_%s", safe[0] ? safe : "T");
+                snprintf(struct_name_buf, sizeof(struct_name_buf), "err_union_%s%s", is_niche ? "nz_" : "",
+                         safe[0] ? safe : "T");
             }
             const char *name_copy = (const char *)arena_strdup(codegen->arena, struct_name_buf);
             if (!name_copy) return "void";
             if (!is_struct_defined(codegen, name_copy)) {
                 add_struct_definition(codegen, name_copy);
-                fprintf(codegen->output, "struct %s { uint32_t error_id;", name_copy);
-                if (!is_void) {
-                    fprintf(codegen->output, " %s value;", payload_c);
+                if (is_niche) {
+                    emitter_printf(codegen->output, "struct %s { union { uintptr_t error_id; %s value; }; };\n",
+                                   name_copy, payload_c);
+                } else {
+                    emitter_printf(codegen->output, "struct %s { %s error_id;", name_copy, tag_c);
+                    if (!is_void) {
+                        emitter_printf(codegen->output, " %s value;", payload_c);
+                    }
+                    emitter_lit(codegen->output, " };\n");
                 }
-                fprintf(codegen->output, " };\n");
                 mark_struct_defined(codegen, name_copy);
             }
             size_t len = strlen(name_copy) + 9;
@@ -587,7 +599,7 @@ void emit_pending_slice_structs(C99CodeGenerator *codegen) {
         if (is_struct_defined(codegen, name)) continue;
         const char *elem_c = c99_type_to_c(codegen, elem);
         if (!elem_c) continue;
-        fprintf(codegen->output, "struct %s { %s *ptr; size_t len; };\n", name, elem_c);
+        emitter_printf(codegen->output, "struct %s { %s *ptr; size_t len; };\n", name, elem_c);
         mark_struct_defined(codegen, name);
     }
 }
@@ -622,6 +634,12 @@ int is_member_access_pointer_type(C99CodeGenerator *codegen, ASTNode *member_acc
         return 0;
     }
     
+    // 检查器已记录字段类型时直接使用（字段的 C 表示与声明类型一致）
+    if (member_access->resolved_type && member_access->resolved_type->kind != TYPE_VOID &&
+        !(codegen->current_type_params && codegen->current_type_param_count > 0)) {
+        return member_access->resolved_type->kind == TYPE_POINTER;
+    }
+    
     ASTNode *object = member_access->data.member_access.object;
     const char *field_name = member_access->data.member_access.field_name;
     
@@ -637,14 +655,14 @@ int is_member_access_pointer_type(C99CodeGenerator *codegen, ASTNode *member_acc
         // 查找变量类型
         const char *var_type_c = NULL;
         for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-            if (strcmp(codegen->local_variables[i].name, var_name) == 0) {
+            if (INTERN_STR_EQ(codegen->local_variables[i].name, var_name)) {
                 var_type_c = codegen->local_variables[i].type_c;
                 break;
             }
         }
         if (!var_type_c) {
             for (int i = 0; i < codegen->global_variable_count; i++) {
-                if (strcmp(codegen->global_variables[i].name, var_name) == 0) {
+                if (INTERN_STR_EQ(codegen->global_variables[i].name, var_name)) {
                     var_type_c = codegen->global_variables[i].type_c;
                     break;
                 }
@@ -710,14 +728,14 @@ int is_member_access_pointer_type(C99CodeGenerator *codegen, ASTNode *member_acc
             // 查找变量类型
             const char *var_type_c = NULL;
             for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-                if (strcmp(codegen->local_variables[i].name, var_name) == 0) {
+                if (INTERN_STR_EQ(codegen->local_variables[i].name, var_name)) {
                     var_type_c = codegen->local_variables[i].type_c;
                     break;
                 }
             }
             if (!var_type_c) {
                 for (int i = 0; i < codegen->global_variable_count; i++) {
-                    if (strcmp(codegen->global_variables[i].name, var_name) == 0) {
+                    if (INTERN_STR_EQ(codegen->global_variables[i].name, var_name)) {
                         var_type_c = codegen->global_variables[i].type_c;
                         break;
                     }
@@ -766,43 +784,40 @@ int is_member_access_pointer_type(C99CodeGenerator *codegen, ASTNode *member_acc
     
     return 0;
 }
-// 检查标识符是否为指针类型
-int is_identifier_pointer_type(C99CodeGenerator *codegen, const char *name) {
-    if (!name) return 0;
-    
-    // 检查局部变量（从后向前查找，支持变量遮蔽）
+
+// 在代码生成的变量表中查找变量的 C 类型（局部变量从后向前查找，支持变量遮蔽；再查全局变量）
+// 变量表中的名称可能是原始名称，也可能是 get_safe_c_identifier 转换后的名称，两者都查
+static const char *lookup_variable_type_c(C99CodeGenerator *codegen, const char *name) {
+    const char *safe_name = get_safe_c_identifier(codegen, name);
     for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-        if (codegen->local_variables[i].name && strcmp(codegen->local_variables[i].name, name) == 0) {
-            const char *type_c = codegen->local_variables[i].type_c;
-            if (!type_c) return 0;
-            
-            // 检查类型是否包含'*'（即是指针）
-            // 注意：'*' 可能在类型名称之后（如 "struct Type *"）或之前（如 "*Type"）
-            const char *asterisk = strchr(type_c, '*');
-            if (asterisk) {
-                // 找到 '*'，确认它是指针类型的一部分
-                // 简单检查：'*' 前后可能有空格，但应该是指针类型
-                return 1;
-            }
-            return 0;
+        const char *var_name = codegen->local_variables[i].name;
+        if (var_name && (INTERN_STR_EQ(var_name, name) || INTERN_STR_EQ(var_name, safe_name))) {
+            return codegen->local_variables[i].type_c;
         }
     }
-    
-    // 检查全局变量
     for (int i = 0; i < codegen->global_variable_count; i++) {
-        if (codegen->global_variables[i].name && strcmp(codegen->global_variables[i].name, name) == 0) {
-            const char *type_c = codegen->global_variables[i].type_c;
-            if (!type_c) return 0;
-            // 检查类型是否包含'*'（即是指针）
-            const char *asterisk = strchr(type_c, '*');
-            if (asterisk) {
-                return 1;
-            }
-            return 0;
+        const char *var_name = codegen->global_variables[i].name;
+        if (var_name && (INTERN_STR_EQ(var_name, name) || INTERN_STR_EQ(var_name, safe_name))) {
+            return codegen->global_variables[i].type_c;
         }
     }
+    return NULL;
+}
+
+// 检查标识符是否为指针类型
+// 检查器记录了变量类型且能得到 C 表示时直接按类型种类判断；
+// 否则（切片参数按指针传递、原子类型、数组等）查代码生成的变量表
+int is_identifier_pointer_type(C99CodeGenerator *codegen, ASTNode *ident) {
+    if (!ident || ident->type != AST_IDENTIFIER || !ident->data.identifier.name) return 0;
+    
+    if (get_resolved_c_type_of_expr(codegen, ident)) {
+        return ident->resolved_type->kind == TYPE_POINTER;
+    }
     
-    return 0;
+    // 检查类型是否包含'*'（即是指针）
+    // 注意：'*' 可能在类型名称之后（如 "struct Type *"）或之前（如 "*Type"）
+    const char *type_c = lookup_variable_type_c(codegen, ident->data.identifier.name);
+    return type_c && strchr(type_c, '*') != NULL;
 }
 
 // 检查标识符是否是指向数组的指针类型（格式：T (*)[N] 或 T (* const var)[N]）
@@ -813,7 +828,7 @@ int is_identifier_pointer_to_array_type(C99CodeGenerator *codegen, const char *n
     
     // 检查局部变量
     for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-        if (strcmp(codegen->local_variables[i].name, name) == 0) {
+        if (INTERN_STR_EQ(codegen->local_variables[i].name, name)) {
             type_c = codegen->local_variables[i].type_c;
             break;
         }
@@ -822,7 +837,7 @@ int is_identifier_pointer_to_array_type(C99CodeGenerator *codegen, const char *n
     // 如果局部变量中没找到，检查全局变量
     if (!type_c) {
         for (int i = 0; i < codegen->global_variable_count; i++) {
-            if (strcmp(codegen->global_variables[i].name, name) == 0) {
+            if (INTERN_STR_EQ(codegen->global_variables[i].name, name)) {
                 type_c = codegen->global_variables[i].type_c;
                 break;
             }
@@ -861,14 +876,14 @@ int is_array_access_pointer_type(C99CodeGenerator *codegen, ASTNode *array_acces
         // 查找变量类型
         const char *array_type_c = NULL;
         for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-            if (codegen->local_variables[i].name && strcmp(codegen->local_variables[i].name, array_name) == 0) {
+            if (codegen->local_variables[i].name && INTERN_STR_EQ(codegen->local_variables[i].name, array_name)) {
                 array_type_c = codegen->local_variables[i].type_c;
                 break;
             }
         }
         if (!array_type_c) {
             for (int i = 0; i < codegen->global_variable_count; i++) {
-                if (codegen->global_variables[i].name && strcmp(codegen->global_variables[i].name, array_name) == 0) {
+                if (codegen->global_variables[i].name && INTERN_STR_EQ(codegen->global_variables[i].name, array_name)) {
                     array_type_c = codegen->global_variables[i].type_c;
                     break;
                 }
@@ -917,14 +932,14 @@ int is_array_access_pointer_type(C99CodeGenerator *codegen, ASTNode *array_acces
             
             // 查找变量类型
             for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-                if (codegen->local_variables[i].name && strcmp(codegen->local_variables[i].name, var_name) == 0) {
+                if (codegen->local_variables[i].name && INTERN_STR_EQ(codegen->local_variables[i].name, var_name)) {
                     var_type_c = codegen->local_variables[i].type_c;
                     break;
                 }
             }
             if (!var_type_c) {
                 for (int i = 0; i < codegen->global_variable_count; i++) {
-                    if (codegen->global_variables[i].name && strcmp(codegen->global_variables[i].name, var_name) == 0) {
+                    if (codegen->global_variables[i].name && INTERN_STR_EQ(codegen->global_variables[i].name, var_name)) {
                         var_type_c = codegen->global_variables[i].type_c;
                         break;
                     }
@@ -999,7 +1014,7 @@ int is_identifier_struct_type(C99CodeGenerator *codegen, const char *name) {
     
     // 检查局部变量
     for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-        if (strcmp(codegen->local_variables[i].name, name) == 0) {
+        if (INTERN_STR_EQ(codegen->local_variables[i].name, name)) {
             const char *type_c = codegen->local_variables[i].type_c;
             if (!type_c) return 0;
             // 检查类型是否包含"struct "且不包含'*'（即不是指针）
@@ -1010,7 +1025,7 @@ int is_identifier_struct_type(C99CodeGenerator *codegen, const char *name) {
     
     // 检查全局变量
     for (int i = 0; i < codegen->global_variable_count; i++) {
-        if (strcmp(codegen->global_variables[i].name, name) == 0) {
+        if (INTERN_STR_EQ(codegen->global_variables[i].name, name)) {
             const char *type_c = codegen->global_variables[i].type_c;
             if (!type_c) return 0;
             // 检查类型是否包含"struct "且不包含'*'（即不是指针）
@@ -1023,19 +1038,12 @@ int is_identifier_struct_type(C99CodeGenerator *codegen, const char *name) {
 }
 
 // 获取标识符（变量）的 C 类型字符串，用于按字段比较时查找结构体
-const char *get_identifier_type_c(C99CodeGenerator *codegen, const char *name) {
-    if (!name) return NULL;
-    for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-        if (strcmp(codegen->local_variables[i].name, name) == 0) {
-            return codegen->local_variables[i].type_c;
-        }
-    }
-    for (int i = 0; i < codegen->global_variable_count; i++) {
-        if (strcmp(codegen->global_variables[i].name, name) == 0) {
-            return codegen->global_variables[i].type_c;
-        }
-    }
-    return NULL;
+// 优先使用检查器记录的类型，得不到 C 表示时查代码生成的变量表
+const char *get_identifier_type_c(C99CodeGenerator *codegen, ASTNode *ident) {
+    if (!ident || ident->type != AST_IDENTIFIER || !ident->data.identifier.name) return NULL;
+    const char *resolved = get_resolved_c_type_of_expr(codegen, ident);
+    if (resolved) return resolved;
+    return lookup_variable_type_c(codegen, ident->data.identifier.name);
 }
 
 /* 从切片表达式推断切片结构体 C 类型（struct uya_slice_X） */
@@ -1046,7 +1054,7 @@ static const char *get_slice_struct_type_c(C99CodeGenerator *codegen, ASTNode *s
         return get_slice_struct_type_c(codegen, base);
     }
     if (base->type == AST_IDENTIFIER) {
-        const char *type_c = get_identifier_type_c(codegen, base->data.identifier.name);
+        const char *type_c = get_identifier_type_c(codegen, base);
         if (type_c && strstr(type_c, "uya_slice_")) {
             return type_c;
         }
@@ -1068,9 +1076,87 @@ static const char *get_slice_struct_type_c(C99CodeGenerator *codegen, ASTNode *s
     return "struct uya_slice_int32_t";
 }
 
+/* 将检查器类型转换为等价的类型节点（从代码生成 Arena 分配），交给 c99_type_to_c 统一生成 C 类型。
+   只处理不依赖单态化的类型（基础类型、非泛型的结构体/枚举/联合体/接口、它们的指针与错误联合），
+   其余返回 NULL */
+static ASTNode *checker_type_to_type_node(C99CodeGenerator *codegen, const Type *type) {
+    if (!type) return NULL;
+    const char *name = NULL;
+    switch (type->kind) {
+        case TYPE_I8: name = "i8"; break;
+        case TYPE_I16: name = "i16"; break;
+        case TYPE_I32: name = "i32"; break;
+        case TYPE_I64: name = "i64"; break;
+        case TYPE_U8: name = "u8"; break;
+        case TYPE_U16: name = "u16"; break;
+        case TYPE_U32: name = "u32"; break;
+        case TYPE_USIZE: name = "usize"; break;
+        case TYPE_U64: name = "u64"; break;
+        case TYPE_BOOL: name = "bool"; break;
+        case TYPE_BYTE: name = "byte"; break;
+        case TYPE_F32: name = "f32"; break;
+        case TYPE_F64: name = "f64"; break;
+        case TYPE_ENUM: name = type->data.enum_name; break;
+        case TYPE_UNION: name = type->data.union_name; break;
+        case TYPE_INTERFACE: name = type->data.interface_name; break;
+        case TYPE_STRUCT:
+            if (type->data.struct_type.type_arg_count > 0) return NULL;
+            name = type->data.struct_type.name;
+            break;
+        case TYPE_POINTER: {
+            ASTNode *pointed = checker_type_to_type_node(codegen, type->data.pointer.pointer_to);
+            if (!pointed) return NULL;
+            ASTNode *node = arena_alloc(codegen->arena, sizeof(ASTNode));
+            memset(node, 0, sizeof(ASTNode));
+            node->type = AST_TYPE_POINTER;
+            node->data.type_pointer.pointed_type = pointed;
+            node->data.type_pointer.is_ffi_pointer = type->data.pointer.is_ffi_pointer;
+            return node;
+        }
+        case TYPE_ERROR_UNION: {
+            ASTNode *payload = checker_type_to_type_node(codegen, type->data.error_union.payload_type);
+            if (!payload) return NULL;
+            ASTNode *node = arena_alloc(codegen->arena, sizeof(ASTNode));
+            memset(node, 0, sizeof(ASTNode));
+            node->type = AST_TYPE_ERROR_UNION;
+            node->data.type_error_union.payload_type = payload;
+            return node;
+        }
+        default:
+            return NULL;
+    }
+    if (!name) return NULL;
+    ASTNode *node = arena_alloc(codegen->arena, sizeof(ASTNode));
+    memset(node, 0, sizeof(ASTNode));
+    node->type = AST_TYPE_NAMED;
+    node->data.type_named.name = name;
+    return node;
+}
+
+/* 检查器记录在表达式上的类型对应的 C 类型；没有记录或类型依赖单态化时返回 NULL。
+   单态化函数体内同一节点对应多个实例，检查器记录的类型不可靠，此时不使用。
+   resolved_type 是规范类型（同一类型的所有表达式共享），C 类型拼写缓存在规范类型上，只计算一次。
+   缓存只由主生成器写入（字符串在主 Arena 中，并行生成期间主生成器不运行），工作线程只读；
+   错误联合等类型首次生成拼写时会输出结构体定义，缓存命中说明定义已输出，跳过 c99_type_to_c 不影响输出 */
+const char *get_resolved_c_type_of_expr(C99CodeGenerator *codegen, ASTNode *expr) {
+    if (!codegen || !expr || !expr->resolved_type) return NULL;
+    if (codegen->current_type_params && codegen->current_type_param_count > 0) return NULL;
+    Type *type = expr->resolved_type;
+    if (type->c_spelling) return type->c_spelling;
+    ASTNode *type_node = checker_type_to_type_node(codegen, type);
+    if (!type_node) return NULL;
+    const char *c_type = c99_type_to_c(codegen, type_node);
+    if (!codegen->is_unit_worker) {
+        type->c_spelling = c_type;
+    }
+    return c_type;
+}
+
 /* 从表达式推断 C 类型字符串（用于元组字面量复合字面量），尽力而为 */
 const char *get_c_type_of_expr(C99CodeGenerator *codegen, ASTNode *expr) {
     if (!codegen || !expr) return "int32_t";
+    const char *resolved = get_resolved_c_type_of_expr(codegen, expr);
+    if (resolved) return resolved;
     switch (expr->type) {
         case AST_UNARY_EXPR: {
             int op = expr->data.unary_expr.op;
@@ -1098,7 +1184,7 @@ const char *get_c_type_of_expr(C99CodeGenerator *codegen, ASTNode *expr) {
         case AST_BOOL:
             return "bool";
         case AST_IDENTIFIER: {
-            const char *t = get_identifier_type_c(codegen, expr->data.identifier.name);
+            const char *t = get_identifier_type_c(codegen, expr);
             return t ? t : "int32_t";
         }
         case AST_SLICE_EXPR:
@@ -1109,7 +1195,7 @@ const char *get_c_type_of_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             if (!object || !field_name) return "int32_t";
             const char *base_type_c = NULL;
             if (object->type == AST_IDENTIFIER) {
-                base_type_c = get_identifier_type_c(codegen, object->data.identifier.name);
+                base_type_c = get_identifier_type_c(codegen, object);
             } else if (object->type == AST_MEMBER_ACCESS) {
                 base_type_c = get_c_type_of_expr(codegen, object);
             } else if (object->type == AST_ARRAY_ACCESS) {
@@ -1163,6 +1249,9 @@ const char *get_c_type_of_expr(C99CodeGenerator *codegen, ASTNode *expr) {
         }
         case AST_ARRAY_ACCESS:
             return "int32_t";
+        case AST_SYSCALL:
+            // @syscall 返回 !i64
+            return "struct err_union_int64_t";
         case AST_CALL_EXPR: {
             // 方法调用：callee 为 obj.method，需要推断方法返回类型
             ASTNode *callee = expr->data.call_expr.callee;
@@ -1170,7 +1259,15 @@ const char *get_c_type_of_expr(C99CodeGenerator *codegen, ASTNode *expr) {
                 // 递归调用 AST_MEMBER_ACCESS 的处理逻辑来获取方法返回类型
                 return get_c_type_of_expr(codegen, callee);
             }
-            // 普通函数调用：无法推断返回类型，返回默认类型
+            // 普通函数调用：非泛型函数返回错误联合类型时使用其返回类型（try/catch 需要操作数的 !T 类型）
+            if (callee && callee->type == AST_IDENTIFIER) {
+                ASTNode *fn_decl = find_function_decl_c99(codegen, callee->data.identifier.name);
+                if (fn_decl && fn_decl->data.fn_decl.type_param_count == 0 && fn_decl->data.fn_decl.return_type &&
+                    fn_decl->data.fn_decl.return_type->type == AST_TYPE_ERROR_UNION) {
+                    return c99_type_to_c(codegen, fn_decl->data.fn_decl.return_type);
+                }
+            }
+            // 其他函数调用：无法推断返回类型，返回默认类型
             return "int32_t";
         }
         default:
@@ -1276,7 +1373,7 @@ void gen_array_wrapper_struct(C99CodeGenerator *codegen, ASTNode *array_type, co
     }
     
     // 生成结构体定义
-    fprintf(codegen->output, "struct %s {\n", struct_name);
+    emitter_printf(codegen->output, "struct %s {\n", struct_name);
     
     // 生成数组字段：需要将数组类型转换为正确的格式
     // 例如：[i32: 3] -> int32_t data[3]
@@ -1294,9 +1391,9 @@ void gen_array_wrapper_struct(C99CodeGenerator *codegen, ASTNode *array_type, co
         array_size = 1;
     }
     
-    fprintf(codegen->output, "    %s data[%d];\n", elem_type_c, array_size);
+    emitter_printf(codegen->output, "    %s data[%d];\n", elem_type_c, array_size);
     
-    fprintf(codegen->output, "};\n");
+    emitter_lit(codegen->output, "};\n");
     
     // 标记为已定义
     for (int i = 0; i < codegen->struct_definition_count; i++) {
@@ -1345,7 +1442,7 @@ const char *get_array_element_type(C99CodeGenerator *codegen, ASTNode *array_exp
         
         // 检查局部变量
         for (int i = codegen->local_variable_count - 1; i >= 0; i--) {
-            if (strcmp(codegen->local_variables[i].name, var_name) == 0) {
+            if (INTERN_STR_EQ(codegen->local_variables[i].name, var_name)) {
                 const char *type_c = codegen->local_variables[i].type_c;
                 if (!type_c) return NULL;
                 
@@ -1381,7 +1478,7 @@ const char *get_array_element_type(C99CodeGenerator *codegen, ASTNode *array_exp
         
         // 检查全局变量
         for (int i = 0; i < codegen->global_variable_count; i++) {
-            if (strcmp(codegen->global_variables[i].name, var_name) == 0) {
+            if (INTERN_STR_EQ(codegen->global_variables[i].name, var_name)) {
                 const char *type_c = codegen->global_variables[i].type_c;
                 if (!type_c) return NULL;
                 
@@ -1429,7 +1526,7 @@ const char *get_array_element_type(C99CodeGenerator *codegen, ASTNode *array_exp
             return get_array_element_type(codegen, base);
         }
         if (base->type == AST_IDENTIFIER) {
-            const char *type_c = get_identifier_type_c(codegen, base->data.identifier.name);
+            const char *type_c = get_identifier_type_c(codegen, base);
             if (type_c) {
                 const char *p = strstr(type_c, "uya_slice_");
                 if (p) {
@@ -6,7 +6,7 @@
 #include <stdlib.h>
 
 // 创建 C99 代码生成器
-int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, FILE *output, const char *module_name, int emit_line_directives) {
+int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, Emitter *output, const char *module_name, int emit_line_directives) {
     if (!codegen || !arena || !output || !module_name) {
         return -1;
     }
@@ -34,6 +34,8 @@ int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, FILE *output, const
     codegen->current_line = 0;  // 当前行号（用于优化 #line 指令）
     codegen->current_filename = NULL;  // 当前文件名（用于优化 #line 指令）
     codegen->emit_line_directives = emit_line_directives;  // 是否生成 #line 指令
+    codegen->first_line_directive = 0;
+    codegen->first_line_filename = NULL;
     codegen->string_interp_buf = NULL;
     codegen->interp_temp_counter = 0;
     codegen->interp_fill_counter = 0;
@@ -41,7 +43,7 @@ int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, FILE *output, const
     codegen->defer_stack_depth = 0;
     codegen->current_drop_scope = -1;
     codegen->slice_struct_count = 0;
-    codegen->mono_instance_count = 0;
+    codegen->mono_table = NULL;
     for (int i = 0; i < C99_MAX_CALL_ARGS; i++) {
         codegen->interp_arg_temp_names[i] = NULL;
     }
@@ -50,7 +52,6 @@ int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, FILE *output, const
     }
     
     // 初始化泛型单态化相关字段
-    codegen->mono_instance_count = 0;
     codegen->current_type_params = NULL;
     codegen->current_type_param_count = 0;
     codegen->current_type_args = NULL;
@@ -61,6 +62,21 @@ int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, FILE *output, const
     // 初始化 has_stdio_conflicts 标志
     codegen->has_stdio_conflicts = 0;
     
+    codegen->jobs = 1;
+    codegen->is_unit_worker = 0;
+    codegen->split_count = 1;
+    codegen->split_outputs = NULL;
+    codegen->compact_error_abi = 0;
+    codegen->devirt_params = NULL;
+    codegen->devirt_param_count = 0;
+    codegen->safety_checks = 0;
+    codegen->safety_report = 0;
+    codegen->safety_check_sites = NULL;
+    codegen->safety_check_count = 0;
+    codegen->safety_hoists = NULL;
+    codegen->safety_hoist_count = 0;
+    codegen->time_report = NULL;
+    
     return 0;
 }
 
@@ -70,16 +86,7 @@ int c99_codegen_set_mono_instances(C99CodeGenerator *codegen, TypeChecker *check
         return -1;
     }
     
-    codegen->mono_instance_count = 0;
-    
-    for (int i = 0; i < checker->mono_instance_count && i < C99_MAX_MONO_INSTANCES; i++) {
-        codegen->mono_instances[i].generic_name = checker->mono_instances[i].generic_name;
-        codegen->mono_instances[i].is_function = checker->mono_instances[i].is_function;
-        codegen->mono_instances[i].type_arg_count = checker->mono_instances[i].type_arg_count;
-        codegen->mono_instances[i].type_args = checker->mono_instances[i].type_arg_nodes;
-        
-        codegen->mono_instance_count++;
-    }
+    codegen->mono_table = &checker->mono_table;
     
     return 0;
 }
@@ -101,6 +108,12 @@ void emit_line_directive(C99CodeGenerator *codegen, int line, const char *filena
     // 如果行号无效（<=0），跳过
     if (line <= 0) return;
     
+    // 记录第一次请求的指令（并行生成时据此判断单元输出是否依赖之前的行号状态）
+    if (codegen->first_line_directive == 0) {
+        codegen->first_line_directive = line;
+        codegen->first_line_filename = filename;
+    }
+    
     // 如果行号和文件名都没有变化，跳过
     if (codegen->current_line == line && 
         codegen->current_filename == filename) {
@@ -113,31 +126,31 @@ void emit_line_directive(C99CodeGenerator *codegen, int line, const char *filena
     
     if (filename && filename[0] != '\0') {
         // 转义文件名中的特殊字符（如引号、反斜杠）
-        fprintf(codegen->output, "#line %d \"", line);
+        emitter_printf(codegen->output, "#line %d \"", line);
         const char *p = filename;
         while (*p) {
             if (*p == '\\' || *p == '"') {
-                fputc('\\', codegen->output);
+                emitter_putc(codegen->output, '\\');
             }
-            fputc(*p, codegen->output);
+            emitter_putc(codegen->output, *p);
             p++;
         }
-        fprintf(codegen->output, "\"\n");
+        emitter_lit(codegen->output, "\"\n");
     } else {
-        fprintf(codegen->output, "#line %d\n", line);
+        emitter_printf(codegen->output, "#line %d\n", line);
     }
 }
 
 // 缩进输出
 void c99_emit_indent(C99CodeGenerator *codegen) {
     for (int i = 0; i < codegen->indent_level; i++) {
-        fputs("    ", codegen->output);
+        emitter_lit(codegen->output, "    ");
     }
 }
 
 // 换行
 void c99_emit_newline(C99CodeGenerator *codegen) {
-    fputc('\n', codegen->output);
+    emitter_putc(codegen->output, '\n');
 }
 
 // 格式化输出（带缩进和换行处理）
@@ -148,8 +161,12 @@ void c99_emit(C99CodeGenerator *codegen, const char *format, ...) {
     // 输出缩进
     c99_emit_indent(codegen);
     
-    // 输出格式化内容
-    vfprintf(codegen->output, format, args);
+    // 输出内容：不含格式说明符时直接追加，不经过格式解析
+    if (strchr(format, '%') == NULL) {
+        emitter_puts(codegen->output, format);
+    } else {
+        emitter_vprintf(codegen->output, format, args);
+    }
     
     va_end(args);
 }
@@ -164,31 +181,68 @@ const char *arena_strdup(Arena *arena, const char *src) {
     return dst;
 }
 
-static uint32_t hash_error_name(const char *name) {
-    uint32_t h = 5381;
-    unsigned char c;
-    while ((c = (unsigned char)*name++) != 0) {
-        h = ((h << 5) + h) + c;
-    }
-    return (h == 0) ? 1 : h;
-}
-
-// 获取或注册错误名称，返回 hash(error_name) 作为 error_id，0 表示失败
+// 获取或注册错误名称，返回 C99_ERROR_ID_BASE + 下标作为 error_id，0 表示失败
+// 整个程序的错误名称由 c99_codegen_set_error_ids 预先编号，这里只会追加类型检查未见过的名称
 unsigned get_or_add_error_id(C99CodeGenerator *codegen, const char *name) {
     if (!codegen || !name) return 0;
-    uint32_t h = hash_error_name(name);
     for (int i = 0; i < codegen->error_count; i++) {
         if (codegen->error_names[i] && strcmp(codegen->error_names[i], name) == 0) {
-            return codegen->error_hashes[i];
+            return C99_ERROR_ID_BASE + (unsigned)i;
         }
     }
     if (codegen->error_count >= 128) return 0;
     const char *copy = arena_strdup(codegen->arena, name);
     if (!copy) return 0;
     codegen->error_names[codegen->error_count] = copy;
-    codegen->error_hashes[codegen->error_count] = h;
     codegen->error_count++;
-    return h;
+    return C99_ERROR_ID_BASE + (unsigned)(codegen->error_count - 1);
+}
+
+int c99_codegen_set_error_ids(C99CodeGenerator *codegen, TypeChecker *checker) {
+    if (!codegen || !checker) {
+        return -1;
+    }
+    // 按名称排序（插入排序，错误名称不超过 128 个），编号与检查顺序、模块顺序无关
+    codegen->error_count = 0;
+    for (int i = 0; i < checker->error_name_count; i++) {
+        const char *name = checker->error_names[i];
+        if (!name) continue;
+        int j = codegen->error_count;
+        while (j > 0 && strcmp(codegen->error_names[j - 1], name) > 0) {
+            codegen->error_names[j] = codegen->error_names[j - 1];
+            j--;
+        }
+        codegen->error_names[j] = name;
+        codegen->error_count++;
+    }
+    return 0;
+}
+
+// 输出错误码表（error_id - C99_ERROR_ID_BASE 为下标），用于调试与按 error_id 取错误名称
+void emit_error_name_table(C99CodeGenerator *codegen) {
+    if (codegen->error_count == 0) return;
+    emitter_printf(codegen->output, "/* 错误码表：error.<name> 的 error_id = %d + 下标（小于 %d 的 error_id 为 errno） */\n",
+                   C99_ERROR_ID_BASE, C99_ERROR_ID_BASE);
+    emitter_printf(codegen->output, "static const char *const uya_error_names[%d] __attribute__((unused)) = {\n",
+                   codegen->error_count);
+    for (int i = 0; i < codegen->error_count; i++) {
+        emitter_printf(codegen->output, "    \"%s\",  /* %d */\n", codegen->error_names[i], C99_ERROR_ID_BASE + i);
+    }
+    emitter_lit(codegen->output, "};\n\n");
+}
+
+// 判断错误联合类型是否为 !&T 的紧凑布局（error_id 与引用共用一个机器字，见 types.c）
+int c99_error_union_is_niche(const char *union_c) {
+    return union_c && strncmp(union_c, "struct err_union_nz_", 20) == 0;
+}
+
+// 输出判断错误联合变量 var 为错误的条件（紧凑布局的 !&T 中只有低地址表示错误）
+void c99_emit_error_test(C99CodeGenerator *codegen, const char *union_c, const char *var) {
+    if (c99_error_union_is_niche(union_c)) {
+        emitter_printf(codegen->output, "%s.error_id - 1 < %uU", var, (unsigned)(C99_ERROR_NICHE_LIMIT - 1));
+    } else {
+        emitter_printf(codegen->output, "%s.error_id != 0", var);
+    }
 }
 
 // C99 关键字列表
@@ -286,28 +340,28 @@ const char *find_string_constant(C99CodeGenerator *codegen, const char *value) {
 }
 
 // 转义字符串中的特殊字符
-void escape_string_for_c(FILE *output, const char *str) {
+void escape_string_for_c(Emitter *output, const char *str) {
     if (!str) return;
     
     for (const char *p = str; *p != '\0'; p++) {
         switch (*p) {
             case '\n':
-                fputs("\\n", output);
+                emitter_lit(output, "\\n");
                 break;
             case '\t':
-                fputs("\\t", output);
+                emitter_lit(output, "\\t");
                 break;
             case '\r':
-                fputs("\\r", output);
+                emitter_lit(output, "\\r");
                 break;
             case '\\':
-                fputs("\\\\", output);
+                emitter_lit(output, "\\\\");
                 break;
             case '"':
-                fputs("\\\"", output);
+                emitter_lit(output, "\\\"");
                 break;
             default:
-                fputc(*p, output);
+                emitter_putc(output, *p);
                 break;
         }
     }
@@ -319,11 +373,11 @@ void emit_string_constants(C99CodeGenerator *codegen) {
         return;
     }
     
-    fputs("\n// 字符串常量\n", codegen->output);
+    emitter_lit(codegen->output, "\n// 字符串常量\n");
     for (int i = 0; i < codegen->string_constant_count; i++) {
-        fprintf(codegen->output, "static const uint8_t %s[] = \"", codegen->string_constants[i].name);
+        emitter_printf(codegen->output, "static const uint8_t %s[] = \"", codegen->string_constants[i].name);
         escape_string_for_c(codegen->output, codegen->string_constants[i].value);
-        fputs("\";\n", codegen->output);
+        emitter_lit(codegen->output, "\";\n");
     }
 }
 
@@ -345,23 +399,13 @@ int eval_const_expr(C99CodeGenerator *codegen, ASTNode *expr) {
             ASTNode *program = codegen->program_node;
             if (program->type != AST_PROGRAM) return -1;
             
-            for (int i = 0; i < program->data.program.decl_count; i++) {
-                ASTNode *decl = program->data.program.decls[i];
-                if (decl != NULL && decl->type == AST_VAR_DECL) {
-                    const char *var_name = decl->data.var_decl.name;
-                    if (var_name != NULL && strcmp(var_name, const_name) == 0) {
-                        // 找到常量变量，检查是否为 const
-                        if (decl->data.var_decl.is_const) {
-                            // 递归评估初始值表达式
-                            // 注意：这里不检查循环引用，因为常量应该是编译时确定的简单表达式
-                            ASTNode *init_expr = decl->data.var_decl.init;
-                            if (init_expr != NULL) {
-                                // 如果初始值也是标识符，递归查找（支持常量链）
-                                return eval_const_expr(codegen, init_expr);
-                            }
-                        }
-                        break;
-                    }
+            ASTNode *decl = ast_find_decl(program, DECL_KEY_VAR, const_name);
+            if (decl != NULL && decl->data.var_decl.is_const) {
+                // 递归评估初始值表达式（支持常量链）
+                // 注意：这里不检查循环引用，因为常量应该是编译时确定的简单表达式
+                ASTNode *init_expr = decl->data.var_decl.init;
+                if (init_expr != NULL) {
+                    return eval_const_expr(codegen, init_expr);
                 }
             }
             // 未找到常量变量或不是 const
@@ -459,9 +503,9 @@ void emit_printf_fmt_inline(C99CodeGenerator *codegen, ASTNode *interp) {
         }
     }
     buf[off] = '\0';
-    fputc('"', codegen->output);
+    emitter_putc(codegen->output, '"');
     escape_string_for_c(codegen->output, buf);
-    fputc('"', codegen->output);
+    emitter_putc(codegen->output, '"');
 }
 
 // 收集表达式中的字符串常量（不生成代码）
@@ -4,6 +4,8 @@
 #include "ast.h"
 #include "arena.h"
 #include "checker.h"
+#include "emitter.h"
+#include "time_report.h"
 #include <stdint.h>
 #include <stdio.h>
 
@@ -20,12 +22,46 @@
 #define C99_MAX_DEFERS_PER_BLOCK    64
 #define C99_MAX_DROP_VARS_PER_BLOCK 64
 #define C99_MAX_SLICE_STRUCTS       32
-#define C99_MAX_MONO_INSTANCES      512
+#define C99_MAX_SPLIT_OUTPUTS       256  // 拆分输出的最大 .c 文件数量
+
+// 命名错误的 error_id 从此值开始连续编号：@syscall 失败时 error_id 为 errno（Linux 上不超过 4095），
+// 两者不会相同；连续的编号使错误分派（catch 比较、match 错误模式）可以生成跳转表
+#define C99_ERROR_ID_BASE           4096
+
+// 紧凑错误联合布局（--error-abi=compact）中 !&T 的错误编码上界：
+// 错误以 [1, C99_ERROR_NICHE_LIMIT) 内的低地址表示（Linux 默认 vm.mmap_min_addr，该范围不会映射），
+// 0 与其余值都是成功的引用
+#define C99_ERROR_NICHE_LIMIT       65536
+
+// 去虚化的接口形参：函数所有调用处传入的都是同一个具体结构体（见 devirt.c）
+typedef struct C99DevirtParam {
+    ASTNode *fn_decl;               // 所属函数
+    const char *param_name;         // 形参名
+    const char *struct_name;        // 具体结构体名
+} C99DevirtParam;
+
+// 需要运行时检查的下标访问或整数运算（见 range.c，按节点地址排序）
+typedef struct C99SafetyCheck {
+    ASTNode *node;                  // AST_ARRAY_ACCESS 或 AST_BINARY_EXPR（+ - * / %）
+    long long len;                  // 下标访问的数组长度，-1 表示运行时切片长度
+    int zero_divisor;               // 除法/取模：除数可能为零
+    ASTNode *overflow_type;         // 可能溢出时为运算的整数类型，否则为 NULL
+} C99SafetyCheck;
+
+// 外提到循环前的下标范围检查：循环中访问 len 长度的 site 数组，下标为归纳变量 + [lo_off, hi_off]
+typedef struct C99SafetyHoist {
+    ASTNode *loop;                  // AST_WHILE_STMT 或 AST_FOR_STMT（按地址排序）
+    ASTNode *site;                  // 代表性的下标访问（提供数组表达式与源位置）
+    long long len;                  // 数组长度，-1 表示运行时切片长度
+    long long lo_off;
+    long long hi_off;
+    int is_unsigned;                // 归纳变量或循环边界是无符号类型（按 uint64_t 比较）
+} C99SafetyHoist;
 
 // C99 代码生成器结构体
 typedef struct C99CodeGenerator {
     Arena *arena;                   // Arena 分配器
-    FILE *output;                   // 输出文件指针
+    Emitter *output;                // 输出缓冲区（生成结束后由调用者一次性写出）
     int indent_level;               // 当前缩进级别
     const char *module_name;        // 模块名称
     
@@ -91,6 +127,8 @@ typedef struct C99CodeGenerator {
     int current_line;               // 当前行号（用于避免重复的 #line 指令）
     const char *current_filename;  // 当前文件名（用于避免重复的 #line 指令）
     int emit_line_directives;      // 是否生成 #line 指令（1 表示是，0 表示否）
+    int first_line_directive;       // 生成单元中第一次请求的 #line 行号（0 表示尚未请求，见 parallel.c）
+    const char *first_line_filename;  // 生成单元中第一次请求的 #line 文件名
     
     // 字符串插值：当前作为表达式输出时的缓冲区名（由赋值/实参等设置后 gen_expr 输出此名）
     const char *string_interp_buf;
@@ -99,9 +137,8 @@ typedef struct C99CodeGenerator {
     int interp_temp_counter;
     int interp_fill_counter;  // 每次 c99_emit_string_interp_fill 递增，用于唯一 _off 变量名
     
-    // 错误集：error_id = hash(error_name)，用于生成 return error.X
+    // 错误集：error_id = C99_ERROR_ID_BASE + 下标（整个程序的错误名称按名称排序后连续编号）
     const char *error_names[128];
-    uint32_t error_hashes[128];
     int error_count;
     
     // defer/errdefer 栈：每层块收集的 defer/errdefer 节点，退出时 LIFO 执行
@@ -121,14 +158,8 @@ typedef struct C99CodeGenerator {
     ASTNode *slice_struct_element_types[C99_MAX_SLICE_STRUCTS];
     int slice_struct_count;
     
-    // 泛型单态化实例（从 TypeChecker 传入）
-    struct MonoInstance {
-        const char *generic_name;   // 泛型函数/结构体名称
-        ASTNode **type_args;        // 类型实参 AST 节点数组
-        int type_arg_count;         // 类型实参数量
-        int is_function;            // 1 表示函数，0 表示结构体
-    } mono_instances[C99_MAX_MONO_INSTANCES];
-    int mono_instance_count;
+    // 泛型单态化实例表（从 TypeChecker 传入，只读；按泛型声明分组查找）
+    const MonoTable *mono_table;
     
     // 当前单态化上下文（生成泛型函数实例时使用）
     TypeParam *current_type_params;    // 当前泛型的类型参数列表
@@ -140,16 +171,46 @@ typedef struct C99CodeGenerator {
     int needs_string_h;                 // 1 表示需要 #include <string.h>
     // 跟踪是否定义了与标准库冲突的函数（fopen, fclose, fread, fgetc, fprintf）
     int has_stdio_conflicts;             // 1 表示定义了与 stdio.h 冲突的函数
+    
+    // 函数定义并行生成的线程数（-jN，<= 1 时串行生成）
+    int jobs;
+    // 1 表示并行生成的工作线程副本：只读取规范类型上缓存的 C 类型，不写入（见 get_resolved_c_type_of_expr）
+    int is_unit_worker;
+    
+    // 拆分输出（--split N）：output 写共享头文件（类型、原型、vtable、字符串常量、全局变量 extern 声明），
+    // 函数与全局变量定义按大小分配到 split_count 个 .c 文件（split_count <= 1 时输出单个文件）
+    int split_count;
+    Emitter *split_outputs;             // 各 .c 文件的内容（由 c99_codegen_generate 分配，第 0 个对应输出文件本身）
+    
+    // 紧凑错误联合布局（--error-abi=compact，整个程序统一，见 types.c）：
+    // !T 的 error_id 为 uint16_t，!&T 与引用共用一个机器字（错误为低地址），默认为 0（uint32_t error_id + value）
+    int compact_error_abi;
+    
+    // 去虚化的接口形参（函数生成前由 c99_analyze_devirt 填写，之后只读）
+    C99DevirtParam *devirt_params;
+    int devirt_param_count;
+    
+    // 区间分析（--safety-checks 生成运行时检查，--safety-report 输出未证明安全的位置）：
+    // 函数生成前由 c99_analyze_safety 填写，之后只读
+    int safety_checks;
+    int safety_report;
+    C99SafetyCheck *safety_check_sites;
+    int safety_check_count;
+    C99SafetyHoist *safety_hoists;
+    int safety_hoist_count;
+    
+    // 编译统计（--time-report，NULL 表示不统计各生成步骤的耗时）
+    TimeReport *time_report;
 } C99CodeGenerator;
 
 // 创建 C99 代码生成器
 // 参数：codegen - C99CodeGenerator 结构体指针（由调用者分配）
 //       arena - Arena 分配器指针
-//       output - 输出文件指针（已打开的文件）
+//       output - 输出缓冲区（已初始化）
 //       module_name - 模块名称
 //       emit_line_directives - 是否生成 #line 指令（1 表示是，0 表示否）
 // 返回：成功返回0，失败返回非0
-int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, FILE *output, const char *module_name, int emit_line_directives);
+int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, Emitter *output, const char *module_name, int emit_line_directives);
 
 // 生成 C99 代码
 // 参数：codegen - C99CodeGenerator 结构体指针
@@ -158,10 +219,22 @@ int c99_codegen_new(C99CodeGenerator *codegen, Arena *arena, FILE *output, const
 // 返回：成功返回0，失败返回非0
 int c99_codegen_generate(C99CodeGenerator *codegen, ASTNode *ast, const char *output_file);
 
+// 拆分输出的文件路径
+// 参数：buf/size - 结果缓冲区，output_file - 输出文件路径（如 out/prog.c），
+//       index - -1 表示共享头文件（out/prog.h），0 表示输出文件本身，i > 0 表示 out/prog_i.c
+// 返回：成功返回0，缓冲区不足返回-1
+int c99_split_output_path(char *buf, size_t size, const char *output_file, int index);
+
 // 释放 C99 代码生成器资源（注意：不关闭输出文件）
 // 参数：codegen - C99CodeGenerator 结构体指针
 void c99_codegen_free(C99CodeGenerator *codegen);
 
+// 设置错误码（从 TypeChecker 传入整个程序的错误名称，按名称排序后连续编号）
+// 参数：codegen - C99CodeGenerator 结构体指针
+//       checker - TypeChecker 指针（类型检查已完成）
+// 返回：成功返回0，失败返回非0
+int c99_codegen_set_error_ids(C99CodeGenerator *codegen, TypeChecker *checker);
+
 // 设置单态化实例（从 TypeChecker 传入）
 // 参数：codegen - C99CodeGenerator 结构体指针
 //       checker - TypeChecker 指针
@@ -0,0 +1,342 @@
+#define _GNU_SOURCE  // 用于 SCM_RIGHTS、clearenv、environ
+#include "compile_server.h"
+#include "arena.h"
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifndef PATH_MAX
+#define PATH_MAX 4096
+#endif
+
+// 请求头魔数（协议变化时修改，"UYA1"）
+#define COMPILE_SERVER_MAGIC 0x31415955u
+
+// 随请求头传递的文件描述符数量（标准输入/输出/错误）
+#define COMPILE_SERVER_FD_COUNT 3
+
+// 请求头（之后依次是以 '\0' 结尾的工作目录、argc 个参数、envc 个环境变量，共 size 字节）
+typedef struct CompileRequestHeader {
+    uint32_t magic;
+    uint32_t size;
+    uint32_t argc;
+    uint32_t envc;
+} CompileRequestHeader;
+
+// 写出全部数据（不因对端关闭产生 SIGPIPE）
+// 返回：成功返回0，失败返回-1
+static int send_full(int fd, const void *data, size_t len) {
+    const char *p = (const char *)data;
+    while (len > 0) {
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+// 读取全部数据
+// 返回：成功返回0，对端提前关闭或出错返回-1
+static int recv_full(int fd, void *data, size_t len) {
+    char *p = (char *)data;
+    while (len > 0) {
+        ssize_t n = recv(fd, p, len, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (n == 0) {
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+// 填充 socket 地址
+// 返回：成功返回0，路径过长返回-1
+static int socket_address(const char *socket_path, struct sockaddr_un *addr) {
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(addr->sun_path)) {
+        return -1;
+    }
+    strcpy(addr->sun_path, socket_path);
+    return 0;
+}
+
+// 连接编译服务
+// 返回：socket 文件描述符，失败返回-1
+static int connect_server(const char *socket_path) {
+    struct sockaddr_un addr;
+    if (socket_address(socket_path, &addr) != 0) {
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// 接收请求头与随附的文件描述符
+// 返回：成功返回0，失败返回-1
+static int recv_request_header(int conn, CompileRequestHeader *header, int fds[COMPILE_SERVER_FD_COUNT]) {
+    union {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(sizeof(int) * COMPILE_SERVER_FD_COUNT)];
+    } control;
+    struct iovec iov;
+    iov.iov_base = header;
+    iov.iov_len = sizeof(*header);
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    ssize_t n;
+    do {
+        n = recvmsg(conn, &msg, 0);
+    } while (n < 0 && errno == EINTR);
+    if (n <= 0) {
+        return -1;
+    }
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg == NULL || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+        cmsg->cmsg_len != CMSG_LEN(sizeof(int) * COMPILE_SERVER_FD_COUNT)) {
+        return -1;
+    }
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(int) * COMPILE_SERVER_FD_COUNT);
+
+    // 文件描述符随第一个字节到达，请求头的其余部分按普通数据读取
+    if ((size_t)n < sizeof(*header) &&
+        recv_full(conn, (char *)header + n, sizeof(*header) - (size_t)n) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+// 在请求子进程中处理一个请求：切换到客户端的工作目录、环境与标准输入/输出/错误后运行 handler
+// 返回：子进程退出码（只用于调试，客户端以发回的退出码为准）
+static int serve_request(int conn, CompileServerHandler handler) {
+    CompileRequestHeader header;
+    int fds[COMPILE_SERVER_FD_COUNT];
+    if (recv_request_header(conn, &header, fds) != 0 || header.magic != COMPILE_SERVER_MAGIC ||
+        header.size == 0 || header.size > COMPILE_SERVER_MAX_REQUEST ||
+        header.argc == 0 || header.argc > header.size || header.envc > header.size) {
+        return 1;
+    }
+
+    // 请求内容与字符串指针数组（子进程结束前一直有效，putenv 直接引用）
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    char *buf = (char *)arena_alloc(&arena, header.size);
+    char **strings = (char **)arena_alloc(&arena, sizeof(char *) * (header.argc + header.envc + 1));
+    if (buf == NULL || strings == NULL || recv_full(conn, buf, header.size) != 0 || buf[header.size - 1] != '\0') {
+        return 1;
+    }
+    uint32_t string_count = 0;
+    uint32_t expected = 1 + header.argc + header.envc;
+    for (uint32_t pos = 0; pos < header.size; pos += (uint32_t)strlen(buf + pos) + 1) {
+        if (string_count >= expected) {
+            return 1;
+        }
+        strings[string_count++] = buf + pos;
+    }
+    if (string_count != expected) {
+        return 1;
+    }
+    const char *cwd = strings[0];
+    char **env = strings + 1 + header.argc;
+    char **argv = (char **)arena_alloc(&arena, sizeof(char *) * (header.argc + 1));
+    if (argv == NULL) {
+        return 1;
+    }
+    memcpy(argv, strings + 1, sizeof(char *) * header.argc);
+    argv[header.argc] = NULL;
+
+    if (chdir(cwd) != 0) {
+        return 1;
+    }
+    clearenv();
+    for (uint32_t i = 0; i < header.envc; i++) {
+        putenv(env[i]);
+    }
+    for (int i = 0; i < COMPILE_SERVER_FD_COUNT; i++) {
+        if (dup2(fds[i], i) < 0) {
+            return 1;
+        }
+    }
+    for (int i = 0; i < COMPILE_SERVER_FD_COUNT; i++) {
+        if (fds[i] >= COMPILE_SERVER_FD_COUNT) {
+            close(fds[i]);
+        }
+    }
+
+    int32_t code = (int32_t)handler((int)header.argc, argv);
+    fflush(stdout);
+    fflush(stderr);
+    send_full(conn, &code, sizeof(code));
+    return 0;
+}
+
+int compile_server_listen(const char *socket_path) {
+    struct sockaddr_un addr;
+    if (socket_address(socket_path, &addr) != 0) {
+        fprintf(stderr, "错误: socket 路径过长: %s\n", socket_path);
+        return -1;
+    }
+
+    // 已有服务在监听时不替换（只删除无人监听的残留文件）
+    int probe = connect_server(socket_path);
+    if (probe >= 0) {
+        close(probe);
+        fprintf(stderr, "错误: 已有编译服务在监听 %s\n", socket_path);
+        return -1;
+    }
+    unlink(socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        fprintf(stderr, "错误: 无法监听 %s: %s\n", socket_path, strerror(errno));
+        if (fd >= 0) {
+            close(fd);
+        }
+        return -1;
+    }
+    return fd;
+}
+
+int compile_server_run(int listen_fd, CompileServerHandler handler) {
+    // 子进程结束后自动回收（请求子进程中恢复默认处理，否则 system() 等无法等待其子进程）
+    signal(SIGCHLD, SIG_IGN);
+
+    for (;;) {
+        int conn = accept(listen_fd, NULL, NULL);
+        if (conn < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            fprintf(stderr, "错误: 编译服务接受连接失败: %s\n", strerror(errno));
+            close(listen_fd);
+            return -1;
+        }
+
+        fflush(stdout);
+        fflush(stderr);
+        pid_t pid = fork();
+        if (pid == 0) {
+            close(listen_fd);
+            signal(SIGCHLD, SIG_DFL);
+            _exit(serve_request(conn, handler));
+        }
+        if (pid < 0) {
+            fprintf(stderr, "警告: 无法为编译请求创建子进程: %s\n", strerror(errno));
+        }
+        close(conn);
+    }
+}
+
+int compile_client_run(const char *socket_path, int argc, char *argv[]) {
+    int fd = connect_server(socket_path);
+    if (fd < 0) {
+        return -1;
+    }
+
+    char cwd[PATH_MAX];
+    if (getcwd(cwd, sizeof(cwd)) == NULL) {
+        close(fd);
+        return -1;
+    }
+
+    // 请求大小：工作目录、参数与环境变量（均含结尾 '\0'）
+    size_t size = strlen(cwd) + 1;
+    for (int i = 0; i < argc; i++) {
+        size += strlen(argv[i]) + 1;
+    }
+    uint32_t envc = 0;
+    for (char **e = environ; *e != NULL; e++) {
+        size += strlen(*e) + 1;
+        envc++;
+    }
+    if (size > COMPILE_SERVER_MAX_REQUEST) {
+        close(fd);
+        return -1;
+    }
+
+    CompileRequestHeader header;
+    header.magic = COMPILE_SERVER_MAGIC;
+    header.size = (uint32_t)size;
+    header.argc = (uint32_t)argc;
+    header.envc = envc;
+
+    // 请求头随附标准输入/输出/错误
+    int fds[COMPILE_SERVER_FD_COUNT] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+    union {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(sizeof(fds))];
+    } control;
+    memset(&control, 0, sizeof(control));
+    struct iovec iov;
+    iov.iov_base = &header;
+    iov.iov_len = sizeof(header);
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    fflush(stdout);
+    fflush(stderr);
+    ssize_t sent;
+    do {
+        sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    int ok = sent > 0 &&
+             ((size_t)sent == sizeof(header) || send_full(fd, (char *)&header + sent, sizeof(header) - (size_t)sent) == 0) &&
+             send_full(fd, cwd, strlen(cwd) + 1) == 0;
+    for (int i = 0; ok && i < argc; i++) {
+        ok = send_full(fd, argv[i], strlen(argv[i]) + 1) == 0;
+    }
+    for (char **e = environ; ok && *e != NULL; e++) {
+        ok = send_full(fd, *e, strlen(*e) + 1) == 0;
+    }
+    if (!ok) {
+        close(fd);
+        return -1;
+    }
+
+    // 请求已完整发送，此后服务可能已开始编译，不再回退到本进程编译
+    int32_t code;
+    if (recv_full(fd, &code, sizeof(code)) != 0) {
+        fprintf(stderr, "错误: 编译服务异常终止\n");
+        close(fd);
+        return 1;
+    }
+    close(fd);
+    return (int)code;
+}
@@ -0,0 +1,32 @@
+#ifndef COMPILE_SERVER_H
+#define COMPILE_SERVER_H
+
+// 编译服务（uya-c --server SOCKET）与客户端（uya-c --client SOCKET ...）
+// 服务进程监听本地 Unix socket，每个编译请求 fork 一个子进程处理：
+// 子进程继承服务进程启动时准备好的状态（如预解析的标准库模块），内存写时复制，
+// 请求之间互不影响，编译结果与单次运行相同。
+// 客户端发送命令行参数、工作目录、环境变量，并通过 SCM_RIGHTS 传递标准输入/输出/错误，
+// 子进程切换到客户端的工作目录与环境后运行编译，输出直接写到客户端的终端或管道，
+// 结束后把退出码发回客户端。
+
+// 请求的最大字节数（工作目录、参数与环境变量）
+#define COMPILE_SERVER_MAX_REQUEST (4 * 1024 * 1024)
+
+// 请求处理函数：在请求子进程中调用，返回值作为客户端的退出码
+typedef int (*CompileServerHandler)(int argc, char *argv[]);
+
+// 开始监听（先于准备预热状态调用，已有服务在监听时尽早报错）
+// 参数：socket_path - socket 文件路径（已有服务在监听时报错；残留的 socket 文件会被替换）
+// 返回：监听的 socket 文件描述符，失败返回-1
+int compile_server_listen(const char *socket_path);
+
+// 处理编译请求（不返回，除非出错）
+// 参数：listen_fd - compile_server_listen 返回的文件描述符，handler - 请求处理函数
+// 返回：出错返回-1
+int compile_server_run(int listen_fd, CompileServerHandler handler);
+
+// 客户端：把 argv、工作目录、环境变量与标准输入/输出/错误交给编译服务，等待编译结束
+// 返回：编译的退出码；无法连接服务或请求未能完整发送时返回-1（服务未运行编译，调用者可以在本进程编译）
+int compile_client_run(const char *socket_path, int argc, char *argv[]);
+
+#endif // COMPILE_SERVER_H
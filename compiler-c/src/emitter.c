@@ -0,0 +1,223 @@
+#define _DEFAULT_SOURCE  // 用于 writev
+#include "emitter.h"
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// writev 单次提交的最大块数
+#ifdef IOV_MAX
+#define EMITTER_IOV_BATCH (IOV_MAX < 1024 ? IOV_MAX : 1024)
+#else
+#define EMITTER_IOV_BATCH 1024
+#endif
+
+// 初始化输出缓冲区
+void emitter_init(Emitter *emitter, Arena *arena) {
+    emitter_init_sized(emitter, arena, EMITTER_CHUNK_SIZE);
+}
+
+// 初始化输出缓冲区（指定第一块容量）
+void emitter_init_sized(Emitter *emitter, Arena *arena, size_t initial_chunk_size) {
+    emitter->arena = arena;
+    emitter->head = NULL;
+    emitter->tail = NULL;
+    emitter->pos = NULL;
+    emitter->end = NULL;
+    emitter->retired = 0;
+    emitter->chunk_size = initial_chunk_size > 0 ? initial_chunk_size : EMITTER_CHUNK_SIZE;
+}
+
+// 把当前写入位置同步到 tail 块的长度
+static void emitter_sync(Emitter *emitter) {
+    if (emitter->tail != NULL) {
+        emitter->tail->len = (size_t)(emitter->pos - emitter->tail->data);
+    }
+}
+
+// 追加一个至少能容纳 min_size 字节的新块并切换为当前块
+static void emitter_push_chunk(Emitter *emitter, size_t min_size) {
+    size_t cap = min_size > emitter->chunk_size ? min_size : emitter->chunk_size;
+    if (emitter->chunk_size < EMITTER_CHUNK_SIZE) {
+        emitter->chunk_size = emitter->chunk_size * 2 < EMITTER_CHUNK_SIZE ? emitter->chunk_size * 2 : EMITTER_CHUNK_SIZE;
+    }
+    EmitterChunk *chunk = (EmitterChunk *)arena_alloc(emitter->arena, sizeof(EmitterChunk));
+    chunk->next = NULL;
+    chunk->data = (char *)arena_alloc(emitter->arena, cap);
+    chunk->len = 0;
+    chunk->cap = cap;
+
+    emitter_sync(emitter);
+    if (emitter->tail != NULL) {
+        emitter->retired += emitter->tail->len;
+        emitter->tail->next = chunk;
+    } else {
+        emitter->head = chunk;
+    }
+    emitter->tail = chunk;
+    emitter->pos = chunk->data;
+    emitter->end = chunk->data + cap;
+}
+
+// 追加 len 字节
+void emitter_write(Emitter *emitter, const char *data, size_t len) {
+    if (len == 0) {
+        return;
+    }
+    size_t avail = (size_t)(emitter->end - emitter->pos);
+    if (len <= avail) {
+        memcpy(emitter->pos, data, len);
+        emitter->pos += len;
+        return;
+    }
+    // 先填满当前块，剩余部分写入新块
+    if (avail > 0) {
+        memcpy(emitter->pos, data, avail);
+        emitter->pos += avail;
+        data += avail;
+        len -= avail;
+    }
+    emitter_push_chunk(emitter, len);
+    memcpy(emitter->pos, data, len);
+    emitter->pos += len;
+}
+
+// 追加以 '\0' 结尾的字符串
+void emitter_puts(Emitter *emitter, const char *str) {
+    if (str != NULL) {
+        emitter_write(emitter, str, strlen(str));
+    }
+}
+
+// 追加单个字符（当前块已满）
+void emitter_putc_slow(Emitter *emitter, char c) {
+    emitter_push_chunk(emitter, 1);
+    *emitter->pos++ = c;
+}
+
+// 追加无符号十进制整数
+void emitter_uint(Emitter *emitter, unsigned long long value) {
+    char buf[24];
+    char *p = buf + sizeof(buf);
+    do {
+        *--p = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    emitter_write(emitter, p, (size_t)(buf + sizeof(buf) - p));
+}
+
+// 追加有符号十进制整数
+void emitter_int(Emitter *emitter, long long value) {
+    if (value < 0) {
+        emitter_putc(emitter, '-');
+        // 先加 1 再取反，避免 LLONG_MIN 取反溢出
+        emitter_uint(emitter, (unsigned long long)(-(value + 1)) + 1u);
+    } else {
+        emitter_uint(emitter, (unsigned long long)value);
+    }
+}
+
+// 格式化追加（va_list 版本）
+void emitter_vprintf(Emitter *emitter, const char *format, va_list args) {
+    size_t avail = (size_t)(emitter->end - emitter->pos);
+    va_list retry;
+    va_copy(retry, args);
+    int n = vsnprintf(emitter->pos, avail, format, args);
+    if (n >= 0 && (size_t)n >= avail) {
+        // 当前块放不下：在新块中重新格式化（vsnprintf 需要额外 1 字节写 '\0'）
+        emitter_push_chunk(emitter, (size_t)n + 1);
+        vsnprintf(emitter->pos, (size_t)n + 1, format, retry);
+    }
+    if (n > 0) {
+        emitter->pos += n;
+    }
+    va_end(retry);
+}
+
+// 格式化追加
+void emitter_printf(Emitter *emitter, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    emitter_vprintf(emitter, format, args);
+    va_end(args);
+}
+
+// 追加另一个输出缓冲区的全部内容
+void emitter_append(Emitter *emitter, Emitter *src) {
+    emitter_sync(src);
+    for (EmitterChunk *chunk = src->head; chunk != NULL; chunk = chunk->next) {
+        emitter_write(emitter, chunk->data, chunk->len);
+    }
+}
+
+// 已写入的总字节数
+size_t emitter_size(const Emitter *emitter) {
+    if (emitter->tail == NULL) {
+        return 0;
+    }
+    return emitter->retired + (size_t)(emitter->pos - emitter->tail->data);
+}
+
+// 将全部内容写入文件描述符
+int emitter_write_fd(Emitter *emitter, int fd) {
+    emitter_sync(emitter);
+    struct iovec iov[EMITTER_IOV_BATCH];
+    EmitterChunk *chunk = emitter->head;
+    while (chunk != NULL) {
+        // 收集一批非空块
+        int count = 0;
+        while (chunk != NULL && count < EMITTER_IOV_BATCH) {
+            if (chunk->len > 0) {
+                iov[count].iov_base = chunk->data;
+                iov[count].iov_len = chunk->len;
+                count++;
+            }
+            chunk = chunk->next;
+        }
+        // 写出该批（处理部分写入）
+        int first = 0;
+        while (first < count) {
+            ssize_t written = writev(fd, &iov[first], count - first);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return -1;
+            }
+            while (first < count && (size_t)written >= iov[first].iov_len) {
+                written -= (ssize_t)iov[first].iov_len;
+                first++;
+            }
+            if (first < count) {
+                iov[first].iov_base = (char *)iov[first].iov_base + written;
+                iov[first].iov_len -= (size_t)written;
+            }
+        }
+    }
+    return 0;
+}
+
+// 将全部内容写入 FILE*
+int emitter_write_file(Emitter *emitter, FILE *file) {
+    emitter_sync(emitter);
+    for (EmitterChunk *chunk = emitter->head; chunk != NULL; chunk = chunk->next) {
+        if (chunk->len > 0 && fwrite(chunk->data, 1, chunk->len, file) != chunk->len) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// 将全部内容拼接为连续字符串
+const char *emitter_to_string(Emitter *emitter, Arena *arena) {
+    emitter_sync(emitter);
+    size_t size = emitter_size(emitter);
+    char *result = (char *)arena_alloc(arena, size + 1);
+    char *p = result;
+    for (EmitterChunk *chunk = emitter->head; chunk != NULL; chunk = chunk->next) {
+        memcpy(p, chunk->data, chunk->len);
+        p += chunk->len;
+    }
+    *p = '\0';
+    return result;
+}
@@ -0,0 +1,87 @@
+#ifndef EMITTER_H
+#define EMITTER_H
+
+#include "arena.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// 输出缓冲区（代码生成使用）
+// 生成的代码先追加到内存中的分块缓冲区（块从 Arena 分配，写满后追加新块，已写内容不移动），
+// 全部生成后一次性写出（文件描述符用 writev 批量写出所有块），也可写到任意 FILE*（如 stdout）
+// 或拼接为连续字符串（测试用）。
+// 字面量、标识符、整数有不经过格式解析的快速路径，只有真正需要格式化时才调用 vsnprintf。
+
+// 单个缓冲块的默认大小（单次写入更大时按需加大）
+#define EMITTER_CHUNK_SIZE (64 * 1024)
+
+// 缓冲块
+typedef struct EmitterChunk {
+    struct EmitterChunk *next;  // 下一块
+    char *data;                 // 块数据（从 Arena 分配）
+    size_t len;                 // 已写入长度（当前块的长度由 pos 计算，切换到新块时写回）
+    size_t cap;                 // 块容量
+} EmitterChunk;
+
+// 输出缓冲区
+typedef struct Emitter {
+    Arena *arena;               // Arena 分配器（缓冲块从此分配）
+    EmitterChunk *head;         // 第一块
+    EmitterChunk *tail;         // 当前写入块
+    char *pos;                  // 当前写入位置（tail 块内）
+    char *end;                  // tail 块末尾
+    size_t retired;             // tail 之前各块的总长度
+    size_t chunk_size;          // 下一块的默认容量（从初始值翻倍增长，最大 EMITTER_CHUNK_SIZE）
+} Emitter;
+
+// 初始化输出缓冲区（首次写入时分配缓冲块）
+// 参数：emitter - 输出缓冲区指针（由调用者提供），arena - Arena 分配器
+void emitter_init(Emitter *emitter, Arena *arena);
+
+// 初始化输出缓冲区，第一块容量为 initial_chunk_size，之后逐块翻倍直到 EMITTER_CHUNK_SIZE
+// 用于大量小输出（如每个函数一个缓冲区），避免每个缓冲区都占用一整块
+void emitter_init_sized(Emitter *emitter, Arena *arena, size_t initial_chunk_size);
+
+// 追加 len 字节
+void emitter_write(Emitter *emitter, const char *data, size_t len);
+
+// 追加以 '\0' 结尾的字符串（NULL 视为空串）
+void emitter_puts(Emitter *emitter, const char *str);
+
+// 追加字符串字面量（长度在编译期确定，不调用 strlen）
+#define emitter_lit(emitter, literal) emitter_write((emitter), "" literal, sizeof(literal) - 1)
+
+// 追加单个字符（当前块有空间时直接写入）
+// 注意：emitter 参数会被求值多次
+void emitter_putc_slow(Emitter *emitter, char c);
+#define emitter_putc(emitter, c) \
+    ((emitter)->pos < (emitter)->end ? (void)(*(emitter)->pos++ = (char)(c)) : emitter_putc_slow((emitter), (char)(c)))
+
+// 追加十进制整数（不经过格式解析）
+void emitter_int(Emitter *emitter, long long value);
+void emitter_uint(Emitter *emitter, unsigned long long value);
+
+// 格式化追加（printf 语义，直接格式化到缓冲块中）
+void emitter_printf(Emitter *emitter, const char *format, ...)
+    __attribute__((format(printf, 2, 3)));
+void emitter_vprintf(Emitter *emitter, const char *format, va_list args);
+
+// 追加另一个输出缓冲区的全部内容（复制，src 不变）
+void emitter_append(Emitter *emitter, Emitter *src);
+
+// 已写入的总字节数
+size_t emitter_size(const Emitter *emitter);
+
+// 将全部内容写入文件描述符（writev 批量写出所有块）
+// 返回：成功返回 0，失败返回 -1
+int emitter_write_fd(Emitter *emitter, int fd);
+
+// 将全部内容写入 FILE*（如 stdout）
+// 返回：成功返回 0，失败返回 -1
+int emitter_write_file(Emitter *emitter, FILE *file);
+
+// 将全部内容拼接为以 '\0' 结尾的连续字符串（测试用）
+// 参数：arena - 结果字符串的分配器
+const char *emitter_to_string(Emitter *emitter, Arena *arena);
+
+#endif // EMITTER_H
@@ -0,0 +1,164 @@
+#include "hash_map.h"
+#include "intern.h"
+#include <string.h>
+
+// 槽位标记
+#define HASH_MAP_EMPTY     (-1)  // 空槽位：探测到此停止
+#define HASH_MAP_TOMBSTONE (-2)  // 墓碑：条目已删除，探测时跳过
+
+// 条目数组容量（槽位数量的 3/4，即最大负载因子）
+static int hash_map_entry_capacity(int capacity) {
+    return capacity - capacity / 4;
+}
+
+// 计算键的哈希值
+// djb2 对仅末尾字符不同的键（如 fn_1、fn_2）给出相邻的值，线性探测下会连成长簇，
+// 因此再做一次 32 位混合，使低位均匀分布
+static unsigned int hash_map_hash(const char *key) {
+    unsigned int h = intern_hash_bytes(key, strlen(key));
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// 初始化哈希表
+void hash_map_init(HashMap *map, Arena *arena) {
+    map->arena = arena;
+    map->slots = NULL;
+    map->capacity = 0;
+    map->entries = NULL;
+    map->entry_count = 0;
+    map->count = 0;
+    map->tombstones = 0;
+}
+
+// 查找键所在槽位
+// 返回：键所在槽位下标，未找到返回 -1
+static int hash_map_find_slot(const HashMap *map, const char *key, unsigned int hash) {
+    if (map->capacity == 0) {
+        return -1;
+    }
+    unsigned int mask = (unsigned int)(map->capacity - 1);
+    unsigned int i = hash & mask;
+    for (;;) {
+        int index = map->slots[i];
+        if (index == HASH_MAP_EMPTY) {
+            return -1;
+        }
+        if (index >= 0) {
+            const HashMapEntry *entry = &map->entries[index];
+            if (entry->hash == hash && INTERN_STR_EQ(entry->key, key)) {
+                return (int)i;
+            }
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+// 重建哈希表：按插入顺序压缩有效条目，重新分配槽位（有效条目不少于一半时容量翻倍）
+static void hash_map_rebuild(HashMap *map) {
+    int new_capacity = map->capacity > 0 ? map->capacity : HASH_MAP_INITIAL_CAPACITY;
+    while (map->count * 2 >= new_capacity) {
+        new_capacity *= 2;
+    }
+
+    int *new_slots = (int *)arena_alloc(map->arena, sizeof(int) * (size_t)new_capacity);
+    for (int i = 0; i < new_capacity; i++) {
+        new_slots[i] = HASH_MAP_EMPTY;
+    }
+    HashMapEntry *new_entries = (HashMapEntry *)arena_alloc(map->arena,
+        sizeof(HashMapEntry) * (size_t)hash_map_entry_capacity(new_capacity));
+
+    unsigned int mask = (unsigned int)(new_capacity - 1);
+    int count = 0;
+    for (int i = 0; i < map->entry_count; i++) {
+        if (map->entries[i].key == NULL) continue;
+        new_entries[count] = map->entries[i];
+        unsigned int j = new_entries[count].hash & mask;
+        while (new_slots[j] != HASH_MAP_EMPTY) {
+            j = (j + 1) & mask;
+        }
+        new_slots[j] = count;
+        count++;
+    }
+
+    map->slots = new_slots;
+    map->capacity = new_capacity;
+    map->entries = new_entries;
+    map->entry_count = count;
+    map->tombstones = 0;
+}
+
+// 查找键对应的值
+void *hash_map_get(const HashMap *map, const char *key) {
+    if (map == NULL || key == NULL) {
+        return NULL;
+    }
+    int slot = hash_map_find_slot(map, key, hash_map_hash(key));
+    return slot >= 0 ? map->entries[map->slots[slot]].value : NULL;
+}
+
+// 插入或替换键对应的值
+int hash_map_put(HashMap *map, const char *key, void *value) {
+    if (map == NULL || key == NULL) {
+        return 0;
+    }
+    unsigned int hash = hash_map_hash(key);
+    int slot = hash_map_find_slot(map, key, hash);
+    if (slot >= 0) {
+        map->entries[map->slots[slot]].value = value;
+        return 0;
+    }
+
+    if (map->entry_count >= hash_map_entry_capacity(map->capacity)) {
+        hash_map_rebuild(map);
+    }
+
+    // 新键：放入探测序列中第一个墓碑或空槽位
+    unsigned int mask = (unsigned int)(map->capacity - 1);
+    unsigned int i = hash & mask;
+    while (map->slots[i] >= 0) {
+        i = (i + 1) & mask;
+    }
+    if (map->slots[i] == HASH_MAP_TOMBSTONE) {
+        map->tombstones--;
+    }
+    HashMapEntry *entry = &map->entries[map->entry_count];
+    entry->key = key;
+    entry->hash = hash;
+    entry->value = value;
+    map->slots[i] = map->entry_count++;
+    map->count++;
+    return 1;
+}
+
+// 删除键
+void *hash_map_remove(HashMap *map, const char *key) {
+    if (map == NULL || key == NULL) {
+        return NULL;
+    }
+    int slot = hash_map_find_slot(map, key, hash_map_hash(key));
+    if (slot < 0) {
+        return NULL;
+    }
+    HashMapEntry *entry = &map->entries[map->slots[slot]];
+    void *value = entry->value;
+    entry->key = NULL;
+    entry->value = NULL;
+    map->slots[slot] = HASH_MAP_TOMBSTONE;
+    map->tombstones++;
+    map->count--;
+    return value;
+}
+
+// 按插入顺序获取条目
+const HashMapEntry *hash_map_entry_at(const HashMap *map, int index) {
+    if (map == NULL || index < 0 || index >= map->entry_count) {
+        return NULL;
+    }
+    const HashMapEntry *entry = &map->entries[index];
+    return entry->key != NULL ? entry : NULL;
+}
@@ -0,0 +1,56 @@
+#ifndef HASH_MAP_H
+#define HASH_MAP_H
+
+#include "arena.h"
+
+// 字符串键哈希表（开放寻址，线性探测）
+// 槽位只保存条目下标，条目数组按插入顺序排列，遍历顺序与插入顺序一致（输出确定）；
+// 查找遇到空槽位即停止，删除的槽位标记为墓碑（探测时跳过、插入时复用）；
+// 条目数组用满（槽位容量的 3/4）时重建：丢弃已删除条目与墓碑，有效条目不少于一半时容量翻倍。
+// 槽位与条目数组均从 Arena 分配，无固定上限；旧数组随 Arena 一起释放。
+
+// 初始槽位数量（必须是2的幂）
+#define HASH_MAP_INITIAL_CAPACITY 16
+
+// 哈希表条目
+typedef struct HashMapEntry {
+    const char *key;            // 键（NULL 表示已删除；调用者保证其生命周期不短于哈希表）
+    unsigned int hash;          // 键的哈希值
+    void *value;                // 值
+} HashMapEntry;
+
+// 哈希表
+typedef struct HashMap {
+    Arena *arena;               // Arena 分配器
+    int *slots;                 // 槽位数组：条目下标，-1 表示空槽位，-2 表示墓碑
+    int capacity;               // 槽位数量（2的幂，0 表示尚未分配）
+    HashMapEntry *entries;      // 条目数组（按插入顺序，含已删除条目，长度上限为槽位数量的 3/4）
+    int entry_count;            // 条目数组已用长度（不小于已用槽位数量，用满即重建）
+    int count;                  // 有效条目数量
+    int tombstones;             // 墓碑槽位数量
+} HashMap;
+
+// 初始化哈希表（首次插入时分配槽位）
+// 参数：map - 哈希表指针（由调用者提供），arena - Arena 分配器
+void hash_map_init(HashMap *map, Arena *arena);
+
+// 查找键对应的值
+// 参数：map - 哈希表指针，key - 键
+// 返回：值，未找到返回 NULL
+void *hash_map_get(const HashMap *map, const char *key);
+
+// 插入或替换键对应的值
+// 参数：map - 哈希表指针，key - 键，value - 值
+// 返回：新插入返回 1，替换已有值返回 0
+int hash_map_put(HashMap *map, const char *key, void *value);
+
+// 删除键
+// 参数：map - 哈希表指针，key - 键
+// 返回：删除的值，未找到返回 NULL
+void *hash_map_remove(HashMap *map, const char *key);
+
+// 按插入顺序遍历：获取第 index 个条目（0 ~ entry_count-1）
+// 返回：条目指针，已删除的条目返回 NULL
+const HashMapEntry *hash_map_entry_at(const HashMap *map, int index);
+
+#endif // HASH_MAP_H
@@ -0,0 +1,108 @@
+#include "intern.h"
+#include <stdint.h>
+#include <string.h>
+
+// 驻留表初始槽位数量（2的幂）
+#define INTERN_INITIAL_CAPACITY 1024
+
+// 计算字符串哈希值（djb2）
+unsigned int intern_hash_bytes(const char *str, size_t len) {
+    unsigned int hash = 5381;
+    for (size_t i = 0; i < len; i++) {
+        hash = ((hash << 5) + hash) + (unsigned char)str[i];
+    }
+    return hash;
+}
+
+// 分配并清零槽位数组
+static InternSlot *intern_alloc_slots(Arena *arena, int capacity) {
+    InternSlot *slots = (InternSlot *)arena_alloc(arena, sizeof(InternSlot) * (size_t)capacity);
+    memset(slots, 0, sizeof(InternSlot) * (size_t)capacity);
+    return slots;
+}
+
+// 获取 Arena 上的驻留表（首次调用时创建）
+static StringInterner *intern_get_table(Arena *arena) {
+    if (arena->interner == NULL) {
+        StringInterner *interner = (StringInterner *)arena_alloc(arena, sizeof(StringInterner));
+        interner->slots = intern_alloc_slots(arena, INTERN_INITIAL_CAPACITY);
+        interner->capacity = INTERN_INITIAL_CAPACITY;
+        interner->count = 0;
+        arena->interner = interner;
+    }
+    return arena->interner;
+}
+
+// 槽位数组翻倍并重新散列（旧数组留在 Arena 中，随 Arena 一起释放）
+static void intern_grow(Arena *arena, StringInterner *interner) {
+    int new_capacity = interner->capacity * 2;
+    InternSlot *new_slots = intern_alloc_slots(arena, new_capacity);
+    unsigned int mask = (unsigned int)(new_capacity - 1);
+    for (int i = 0; i < interner->capacity; i++) {
+        InternSlot *slot = &interner->slots[i];
+        if (slot->str == NULL) continue;
+        unsigned int j = slot->hash & mask;
+        while (new_slots[j].str != NULL) {
+            j = (j + 1) & mask;
+        }
+        new_slots[j] = *slot;
+    }
+    interner->slots = new_slots;
+    interner->capacity = new_capacity;
+}
+
+// 驻留长度为 len 的字符串
+const char *intern_string(Arena *arena, const char *str, size_t len) {
+    if (arena == NULL || str == NULL) {
+        return NULL;
+    }
+
+    StringInterner *interner = intern_get_table(arena);
+    unsigned int hash = intern_hash_bytes(str, len);
+    unsigned int mask = (unsigned int)(interner->capacity - 1);
+    unsigned int i = hash & mask;
+
+    // 线性探测：命中则返回已有的规范指针
+    while (interner->slots[i].str != NULL) {
+        InternSlot *slot = &interner->slots[i];
+        if (slot->hash == hash) {
+            const InternHeader *header = (const InternHeader *)slot->str - 1;
+            if (header->len == len && memcmp(slot->str, str, len) == 0) {
+                return slot->str;
+            }
+        }
+        i = (i + 1) & mask;
+    }
+
+    // 未命中：头部与内容一起分配，头部紧挨在内容之前
+    InternHeader *header = (InternHeader *)arena_alloc(arena, sizeof(InternHeader) + len + 1);
+    header->hash = hash;
+    header->len = (unsigned int)len;
+    char *copy = (char *)(header + 1);
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+
+    interner->slots[i].hash = hash;
+    interner->slots[i].str = copy;
+    interner->count++;
+
+    // 负载超过一半时扩容，保持探测链短
+    if (interner->count * 2 > interner->capacity) {
+        intern_grow(arena, interner);
+    }
+
+    return copy;
+}
+
+// 驻留以 '\0' 结尾的字符串
+const char *intern_cstring(Arena *arena, const char *str) {
+    if (str == NULL) {
+        return NULL;
+    }
+    return intern_string(arena, str, strlen(str));
+}
+
+// 获取驻留字符串的哈希值
+unsigned int intern_hash(const char *interned) {
+    return ((const InternHeader *)interned - 1)->hash;
+}
@@ -0,0 +1,51 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+#include "arena.h"
+#include <stddef.h>
+#include <string.h>
+
+// 字符串驻留（interning）
+// 同一 Arena 中相同内容的字符串只保存一份，返回唯一的规范指针，
+// 因此驻留后的名称可直接用指针比较；哈希值在驻留时计算并保存在字符串前方。
+// 驻留表本身也从 Arena 分配，生命周期与 Arena 相同（arena_reset 后失效）。
+
+// 驻留字符串头部（紧挨在字符串内容之前）
+typedef struct InternHeader {
+    unsigned int hash;      // 字符串哈希值（djb2）
+    unsigned int len;       // 字符串长度（不含 '\0'）
+} InternHeader;
+
+// 驻留表槽位
+typedef struct InternSlot {
+    unsigned int hash;      // 缓存的哈希值，避免探测时解引用字符串
+    const char *str;        // 驻留字符串（NULL 表示空槽位）
+} InternSlot;
+
+// 驻留表（开放寻址哈希表，满载一半时翻倍）
+typedef struct StringInterner {
+    InternSlot *slots;      // 槽位数组（从 Arena 分配）
+    int capacity;           // 槽位数量（2的幂）
+    int count;              // 已驻留字符串数量
+} StringInterner;
+
+// 计算字符串哈希值（djb2）
+// 参数：str - 字符串起始位置，len - 字符串长度
+unsigned int intern_hash_bytes(const char *str, size_t len);
+
+// 驻留长度为 len 的字符串（不要求以 '\0' 结尾）
+// 参数：arena - Arena 分配器（驻留表挂在该 Arena 上），str - 字符串起始位置，len - 长度
+// 返回：规范字符串指针（以 '\0' 结尾），str 为 NULL 时返回 NULL
+const char *intern_string(Arena *arena, const char *str, size_t len);
+
+// 驻留以 '\0' 结尾的字符串
+const char *intern_cstring(Arena *arena, const char *str);
+
+// 获取驻留字符串在驻留时计算的哈希值（仅对 intern_* 返回的指针有效）
+unsigned int intern_hash(const char *interned);
+
+// 名称比较：驻留后的名称通常指针相同，先比较指针再回退到 strcmp
+// 注意：参数会被求值两次，且均不能为 NULL
+#define INTERN_STR_EQ(a, b) ((a) == (b) || strcmp((a), (b)) == 0)
+
+#endif // INTERN_H
@@ -1,23 +1,50 @@
 #include "lexer.h"
+#include "intern.h"
 #include <stdio.h>
 #include <string.h>
 #include <ctype.h>
 #include <stddef.h>
 
+// 字符类别位（用于标识符/数字/空白扫描的查表快速路径）
+#define CC_IDENT_START 0x01   // 标识符首字符：字母或 '_'
+#define CC_IDENT       0x02   // 标识符后续字符：字母、数字或 '_'
+#define CC_DIGIT       0x04   // 十进制数字
+#define CC_HEX         0x08   // 十六进制数字
+#define CC_SPACE       0x10   // 行内空白：' '、'\t'、'\r'（'\n' 需更新行号，单独处理）
+
+#define L (CC_IDENT_START | CC_IDENT)
+#define X (CC_IDENT_START | CC_IDENT | CC_HEX)
+#define D (CC_IDENT | CC_DIGIT | CC_HEX)
+#define S CC_SPACE
+
+// ASCII 字符类别表（非 ASCII 字节均为 0）
+static const unsigned char char_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, S, 0, 0, 0, S, 0, 0,  // 0x00-0x0F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x10-0x1F
+    S, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x20-0x2F
+    D, D, D, D, D, D, D, D, D, D, 0, 0, 0, 0, 0, 0,  // 0x30-0x3F  0-9
+    0, X, X, X, X, X, X, L, L, L, L, L, L, L, L, L,  // 0x40-0x4F  A-O
+    L, L, L, L, L, L, L, L, L, L, L, 0, 0, 0, 0, L,  // 0x50-0x5F  P-Z _
+    0, X, X, X, X, X, X, L, L, L, L, L, L, L, L, L,  // 0x60-0x6F  a-o
+    L, L, L, L, L, L, L, L, L, L, L, 0, 0, 0, 0, 0,  // 0x70-0x7F  p-z
+};
+
+#undef L
+#undef X
+#undef D
+#undef S
+
+// 查询字符是否属于指定类别
+#define CHAR_IS(c, cls) ((char_class[(unsigned char)(c)] & (cls)) != 0)
+
 // 初始化 Lexer
 int lexer_init(Lexer *lexer, const char *source, size_t source_len, const char *filename, Arena *arena) {
     if (lexer == NULL || source == NULL || arena == NULL) {
         return -1;
     }
     
-    // 检查源代码长度是否超过缓冲区大小
-    if (source_len >= LEXER_BUFFER_SIZE) {
-        return -1;  // 源代码太长
-    }
-    
-    // 复制源代码到缓冲区
-    memcpy(lexer->buffer, source, source_len);
-    lexer->buffer[source_len] = '\0';
+    // 直接借用源代码，不复制
+    lexer->buffer = source;
     lexer->buffer_size = source_len;
     
     // 初始化位置信息
@@ -34,8 +61,10 @@ int lexer_init(Lexer *lexer, const char *source, size_t source_len, const char *
     lexer->interp_depth = 0;
     lexer->pending_interp_open = 0;
     lexer->reading_spec = 0;
+    lexer->string_text_buffer = (char *)arena_alloc(arena, LEXER_STRING_INTERP_BUFFER_SIZE);
     lexer->string_text_len = 0;
     lexer->has_seen_interp_in_string = 0;
+    lexer->token_arena = NULL;
     
     // 复制文件名到 Arena
     if (filename != NULL) {
@@ -85,7 +114,15 @@ static char advance_char(Lexer *lexer) {
 static void skip_whitespace_and_comments(Lexer *lexer) {
     while (lexer->position < lexer->buffer_size) {
         char c = peek_char(lexer, 0);
-        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+        if (CHAR_IS(c, CC_SPACE)) {
+            // 行内空白批量跳过
+            size_t pos = lexer->position + 1;
+            while (pos < lexer->buffer_size && CHAR_IS(lexer->buffer[pos], CC_SPACE)) {
+                pos++;
+            }
+            lexer->column += (int)(pos - lexer->position);
+            lexer->position = pos;
+        } else if (c == '\n') {
             advance_char(lexer);
         } else if (c == '/' && peek_char(lexer, 1) == '/') {
             // 单行注释：跳过到行尾
@@ -126,60 +163,83 @@ static void skip_whitespace_and_comments(Lexer *lexer) {
     }
 }
 
-// 检查是否为关键字
-static TokenType is_keyword(const char *str) {
-    if (strcmp(str, "enum") == 0) return TOKEN_ENUM;
-    if (strcmp(str, "struct") == 0) return TOKEN_STRUCT;
-    if (strcmp(str, "union") == 0) return TOKEN_UNION;
-    if (strcmp(str, "interface") == 0) return TOKEN_INTERFACE;
-    if (strcmp(str, "atomic") == 0) return TOKEN_ATOMIC;
-    if (strcmp(str, "const") == 0) return TOKEN_CONST;
-    if (strcmp(str, "var") == 0) return TOKEN_VAR;
-    if (strcmp(str, "fn") == 0) return TOKEN_FN;
-    if (strcmp(str, "extern") == 0) return TOKEN_EXTERN;
-    if (strcmp(str, "return") == 0) return TOKEN_RETURN;
-    if (strcmp(str, "if") == 0) return TOKEN_IF;
-    if (strcmp(str, "else") == 0) return TOKEN_ELSE;
-    if (strcmp(str, "while") == 0) return TOKEN_WHILE;
-    if (strcmp(str, "for") == 0) return TOKEN_FOR;
-    if (strcmp(str, "break") == 0) return TOKEN_BREAK;
-    if (strcmp(str, "continue") == 0) return TOKEN_CONTINUE;
-    if (strcmp(str, "true") == 0) return TOKEN_TRUE;
-    if (strcmp(str, "false") == 0) return TOKEN_FALSE;
-    if (strcmp(str, "null") == 0) return TOKEN_NULL;
-    if (strcmp(str, "try") == 0) return TOKEN_TRY;
-    if (strcmp(str, "catch") == 0) return TOKEN_CATCH;
-    if (strcmp(str, "error") == 0) return TOKEN_ERROR;
-    if (strcmp(str, "defer") == 0) return TOKEN_DEFER;
-    if (strcmp(str, "errdefer") == 0) return TOKEN_ERRDEFER;
-    if (strcmp(str, "export") == 0) return TOKEN_EXPORT;
-    if (strcmp(str, "use") == 0) return TOKEN_USE;
-    if (strcmp(str, "as") == 0) return TOKEN_AS;
-    if (strcmp(str, "match") == 0) return TOKEN_MATCH;
-    if (strcmp(str, "test") == 0) return TOKEN_TEST;
-    if (strcmp(str, "mc") == 0) return TOKEN_MC;
-    if (strcmp(str, "type") == 0) return TOKEN_TYPE;
-    return TOKEN_IDENTIFIER;  // 不是关键字，是标识符
-}
-
-// 从 Arena 复制字符串
-static const char *arena_strdup(Arena *arena, const char *start, size_t len) {
-    if (arena == NULL || start == NULL) {
-        return NULL;
-    }
-    
-    char *result = (char *)arena_alloc(arena, len + 1);
-    if (result == NULL) {
-        return NULL;
+// 检查是否为关键字（直接在源码缓冲区上按长度和首字符分派，最多一次 memcmp）
+// 参数：str - 标识符起始位置（不要求以 '\0' 结尾），len - 标识符长度
+static TokenType is_keyword(const char *str, size_t len) {
+#define KEYWORD(word, token) (memcmp(str, word, len) == 0 ? (token) : TOKEN_IDENTIFIER)
+    switch (len) {
+        case 2:
+            switch (str[0]) {
+                case 'a': return KEYWORD("as", TOKEN_AS);
+                case 'f': return KEYWORD("fn", TOKEN_FN);
+                case 'i': return KEYWORD("if", TOKEN_IF);
+                case 'm': return KEYWORD("mc", TOKEN_MC);
+            }
+            break;
+        case 3:
+            switch (str[0]) {
+                case 'f': return KEYWORD("for", TOKEN_FOR);
+                case 't': return KEYWORD("try", TOKEN_TRY);
+                case 'u': return KEYWORD("use", TOKEN_USE);
+                case 'v': return KEYWORD("var", TOKEN_VAR);
+            }
+            break;
+        case 4:
+            switch (str[0]) {
+                case 'e':
+                    if (str[1] == 'n') return KEYWORD("enum", TOKEN_ENUM);
+                    return KEYWORD("else", TOKEN_ELSE);
+                case 'n': return KEYWORD("null", TOKEN_NULL);
+                case 't':
+                    if (str[1] == 'r') return KEYWORD("true", TOKEN_TRUE);
+                    if (str[1] == 'e') return KEYWORD("test", TOKEN_TEST);
+                    return KEYWORD("type", TOKEN_TYPE);
+            }
+            break;
+        case 5:
+            switch (str[0]) {
+                case 'b': return KEYWORD("break", TOKEN_BREAK);
+                case 'c':
+                    if (str[1] == 'o') return KEYWORD("const", TOKEN_CONST);
+                    return KEYWORD("catch", TOKEN_CATCH);
+                case 'd': return KEYWORD("defer", TOKEN_DEFER);
+                case 'e': return KEYWORD("error", TOKEN_ERROR);
+                case 'f': return KEYWORD("false", TOKEN_FALSE);
+                case 'm': return KEYWORD("match", TOKEN_MATCH);
+                case 'u': return KEYWORD("union", TOKEN_UNION);
+                case 'w': return KEYWORD("while", TOKEN_WHILE);
+            }
+            break;
+        case 6:
+            switch (str[0]) {
+                case 'a': return KEYWORD("atomic", TOKEN_ATOMIC);
+                case 'e':
+                    if (str[2] == 't') return KEYWORD("extern", TOKEN_EXTERN);
+                    return KEYWORD("export", TOKEN_EXPORT);
+                case 'r': return KEYWORD("return", TOKEN_RETURN);
+                case 's': return KEYWORD("struct", TOKEN_STRUCT);
+            }
+            break;
+        case 8:
+            switch (str[0]) {
+                case 'c': return KEYWORD("continue", TOKEN_CONTINUE);
+                case 'e': return KEYWORD("errdefer", TOKEN_ERRDEFER);
+            }
+            break;
+        case 9:
+            return KEYWORD("interface", TOKEN_INTERFACE);
     }
-    
-    memcpy(result, start, len);
-    result[len] = '\0';
-    return result;
+#undef KEYWORD
+    return TOKEN_IDENTIFIER;  // 不是关键字，是标识符
 }
 
 // 创建 Token
-static Token *make_token(Arena *arena, TokenType type, const char *value, int line, int column) {
+// Token 结构体本身只在解析期间使用，优先分配在 lexer->token_arena 中（解析结束后可整体回收）；
+// value 字符串由调用方驻留在 arena 中，随 AST 一同保留
+static Token *make_token(const Lexer *lexer, Arena *arena, TokenType type, const char *value, int line, int column) {
+    if (lexer->token_arena != NULL) {
+        arena = lexer->token_arena;
+    }
     if (arena == NULL) {
         return NULL;
     }
@@ -203,17 +263,14 @@ static Token *read_identifier_or_keyword(Lexer *lexer, Arena *arena) {
     int line = lexer->line;
     int column = lexer->column;
     
-    // 读取标识符字符
-    while (lexer->position < lexer->buffer_size) {
-        char c = peek_char(lexer, 0);
-        if (isalnum((unsigned char)c) || c == '_') {
-            advance_char(lexer);
-        } else {
-            break;
-        }
+    // 读取标识符字符（标识符不含换行，直接推进位置与列号）
+    size_t pos = lexer->position;
+    while (pos < lexer->buffer_size && CHAR_IS(lexer->buffer[pos], CC_IDENT)) {
+        pos++;
     }
-    
-    size_t len = (lexer->buffer + lexer->position) - start;
+    size_t len = pos - lexer->position;
+    lexer->position = pos;
+    lexer->column += (int)len;
     
     // 检查标识符长度是否合法
     if (len <= 0 || len > 256) {
@@ -221,22 +278,22 @@ static Token *read_identifier_or_keyword(Lexer *lexer, Arena *arena) {
         return NULL;
     }
     
-    const char *value = arena_strdup(arena, start, len);
-    if (value == NULL) {
-        fprintf(stderr, "错误: 无法为标识符分配内存\n");
-        return NULL;
-    }
-    
-    // 检查是否为关键字
-    TokenType type = is_keyword(value);
+    // 检查是否为关键字（在复制/驻留之前直接从源码分类）
+    TokenType type = is_keyword(start, len);
     
     /* as! 为单 token：识别 "as" 后若下一字符为 '!'，则消费并返回 TOKEN_AS_BANG */
-    if (type == TOKEN_AS && len == 2 && lexer->position < lexer->buffer_size && peek_char(lexer, 0) == '!') {
+    if (type == TOKEN_AS && lexer->position < lexer->buffer_size && peek_char(lexer, 0) == '!') {
         advance_char(lexer);
-        return make_token(arena, TOKEN_AS_BANG, "as!", line, column);
+        return make_token(lexer, arena, TOKEN_AS_BANG, "as!", line, column);
+    }
+    
+    const char *value = intern_string(arena, start, len);
+    if (value == NULL) {
+        fprintf(stderr, "错误: 无法为标识符分配内存\n");
+        return NULL;
     }
     
-    return make_token(arena, type, value, line, column);
+    return make_token(lexer, arena, type, value, line, column);
 }
 
 // 读取数字字面量（整数或浮点数，支持下划线分隔符）
@@ -256,7 +313,7 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
             advance_char(lexer); // 跳过 'x' 或 'X'
             
             // 至少要有一个十六进制数字
-            if (!isxdigit((unsigned char)peek_char(lexer, 0))) {
+            if (!CHAR_IS(peek_char(lexer, 0), CC_HEX)) {
                 fprintf(stderr, "错误: 十六进制字面量至少需要一个数字\n");
                 return NULL;
             }
@@ -265,7 +322,7 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
             char prev_char = 'x';  // 前一个字符，用于检测连续下划线
             while (lexer->position < lexer->buffer_size) {
                 char c = peek_char(lexer, 0);
-                if (isxdigit((unsigned char)c)) {
+                if (CHAR_IS(c, CC_HEX)) {
                     advance_char(lexer);
                     has_digit = 1;
                     prev_char = c;
@@ -293,11 +350,11 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
             }
             
             size_t len = (lexer->buffer + lexer->position) - start;
-            const char *value = arena_strdup(arena, start, len);
+            const char *value = intern_string(arena, start, len);
             if (value == NULL) {
                 return NULL;
             }
-            return make_token(arena, TOKEN_NUMBER, value, line, column);
+            return make_token(lexer, arena, TOKEN_NUMBER, value, line, column);
         }
         
         // 八进制：0o 或 0O
@@ -327,7 +384,7 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
                     }
                     advance_char(lexer);
                     prev_char = '_';
-                } else if (isdigit((unsigned char)c)) {
+                } else if (CHAR_IS(c, CC_DIGIT)) {
                     fprintf(stderr, "错误: 八进制字面量包含非法数字 '%c'\n", c);
                     return NULL;
                 } else {
@@ -346,11 +403,11 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
             }
             
             size_t len = (lexer->buffer + lexer->position) - start;
-            const char *value = arena_strdup(arena, start, len);
+            const char *value = intern_string(arena, start, len);
             if (value == NULL) {
                 return NULL;
             }
-            return make_token(arena, TOKEN_NUMBER, value, line, column);
+            return make_token(lexer, arena, TOKEN_NUMBER, value, line, column);
         }
         
         // 二进制：0b 或 0B
@@ -380,7 +437,7 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
                     }
                     advance_char(lexer);
                     prev_char = '_';
-                } else if (isdigit((unsigned char)c)) {
+                } else if (CHAR_IS(c, CC_DIGIT)) {
                     fprintf(stderr, "错误: 二进制字面量包含非法数字 '%c'\n", c);
                     return NULL;
                 } else {
@@ -399,11 +456,11 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
             }
             
             size_t len = (lexer->buffer + lexer->position) - start;
-            const char *value = arena_strdup(arena, start, len);
+            const char *value = intern_string(arena, start, len);
             if (value == NULL) {
                 return NULL;
             }
-            return make_token(arena, TOKEN_NUMBER, value, line, column);
+            return make_token(lexer, arena, TOKEN_NUMBER, value, line, column);
         }
     }
     
@@ -412,7 +469,7 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
     char prev_char = '\0';
     while (lexer->position < lexer->buffer_size) {
         char c = peek_char(lexer, 0);
-        if (isdigit((unsigned char)c)) {
+        if (CHAR_IS(c, CC_DIGIT)) {
             advance_char(lexer);
             prev_char = c;
         } else if (c == '_') {
@@ -445,7 +502,7 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
         
         while (lexer->position < lexer->buffer_size) {
             char c = peek_char(lexer, 0);
-            if (isdigit((unsigned char)c)) {
+            if (CHAR_IS(c, CC_DIGIT)) {
                 advance_char(lexer);
                 prev_char = c;
             } else if (c == '_') {
@@ -484,13 +541,13 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
             prev_char = '+';  // 或 '-'，标记为符号位
         }
         
-        if (!isdigit((unsigned char)peek_char(lexer, 0))) {
+        if (!CHAR_IS(peek_char(lexer, 0), CC_DIGIT)) {
             return NULL;  /* 指数后必须有数字 */
         }
         
         while (lexer->position < lexer->buffer_size) {
             char c = peek_char(lexer, 0);
-            if (isdigit((unsigned char)c)) {
+            if (CHAR_IS(c, CC_DIGIT)) {
                 advance_char(lexer);
                 prev_char = c;
             } else if (c == '_') {
@@ -513,12 +570,12 @@ static Token *read_number(Lexer *lexer, Arena *arena) {
     }
     
     size_t len = (lexer->buffer + lexer->position) - start;
-    const char *value = arena_strdup(arena, start, len);
+    const char *value = intern_string(arena, start, len);
     if (value == NULL) {
         return NULL;
     }
     
-    return make_token(arena, is_float ? TOKEN_FLOAT : TOKEN_NUMBER, value, line, column);
+    return make_token(lexer, arena, is_float ? TOKEN_FLOAT : TOKEN_NUMBER, value, line, column);
 }
 
 // 在字符串插值模式下读取一个逻辑字符（处理转义），追加到 string_text_buffer，成功返回 0，失败返回 -1
@@ -581,7 +638,7 @@ top_of_token:
             return NULL;
         }
         lexer->string_text_buffer[lexer->string_text_len] = '\0';
-        const char *spec_value = arena_strdup(arena, lexer->string_text_buffer, lexer->string_text_len);
+        const char *spec_value = intern_string(arena, lexer->string_text_buffer, lexer->string_text_len);
         if (spec_value == NULL) {
             return NULL;
         }
@@ -589,7 +646,7 @@ top_of_token:
         lexer->interp_depth = 0;
         lexer->reading_spec = 0;
         lexer->pending_interp_open = 0;  /* 插值段结束，避免下一 token 误走 pending_interp_open */
-        return make_token(arena, TOKEN_INTERP_SPEC, spec_value, line, column);
+        return make_token(lexer, arena, TOKEN_INTERP_SPEC, spec_value, line, column);
     }
     
     if (lexer->pending_interp_open) {
@@ -601,7 +658,7 @@ top_of_token:
         advance_char(lexer);
         lexer->pending_interp_open = 0;
         lexer->interp_depth = 1;
-        return make_token(arena, TOKEN_INTERP_OPEN, NULL, line, column);
+        return make_token(lexer, arena, TOKEN_INTERP_OPEN, NULL, line, column);
     }
     
     if (lexer->interp_depth > 0) {
@@ -609,7 +666,7 @@ top_of_token:
         if (p == '}') {
             advance_char(lexer);
             lexer->interp_depth = 0;
-            return make_token(arena, TOKEN_INTERP_CLOSE, NULL, lexer->line, lexer->column);
+            return make_token(lexer, arena, TOKEN_INTERP_CLOSE, NULL, lexer->line, lexer->column);
         }
         if (p == ':') {
             advance_char(lexer);
@@ -626,7 +683,7 @@ top_of_token:
                 return NULL;
             }
             lexer->string_text_buffer[lexer->string_text_len] = '\0';
-            const char *spec_value = arena_strdup(arena, lexer->string_text_buffer, lexer->string_text_len);
+            const char *spec_value = intern_string(arena, lexer->string_text_buffer, lexer->string_text_len);
             if (spec_value == NULL) {
                 return NULL;
             }
@@ -634,7 +691,7 @@ top_of_token:
             lexer->interp_depth = 0;
             lexer->pending_interp_open = 0;  /* 同上 */
             lexer->reading_spec = 0;  /* 避免下次 next_token 误入 reading_spec 分支再返回错误 INTERP_SPEC */
-            return make_token(arena, TOKEN_INTERP_SPEC, spec_value, line, column);
+            return make_token(lexer, arena, TOKEN_INTERP_SPEC, spec_value, line, column);
         }
     }
     
@@ -646,13 +703,13 @@ top_of_token:
             if (p == '`') {
                 // 遇到结束反引号
                 lexer->string_text_buffer[lexer->string_text_len] = '\0';
-                const char *value = arena_strdup(arena, lexer->string_text_buffer, lexer->string_text_len);
+                const char *value = intern_string(arena, lexer->string_text_buffer, lexer->string_text_len);
                 if (value == NULL) {
                     return NULL;
                 }
                 advance_char(lexer);
                 lexer->raw_string_mode = 0;
-                return make_token(arena, TOKEN_RAW_STRING, value, line, column);
+                return make_token(lexer, arena, TOKEN_RAW_STRING, value, line, column);
             }
             // 原始字符串：所有字符按字面量处理，不转义
             if (lexer->string_text_len >= LEXER_STRING_INTERP_BUFFER_SIZE - 1) {
@@ -676,38 +733,38 @@ top_of_token:
             if (p == '"') {
                 if (!lexer->has_seen_interp_in_string) {
                     lexer->string_text_buffer[lexer->string_text_len] = '\0';
-                    const char *value = arena_strdup(arena, lexer->string_text_buffer, lexer->string_text_len);
+                    const char *value = intern_string(arena, lexer->string_text_buffer, lexer->string_text_len);
                     if (value == NULL) {
                         return NULL;
                     }
                     advance_char(lexer);
                     lexer->string_mode = 0;
-                    return make_token(arena, TOKEN_STRING, value, line, column);
+                    return make_token(lexer, arena, TOKEN_STRING, value, line, column);
                 }
                 if (lexer->string_text_len > 0) {
                     lexer->string_text_buffer[lexer->string_text_len] = '\0';
-                    const char *value = arena_strdup(arena, lexer->string_text_buffer, lexer->string_text_len);
+                    const char *value = intern_string(arena, lexer->string_text_buffer, lexer->string_text_len);
                     if (value == NULL) {
                         return NULL;
                     }
                     lexer->string_text_len = 0;
-                    return make_token(arena, TOKEN_INTERP_TEXT, value, line, column);
+                    return make_token(lexer, arena, TOKEN_INTERP_TEXT, value, line, column);
                 }
                 advance_char(lexer);
                 lexer->string_mode = 0;
                 lexer->has_seen_interp_in_string = 0;
-                return make_token(arena, TOKEN_INTERP_END, NULL, lexer->line, lexer->column);
+                return make_token(lexer, arena, TOKEN_INTERP_END, NULL, lexer->line, lexer->column);
             }
             if (p == '$' && peek_char(lexer, 1) == '{') {
                 lexer->has_seen_interp_in_string = 1;
                 lexer->pending_interp_open = 1;
                 lexer->string_text_buffer[lexer->string_text_len] = '\0';
-                const char *value = arena_strdup(arena, lexer->string_text_buffer, lexer->string_text_len);
+                const char *value = intern_string(arena, lexer->string_text_buffer, lexer->string_text_len);
                 if (value == NULL) {
                     return NULL;
                 }
                 lexer->string_text_len = 0;
-                return make_token(arena, TOKEN_INTERP_TEXT, value, line, column);
+                return make_token(lexer, arena, TOKEN_INTERP_TEXT, value, line, column);
             }
             if (read_string_char_into_buffer(lexer) != 0) {
                 return NULL;
@@ -726,7 +783,7 @@ top_of_token:
     
     // 检查是否到达文件末尾
     if (lexer->position >= lexer->buffer_size) {
-        return make_token(arena, TOKEN_EOF, NULL, lexer->line, lexer->column);
+        return make_token(lexer, arena, TOKEN_EOF, NULL, lexer->line, lexer->column);
     }
     
     char c = peek_char(lexer, 0);
@@ -741,172 +798,172 @@ top_of_token:
             advance_char(lexer);
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_PLUS_ASSIGN, "+=", line, column);
+                return make_token(lexer, arena, TOKEN_PLUS_ASSIGN, "+=", line, column);
             }
             if (peek_char(lexer, 0) == '|') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_PLUS_PIPE, "+|", line, column);
+                return make_token(lexer, arena, TOKEN_PLUS_PIPE, "+|", line, column);
             }
             if (peek_char(lexer, 0) == '%') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_PLUS_PERCENT, "+%", line, column);
+                return make_token(lexer, arena, TOKEN_PLUS_PERCENT, "+%", line, column);
             }
-            return make_token(arena, TOKEN_PLUS, "+", line, column);
+            return make_token(lexer, arena, TOKEN_PLUS, "+", line, column);
         case '-':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_MINUS_ASSIGN, "-=", line, column);
+                return make_token(lexer, arena, TOKEN_MINUS_ASSIGN, "-=", line, column);
             }
             if (peek_char(lexer, 0) == '|') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_MINUS_PIPE, "-|", line, column);
+                return make_token(lexer, arena, TOKEN_MINUS_PIPE, "-|", line, column);
             }
             if (peek_char(lexer, 0) == '%') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_MINUS_PERCENT, "-%", line, column);
+                return make_token(lexer, arena, TOKEN_MINUS_PERCENT, "-%", line, column);
             }
-            return make_token(arena, TOKEN_MINUS, "-", line, column);
+            return make_token(lexer, arena, TOKEN_MINUS, "-", line, column);
         case '*':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_ASTERISK_ASSIGN, "*=", line, column);
+                return make_token(lexer, arena, TOKEN_ASTERISK_ASSIGN, "*=", line, column);
             }
             if (peek_char(lexer, 0) == '|') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_ASTERISK_PIPE, "*|", line, column);
+                return make_token(lexer, arena, TOKEN_ASTERISK_PIPE, "*|", line, column);
             }
             if (peek_char(lexer, 0) == '%') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_ASTERISK_PERCENT, "*%", line, column);
+                return make_token(lexer, arena, TOKEN_ASTERISK_PERCENT, "*%", line, column);
             }
-            return make_token(arena, TOKEN_ASTERISK, "*", line, column);
+            return make_token(lexer, arena, TOKEN_ASTERISK, "*", line, column);
         case '/':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_SLASH_ASSIGN, "/=", line, column);
+                return make_token(lexer, arena, TOKEN_SLASH_ASSIGN, "/=", line, column);
             }
-            return make_token(arena, TOKEN_SLASH, "/", line, column);
+            return make_token(lexer, arena, TOKEN_SLASH, "/", line, column);
         case '%':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_PERCENT_ASSIGN, "%=", line, column);
+                return make_token(lexer, arena, TOKEN_PERCENT_ASSIGN, "%=", line, column);
             }
-            return make_token(arena, TOKEN_PERCENT, "%", line, column);
+            return make_token(lexer, arena, TOKEN_PERCENT, "%", line, column);
         case '=':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '>') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_FAT_ARROW, "=>", line, column);
+                return make_token(lexer, arena, TOKEN_FAT_ARROW, "=>", line, column);
             }
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_EQUAL, "==", line, column);
+                return make_token(lexer, arena, TOKEN_EQUAL, "==", line, column);
             }
-            return make_token(arena, TOKEN_ASSIGN, "=", line, column);
+            return make_token(lexer, arena, TOKEN_ASSIGN, "=", line, column);
         case '!':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_NOT_EQUAL, "!=", line, column);
+                return make_token(lexer, arena, TOKEN_NOT_EQUAL, "!=", line, column);
             }
-            return make_token(arena, TOKEN_EXCLAMATION, "!", line, column);
+            return make_token(lexer, arena, TOKEN_EXCLAMATION, "!", line, column);
         case '<':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '<') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_LSHIFT, "<<", line, column);
+                return make_token(lexer, arena, TOKEN_LSHIFT, "<<", line, column);
             }
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_LESS_EQUAL, "<=", line, column);
+                return make_token(lexer, arena, TOKEN_LESS_EQUAL, "<=", line, column);
             }
-            return make_token(arena, TOKEN_LESS, "<", line, column);
+            return make_token(lexer, arena, TOKEN_LESS, "<", line, column);
         case '>':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '>') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_RSHIFT, ">>", line, column);
+                return make_token(lexer, arena, TOKEN_RSHIFT, ">>", line, column);
             }
             if (peek_char(lexer, 0) == '=') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_GREATER_EQUAL, ">=", line, column);
+                return make_token(lexer, arena, TOKEN_GREATER_EQUAL, ">=", line, column);
             }
-            return make_token(arena, TOKEN_GREATER, ">", line, column);
+            return make_token(lexer, arena, TOKEN_GREATER, ">", line, column);
         case '^':
             advance_char(lexer);
-            return make_token(arena, TOKEN_CARET, "^", line, column);
+            return make_token(lexer, arena, TOKEN_CARET, "^", line, column);
         case '~':
             advance_char(lexer);
-            return make_token(arena, TOKEN_TILDE, "~", line, column);
+            return make_token(lexer, arena, TOKEN_TILDE, "~", line, column);
         case '&':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '&') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_LOGICAL_AND, "&&", line, column);
+                return make_token(lexer, arena, TOKEN_LOGICAL_AND, "&&", line, column);
             }
             // 单个 & 是取地址运算符
-            return make_token(arena, TOKEN_AMPERSAND, "&", line, column);
+            return make_token(lexer, arena, TOKEN_AMPERSAND, "&", line, column);
         case '|':
             advance_char(lexer);
             if (peek_char(lexer, 0) == '|') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_LOGICAL_OR, "||", line, column);
+                return make_token(lexer, arena, TOKEN_LOGICAL_OR, "||", line, column);
             }
             // 单个 | 用于 for 循环（for expr | ID | { ... }）
-            return make_token(arena, TOKEN_PIPE, "|", line, column);
+            return make_token(lexer, arena, TOKEN_PIPE, "|", line, column);
         case '(':
             advance_char(lexer);
-            return make_token(arena, TOKEN_LEFT_PAREN, "(", line, column);
+            return make_token(lexer, arena, TOKEN_LEFT_PAREN, "(", line, column);
         case ')':
             advance_char(lexer);
-            return make_token(arena, TOKEN_RIGHT_PAREN, ")", line, column);
+            return make_token(lexer, arena, TOKEN_RIGHT_PAREN, ")", line, column);
         case '{':
             advance_char(lexer);
-            return make_token(arena, TOKEN_LEFT_BRACE, "{", line, column);
+            return make_token(lexer, arena, TOKEN_LEFT_BRACE, "{", line, column);
         case '}':
             advance_char(lexer);
-            return make_token(arena, TOKEN_RIGHT_BRACE, "}", line, column);
+            return make_token(lexer, arena, TOKEN_RIGHT_BRACE, "}", line, column);
         case '[':
             advance_char(lexer);
-            return make_token(arena, TOKEN_LEFT_BRACKET, "[", line, column);
+            return make_token(lexer, arena, TOKEN_LEFT_BRACKET, "[", line, column);
         case ']':
             advance_char(lexer);
-            return make_token(arena, TOKEN_RIGHT_BRACKET, "]", line, column);
+            return make_token(lexer, arena, TOKEN_RIGHT_BRACKET, "]", line, column);
         case ';':
             advance_char(lexer);
-            return make_token(arena, TOKEN_SEMICOLON, ";", line, column);
+            return make_token(lexer, arena, TOKEN_SEMICOLON, ";", line, column);
         case ',':
             advance_char(lexer);
-            return make_token(arena, TOKEN_COMMA, ",", line, column);
+            return make_token(lexer, arena, TOKEN_COMMA, ",", line, column);
         case '.':
             advance_char(lexer);
             // 检查是否为 ...（可变参数）
             if (peek_char(lexer, 0) == '.' && peek_char(lexer, 1) == '.') {
                 advance_char(lexer);  // 消费第二个 .
                 advance_char(lexer);  // 消费第三个 .
-                return make_token(arena, TOKEN_ELLIPSIS, "...", line, column);
+                return make_token(lexer, arena, TOKEN_ELLIPSIS, "...", line, column);
             }
             // 检查是否为 ..（范围，用于 for start..end）
             if (peek_char(lexer, 0) == '.') {
                 advance_char(lexer);
-                return make_token(arena, TOKEN_DOT_DOT, "..", line, column);
+                return make_token(lexer, arena, TOKEN_DOT_DOT, "..", line, column);
             }
-            return make_token(arena, TOKEN_DOT, ".", line, column);
+            return make_token(lexer, arena, TOKEN_DOT, ".", line, column);
         case ':':
             advance_char(lexer);
-            return make_token(arena, TOKEN_COLON, ":", line, column);
+            return make_token(lexer, arena, TOKEN_COLON, ":", line, column);
         case '@':
             advance_char(lexer);
             // @ 后必须是标识符（内置函数名）
-            if (isalpha((unsigned char)peek_char(lexer, 0)) || peek_char(lexer, 0) == '_') {
+            if (CHAR_IS(peek_char(lexer, 0), CC_IDENT_START)) {
                 const char *start = lexer->buffer + lexer->position;
                 while (lexer->position < lexer->buffer_size) {
                     char c = peek_char(lexer, 0);
-                    if (isalnum((unsigned char)c) || c == '_') {
+                    if (CHAR_IS(c, CC_IDENT)) {
                         advance_char(lexer);
                     } else {
                         break;
@@ -917,7 +974,7 @@ top_of_token:
                     fprintf(stderr, "错误: @ 后标识符长度无效 (%zu)\n", len);
                     return NULL;
                 }
-                const char *value = arena_strdup(arena, start, len);
+                const char *value = intern_string(arena, start, len);
                 if (value == NULL) {
                     fprintf(stderr, "错误: 无法为 @ 标识符分配内存\n");
                     return NULL;
@@ -933,7 +990,7 @@ top_of_token:
                     strcmp(value, "async_fn") == 0 || strcmp(value, "await") == 0 ||  // 异步编程
                     strcmp(value, "mc_eval") == 0 || strcmp(value, "mc_code") == 0 ||
                     strcmp(value, "mc_ast") == 0 || strcmp(value, "mc_error") == 0 || strcmp(value, "mc_get_env") == 0) {
-                    return make_token(arena, TOKEN_AT_IDENTIFIER, value, line, column);
+                    return make_token(lexer, arena, TOKEN_AT_IDENTIFIER, value, line, column);
                 }
                 // 检查是否为宏编译时内置函数（@mc_*）
         if (strncmp(value, "mc_", 3) == 0) {
@@ -941,7 +998,7 @@ top_of_token:
                     if (strcmp(mc_func, "eval") == 0 || strcmp(mc_func, "type") == 0 ||
                         strcmp(mc_func, "ast") == 0 || strcmp(mc_func, "code") == 0 ||
                         strcmp(mc_func, "error") == 0 || strcmp(mc_func, "get_env") == 0) {
-                        return make_token(arena, TOKEN_AT_IDENTIFIER, value, line, column);
+                        return make_token(lexer, arena, TOKEN_AT_IDENTIFIER, value, line, column);
                     }
                 }
                 fprintf(stderr, "错误: 未知内置 @%s，支持：@size_of、@align_of、@len、@max、@min、@params、@src_name、@src_path、@src_line、@src_col、@func_name、@syscall、@async_fn、@await、@mc_eval、@mc_type、@mc_ast、@mc_code、@mc_error、@mc_get_env\n", value);
@@ -967,7 +1024,7 @@ top_of_token:
             if (peek_char(lexer, 1) == '{') {
                 advance_char(lexer);  // 消费 $
                 advance_char(lexer);  // 消费 {
-                return make_token(arena, TOKEN_INTERP_OPEN, "${", line, column);
+                return make_token(lexer, arena, TOKEN_INTERP_OPEN, "${", line, column);
             }
             // 单独的 $ 是非法的
             {
@@ -976,12 +1033,12 @@ top_of_token:
                         filename, line, column);
                 fprintf(stderr, "提示: 在宏内使用 ${var} 来引用参数或变量\n");
                 advance_char(lexer);
-                return make_token(arena, TOKEN_EOF, NULL, line, column);
+                return make_token(lexer, arena, TOKEN_EOF, NULL, line, column);
             }
         default:
-            if (isalpha((unsigned char)c) || c == '_') {
+            if (CHAR_IS(c, CC_IDENT_START)) {
                 return read_identifier_or_keyword(lexer, arena);
-            } else if (isdigit((unsigned char)c)) {
+            } else if (CHAR_IS(c, CC_DIGIT)) {
                 return read_number(lexer, arena);
             } else {
                 // 未知字符，输出错误信息并返回 EOF 作为错误标记
@@ -995,7 +1052,7 @@ top_of_token:
                 fprintf(stderr, "' (ASCII %d)\n", (unsigned char)c);
                 fprintf(stderr, "提示: Uya Mini 不支持此字符。如果是三元运算符 '?'，请使用 if-else 语句替代。\n");
                 advance_char(lexer);
-                return make_token(arena, TOKEN_EOF, NULL, line, column);
+                return make_token(lexer, arena, TOKEN_EOF, NULL, line, column);
             }
     }
 }
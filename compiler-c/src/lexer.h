@@ -125,16 +125,15 @@ typedef struct Token {
     int column;             // 列号
 } Token;
 
-// Lexer 结构体
-// 使用固定大小缓冲区，不分配堆内存
-#define LEXER_BUFFER_SIZE (1024 * 1024)  // 1MB 缓冲区大小
-
 // 字符串插值内部缓冲区大小
 #define LEXER_STRING_INTERP_BUFFER_SIZE 4096
 
+// Lexer 结构体
+// 源代码不复制：buffer 借用调用者提供的内存（如 mmap 映射的文件），长度不受限制，
+// 调用者需保证其在词法/语法分析期间有效；Token 与 AST 中的字符串均已驻留到 Arena
 typedef struct Lexer {
-    char buffer[LEXER_BUFFER_SIZE];  // 源代码缓冲区（固定大小数组）
-    size_t buffer_size;              // 缓冲区实际大小（字节数）
+    const char *buffer;              // 源代码（借用，不要求以 '\0' 结尾）
+    size_t buffer_size;              // 源代码长度（字节数）
     size_t position;                 // 当前读取位置
     int line;                        // 当前行号（从1开始）
     int column;                      // 当前列号（从1开始）
@@ -147,14 +146,15 @@ typedef struct Lexer {
     int pending_interp_open;         // 1 表示已返回 INTERP_TEXT，下一 token 应为 INTERP_OPEN
     int reading_spec;                 // 1 表示正在读取 :spec 直到 }
     int has_seen_interp_in_string;   // 当前字符串中是否出现过 ${
-    char string_text_buffer[LEXER_STRING_INTERP_BUFFER_SIZE];  // 当前文本段缓冲
+    char *string_text_buffer;        // 当前文本段缓冲（LEXER_STRING_INTERP_BUFFER_SIZE 字节，从 Arena 分配）
     size_t string_text_len;           // 当前文本段长度
+    Arena *token_arena;              // Token 结构体所用 Arena（NULL 表示使用 lexer_next_token 的 arena；字符串值始终驻留在后者）
 } Lexer;
 
 // 初始化 Lexer
-// 参数：lexer - Lexer 结构体指针（由调用者提供，栈上或静态分配），source - 源代码字符串，source_len - 源代码长度，filename - 文件名（存储在 Arena 中），arena - Arena 分配器
+// 参数：lexer - Lexer 结构体指针（由调用者提供，栈上或静态分配），source - 源代码（借用，不复制），source_len - 源代码长度，filename - 文件名（存储在 Arena 中），arena - Arena 分配器
 // 返回：成功返回 0，失败返回 -1
-// 注意：Lexer 结构体由调用者在栈上或静态分配，此函数只负责初始化
+// 注意：Lexer 结构体由调用者在栈上或静态分配，此函数只负责初始化；source 在解析结束前必须保持有效
 int lexer_init(Lexer *lexer, const char *source, size_t source_len, const char *filename, Arena *arena);
 
 // 获取下一个 Token
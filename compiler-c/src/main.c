@@ -4,6 +4,8 @@
 #include <string.h>
 #include <unistd.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <limits.h>
 #include <dirent.h>
 #include "arena.h"
@@ -11,61 +13,129 @@
 #include "parser.h"
 #include "checker.h"
 #include "codegen_c99.h"
+#include "thread_pool.h"
+#include "build_cache.h"
+#include "time_report.h"
+#include "compile_server.h"
 
 // 如果 PATH_MAX 未定义，定义它
 #ifndef PATH_MAX
 #define PATH_MAX 4096
 #endif
 
-// 文件读取缓冲区大小（与Lexer的缓冲区大小相同）
-#define FILE_BUFFER_SIZE (1024 * 1024)  // 1MB
-
-// Arena 分配器缓冲区大小
-// 注意：编译大型文件和多文件编译需要更大的缓冲区
-// 多文件编译时，所有文件的 AST 节点都存储在同一个 Arena 中
-// 使用 32MB 以支持大型函数和多文件编译（gen_expr 等函数很大，需要更多内存）
-// 自举编译增加了泛型结构体方法单态化支持，需要更大的缓冲区
+// Arena 初始缓冲区大小
+// 多文件编译时，所有文件的 AST 节点与类型信息都存储在同一个 Arena 中
+// 初始缓冲区用完后 Arena 会按需映射新块，这里只决定常见规模下不需要额外映射
 #define ARENA_BUFFER_SIZE (32 * 1024 * 1024)  // 32MB
 
+// Token Arena 初始缓冲区大小（Token 结构体只在解析单个文件期间存活，每个文件解析后回收）
+#define TOKEN_ARENA_BUFFER_SIZE (1024 * 1024)  // 1MB
+
 // 最大输入文件数量
 #define MAX_INPUT_FILES 64
 
 // 全局缓冲区（替代 malloc）
 static uint8_t arena_buffer[ARENA_BUFFER_SIZE];  // Arena 分配器缓冲区
-static char file_buffer[FILE_BUFFER_SIZE];        // 文件读取缓冲区
-static uint8_t temp_arena_buffer[32 * 1024 * 1024];  // 32MB 临时缓冲区（用于依赖收集，全局变量避免栈溢出）
+static uint8_t token_arena_buffer[TOKEN_ARENA_BUFFER_SIZE];  // Token Arena 缓冲区
 
-// 读取文件内容到缓冲区
-// 参数：filename - 文件名
-//       buffer - 缓冲区（固定大小数组）
-//       buffer_size - 缓冲区大小
-// 返回：成功返回读取的字节数，失败返回-1
-// 注意：文件大小不能超过缓冲区大小
-static int read_file_content(const char *filename, char *buffer, size_t buffer_size) {
-    FILE *file = fopen(filename, "rb");  // 二进制模式读取
-    if (file == NULL) {
+// 单个文件的解析结果
+typedef enum {
+    PARSE_PENDING,          // 尚未解析
+    PARSE_OK,               // 解析成功
+    PARSE_ERR_OPEN,         // 无法读取文件
+    PARSE_ERR_LEXER_INIT,   // Lexer 初始化失败
+    PARSE_ERR_PARSER_INIT,  // Parser 初始化失败
+    PARSE_ERR_SYNTAX,       // 语法分析失败（含词法错误）
+    PARSE_ERR_NOT_PROGRAM   // 解析结果不是程序节点
+} ParseStatus;
+
+// 解析计数（--time-report）
+typedef struct ParseCounts {
+    size_t tokens;          // Token 数量
+    size_t nodes;           // AST 节点数量
+} ParseCounts;
+
+// 编译服务（--server）启动时预解析的模块
+// 服务进程解析 UYA_ROOT 下的全部模块，请求子进程 fork 后写时复制地继承这些 AST：
+// 类型检查会就地修改 AST，但修改只发生在各自的子进程中，不影响服务进程与其他请求
+typedef struct WarmModule {
+    uint64_t hash;          // 预解析时的文件内容哈希（请求时重新哈希，文件变化则重新解析）
+    ASTNode *program;       // AST_PROGRAM 节点
+    ParseCounts counts;     // 解析计数（--time-report 时计入请求的统计）
+} WarmModule;
+
+// 预解析的模块：文件路径（与 find_module_file 构造的路径字符串相同）-> WarmModule
+static HashMap warm_modules;
+static int warm_modules_ready = 0;
+
+// 并行解析上下文（-jN）：每个工作线程使用私有的 AST/Token Arena，
+// 结果按文件下标写回，汇总与报错顺序与串行解析一致
+typedef struct ParseJobs {
+    const char **files;             // 所有文件
+    ASTNode **programs;             // 输出：解析结果（与 files 下标对应）
+    ParseStatus *status;            // 输出：解析状态（与 files 下标对应）
+    const int *pending;             // 待解析的文件下标
+    Arena *arenas;                  // 每个工作线程的 AST Arena
+    Arena *token_arenas;            // 每个工作线程的 Token Arena
+    ParseCounts *counts;            // 每个工作线程的解析计数
+} ParseJobs;
+
+// -jN 的解析工作线程：依赖收集与词法/语法分析阶段共用，Arena 在首次并行解析时初始化
+typedef struct ParseWorkers {
+    int count;                                          // 已初始化的工作线程数量
+    Arena arenas[THREAD_POOL_MAX_WORKERS];              // AST Arena（AST 生命周期与主 Arena 相同，不回收）
+    Arena token_arenas[THREAD_POOL_MAX_WORKERS];        // Token Arena
+    ParseCounts counts[THREAD_POOL_MAX_WORKERS];        // 解析计数
+} ParseWorkers;
+
+// 源文件映射：只读 mmap 整个文件，直接借给 Lexer 使用（不复制，不限制文件大小）
+typedef struct SourceFile {
+    const char *data;       // 文件内容（不以 '\0' 结尾；空文件时指向空字符串）
+    size_t size;            // 文件大小（字节）
+    int mapped;             // 1 表示 data 来自 mmap，需要 munmap
+} SourceFile;
+
+// 打开并映射源文件
+// 参数：filename - 文件名，source - 输出的映射信息
+// 返回：成功返回0，失败返回-1（文件不存在或不是普通文件）
+static int source_file_open(const char *filename, SourceFile *source) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
         return -1;
     }
 
-    // 读取文件内容（保留一个字节用于'\0'）
-    size_t bytes_read = fread(buffer, 1, buffer_size - 1, file);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return -1;
+    }
 
-    // 检查是否还有更多数据（文件太大）
-    if (bytes_read >= buffer_size - 1) {
-        int c = fgetc(file);
-        fclose(file);
-        if (c != EOF) {
-            // 文件还有更多数据，文件太大
+    source->size = (size_t)st.st_size;
+    source->mapped = 0;
+    source->data = "";
+    if (source->size > 0) {
+        void *data = mmap(NULL, source->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
             return -1;
         }
-    } else {
-        fclose(file);
+        source->data = (const char *)data;
+        source->mapped = 1;
     }
 
-    // 添加字符串结束符
-    buffer[bytes_read] = '\0';
+    // 映射建立后即可关闭文件描述符
+    close(fd);
+    return 0;
+}
 
-    return (int)bytes_read;
+// 解除源文件映射（Token 与 AST 中的字符串均已驻留到 Arena，解析结束后即可释放）
+static void source_file_close(SourceFile *source) {
+    if (source->mapped) {
+        munmap((void *)source->data, source->size);
+    }
+    source->data = "";
+    source->size = 0;
+    source->mapped = 0;
 }
 
 // 获取编译器程序所在目录
@@ -403,21 +473,22 @@ static int detect_main_function(const char *filename) {
         return 0;
     }
     
-    int file_size = read_file_content(filename, file_buffer, FILE_BUFFER_SIZE);
-    if (file_size < 0) {
+    SourceFile source;
+    if (source_file_open(filename, &source) != 0) {
         return 0;
     }
     
     // 简单的字符串搜索（查找 "fn main("）
-    const char *p = file_buffer;
-    while (*p != '\0') {
-        if (strncmp(p, "fn main(", 8) == 0) {
-            return 1;
+    int found = 0;
+    for (size_t i = 0; i + 8 <= source.size; i++) {
+        if (memcmp(source.data + i, "fn main(", 8) == 0) {
+            found = 1;
+            break;
         }
-        p++;
     }
     
-    return 0;
+    source_file_close(&source);
+    return found;
 }
 
 // 在目录中查找包含 main 函数的文件
@@ -461,132 +532,357 @@ static int find_main_files_in_dir(const char *dir_path, const char *main_files[]
     return 0;
 }
 
-// 递归收集模块依赖
-// 参数：filename - 当前处理的文件
+// 词法/语法分析单个文件
+// 参数：filename - 文件名，arena - AST Arena，token_arena - Token Arena（解析完成后回退），
+//       out - 输出：AST_PROGRAM 节点（有词法错误时仍会输出，但返回 PARSE_ERR_SYNTAX），
+//       counts - 累加 Token 与 AST 节点数量（可为 NULL）
+// 返回：解析状态
+static ParseStatus parse_source_file(const char *filename, Arena *arena, Arena *token_arena, ASTNode **out, ParseCounts *counts) {
+    // 编译服务：文件内容未变化时直接使用预解析的 AST
+    if (warm_modules_ready) {
+        const WarmModule *warm = (const WarmModule *)hash_map_get(&warm_modules, filename);
+        uint64_t hash = 0;
+        if (warm != NULL && build_cache_hash_file(filename, &hash, NULL) == 0 && hash == warm->hash) {
+            *out = warm->program;
+            if (counts != NULL) {
+                counts->tokens += warm->counts.tokens;
+                counts->nodes += warm->counts.nodes;
+            }
+            return PARSE_OK;
+        }
+    }
+
+    SourceFile source;
+    if (source_file_open(filename, &source) != 0) {
+        return PARSE_ERR_OPEN;
+    }
+
+    Lexer lexer;
+    if (lexer_init(&lexer, source.data, source.size, filename, arena) != 0) {
+        source_file_close(&source);
+        return PARSE_ERR_LEXER_INIT;
+    }
+    lexer.token_arena = token_arena;
+
+    Parser parser;
+    if (parser_init(&parser, &lexer, arena) != 0) {
+        source_file_close(&source);
+        return PARSE_ERR_PARSER_INIT;
+    }
+
+    ArenaMark token_mark = arena_mark(token_arena);
+    ASTNode *ast = parser_parse(&parser);
+    source_file_close(&source);
+    arena_rewind(token_arena, token_mark);
+    if (counts != NULL) {
+        counts->tokens += (size_t)parser.token_count;
+        counts->nodes += (size_t)parser.node_count;
+    }
+    if (ast == NULL) {
+        return PARSE_ERR_SYNTAX;
+    }
+
+    if (ast->type != AST_PROGRAM) {
+        return PARSE_ERR_NOT_PROGRAM;
+    }
+
+    *out = ast;
+    
+    // 检查词法分析错误（如未闭合块注释）
+    if (lexer.has_error) {
+        return PARSE_ERR_SYNTAX;
+    }
+    return PARSE_OK;
+}
+
+// 报告解析错误
+// 参数：status - 解析状态，filename - 文件名
+static void report_parse_error(ParseStatus status, const char *filename) {
+    switch (status) {
+        case PARSE_ERR_OPEN:
+            fprintf(stderr, "错误: 无法读取文件 '%s' (文件不存在或不是普通文件)\n", filename);
+            break;
+        case PARSE_ERR_LEXER_INIT:
+            fprintf(stderr, "错误: Lexer 初始化失败: %s (可能 Arena 内存不足)\n", filename);
+            break;
+        case PARSE_ERR_PARSER_INIT:
+            fprintf(stderr, "错误: Parser 初始化失败: %s (可能 Arena 内存不足)\n", filename);
+            break;
+        case PARSE_ERR_NOT_PROGRAM:
+            fprintf(stderr, "错误: 解析结果不是程序节点: %s\n", filename);
+            break;
+        default:
+            fprintf(stderr, "错误: 语法分析失败: %s\n", filename);
+            break;
+    }
+}
+
+// 递归预解析目录中的模块（编译服务启动时调用）
+// 模块路径按 find_module_file 的方式拼接（目录 + 文件名），请求中查找模块得到的路径字符串与之相同
+// 参数：dir - 目录路径（以 '/' 结尾），arena - AST Arena，token_arena - Token Arena
+// 返回：预解析的模块数量（有语法错误的模块不预解析，请求时照常解析并报错）
+static int warm_modules_load_dir(const char *dir, Arena *arena, Arena *token_arena) {
+    DIR *d = opendir(dir);
+    if (d == NULL) {
+        return 0;
+    }
+    int count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        const char *name = entry->d_name;
+        size_t name_len = strlen(name);
+        if (name[0] == '.') {
+            continue;
+        }
+        char path[PATH_MAX];
+        if (entry->d_type == DT_DIR) {
+            int len = snprintf(path, sizeof(path), "%s%s/", dir, name);
+            if (len > 0 && len < (int)sizeof(path)) {
+                count += warm_modules_load_dir(path, arena, token_arena);
+            }
+            continue;
+        }
+        if (entry->d_type != DT_REG || name_len <= 4 || strcmp(name + name_len - 4, ".uya") != 0) {
+            continue;
+        }
+        int len = snprintf(path, sizeof(path), "%s%s", dir, name);
+        if (len <= 0 || len >= (int)sizeof(path)) {
+            continue;
+        }
+
+        // 解析前后各哈希一次：解析期间文件被修改时不预解析（否则记录的哈希与 AST 不对应）
+        WarmModule *warm = (WarmModule *)arena_alloc(arena, sizeof(WarmModule));
+        char *key = (char *)arena_alloc(arena, (size_t)len + 1);
+        if (warm == NULL || key == NULL) {
+            break;
+        }
+        memcpy(key, path, (size_t)len + 1);
+        warm->counts.tokens = 0;
+        warm->counts.nodes = 0;
+        uint64_t hash_after = 0;
+        ASTNode *program = NULL;
+        if (build_cache_hash_file(key, &warm->hash, NULL) == 0 &&
+            parse_source_file(key, arena, token_arena, &program, &warm->counts) == PARSE_OK &&
+            build_cache_hash_file(key, &hash_after, NULL) == 0 && hash_after == warm->hash) {
+            warm->program = program;
+            hash_map_put(&warm_modules, key, warm);
+            count++;
+        }
+    }
+    closedir(d);
+    return count;
+}
+
+// 并行解析任务：解析 pending[task] 对应的文件到工作线程私有的 Arena
+static void parse_job_run(void *ctx, int worker, int task) {
+    ParseJobs *jobs = (ParseJobs *)ctx;
+    int index = jobs->pending[task];
+    jobs->status[index] = parse_source_file(jobs->files[index], &jobs->arenas[worker],
+                                            &jobs->token_arenas[worker], &jobs->programs[index],
+                                            &jobs->counts[worker]);
+}
+
+// 在线程池上并行解析 pending 中的文件（-jN 且待解析文件多于一个时），工作线程的 Arena 按需初始化
+// 参数：workers - 工作线程状态，jobs - 线程数，files/programs/status - 与 ParseJobs 相同，
+//       pending - 待解析的文件下标，pending_count - 待解析文件数量
+// 返回：并行解析返回 1（结果写入 programs/status），否则返回 0（由调用方串行解析）
+static int parse_files_parallel(ParseWorkers *workers, int jobs, const char **files, ASTNode **programs,
+                                ParseStatus *status, const int *pending, int pending_count) {
+    if (jobs <= 1 || pending_count <= 1) {
+        return 0;
+    }
+    int worker_count = jobs < pending_count ? jobs : pending_count;
+    if (worker_count > THREAD_POOL_MAX_WORKERS) {
+        worker_count = THREAD_POOL_MAX_WORKERS;
+    }
+    for (int w = workers->count; w < worker_count; w++) {
+        arena_init(&workers->arenas[w], NULL, 0);
+        arena_init(&workers->token_arenas[w], NULL, 0);
+        workers->counts[w].tokens = 0;
+        workers->counts[w].nodes = 0;
+    }
+    if (worker_count > workers->count) {
+        workers->count = worker_count;
+    }
+    ParseJobs parse_jobs;
+    parse_jobs.files = files;
+    parse_jobs.programs = programs;
+    parse_jobs.status = status;
+    parse_jobs.pending = pending;
+    parse_jobs.arenas = workers->arenas;
+    parse_jobs.token_arenas = workers->token_arenas;
+    parse_jobs.counts = workers->counts;
+    thread_pool_run(worker_count, pending_count, parse_job_run, &parse_jobs);
+    return 1;
+}
+
+// 依赖扫描结果：入口文件可达的全部模块（按发现顺序）及其 AST 与直接依赖
+typedef struct DepScan {
+    const char *files[MAX_INPUT_FILES];
+    ASTNode *programs[MAX_INPUT_FILES];
+    ParseStatus status[MAX_INPUT_FILES];
+    int *deps[MAX_INPUT_FILES];         // use 语句引用的模块（files 下标，按 use 顺序）
+    int dep_counts[MAX_INPUT_FILES];
+    int added[MAX_INPUT_FILES];         // 重放时是否已加入文件列表
+    int count;
+} DepScan;
+
+// 查找已扫描的文件，不存在返回 -1
+static int dep_scan_find(const DepScan *scan, const char *filename) {
+    for (int i = 0; i < scan->count; i++) {
+        if (paths_equal(scan->files[i], filename)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 按深度优先顺序重放扫描结果：文件列表顺序与逐个递归解析时相同
+static int dep_scan_replay(DepScan *scan, int index, const char *file_list[], ASTNode *programs[],
+                           int file_list_size, int max_files) {
+    for (int i = 0; i < scan->dep_counts[index]; i++) {
+        int dep = scan->deps[index][i];
+        if (scan->added[dep] || file_list_size >= max_files) {
+            continue;
+        }
+        scan->added[dep] = 1;
+        file_list[file_list_size] = scan->files[dep];
+        programs[file_list_size] = scan->status[dep] == PARSE_OK ? scan->programs[dep] : NULL;
+        file_list_size++;
+        file_list_size = dep_scan_replay(scan, dep, file_list, programs, file_list_size, max_files);
+    }
+    return file_list_size;
+}
+
+// 收集模块依赖
+// 按层扫描：每层新发现的模块一起解析（-jN 时在线程池上并行），再从其 use 语句得到下一层；
+// 全部解析完成后按深度优先顺序重放，文件列表顺序与逐个递归解析时相同
+// 参数：filename - 入口文件（已在 file_list 中）
 //       file_list - 输出数组（存储所有需要编译的文件）
+//       programs - 输出数组（与 file_list 下标对应，存储解析得到的 AST_PROGRAM，
+//                  编译阶段直接复用，每个文件只解析一次；有词法错误的文件留空，由编译阶段重新解析并报错）
 //       file_list_size - 文件列表当前大小
 //       max_files - 最大文件数量
-//       processed_files - 已处理的文件列表（避免循环依赖）
-//       processed_count - 已处理文件数量
-//       max_processed - 最大已处理文件数量
 //       project_root - 项目根目录
 //       uya_root - UYA_ROOT 目录
+//       ast_arena - AST Arena（串行解析结果的 AST 与驻留字符串分配在此）
+//       token_arena - Token Arena（每个文件解析完成后回退）
+//       counts - 解析计数（可为 NULL）
+//       workers - 并行解析的工作线程，jobs - 线程数（-jN）
 //       arena - Arena 分配器（用于临时分配）
 // 返回：成功返回新的文件列表大小，失败返回-1
 static int collect_module_dependencies(
     const char *filename,
     const char *file_list[],
+    ASTNode *programs[],
     int file_list_size,
     int max_files,
-    const char *processed_files[],
-    int *processed_count,
-    int max_processed,
     const char *project_root,
     const char *uya_root,
+    Arena *ast_arena,
+    Arena *token_arena,
+    ParseCounts *counts,
+    ParseWorkers *workers,
+    int jobs,
     Arena *arena
 ) {
-    if (filename == NULL || file_list == NULL || processed_files == NULL || 
-        processed_count == NULL || arena == NULL) {
-        return -1;
-    }
-    
-    // 检查是否已处理过（避免循环依赖）
-    // 使用路径比较函数，考虑路径格式差异
-    for (int i = 0; i < *processed_count; i++) {
-        if (processed_files[i] != NULL && paths_equal(processed_files[i], filename)) {
-            return file_list_size;  // 已处理，直接返回
-        }
-    }
-    
-    // 注意：文件可能已在列表中（由调用方预先添加），但仍需要处理其依赖
-    
-    // 标记为已处理（在解析之前标记，避免重复解析）
-    if (*processed_count >= max_processed) {
-        return -1;
-    }
-    processed_files[*processed_count] = filename;
-    (*processed_count)++;
-    
-    // 读取文件并解析 AST（只有在文件不在列表中时才解析）
-    int file_size = read_file_content(filename, file_buffer, FILE_BUFFER_SIZE);
-    if (file_size < 0) {
-        return -1;
-    }
-    
-    Lexer lexer;
-    if (lexer_init(&lexer, file_buffer, (size_t)file_size, filename, arena) != 0) {
-        return -1;
-    }
-    
-    Parser parser;
-    if (parser_init(&parser, &lexer, arena) != 0) {
+    if (filename == NULL || file_list == NULL || programs == NULL || ast_arena == NULL ||
+        token_arena == NULL || workers == NULL || arena == NULL) {
         return -1;
     }
-    
-    ASTNode *ast = parser_parse(&parser);
-    if (ast == NULL || ast->type != AST_PROGRAM) {
-        return -1;
-    }
-    
-    // 提取 use 语句中的模块路径
-    const char *modules[MAX_INPUT_FILES];
-    int module_count = 0;
-    if (extract_use_modules(ast, modules, MAX_INPUT_FILES, &module_count, project_root, uya_root, arena) != 0) {
+
+    DepScan *scan = (DepScan *)arena_alloc(arena, sizeof(DepScan));
+    if (scan == NULL) {
         return -1;
     }
-    
-    // 对于每个模块，查找文件并递归处理
-    for (int i = 0; i < module_count; i++) {
-        if (modules[i] == NULL) {
-            continue;
+    scan->files[0] = filename;
+    scan->count = 1;
+    int pending[MAX_INPUT_FILES];
+    int level_start = 0;
+    while (level_start < scan->count) {
+        int level_end = scan->count;
+        int pending_count = 0;
+        for (int i = level_start; i < level_end; i++) {
+            scan->programs[i] = NULL;
+            scan->status[i] = PARSE_PENDING;
+            pending[pending_count++] = i;
         }
-        
-        // 特殊处理：main 模块
-        if (strcmp(modules[i], "main") == 0) {
-            // main 模块在项目根目录
-            // 注意：main 模块通常已经在文件列表中（作为入口文件），
-            // 所以这里不需要再次添加。如果确实需要添加，应该检查是否已在列表中。
-            // 为了避免重复添加，这里直接跳过 main 模块的处理。
-            // 如果 main.uya 不在列表中，它应该已经作为入口文件被添加了。
-            // 注意：modules[i] 是通过 Arena 分配的，不需要手动释放
-            continue;
+        if (!parse_files_parallel(workers, jobs, scan->files, scan->programs, scan->status, pending, pending_count)) {
+            for (int i = level_start; i < level_end; i++) {
+                scan->status[i] = parse_source_file(scan->files[i], ast_arena, token_arena, &scan->programs[i], counts);
+            }
         }
-        
-        // 查找模块文件
-        char module_file[PATH_MAX];
-        if (find_module_file(modules[i], project_root, uya_root, module_file, sizeof(module_file)) == 0) {
-            // 检查是否已在列表中（使用路径比较函数）
-            int already_added = 0;
-            for (int j = 0; j < file_list_size; j++) {
-                if (file_list[j] != NULL && paths_equal(file_list[j], module_file)) {
-                    already_added = 1;
-                    break;
-                }
+
+        // 按文件顺序扫描本层的 use 语句，新模块加入下一层
+        for (int i = level_start; i < level_end; i++) {
+            if (scan->programs[i] == NULL) {
+                return -1;
             }
-            if (!already_added && file_list_size < max_files) {
-                // 使用 Arena 分配文件路径
-                size_t path_len = strlen(module_file);
-                char *path_copy = (char *)arena_alloc(arena, path_len + 1);
-                if (path_copy != NULL) {
-                    strcpy(path_copy, module_file);
-                    file_list[file_list_size] = path_copy;
-                    file_list_size++;
-                    // 递归处理依赖（使用 Arena 分配的 path_copy，而不是栈上的 module_file）
-                    // 注意：这里需要递归处理，因为新文件可能有自己的依赖
-                    file_list_size = collect_module_dependencies(
-                        path_copy, file_list, file_list_size, max_files,
-                        processed_files, processed_count, max_processed,
-                        project_root, uya_root, arena
-                    );
-                    if (file_list_size < 0) {
-                        return -1;
+            const char *modules[MAX_INPUT_FILES];
+            int module_count = 0;
+            if (extract_use_modules(scan->programs[i], modules, MAX_INPUT_FILES, &module_count, project_root, uya_root, arena) != 0) {
+                return -1;
+            }
+            int *deps = (int *)arena_alloc(arena, sizeof(int) * (size_t)(module_count > 0 ? module_count : 1));
+            if (deps == NULL) {
+                return -1;
+            }
+            scan->deps[i] = deps;
+            scan->dep_counts[i] = 0;
+            for (int m = 0; m < module_count; m++) {
+                // main 模块即入口文件，已在文件列表中
+                if (modules[m] == NULL || strcmp(modules[m], "main") == 0) {
+                    continue;
+                }
+                char module_file[PATH_MAX];
+                if (find_module_file(modules[m], project_root, uya_root, module_file, sizeof(module_file)) != 0) {
+                    continue;
+                }
+                int dep = dep_scan_find(scan, module_file);
+                if (dep < 0) {
+                    if (scan->count >= MAX_INPUT_FILES) {
+                        continue;
+                    }
+                    // 使用 Arena 分配文件路径
+                    size_t path_len = strlen(module_file);
+                    char *path_copy = (char *)arena_alloc(arena, path_len + 1);
+                    if (path_copy == NULL) {
+                        continue;
                     }
+                    memcpy(path_copy, module_file, path_len + 1);
+                    dep = scan->count++;
+                    scan->files[dep] = path_copy;
                 }
+                deps[scan->dep_counts[i]++] = dep;
             }
         }
+        level_start = level_end;
     }
-    
-    return file_list_size;
+
+    // 文件列表中已有的文件（入口文件等）不再加入
+    for (int i = 0; i < scan->count; i++) {
+        scan->added[i] = 0;
+        for (int j = 0; j < file_list_size; j++) {
+            if (file_list[j] != NULL && paths_equal(file_list[j], scan->files[i])) {
+                scan->added[i] = 1;
+                if (scan->status[i] == PARSE_OK) {
+                    programs[j] = scan->programs[i];
+                }
+                break;
+            }
+        }
+    }
+    return dep_scan_replay(scan, 0, file_list, programs, file_list_size, max_files);
+}
+
+// 打印 Arena 使用统计（--arena-stats）
+// 参数：phase - 阶段名称，name - Arena 名称，arena - Arena 指针
+static void print_arena_stats(const char *phase, const char *name, const Arena *arena) {
+    ArenaStats stats;
+    arena_get_stats(arena, &stats);
+    fprintf(stderr, "  [arena] %s/%s: 已用 %zu KB, 峰值 %zu KB, 占用 %zu KB, 分配 %zu 次, 映射块 %d\n",
+            phase, name, stats.bytes_used / 1024, stats.peak_bytes / 1024,
+            stats.reserved_bytes / 1024, stats.alloc_count, stats.chunk_count);
 }
 
 // 打印使用说明
@@ -601,6 +897,23 @@ static void print_usage(const char *program_name) {
     fprintf(stderr, "  -exec                生成可执行文件（编译并链接 C 代码）\n");
     fprintf(stderr, "  --no-line-directives 禁用 #line 指令生成（默认禁用）\n");
     fprintf(stderr, "  --line-directives    启用 #line 指令生成（默认禁用）\n");
+    fprintf(stderr, "  --arena-stats        输出各编译阶段的 Arena 内存使用统计\n");
+    fprintf(stderr, "  -jN                  使用 N 个线程并行解析源文件与生成函数定义（默认 1，即串行）\n");
+    fprintf(stderr, "  --split N            拆分输出为共享头文件 <输出>.h 与 N 个 .c 文件（<输出>.c、<输出>_1.c ...），\n");
+    fprintf(stderr, "                       -exec 时用 -jN 个进程并行编译后链接\n");
+    fprintf(stderr, "  --cache-dir DIR      增量编译缓存目录（也可用 UYA_CACHE_DIR 环境变量指定）：\n");
+    fprintf(stderr, "                       所有模块文件与选项都未变化时直接复用上次生成的 C 代码\n");
+    fprintf(stderr, "  --time-report[=FILE] 以 JSON 输出各编译阶段的耗时、Arena 用量与 Token/AST/符号等计数\n");
+    fprintf(stderr, "                       （默认输出到标准错误）\n");
+    fprintf(stderr, "  --error-abi=compact  紧凑错误联合布局：!T 的错误码为 16 位，!&T 与引用共用一个寄存器\n");
+    fprintf(stderr, "                       （错误为低地址）；整个程序统一使用，默认 --error-abi=default\n");
+    fprintf(stderr, "  --safety-checks      区间分析无法证明安全的数组/切片下标、除数与整数运算生成运行时检查\n");
+    fprintf(stderr, "                       （循环中可外提的下标检查在循环前只做一次）\n");
+    fprintf(stderr, "  --safety-report      在标准错误输出未证明安全的下标、除法与整数运算位置及统计\n");
+    fprintf(stderr, "\n编译服务:\n");
+    fprintf(stderr, "  %s --server <socket>             启动编译服务：预解析 UYA_ROOT 下的模块后监听编译请求\n", program_name);
+    fprintf(stderr, "  %s --client <socket> [参数...]   由编译服务编译（参数与直接运行相同，结果相同；\n", program_name);
+    fprintf(stderr, "                                     服务不可用时在本进程编译）\n");
     fprintf(stderr, "\n说明:\n");
     fprintf(stderr, "  - 输出 C99 源代码，输出文件建议使用 .c 后缀\n");
     fprintf(stderr, "  - 可以指定单个文件或目录，编译器会自动解析模块依赖\n");
@@ -616,8 +929,16 @@ static void print_usage(const char *program_name) {
 //       output_file - 输出参数：输出文件名
 //       generate_executable - 输出参数：是否生成可执行文件（1 表示是，0 表示否）
 //       emit_line_directives - 输出参数：是否生成 #line 指令（1 表示是，0 表示否）
+//       arena_stats - 输出参数：是否输出 Arena 统计（1 表示是，0 表示否）
+//       jobs - 输出参数：并行线程数（-jN，默认 1）
+//       split - 输出参数：拆分输出的 .c 文件数量（--split N，默认 1，即单个文件）
+//       cache_dir - 输出参数：增量编译缓存目录（--cache-dir DIR，默认 NULL，即不使用缓存）
+//       time_report - 输出参数：编译统计的输出文件（--time-report[=FILE]，"-" 表示标准错误，默认 NULL，即不统计）
+//       compact_error_abi - 输出参数：是否使用紧凑错误联合布局（--error-abi=compact，默认 0）
+//       safety_checks - 输出参数：是否生成下标、除数与整数溢出的运行时检查（--safety-checks，默认 0）
+//       safety_report - 输出参数：是否输出安全检查报告（--safety-report，默认 0）
 // 返回：成功返回0，失败返回-1
-static int parse_args(int argc, char *argv[], const char *input_files[], int *input_file_count, const char **output_file, int *generate_executable, int *emit_line_directives) {
+static int parse_args(int argc, char *argv[], const char *input_files[], int *input_file_count, const char **output_file, int *generate_executable, int *emit_line_directives, int *arena_stats, int *jobs, int *split, const char **cache_dir, const char **time_report, int *compact_error_abi, int *safety_checks, int *safety_report) {
     if (argc < 4) {
         print_usage(argv[0]);
         return -1;
@@ -628,6 +949,14 @@ static int parse_args(int argc, char *argv[], const char *input_files[], int *in
     *output_file = NULL;
     *generate_executable = 0;
     *emit_line_directives = 0;     // 默认不生成 #line 指令
+    *arena_stats = 0;
+    *jobs = 1;
+    *split = 1;
+    *cache_dir = NULL;
+    *time_report = NULL;
+    *compact_error_abi = 0;
+    *safety_checks = 0;
+    *safety_report = 0;
 
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "-o") == 0) {
@@ -644,6 +973,57 @@ static int parse_args(int argc, char *argv[], const char *input_files[], int *in
             *emit_line_directives = 0;  // 禁用 #line 指令生成
         } else if (strcmp(argv[i], "--line-directives") == 0) {
             *emit_line_directives = 1;  // 启用 #line 指令生成
+        } else if (strcmp(argv[i], "--arena-stats") == 0) {
+            *arena_stats = 1;
+        } else if (strncmp(argv[i], "-j", 2) == 0) {
+            // 并行线程数：-jN 或 -j N
+            const char *value = argv[i][2] != '\0' ? argv[i] + 2 : (i + 1 < argc ? argv[++i] : NULL);
+            char *end = NULL;
+            long n = value != NULL ? strtol(value, &end, 10) : 0;
+            if (value == NULL || *end != '\0' || n < 1 || n > THREAD_POOL_MAX_WORKERS) {
+                fprintf(stderr, "错误: -j 选项需要 1 到 %d 之间的线程数\n", THREAD_POOL_MAX_WORKERS);
+                return -1;
+            }
+            *jobs = (int)n;
+        } else if (strcmp(argv[i], "--split") == 0) {
+            // 拆分输出：--split N
+            char *end = NULL;
+            long n = i + 1 < argc ? strtol(argv[i + 1], &end, 10) : 0;
+            if (i + 1 >= argc || *end != '\0' || n < 1 || n > C99_MAX_SPLIT_OUTPUTS) {
+                fprintf(stderr, "错误: --split 选项需要 1 到 %d 之间的文件数量\n", C99_MAX_SPLIT_OUTPUTS);
+                return -1;
+            }
+            *split = (int)n;
+            i++;
+        } else if (strcmp(argv[i], "--cache-dir") == 0) {
+            if (i + 1 < argc) {
+                *cache_dir = argv[i + 1];
+                i++;
+            } else {
+                fprintf(stderr, "错误: --cache-dir 选项需要指定缓存目录\n");
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--time-report") == 0) {
+            *time_report = "-";
+        } else if (strncmp(argv[i], "--time-report=", 14) == 0) {
+            if (argv[i][14] == '\0') {
+                fprintf(stderr, "错误: --time-report= 选项需要指定输出文件\n");
+                return -1;
+            }
+            *time_report = argv[i] + 14;
+        } else if (strncmp(argv[i], "--error-abi=", 12) == 0) {
+            if (strcmp(argv[i] + 12, "compact") == 0) {
+                *compact_error_abi = 1;
+            } else if (strcmp(argv[i] + 12, "default") == 0) {
+                *compact_error_abi = 0;
+            } else {
+                fprintf(stderr, "错误: --error-abi= 选项只支持 default 或 compact\n");
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--safety-checks") == 0) {
+            *safety_checks = 1;
+        } else if (strcmp(argv[i], "--safety-report") == 0) {
+            *safety_report = 1;
         } else if (strcmp(argv[i], "--c99") == 0) {
             // 保留 --c99 选项以兼容旧脚本，忽略
         } else if (argv[i][0] != '-') {
@@ -681,6 +1061,137 @@ static int parse_args(int argc, char *argv[], const char *input_files[], int *in
     return 0;
 }
 
+// 将输出缓冲区写入文件（覆盖已有文件）
+// 返回：成功返回0，失败返回-1
+static int write_emitter_to_path(Emitter *emitter, const char *path) {
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    int result = emitter_write_fd(emitter, fd);
+    if (close(fd) != 0) {
+        result = -1;
+    }
+    return result;
+}
+
+// 拆分输出的第 index 个 .c 文件对应的目标文件路径（.c 替换为 .o，其他后缀追加 .o）
+// 返回：成功返回0，缓冲区不足返回-1
+static int split_object_path(char *buf, size_t size, const char *output_file, int index) {
+    if (c99_split_output_path(buf, size, output_file, index) != 0) {
+        return -1;
+    }
+    size_t len = strlen(buf);
+    if (len >= 2 && buf[len - 2] == '.' && buf[len - 1] == 'c') {
+        buf[len - 1] = 'o';
+        return 0;
+    }
+    if (len + 3 > size) {
+        return -1;
+    }
+    memcpy(buf + len, ".o", 3);
+    return 0;
+}
+
+// 并行编译拆分输出的上下文
+typedef struct SplitCompileJobs {
+    const char *output_file;    // 输出文件（拆分输出的第 0 个 .c 文件）
+    int *status;                // 每个文件的编译结果（0 表示成功）
+} SplitCompileJobs;
+
+// 线程池任务：编译拆分输出的第 task 个 .c 文件为目标文件
+static void split_compile_run(void *ctx, int worker, int task) {
+    SplitCompileJobs *jobs = (SplitCompileJobs *)ctx;
+    (void)worker;
+    char source[1024];
+    char object[1024];
+    char cmd[2304];
+    jobs->status[task] = -1;
+    if (c99_split_output_path(source, sizeof(source), jobs->output_file, task) != 0 ||
+        split_object_path(object, sizeof(object), jobs->output_file, task) != 0) {
+        return;
+    }
+    snprintf(cmd, sizeof(cmd), "gcc --std=c99 -c -o \"%s\" \"%s\"", object, source);
+    fprintf(stderr, "执行编译命令: %s\n", cmd);
+    jobs->status[task] = system(cmd) == 0 ? 0 : -1;
+}
+
+// 用 jobs 个进程并行编译拆分输出的 split 个 .c 文件，再与 bridge.c（可为 NULL）链接为可执行文件
+// 返回：成功返回0，失败返回-1
+static int build_split_executable(const char *output_file, int split, int jobs, const char *executable_file, const char *bridge_file) {
+    int status[C99_MAX_SPLIT_OUTPUTS];
+    SplitCompileJobs compile_jobs;
+    compile_jobs.output_file = output_file;
+    compile_jobs.status = status;
+    thread_pool_run(jobs, split, split_compile_run, &compile_jobs);
+    for (int i = 0; i < split; i++) {
+        if (status[i] != 0) {
+            return -1;
+        }
+    }
+
+    // 链接命令长度随文件数量增长，从临时 Arena 分配
+    Arena cmd_arena;
+    arena_init(&cmd_arena, NULL, 0);
+    size_t cap = strlen(executable_file) + (bridge_file ? strlen(bridge_file) : 0) + 64;
+    cap += (size_t)split * 1040;
+    char *cmd = (char *)arena_alloc(&cmd_arena, cap);
+    size_t len = (size_t)snprintf(cmd, cap, "gcc --std=c99 -o \"%s\"", executable_file);
+    for (int i = 0; i < split; i++) {
+        char object[1024];
+        split_object_path(object, sizeof(object), output_file, i);
+        len += (size_t)snprintf(cmd + len, cap - len, " \"%s\"", object);
+    }
+    if (bridge_file) {
+        snprintf(cmd + len, cap - len, " \"%s\"", bridge_file);
+    }
+    fprintf(stderr, "执行链接命令: %s\n", cmd);
+    int result = system(cmd) == 0 ? 0 : -1;
+    arena_reset(&cmd_arena);
+    return result;
+}
+
+// 增量编译缓存的编译键：编译器二进制内容与所有影响输出的输入（选项、输入参数、输出路径、工作目录、UYA_ROOT）
+// -jN 不影响输出，不参与编译键
+static uint64_t build_cache_key(const char *argv0, const char *input_files[], int input_file_count, const char *output_file,
+                                int emit_line_directives, int split, int compact_error_abi, int safety_checks, const char *uya_root) {
+    uint64_t key = BUILD_CACHE_HASH_INIT;
+    uint64_t compiler_hash = 0;
+    if (build_cache_hash_file("/proc/self/exe", &compiler_hash, NULL) != 0 &&
+        build_cache_hash_file(argv0, &compiler_hash, NULL) != 0) {
+        compiler_hash = 0;
+    }
+    key = build_cache_hash(key, &compiler_hash, sizeof(compiler_hash));
+    int options[4] = { emit_line_directives, split, compact_error_abi, safety_checks };
+    key = build_cache_hash(key, options, sizeof(options));
+    for (int i = 0; i < input_file_count; i++) {
+        key = build_cache_hash_str(key, input_files[i]);
+    }
+    key = build_cache_hash_str(key, output_file);
+    char cwd[PATH_MAX];
+    key = build_cache_hash_str(key, getcwd(cwd, sizeof(cwd)) != NULL ? cwd : "");
+    key = build_cache_hash_str(key, uya_root);
+    return key;
+}
+
+// 本次编译的全部输出文件路径：输出文件本身，拆分输出时依次为头文件与其余 .c 文件
+// 返回：输出文件数量，路径过长返回-1
+static int build_cache_output_paths(const char *output_file, int split, const char *paths[], Arena *arena) {
+    paths[0] = output_file;
+    if (split <= 1) {
+        return 1;
+    }
+    for (int i = 1; i <= split; i++) {
+        char *path = (char *)arena_alloc(arena, PATH_MAX);
+        // 第 1 个为头文件（下标 -1），其后为第 1 到 split - 1 个 .c 文件
+        if (path == NULL || c99_split_output_path(path, PATH_MAX, output_file, i == 1 ? -1 : i - 1) != 0) {
+            return -1;
+        }
+        paths[i] = path;
+    }
+    return split + 1;
+}
+
 // 主编译函数
 // 协调所有编译阶段：词法分析 → 语法分析 → AST 合并 → 类型检查 → C99 代码生成
 // 参数：input_files - 输入文件名或目录数组
@@ -688,11 +1199,23 @@ static int parse_args(int argc, char *argv[], const char *input_files[], int *in
 //       output_file - 输出文件名
 //       emit_line_directives - 是否生成 #line 指令（C99 后端）
 //       argv0 - 程序路径（用于获取编译器目录）
+//       arena_stats - 是否输出各阶段 Arena 统计
+//       jobs - 并行线程数（> 1 时依赖收集逐层并行解析新发现的模块、并行解析其余文件，并行生成函数定义）
+//       split - 拆分输出的 .c 文件数量（> 1 时另外输出共享头文件，见 c99_split_output_path）
+//       cache_dir - 增量编译缓存目录（NULL 表示不使用缓存，见 build_cache.h）
+//       report - 编译统计（--time-report，NULL 表示不统计，见 time_report.h）
+//       compact_error_abi - 是否使用紧凑错误联合布局（整个程序统一，见 codegen/c99/types.c）
+//       safety_checks - 是否生成下标、除数与整数溢出的运行时检查（见 codegen/c99/range.c）
+//       safety_report - 是否输出安全检查报告（此时不使用缓存，保证每次都输出报告）
 // 返回：成功返回0，失败返回非0
-static int compile_files(const char *input_files[], int input_file_count, const char *output_file, int emit_line_directives, const char *argv0) {
-    // 初始化 Arena（用于依赖收集，使用全局缓冲区避免栈溢出）
+static int compile_files(const char *input_files[], int input_file_count, const char *output_file, int emit_line_directives, const char *argv0, int arena_stats, int jobs, int split, const char *cache_dir, TimeReport *report, int compact_error_abi, int safety_checks, int safety_report) {
+    // 初始化 Arena（用于依赖收集中的临时路径，全部来自按需映射的块，解析完成后归还）
     Arena temp_arena;
-    arena_init(&temp_arena, temp_arena_buffer, sizeof(temp_arena_buffer));
+    arena_init(&temp_arena, NULL, 0);
+
+    // 当前阶段的计时器（未启用 --time-report 时不计时）
+    TimeReportTimer timer;
+    time_report_start(report, &timer, NULL);
     
     // 获取 UYA_ROOT 和编译器目录
     char uya_root[PATH_MAX];
@@ -700,6 +1223,31 @@ static int compile_files(const char *input_files[], int input_file_count, const
         fprintf(stderr, "错误: 无法获取 UYA_ROOT 目录\n");
         return 1;
     }
+
+    // 增量编译缓存：所有模块文件与选项都未变化时直接复用上次的输出
+    BuildCache cache;
+    int use_cache = 0;
+    Arena cache_arena;
+    const char *output_paths[BUILD_CACHE_MAX_OUTPUTS];
+    int output_count = 0;
+    if (cache_dir != NULL && !safety_report) {
+        arena_init(&cache_arena, NULL, 0);
+        uint64_t key = build_cache_key(argv0, input_files, input_file_count, output_file, emit_line_directives, split,
+                                       compact_error_abi, safety_checks, uya_root);
+        output_count = build_cache_output_paths(output_file, split, output_paths, &cache_arena);
+        if (output_count > 0 && build_cache_init(&cache, cache_dir, key) == 0) {
+            use_cache = 1;
+            if (build_cache_lookup(&cache, output_paths, output_count, &cache_arena) == 0) {
+                time_report_stop(report, "cache_lookup", &timer);
+                fprintf(stderr, "代码生成完成: %s（增量缓存命中，所有模块均未变化）\n", output_file);
+                return 0;
+            }
+        } else {
+            fprintf(stderr, "警告: 无法使用缓存目录 '%s'，本次编译不使用增量缓存\n", cache_dir);
+        }
+        time_report_stop(report, "cache_lookup", &timer);
+        time_report_start(report, &timer, NULL);
+    }
     
     // 处理输入：如果是目录，查找包含 main 的文件；如果是文件，检查是否包含 main
     const char *resolved_files[MAX_INPUT_FILES];
@@ -811,20 +1359,36 @@ static int compile_files(const char *input_files[], int input_file_count, const
         fprintf(stderr, "错误: 未找到包含 main 函数的文件\n");
         return 1;
     }
+    time_report_stop(report, "resolve_inputs", &timer);
     
+    // 初始化 Arena 分配器（所有文件的 AST 与类型信息共享同一个 Arena）
+    Arena arena;
+    arena_init(&arena, arena_buffer, ARENA_BUFFER_SIZE);
+    ParseCounts parse_counts = {0, 0};
+
+    // Token Arena：每个文件解析完成后回退，Token 结构体不占用 AST Arena
+    Arena token_arena;
+    arena_init(&token_arena, token_arena_buffer, TOKEN_ARENA_BUFFER_SIZE);
+
     // 自动收集模块依赖
     const char *all_files[MAX_INPUT_FILES];
     int all_file_count = resolved_count;
+
+    // 存储每个文件的 AST_PROGRAM 节点（栈上分配，只存储指针）
+    // 依赖收集时解析过的文件直接复用其 AST，其余文件在词法/语法分析阶段解析
+    ASTNode *programs[MAX_INPUT_FILES];
     
     // 先添加入口文件
     for (int i = 0; i < resolved_count; i++) {
         all_files[i] = resolved_files[i];
+        programs[i] = NULL;
     }
     
     // 收集依赖（只对包含 main 的文件进行依赖收集）
     // 库文件已经在列表中，不需要进行依赖收集
-    const char *processed_files[MAX_INPUT_FILES];
-    int processed_count = 0;
+    // -jN：依赖收集与词法/语法分析阶段共用解析工作线程
+    ParseWorkers parse_workers;
+    parse_workers.count = 0;
     
     // 找出包含 main 的文件（入口文件）
     int main_file_count = 0;
@@ -841,18 +1405,22 @@ static int compile_files(const char *input_files[], int input_file_count, const
     // 只有在自动依赖收集模式下（只传递了单个入口文件），才需要进行依赖收集
     // 判断是否为手动文件列表模式：如果 resolved_count > 1，说明是手动文件列表模式
     if (resolved_count == 1) {
-        // 自动依赖收集模式：只传递了单个文件，需要进行依赖收集
+        // 自动依赖收集模式：只传递了单个文件，需要进行依赖收集（依赖文件在此解析）
+        time_report_start(report, &timer, &arena);
         for (int i = 0; i < main_file_count; i++) {
             int new_count = collect_module_dependencies(
                 main_files[i],
                 all_files,
+                programs,
                 all_file_count,
                 MAX_INPUT_FILES,
-                processed_files,
-                &processed_count,
-                MAX_INPUT_FILES,
                 project_root,
                 uya_root,
+                &arena,
+                &token_arena,
+                &parse_counts,
+                &parse_workers,
+                jobs,
                 &temp_arena
             );
             if (new_count < 0) {
@@ -861,71 +1429,94 @@ static int compile_files(const char *input_files[], int input_file_count, const
             }
             all_file_count = new_count;
         }
+        time_report_stop(report, "collect_deps", &timer);
     }
     // 手动文件列表模式：所有文件已经在列表中，不需要进行依赖收集
     
     fprintf(stderr, "=== 开始编译 ===\n");
     fprintf(stderr, "=== 词法/语法分析 ===\n");
 
-    // 初始化 Arena 分配器（所有文件共享同一个 Arena）
-    Arena arena;
-    arena_init(&arena, arena_buffer, ARENA_BUFFER_SIZE);
+    // 依赖收集阶段未解析的文件
+    int pending[MAX_INPUT_FILES];
+    int pending_count = 0;
+    ParseStatus parse_status[MAX_INPUT_FILES];
+    for (int i = 0; i < all_file_count; i++) {
+        parse_status[i] = programs[i] != NULL ? PARSE_OK : PARSE_PENDING;
+        if (programs[i] == NULL) {
+            pending[pending_count++] = i;
+        }
+    }
 
-    // 存储每个文件的 AST_PROGRAM 节点（栈上分配，只存储指针）
-    ASTNode *programs[MAX_INPUT_FILES];
+    // -jN：并行解析，每个工作线程使用私有的 Arena（AST 生命周期与主 Arena 相同，不回收）
+    time_report_start(report, &timer, &arena);
+    parse_files_parallel(&parse_workers, jobs, all_files, programs, parse_status, pending, pending_count);
 
-    // 解析每个文件
+    // 按文件顺序汇总（串行模式在此解析），遇到第一个错误即停止
     for (int i = 0; i < all_file_count; i++) {
         const char *input_file = all_files[i];
-        
-
-        int file_size = read_file_content(input_file, file_buffer, FILE_BUFFER_SIZE);
-        if (file_size < 0) {
-            fprintf(stderr, "错误: 无法读取文件 '%s' (可能文件太大或不存在)\n", input_file);
-            return 1;
+        if (parse_status[i] == PARSE_PENDING) {
+            parse_status[i] = parse_source_file(input_file, &arena, &token_arena, &programs[i], &parse_counts);
         }
-
-        Lexer lexer;
-        if (lexer_init(&lexer, file_buffer, (size_t)file_size, input_file, &arena) != 0) {
-            fprintf(stderr, "错误: Lexer 初始化失败: %s (可能 Arena 内存不足或文件太大)\n", input_file);
+        if (parse_status[i] != PARSE_OK) {
+            report_parse_error(parse_status[i], input_file);
             return 1;
         }
-
-        Parser parser;
-        if (parser_init(&parser, &lexer, &arena) != 0) {
-            fprintf(stderr, "错误: Parser 初始化失败: %s (可能 Arena 内存不足)\n", input_file);
-            return 1;
+        fprintf(stderr, "  解析完成: %s (声明数: %d)\n", input_file, programs[i]->data.program.decl_count);
+    }
+    fprintf(stderr, "=== 词法/语法分析完成，共 %d 个文件 ===\n", all_file_count);
+    TimeReportPhase *parse_phase = time_report_stop(report, "parse", &timer);
+    if (report != NULL) {
+        // 工作线程的计数与 AST 内存含依赖收集阶段的并行解析
+        for (int w = 0; w < parse_workers.count; w++) {
+            ArenaStats stats;
+            arena_get_stats(&parse_workers.arenas[w], &stats);
+            if (parse_phase != NULL) {
+                parse_phase->arena_bytes += stats.bytes_used;
+            }
+            parse_counts.tokens += parse_workers.counts[w].tokens;
+            parse_counts.nodes += parse_workers.counts[w].nodes;
         }
-
-        ASTNode *ast = parser_parse(&parser);
-        if (ast == NULL) {
-            fprintf(stderr, "错误: 语法分析失败: %s\n", input_file);
-            return 1;
+        report->file_count = (size_t)all_file_count;
+        report->token_count = parse_counts.tokens;
+        report->ast_node_count = parse_counts.nodes;
+    }
+    if (arena_stats) {
+        print_arena_stats("解析", "Token", &token_arena);
+        print_arena_stats("解析", "依赖收集", &temp_arena);
+        print_arena_stats("解析", "AST", &arena);
+        for (int w = 0; w < parse_workers.count; w++) {
+            char worker_name[32];
+            snprintf(worker_name, sizeof(worker_name), "AST#%d", w);
+            print_arena_stats("解析", worker_name, &parse_workers.arenas[w]);
         }
+    }
 
-        if (ast->type != AST_PROGRAM) {
-            fprintf(stderr, "错误: 解析结果不是程序节点: %s\n", input_file);
-            return 1;
-        }
-        
-        // 检查词法分析错误（如未闭合块注释）
-        if (lexer.has_error) {
-            fprintf(stderr, "错误: 语法分析失败: %s\n", input_file);
-            return 1;
+    // 缓存清单需要全部模块文件路径，在临时 Arena 回收前复制
+    const char *cache_files[MAX_INPUT_FILES];
+    if (use_cache) {
+        for (int i = 0; i < all_file_count; i++) {
+            size_t len = strlen(all_files[i]);
+            char *copy = (char *)arena_alloc(&cache_arena, len + 1);
+            memcpy(copy, all_files[i], len + 1);
+            cache_files[i] = copy;
         }
-
-        programs[i] = ast;
-        fprintf(stderr, "  解析完成: %s (声明数: %d)\n", input_file, ast->data.program.decl_count);
     }
-    fprintf(stderr, "=== 词法/语法分析完成，共 %d 个文件 ===\n", all_file_count);
+
+    // 依赖收集阶段的临时路径与模块名已不再使用（文件名已复制到 AST Arena）
+    arena_reset(&temp_arena);
 
     fprintf(stderr, "=== AST 合并阶段 ===\n");
+    time_report_start(report, &timer, &arena);
     ASTNode *merged_ast = ast_merge_programs(programs, all_file_count, &arena);
     if (merged_ast == NULL) {
         fprintf(stderr, "错误: AST 合并失败\n");
         return 1;
     }
+    time_report_stop(report, "merge", &timer);
     fprintf(stderr, "AST 合并完成，共 %d 个声明\n", merged_ast->data.program.decl_count);
+    if (arena_stats) {
+        print_arena_stats("合并", "AST", &arena);
+    }
     
     // 检查合并后的 AST 中是否有重复的 collect_module_dependencies 函数
     int collect_module_count = 0;
@@ -960,8 +1551,12 @@ static int compile_files(const char *input_files[], int input_file_count, const
 
     // 设置 UYA_ROOT 目录，供 checker 识别标准库模块
     checker.uya_root_dir = uya_root;
+    checker.time_report = report;
 
-    if (checker_check(&checker, merged_ast) != 0) {
+    time_report_start(report, &timer, &arena);
+    int check_result = checker_check(&checker, merged_ast);
+    time_report_stop(report, "check", &timer);
+    if (check_result != 0) {
         fprintf(stderr, "错误: 类型检查失败（错误数量: %d）\n", checker_get_error_count(&checker));
         return 1;
     }
@@ -971,55 +1566,169 @@ static int compile_files(const char *input_files[], int input_file_count, const
         return 1;
     }
     fprintf(stderr, "类型检查通过\n");
+    if (report != NULL) {
+        report->symbol_count = (size_t)checker.symbols_declared;
+        report->mono_instance_count = (size_t)checker.mono_table.count;
+    }
+
+    // 宏通过 @mc_get_env 读取的环境变量（记入增量缓存清单）
+    const char **cache_env_names = NULL;
+    int cache_env_count = 0;
+    if (use_cache && checker.macro_env_names.count > 0) {
+        cache_env_names = (const char **)arena_alloc(&cache_arena, sizeof(const char *) * (size_t)checker.macro_env_names.count);
+        for (int i = 0; i < checker.macro_env_names.entry_count; i++) {
+            const HashMapEntry *entry = hash_map_entry_at(&checker.macro_env_names, i);
+            if (entry != NULL) {
+                cache_env_names[cache_env_count++] = entry->key;
+            }
+        }
+    }
+    if (arena_stats) {
+        print_arena_stats("类型检查", "AST", &arena);
+    }
 
     fprintf(stderr, "=== 代码生成阶段 ===\n");
     const char *module_name = all_file_count > 0 ? all_files[0] : "(unknown)";
     fprintf(stderr, "模块名: %s\n", module_name);
 
     // C99 后端：生成 C 源代码
-    FILE *out_file = fopen(output_file, "w");
-    if (!out_file) {
+    int out_fd = open(output_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out_fd < 0) {
         fprintf(stderr, "错误: 无法打开输出文件 '%s'\n", output_file);
         return 1;
     }
 
+    // 代码生成使用独立的 Arena（只读 AST，生成的字符串不回写到 AST）
+    Arena codegen_arena;
+    arena_init(&codegen_arena, NULL, 0);
+
+    // 生成的代码先写入内存缓冲区，结束后一次性写出（失败时也写出已生成的部分）
+    Emitter out_emitter;
+    emitter_init(&out_emitter, &codegen_arena);
+
     C99CodeGenerator c99_codegen;
-    if (c99_codegen_new(&c99_codegen, &arena, out_file, module_name, emit_line_directives) != 0) {
+    if (c99_codegen_new(&c99_codegen, &codegen_arena, &out_emitter, module_name, emit_line_directives) != 0) {
         fprintf(stderr, "错误: C99CodeGenerator 初始化失败\n");
-        fclose(out_file);
+        close(out_fd);
         return 1;
     }
     
     // 传递泛型单态化实例到代码生成器
     c99_codegen_set_mono_instances(&c99_codegen, &checker);
+    // 整个程序的错误名称按名称连续编号
+    c99_codegen_set_error_ids(&c99_codegen, &checker);
+    // -jN：并行生成函数定义
+    c99_codegen.jobs = jobs;
+    // --split N：拆分输出
+    c99_codegen.split_count = split;
+    // --error-abi=compact：紧凑错误联合布局
+    c99_codegen.compact_error_abi = compact_error_abi;
+    // --safety-checks / --safety-report：下标、除数与整数运算的区间分析
+    c99_codegen.safety_checks = safety_checks;
+    c99_codegen.safety_report = safety_report;
+    c99_codegen.time_report = report;
 
-    if (c99_codegen_generate(&c99_codegen, merged_ast, output_file) != 0) {
+    time_report_start(report, &timer, &codegen_arena);
+    int codegen_result = c99_codegen_generate(&c99_codegen, merged_ast, output_file);
+    time_report_stop(report, "codegen", &timer);
+    if (report != NULL) {
+        report->string_constant_count = (size_t)c99_codegen.string_constant_count;
+    }
+    c99_codegen_free(&c99_codegen);
+    time_report_start(report, &timer, NULL);
+    int write_result;
+    if (split > 1 && c99_codegen.split_outputs != NULL) {
+        // 拆分输出：out_emitter 为共享头文件，第 0 个 .c 文件写入输出文件本身
+        char path[1024];
+        write_result = emitter_write_fd(&c99_codegen.split_outputs[0], out_fd);
+        if (c99_split_output_path(path, sizeof(path), output_file, -1) != 0 ||
+            write_emitter_to_path(&out_emitter, path) != 0) {
+            write_result = -1;
+        }
+        for (int i = 1; i < split && write_result == 0; i++) {
+            if (c99_split_output_path(path, sizeof(path), output_file, i) != 0 ||
+                write_emitter_to_path(&c99_codegen.split_outputs[i], path) != 0) {
+                write_result = -1;
+            }
+        }
+    } else {
+        write_result = emitter_write_fd(&out_emitter, out_fd);
+    }
+    close(out_fd);
+    time_report_stop(report, "write", &timer);
+    if (codegen_result != 0) {
         fprintf(stderr, "错误: C99 代码生成失败\n");
-        c99_codegen_free(&c99_codegen);
-        fclose(out_file);
         return 1;
     }
+    if (write_result != 0) {
+        fprintf(stderr, "错误: 写入输出文件 '%s' 失败\n", output_file);
+        return 1;
+    }
+    if (split > 1) {
+        fprintf(stderr, "代码生成完成: %s（拆分为 %d 个文件）\n", output_file, split);
+    } else {
+        fprintf(stderr, "代码生成完成: %s\n", output_file);
+    }
+    if (arena_stats) {
+        print_arena_stats("代码生成", "代码生成", &codegen_arena);
+    }
 
-    c99_codegen_free(&c99_codegen);
-    fclose(out_file);
-    fprintf(stderr, "代码生成完成: %s\n", output_file);
+    // 保存到增量缓存（失败只影响下次编译的速度）
+    if (use_cache) {
+        if (build_cache_store(&cache, cache_files, all_file_count, cache_env_names, cache_env_count,
+                              output_paths, output_count) != 0) {
+            fprintf(stderr, "警告: 保存增量缓存失败\n");
+        }
+        arena_reset(&cache_arena);
+    }
 
     return 0;
 }
 
-// 主函数
-int main(int argc, char *argv[]) {
+// 运行一次编译（命令行参数见 print_usage；编译服务的请求子进程以客户端的参数调用）
+// 返回：进程退出码
+static int run_compiler(int argc, char *argv[]) {
     const char *input_files[MAX_INPUT_FILES];
     int input_file_count = 0;
     const char *output_file = NULL;
     int generate_executable = 0;
     int emit_line_directives = 0;
+    int arena_stats = 0;
+    int jobs = 1;
+    int split = 1;
+    const char *cache_dir = NULL;
+    const char *time_report_path = NULL;
+    int compact_error_abi = 0;
+    int safety_checks = 0;
+    int safety_report = 0;
 
-    if (parse_args(argc, argv, input_files, &input_file_count, &output_file, &generate_executable, &emit_line_directives) != 0) {
+    if (parse_args(argc, argv, input_files, &input_file_count, &output_file, &generate_executable, &emit_line_directives, &arena_stats, &jobs, &split, &cache_dir, &time_report_path, &compact_error_abi, &safety_checks, &safety_report) != 0) {
         return 1;
     }
+    if (cache_dir == NULL) {
+        const char *env_cache_dir = getenv("UYA_CACHE_DIR");
+        if (env_cache_dir != NULL && env_cache_dir[0] != '\0') {
+            cache_dir = env_cache_dir;
+        }
+    }
 
-    int result = compile_files(input_files, input_file_count, output_file, emit_line_directives, argv[0]);
+    // --time-report：统计随编译过程累积，编译结束（含失败）后输出
+    static TimeReport time_report;
+    if (time_report_path != NULL) {
+        time_report_init(&time_report);
+    }
+
+    int result = compile_files(input_files, input_file_count, output_file, emit_line_directives, argv[0], arena_stats, jobs, split, cache_dir,
+                               time_report_path != NULL ? &time_report : NULL, compact_error_abi, safety_checks, safety_report);
+    if (time_report_path != NULL) {
+        FILE *report_out = strcmp(time_report_path, "-") == 0 ? stderr : fopen(time_report_path, "w");
+        if (report_out == NULL || time_report_write_json(&time_report, report_out) != 0) {
+            fprintf(stderr, "警告: 无法写入编译统计 '%s'\n", time_report_path);
+        }
+        if (report_out != NULL && report_out != stderr) {
+            fclose(report_out);
+        }
+    }
     if (result != 0) {
         return result;
     }
@@ -1056,6 +1765,16 @@ int main(int argc, char *argv[]) {
             bridge_file = "../tests/bridge.c";
         }
 
+        if (split > 1) {
+            // 拆分输出：并行编译各 .c 文件后链接
+            if (build_split_executable(output_file, split, jobs, executable_file, bridge_file) != 0) {
+                fprintf(stderr, "错误: 编译 C99 代码失败\n");
+                return 1;
+            }
+            fprintf(stderr, "可执行文件已生成: %s\n", executable_file);
+            return 0;
+        }
+
         char cmd[2048];
         int cmd_len;
         if (bridge_file) {
@@ -1081,3 +1800,60 @@ int main(int argc, char *argv[]) {
 
     return 0;
 }
+
+// 编译服务（--server SOCKET）：预解析 UYA_ROOT 下的模块后监听编译请求
+// 返回：出错时返回非0（正常情况下一直运行）
+static int run_server(const char *argv0, const char *socket_path) {
+    char uya_root[PATH_MAX];
+    if (get_uya_root(argv0, uya_root, sizeof(uya_root)) != 0) {
+        fprintf(stderr, "错误: 无法获取 UYA_ROOT 目录\n");
+        return 1;
+    }
+
+    int listen_fd = compile_server_listen(socket_path);
+    if (listen_fd < 0) {
+        return 1;
+    }
+
+    // 预解析的 AST 在服务进程中一直存活，请求子进程写时复制地继承（预解析期间到达的请求在监听队列中等待）
+    Arena warm_arena;
+    Arena warm_token_arena;
+    arena_init(&warm_arena, NULL, 0);
+    arena_init(&warm_token_arena, NULL, 0);
+    hash_map_init(&warm_modules, &warm_arena);
+    int count = warm_modules_load_dir(uya_root, &warm_arena, &warm_token_arena);
+    warm_modules_ready = 1;
+
+    fprintf(stderr, "编译服务已启动: %s（已预解析 %s 下的 %d 个模块）\n", socket_path, uya_root, count);
+    return compile_server_run(listen_fd, run_compiler) != 0 ? 1 : 0;
+}
+
+// 主函数
+int main(int argc, char *argv[]) {
+    // 编译服务：uya-c --server <socket>
+    if (argc >= 2 && strcmp(argv[1], "--server") == 0) {
+        if (argc != 3) {
+            fprintf(stderr, "用法: %s --server <socket>\n", argv[0]);
+            return 1;
+        }
+        return run_server(argv[0], argv[2]);
+    }
+
+    // 客户端：uya-c --client <socket> [参数...]，服务不可用时在本进程编译
+    if (argc >= 2 && strcmp(argv[1], "--client") == 0) {
+        if (argc < 3) {
+            fprintf(stderr, "用法: %s --client <socket> [参数...]\n", argv[0]);
+            return 1;
+        }
+        const char *socket_path = argv[2];
+        argv[2] = argv[0];
+        int result = compile_client_run(socket_path, argc - 2, argv + 2);
+        if (result >= 0) {
+            return result;
+        }
+        fprintf(stderr, "警告: 无法连接编译服务 %s，在本进程编译\n", socket_path);
+        return run_compiler(argc - 2, argv + 2);
+    }
+
+    return run_compiler(argc, argv);
+}
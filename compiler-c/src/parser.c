@@ -1,9 +1,16 @@
 #include "parser.h"
+#include "intern.h"
 #include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
 
+// 辅助函数：从 Lexer 读取下一个 Token 并计数（--time-report 统计）
+static Token *parser_read_token(Parser *parser) {
+    parser->token_count++;
+    return lexer_next_token(parser->lexer, parser->arena);
+}
+
 // 初始化 Parser
 int parser_init(Parser *parser, Lexer *lexer, Arena *arena) {
     if (parser == NULL || lexer == NULL || arena == NULL) {
@@ -14,13 +21,41 @@ int parser_init(Parser *parser, Lexer *lexer, Arena *arena) {
     parser->arena = arena;
     parser->context = PARSER_CONTEXT_NORMAL;  // 默认上下文
     parser->pending_greater_token = NULL;     // 初始化待处理的 > token
+    parser->lookahead_head = 0;
+    parser->lookahead_count = 0;
+    parser->token_count = 0;
+    parser->node_count = 0;
     
     // 获取第一个 Token
-    parser->current_token = lexer_next_token(lexer, arena);
+    parser->current_token = parser_read_token(parser);
+    parser->current_in_string = lexer->string_mode || lexer->interp_depth > 0;
     
     return 0;
 }
 
+// 辅助函数：创建 AST 节点并计数（--time-report 统计）
+static ASTNode *parser_new_node(Parser *parser, ASTNodeType type, int line, int column, const char *filename) {
+    parser->node_count++;
+    return ast_new_node(type, line, column, parser->arena, filename);
+}
+
+// 辅助函数：查看当前 Token 之后的第 n 个 Token（n >= 1），不消费
+// 不足 n 个时从 Lexer 读取并追加到前瞻缓冲区，之后 parser_consume 直接取用
+static Token *parser_peek(Parser *parser, int n) {
+    if (parser == NULL || parser->lexer == NULL || n < 1 || n > PARSER_LOOKAHEAD_SIZE) {
+        return NULL;
+    }
+    
+    Lexer *lexer = parser->lexer;
+    while (parser->lookahead_count < n) {
+        int slot = (parser->lookahead_head + parser->lookahead_count) & (PARSER_LOOKAHEAD_SIZE - 1);
+        parser->lookahead[slot].token = parser_read_token(parser);
+        parser->lookahead[slot].in_string = lexer->string_mode || lexer->interp_depth > 0;
+        parser->lookahead_count++;
+    }
+    return parser->lookahead[(parser->lookahead_head + n - 1) & (PARSER_LOOKAHEAD_SIZE - 1)].token;
+}
+
 // 辅助函数：检查当前 Token 类型是否匹配
 static int parser_match(Parser *parser, TokenType type) {
     if (parser == NULL) {
@@ -54,7 +89,18 @@ static Token *parser_consume(Parser *parser) {
     }
     
     Token *current = parser->current_token;
-    parser->current_token = lexer_next_token(parser->lexer, parser->arena);
+    if (parser->lookahead_count > 0) {
+        // 优先取前瞻时已读出的 Token
+        ParserLookahead *next = &parser->lookahead[parser->lookahead_head];
+        parser->current_token = next->token;
+        parser->current_in_string = next->in_string;
+        parser->lookahead_head = (parser->lookahead_head + 1) & (PARSER_LOOKAHEAD_SIZE - 1);
+        parser->lookahead_count--;
+    } else {
+        Lexer *lexer = parser->lexer;
+        parser->current_token = parser_read_token(parser);
+        parser->current_in_string = lexer->string_mode || lexer->interp_depth > 0;
+    }
     return current;
 }
 
@@ -96,32 +142,18 @@ static int parser_peek_is_struct_init(Parser *parser) {
         return 0;
     }
     
-    Lexer *lexer = parser->lexer;
-    /* 在字符串/插值内部不能做 lookahead，会破坏 string_mode/interp_depth 等状态 */
-    if (lexer->string_mode || lexer->interp_depth > 0) {
+    /* 在字符串/插值内部不把 '{' 视为结构体字面量的开始 */
+    if (parser->current_in_string) {
         return 0;
     }
     
-    // 保存 lexer 状态（当前 lexer 的 position 已经在 '{' 之后）
-    size_t saved_position = lexer->position;
-    int saved_line = lexer->line;
-    int saved_column = lexer->column;
-    
     // 获取 '{' 后面的 token（lexer_next_token 会跳过空白字符和注释）
-    Token *after_brace = lexer_next_token(lexer, parser->arena);
+    Token *after_brace = parser_peek(parser, 1);
     
     if (!after_brace) {
-        // 恢复状态
-        lexer->position = saved_position;
-        lexer->line = saved_line;
-        lexer->column = saved_column;
         return 0;
     }
     
-    // 保存 lexer 在 after_brace 之后的状态（lexer_next_token 已经跳过了空白字符和注释）
-    // 这些变量用于调试目的，但当前未使用
-    (void)lexer; // 抑制未使用变量警告
-    
     TokenType token_type = after_brace->type;
     int is_struct_init = 0;
     
@@ -138,48 +170,15 @@ static int parser_peek_is_struct_init(Parser *parser) {
     } else if (token_type == TOKEN_IDENTIFIER || token_type == TOKEN_TYPE) {
         // 检查标识符后面是否有 ':'
         // 允许 'type' 关键字作为字段名（常见字段名）
-        size_t saved_position2 = lexer->position;
-        int saved_line2 = lexer->line;
-        int saved_column2 = lexer->column;
-        
-        Token *after_identifier = lexer_next_token(lexer, parser->arena);
+        Token *after_identifier = parser_peek(parser, 2);
         if (after_identifier && after_identifier->type == TOKEN_COLON) {
             is_struct_init = 1;
         }
-        
-        // 恢复状态到标识符之前（after_brace 之后）
-        lexer->position = saved_position2;
-        lexer->line = saved_line2;
-        lexer->column = saved_column2;
     }
     
-    // 恢复 lexer 状态到 '{' 之后（原始位置）
-    // 注意：这里恢复到 '{' 之后的原始位置，而不是 after_brace 之后的位置
-    // 因为 parser->current_token 仍然是 '{'，我们需要确保下次调用 lexer_next_token 时
-    // 能够正确返回 '{' 后面的 token
-    lexer->position = saved_position;
-    lexer->line = saved_line;
-    lexer->column = saved_column;
-    
     return is_struct_init;
 }
 
-// 从 Arena 复制字符串
-static const char *arena_strdup(Arena *arena, const char *src) {
-    if (arena == NULL || src == NULL) {
-        return NULL;
-    }
-    
-    size_t len = strlen(src) + 1;
-    char *result = (char *)arena_alloc(arena, len);
-    if (result == NULL) {
-        return NULL;
-    }
-    
-    memcpy(result, src, len);
-    return result;
-}
-
 // 解析类型（支持命名类型、指针类型和数组类型）
 // type = named_type | pointer_type | array_type
 // named_type = ID
@@ -200,7 +199,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
         if (payload == NULL) {
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_TYPE_ERROR_UNION, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_TYPE_ERROR_UNION, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -215,7 +214,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
         if (inner_type == NULL) {
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_TYPE_ATOMIC, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_TYPE_ATOMIC, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -266,7 +265,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
                 return NULL;
             }
             
-            ASTNode *tuple_type = ast_new_node(AST_TYPE_TUPLE, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *tuple_type = parser_new_node(parser, AST_TYPE_TUPLE, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (tuple_type == NULL) {
                 return NULL;
             }
@@ -304,7 +303,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
             if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) {
                 return NULL;
             }
-            ASTNode *slice_type = ast_new_node(AST_TYPE_SLICE, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *slice_type = parser_new_node(parser, AST_TYPE_SLICE, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (slice_type == NULL) {
                 return NULL;
             }
@@ -320,7 +319,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
         }
         
         // 创建指针类型节点
-        ASTNode *pointer_type = ast_new_node(AST_TYPE_POINTER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *pointer_type = parser_new_node(parser, AST_TYPE_POINTER, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (pointer_type == NULL) {
             return NULL;
         }
@@ -340,7 +339,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
         }
         
         // 创建 FFI 指针类型节点
-        ASTNode *pointer_type = ast_new_node(AST_TYPE_POINTER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *pointer_type = parser_new_node(parser, AST_TYPE_POINTER, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (pointer_type == NULL) {
             return NULL;
         }
@@ -377,7 +376,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
         }
         
         // 创建数组类型节点
-        ASTNode *array_type = ast_new_node(AST_TYPE_ARRAY, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *array_type = parser_new_node(parser, AST_TYPE_ARRAY, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (array_type == NULL) {
             return NULL;
         }
@@ -392,10 +391,10 @@ static ASTNode *parser_parse_type(Parser *parser) {
         if (!parser_match(parser, TOKEN_IDENTIFIER)) {
             return NULL;
         }
-        const char *union_type_name = arena_strdup(parser->arena, parser->current_token->value);
+        const char *union_type_name = parser->current_token->value;
         if (union_type_name == NULL) return NULL;
         parser_consume(parser);
-        ASTNode *type_node = ast_new_node(AST_TYPE_NAMED, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *type_node = parser_new_node(parser, AST_TYPE_NAMED, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (type_node == NULL) return NULL;
         type_node->data.type_named.name = union_type_name;
         return type_node;
@@ -404,7 +403,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
         // 或者类型宏调用（macro_name()）
         
         // 复制类型名称到 Arena
-        const char *type_name = arena_strdup(parser->arena, parser->current_token->value);
+        const char *type_name = parser->current_token->value;
         if (type_name == NULL) {
             return NULL;
         }
@@ -417,12 +416,12 @@ static ASTNode *parser_parse_type(Parser *parser) {
             parser_consume(parser);  // 消费 '('
             
             // 创建宏调用节点
-            ASTNode *callee = ast_new_node(AST_IDENTIFIER, line, column, parser->arena, 
+            ASTNode *callee = parser_new_node(parser, AST_IDENTIFIER, line, column, 
                 parser->lexer ? parser->lexer->filename : NULL);
             if (callee == NULL) return NULL;
             callee->data.identifier.name = type_name;
             
-            ASTNode *call = ast_new_node(AST_CALL_EXPR, line, column, parser->arena,
+            ASTNode *call = parser_new_node(parser, AST_CALL_EXPR, line, column,
                 parser->lexer ? parser->lexer->filename : NULL);
             if (call == NULL) return NULL;
             call->data.call_expr.callee = callee;
@@ -456,7 +455,7 @@ static ASTNode *parser_parse_type(Parser *parser) {
         }
         
         // 普通命名类型
-        ASTNode *type_node = ast_new_node(AST_TYPE_NAMED, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *type_node = parser_new_node(parser, AST_TYPE_NAMED, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (type_node == NULL) {
             return NULL;
         }
@@ -572,7 +571,7 @@ static ASTNode *parser_parse_block(Parser *parser) {
     int column = parser->current_token->column;
     
     // 创建代码块节点
-    ASTNode *block = ast_new_node(AST_BLOCK, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *block = parser_new_node(parser, AST_BLOCK, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (block == NULL) {
         return NULL;
     }
@@ -686,7 +685,7 @@ ASTNode *parser_parse_struct(Parser *parser) {
         return NULL;
     }
     
-    const char *struct_name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *struct_name = parser->current_token->value;
     if (struct_name == NULL) {
         return NULL;
     }
@@ -695,7 +694,7 @@ ASTNode *parser_parse_struct(Parser *parser) {
     parser_consume(parser);
     
     // 创建结构体声明节点
-    ASTNode *struct_decl = ast_new_node(AST_STRUCT_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *struct_decl = parser_new_node(parser, AST_STRUCT_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (struct_decl == NULL) {
         return NULL;
     }
@@ -726,7 +725,7 @@ ASTNode *parser_parse_struct(Parser *parser) {
                 return NULL;  // 错误：期望类型参数名称
             }
             
-            const char *param_name = arena_strdup(parser->arena, parser->current_token->value);
+            const char *param_name = parser->current_token->value;
             if (param_name == NULL) return NULL;
             parser_consume(parser);
             
@@ -758,7 +757,7 @@ ASTNode *parser_parse_struct(Parser *parser) {
                 while (parser->current_token != NULL && 
                        parser_match(parser, TOKEN_IDENTIFIER)) {
                     
-                    const char *constraint_name = arena_strdup(parser->arena, parser->current_token->value);
+                    const char *constraint_name = parser->current_token->value;
                     if (constraint_name == NULL) return NULL;
                     parser_consume(parser);
                     
@@ -823,7 +822,7 @@ ASTNode *parser_parse_struct(Parser *parser) {
             }
             
             // 获取接口名称
-            const char *iface_base_name = arena_strdup(parser->arena, parser->current_token->value);
+            const char *iface_base_name = parser->current_token->value;
             if (!iface_base_name) return NULL;
             parser_consume(parser);
             
@@ -867,7 +866,7 @@ ASTNode *parser_parse_struct(Parser *parser) {
                 }
                 
                 pos += snprintf(full_name + pos, sizeof(full_name) - pos, ">");
-                ifaces[iface_count] = arena_strdup(parser->arena, full_name);
+                ifaces[iface_count] = intern_cstring(parser->arena, full_name);
             } else {
                 ifaces[iface_count] = iface_base_name;
             }
@@ -948,9 +947,9 @@ ASTNode *parser_parse_struct(Parser *parser) {
         // 解析字段名称（允许 'type' 关键字作为字段名，因为它是常见的字段名）
         const char *field_name = NULL;
         if (parser_match(parser, TOKEN_IDENTIFIER)) {
-            field_name = arena_strdup(parser->arena, parser->current_token->value);
+            field_name = parser->current_token->value;
         } else if (parser_match(parser, TOKEN_TYPE)) {
-            field_name = arena_strdup(parser->arena, "type");
+            field_name = intern_cstring(parser->arena, "type");
         } else {
             return NULL;
         }
@@ -985,7 +984,7 @@ ASTNode *parser_parse_struct(Parser *parser) {
         }
         
         // 创建字段节点（使用 AST_VAR_DECL，is_const = 0）
-        ASTNode *field = ast_new_node(AST_VAR_DECL, field_line, field_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *field = parser_new_node(parser, AST_VAR_DECL, field_line, field_column, parser->lexer ? parser->lexer->filename : NULL);
         if (field == NULL) {
             return NULL;
         }
@@ -1046,10 +1045,10 @@ static ASTNode *parser_parse_union_body(Parser *parser, int line, int column, in
     if (parser == NULL || parser->current_token == NULL || !parser_match(parser, TOKEN_IDENTIFIER)) {
         return NULL;
     }
-    const char *union_name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *union_name = parser->current_token->value;
     if (union_name == NULL) return NULL;
     parser_consume(parser);
-    ASTNode *union_decl = ast_new_node(AST_UNION_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *union_decl = parser_new_node(parser, AST_UNION_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (union_decl == NULL) return NULL;
     union_decl->data.union_decl.name = union_name;
     union_decl->data.union_decl.is_extern = is_extern;
@@ -1078,13 +1077,13 @@ static ASTNode *parser_parse_union_body(Parser *parser, int line, int column, in
         }
         if (!parser_match(parser, TOKEN_IDENTIFIER)) return NULL;
         int v_line = parser->current_token->line, v_column = parser->current_token->column;
-        const char *variant_name = arena_strdup(parser->arena, parser->current_token->value);
+        const char *variant_name = parser->current_token->value;
         if (variant_name == NULL) return NULL;
         parser_consume(parser);
         if (!parser_expect(parser, TOKEN_COLON)) return NULL;
         ASTNode *variant_type = parser_parse_type(parser);
         if (variant_type == NULL) return NULL;
-        ASTNode *variant = ast_new_node(AST_VAR_DECL, v_line, v_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *variant = parser_new_node(parser, AST_VAR_DECL, v_line, v_column, parser->lexer ? parser->lexer->filename : NULL);
         if (variant == NULL) return NULL;
         variant->data.var_decl.name = variant_name;
         variant->data.var_decl.type = variant_type;
@@ -1144,7 +1143,7 @@ ASTNode *parser_parse_enum(Parser *parser) {
         return NULL;
     }
     
-    const char *enum_name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *enum_name = parser->current_token->value;
     if (enum_name == NULL) {
         return NULL;
     }
@@ -1153,7 +1152,7 @@ ASTNode *parser_parse_enum(Parser *parser) {
     parser_consume(parser);
     
     // 创建枚举声明节点
-    ASTNode *enum_decl = ast_new_node(AST_ENUM_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *enum_decl = parser_new_node(parser, AST_ENUM_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (enum_decl == NULL) {
         return NULL;
     }
@@ -1184,7 +1183,7 @@ ASTNode *parser_parse_enum(Parser *parser) {
             return NULL;
         }
         
-        const char *variant_name = arena_strdup(parser->arena, parser->current_token->value);
+        const char *variant_name = parser->current_token->value;
         if (variant_name == NULL) {
             return NULL;
         }
@@ -1224,7 +1223,7 @@ ASTNode *parser_parse_enum(Parser *parser) {
             }
             
             // 复制数字值字符串到 Arena
-            variant_value = arena_strdup(parser->arena, parser->current_token->value);
+            variant_value = parser->current_token->value;
             if (variant_value == NULL) {
                 return NULL;
             }
@@ -1273,7 +1272,7 @@ static ASTNode *parser_parse_error_decl(Parser *parser) {
     if (!parser_match(parser, TOKEN_IDENTIFIER)) {
         return NULL;
     }
-    const char *name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *name = parser->current_token->value;
     if (name == NULL) {
         return NULL;
     }
@@ -1281,7 +1280,7 @@ static ASTNode *parser_parse_error_decl(Parser *parser) {
     if (!parser_expect(parser, TOKEN_SEMICOLON)) {
         return NULL;
     }
-    ASTNode *node = ast_new_node(AST_ERROR_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *node = parser_new_node(parser, AST_ERROR_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (node == NULL) {
         return NULL;
     }
@@ -1298,12 +1297,12 @@ static ASTNode *parser_parse_interface(Parser *parser) {
     int column = parser->current_token->column;
     parser_consume(parser);
     if (!parser_match(parser, TOKEN_IDENTIFIER)) return NULL;
-    const char *iface_name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *iface_name = parser->current_token->value;
     if (!iface_name) return NULL;
     parser_consume(parser);
     
     // 创建接口声明节点
-    ASTNode *interface_decl = ast_new_node(AST_INTERFACE_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *interface_decl = parser_new_node(parser, AST_INTERFACE_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (interface_decl == NULL) return NULL;
     
     interface_decl->data.interface_decl.name = iface_name;
@@ -1330,7 +1329,7 @@ static ASTNode *parser_parse_interface(Parser *parser) {
                 return NULL;  // 错误：期望类型参数名称
             }
             
-            const char *param_name = arena_strdup(parser->arena, parser->current_token->value);
+            const char *param_name = parser->current_token->value;
             if (param_name == NULL) return NULL;
             parser_consume(parser);
             
@@ -1362,7 +1361,7 @@ static ASTNode *parser_parse_interface(Parser *parser) {
                 while (parser->current_token != NULL && 
                        parser_match(parser, TOKEN_IDENTIFIER)) {
                     
-                    const char *constraint_name = arena_strdup(parser->arena, parser->current_token->value);
+                    const char *constraint_name = parser->current_token->value;
                     if (constraint_name == NULL) return NULL;
                     parser_consume(parser);
                     
@@ -1422,7 +1421,7 @@ static ASTNode *parser_parse_interface(Parser *parser) {
         // 接口体中只允许两种形式：fn method(...) 或 IName;
         if (parser_match(parser, TOKEN_IDENTIFIER)) {
             // 这是组合接口引用：IReader;
-            const char *composed_name = arena_strdup(parser->arena, parser->current_token->value);
+            const char *composed_name = parser->current_token->value;
             if (!composed_name) return NULL;
             parser_consume(parser);  // 消费标识符
             if (!parser_expect(parser, TOKEN_SEMICOLON)) return NULL;  // 期望分号
@@ -1443,7 +1442,7 @@ static ASTNode *parser_parse_interface(Parser *parser) {
         int mc = parser->current_token->column;
         parser_consume(parser);
         if (!parser_match(parser, TOKEN_IDENTIFIER)) return NULL;
-        const char *method_name = arena_strdup(parser->arena, parser->current_token->value);
+        const char *method_name = parser->current_token->value;
         if (!method_name) return NULL;
         parser_consume(parser);
         if (!parser_expect(parser, TOKEN_LEFT_PAREN)) return NULL;
@@ -1452,7 +1451,7 @@ static ASTNode *parser_parse_interface(Parser *parser) {
         int param_cap = 0;
         while (parser->current_token != NULL && !parser_match(parser, TOKEN_RIGHT_PAREN) && !parser_match(parser, TOKEN_EOF)) {
             if (!parser_match(parser, TOKEN_IDENTIFIER)) return NULL;
-            const char *pname = arena_strdup(parser->arena, parser->current_token->value);
+            const char *pname = parser->current_token->value;
             if (!pname) return NULL;
             parser_consume(parser);
             if (!parser_expect(parser, TOKEN_COLON)) return NULL;
@@ -1466,7 +1465,7 @@ static ASTNode *parser_parse_interface(Parser *parser) {
                 params = new_p;
                 param_cap = new_cap;
             }
-            ASTNode *pnode = ast_new_node(AST_VAR_DECL, ml, mc, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *pnode = parser_new_node(parser, AST_VAR_DECL, ml, mc, parser->lexer ? parser->lexer->filename : NULL);
             if (!pnode) return NULL;
             pnode->data.var_decl.name = pname;
             pnode->data.var_decl.type = ptype;
@@ -1480,7 +1479,7 @@ static ASTNode *parser_parse_interface(Parser *parser) {
         ASTNode *ret_type = parser_parse_type(parser);
         if (!ret_type) return NULL;
         if (!parser_expect(parser, TOKEN_SEMICOLON)) return NULL;
-        ASTNode *sig = ast_new_node(AST_FN_DECL, ml, mc, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *sig = parser_new_node(parser, AST_FN_DECL, ml, mc, parser->lexer ? parser->lexer->filename : NULL);
         if (!sig) return NULL;
         sig->data.fn_decl.name = method_name;
         sig->data.fn_decl.type_params = NULL;
@@ -1531,7 +1530,7 @@ static ASTNode *parser_parse_method_block(Parser *parser, const char *struct_nam
             // 可能是宏调用：macro_name(args);
             int item_line = parser->current_token->line;
             int item_col = parser->current_token->column;
-            const char *name = arena_strdup(parser->arena, parser->current_token->value);
+            const char *name = parser->current_token->value;
             if (!name) return NULL;
             parser_consume(parser);
             
@@ -1539,12 +1538,12 @@ static ASTNode *parser_parse_method_block(Parser *parser, const char *struct_nam
                 // 宏调用：name(args);
                 parser_consume(parser);  // 消费 '('
                 
-                ASTNode *callee = ast_new_node(AST_IDENTIFIER, item_line, item_col, parser->arena, 
+                ASTNode *callee = parser_new_node(parser, AST_IDENTIFIER, item_line, item_col, 
                     parser->lexer ? parser->lexer->filename : NULL);
                 if (!callee) return NULL;
                 callee->data.identifier.name = name;
                 
-                ASTNode *call = ast_new_node(AST_CALL_EXPR, item_line, item_col, parser->arena,
+                ASTNode *call = parser_new_node(parser, AST_CALL_EXPR, item_line, item_col,
                     parser->lexer ? parser->lexer->filename : NULL);
                 if (!call) return NULL;
                 call->data.call_expr.callee = callee;
@@ -1598,7 +1597,7 @@ static ASTNode *parser_parse_method_block(Parser *parser, const char *struct_nam
         methods[method_count++] = item;
     }
     if (!parser_expect(parser, TOKEN_RIGHT_BRACE)) return NULL;
-    ASTNode *node = ast_new_node(AST_METHOD_BLOCK, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *node = parser_new_node(parser, AST_METHOD_BLOCK, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (!node) return NULL;
     node->data.method_block.struct_name = struct_name;
     node->data.method_block.methods = methods;
@@ -1630,7 +1629,7 @@ ASTNode *parser_parse_function(Parser *parser) {
         return NULL;
     }
     
-    const char *fn_name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *fn_name = parser->current_token->value;
     if (fn_name == NULL) {
         return NULL;
     }
@@ -1639,7 +1638,7 @@ ASTNode *parser_parse_function(Parser *parser) {
     parser_consume(parser);
     
     // 创建函数声明节点
-    ASTNode *fn_decl = ast_new_node(AST_FN_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *fn_decl = parser_new_node(parser, AST_FN_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (fn_decl == NULL) {
         return NULL;
     }
@@ -1673,7 +1672,7 @@ ASTNode *parser_parse_function(Parser *parser) {
                 return NULL;  // 错误：期望类型参数名称
             }
             
-            const char *param_name = arena_strdup(parser->arena, parser->current_token->value);
+            const char *param_name = parser->current_token->value;
             if (param_name == NULL) return NULL;
             parser_consume(parser);
             
@@ -1705,7 +1704,7 @@ ASTNode *parser_parse_function(Parser *parser) {
                 while (parser->current_token != NULL && 
                        parser_match(parser, TOKEN_IDENTIFIER)) {
                     
-                    const char *constraint_name = arena_strdup(parser->arena, parser->current_token->value);
+                    const char *constraint_name = parser->current_token->value;
                     if (constraint_name == NULL) return NULL;
                     parser_consume(parser);
                     
@@ -1779,9 +1778,9 @@ ASTNode *parser_parse_function(Parser *parser) {
             // 解析参数名称，允许 'type' 关键字作为参数名（常见参数名）
             const char *param_name = NULL;
             if (parser_match(parser, TOKEN_IDENTIFIER)) {
-                param_name = arena_strdup(parser->arena, parser->current_token->value);
+                param_name = parser->current_token->value;
             } else if (parser_match(parser, TOKEN_TYPE)) {
-                param_name = arena_strdup(parser->arena, "type");
+                param_name = intern_cstring(parser->arena, "type");
             } else {
                 return NULL;
             }
@@ -1806,7 +1805,7 @@ ASTNode *parser_parse_function(Parser *parser) {
             }
             
             // 创建参数节点（使用 AST_VAR_DECL，is_const = 0）
-            ASTNode *param = ast_new_node(AST_VAR_DECL, param_line, param_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *param = parser_new_node(parser, AST_VAR_DECL, param_line, param_column, parser->lexer ? parser->lexer->filename : NULL);
             if (param == NULL) {
                 return NULL;
             }
@@ -1906,7 +1905,7 @@ ASTNode *parser_parse_type_alias(Parser *parser) {
         return NULL;
     }
     
-    const char *alias_name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *alias_name = parser->current_token->value;
     if (alias_name == NULL) {
         return NULL;
     }
@@ -1931,7 +1930,7 @@ ASTNode *parser_parse_type_alias(Parser *parser) {
     }
     
     // 创建类型别名节点
-    ASTNode *type_alias = ast_new_node(AST_TYPE_ALIAS, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *type_alias = parser_new_node(parser, AST_TYPE_ALIAS, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (type_alias == NULL) {
         return NULL;
     }
@@ -1972,7 +1971,7 @@ ASTNode *parser_parse_macro(Parser *parser) {
         return NULL;
     }
     
-    const char *macro_name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *macro_name = parser->current_token->value;
     if (macro_name == NULL) {
         return NULL;
     }
@@ -1981,7 +1980,7 @@ ASTNode *parser_parse_macro(Parser *parser) {
     parser_consume(parser);
     
     // 创建宏声明节点
-    ASTNode *macro_decl = ast_new_node(AST_MACRO_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *macro_decl = parser_new_node(parser, AST_MACRO_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (macro_decl == NULL) {
         return NULL;
     }
@@ -2020,7 +2019,7 @@ ASTNode *parser_parse_macro(Parser *parser) {
             
             int param_line = parser->current_token->line;
             int param_column = parser->current_token->column;
-            const char *param_name = arena_strdup(parser->arena, parser->current_token->value);
+            const char *param_name = parser->current_token->value;
             if (param_name == NULL) {
                 return NULL;
             }
@@ -2036,10 +2035,10 @@ ASTNode *parser_parse_macro(Parser *parser) {
             // 注意：'type' 既是关键字又是宏参数类型，需要同时接受 TOKEN_IDENTIFIER 和 TOKEN_TYPE
             const char *param_type_str = NULL;
             if (parser_match(parser, TOKEN_IDENTIFIER)) {
-                param_type_str = arena_strdup(parser->arena, parser->current_token->value);
+                param_type_str = parser->current_token->value;
             } else if (parser_match(parser, TOKEN_TYPE)) {
                 // 'type' 关键字在宏参数类型位置作为参数类型标识符
-                param_type_str = arena_strdup(parser->arena, "type");
+                param_type_str = intern_cstring(parser->arena, "type");
             } else {
                 const char *filename = parser->lexer && parser->lexer->filename ? parser->lexer->filename : "<unknown>";
                 fprintf(stderr, "错误: 语法分析失败 (%s:%d:%d): 宏参数类型必须是 'expr', 'stmt', 'type', 'pattern' 或 'ident'\n",
@@ -2080,13 +2079,13 @@ ASTNode *parser_parse_macro(Parser *parser) {
             
             // 创建参数节点（使用 AST_VAR_DECL，type 字段存储参数类型字符串作为标识符）
             // 注意：这里我们使用 AST_TYPE_NAMED 来存储参数类型字符串
-            ASTNode *param_type_node = ast_new_node(AST_TYPE_NAMED, param_line, param_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *param_type_node = parser_new_node(parser, AST_TYPE_NAMED, param_line, param_column, parser->lexer ? parser->lexer->filename : NULL);
             if (param_type_node == NULL) {
                 return NULL;
             }
             param_type_node->data.type_named.name = param_type_str;
             
-            ASTNode *param = ast_new_node(AST_VAR_DECL, param_line, param_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *param = parser_new_node(parser, AST_VAR_DECL, param_line, param_column, parser->lexer ? parser->lexer->filename : NULL);
             if (param == NULL) {
                 return NULL;
             }
@@ -2137,14 +2136,14 @@ ASTNode *parser_parse_macro(Parser *parser) {
     // 注意：struct 和 type 是关键字，其他是标识符
     const char *return_tag = NULL;
     if (parser_match(parser, TOKEN_STRUCT)) {
-        return_tag = arena_strdup(parser->arena, "struct");
+        return_tag = intern_cstring(parser->arena, "struct");
         parser_consume(parser);
     } else if (parser_match(parser, TOKEN_TYPE)) {
         // 'type' 关键字在宏返回标签位置作为标签
-        return_tag = arena_strdup(parser->arena, "type");
+        return_tag = intern_cstring(parser->arena, "type");
         parser_consume(parser);
     } else if (parser_match(parser, TOKEN_IDENTIFIER)) {
-        return_tag = arena_strdup(parser->arena, parser->current_token->value);
+        return_tag = parser->current_token->value;
         if (return_tag == NULL) {
             return NULL;
         }
@@ -2209,12 +2208,12 @@ static ASTNode *parser_parse_extern_function_after_extern(Parser *parser) {
     int column = parser->current_token->column;
     if (!parser_expect(parser, TOKEN_FN)) return NULL;
     if (!parser_match(parser, TOKEN_IDENTIFIER)) return NULL;
-    const char *fn_name = arena_strdup(parser->arena, parser->current_token->value);
+    const char *fn_name = parser->current_token->value;
     if (fn_name == NULL) return NULL;
     parser_consume(parser);
     
     // 创建函数声明节点
-    ASTNode *fn_decl = ast_new_node(AST_FN_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *fn_decl = parser_new_node(parser, AST_FN_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (fn_decl == NULL) {
         return NULL;
     }
@@ -2258,9 +2257,9 @@ static ASTNode *parser_parse_extern_function_after_extern(Parser *parser) {
             // 解析参数名称，允许 'type' 关键字作为参数名
             const char *param_name = NULL;
             if (parser_match(parser, TOKEN_IDENTIFIER)) {
-                param_name = arena_strdup(parser->arena, parser->current_token->value);
+                param_name = parser->current_token->value;
             } else if (parser_match(parser, TOKEN_TYPE)) {
-                param_name = arena_strdup(parser->arena, "type");
+                param_name = intern_cstring(parser->arena, "type");
             } else {
                 return NULL;
             }
@@ -2285,7 +2284,7 @@ static ASTNode *parser_parse_extern_function_after_extern(Parser *parser) {
             }
             
             // 创建参数节点（使用 AST_VAR_DECL，is_const = 0）
-            ASTNode *param = ast_new_node(AST_VAR_DECL, param_line, param_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *param = parser_new_node(parser, AST_VAR_DECL, param_line, param_column, parser->lexer ? parser->lexer->filename : NULL);
             if (param == NULL) {
                 return NULL;
             }
@@ -2416,7 +2415,7 @@ ASTNode *parser_parse_use_stmt(Parser *parser) {
             path_segment_capacity = new_capacity;
         }
         
-        const char *segment = arena_strdup(parser->arena, parser->current_token->value);
+        const char *segment = parser->current_token->value;
         if (segment == NULL) {
             return NULL;
         }
@@ -2431,7 +2430,7 @@ ASTNode *parser_parse_use_stmt(Parser *parser) {
     }
     
     // 创建 use 语句节点
-    ASTNode *use_stmt = ast_new_node(AST_USE_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *use_stmt = parser_new_node(parser, AST_USE_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (use_stmt == NULL) {
         return NULL;
     }
@@ -2451,7 +2450,7 @@ ASTNode *parser_parse_use_stmt(Parser *parser) {
                     parser->current_token ? parser->current_token->column : 0);
             return NULL;
         }
-        use_stmt->data.use_stmt.item_name = arena_strdup(parser->arena, parser->current_token->value);
+        use_stmt->data.use_stmt.item_name = parser->current_token->value;
         if (use_stmt->data.use_stmt.item_name == NULL) {
             return NULL;
         }
@@ -2468,7 +2467,7 @@ ASTNode *parser_parse_use_stmt(Parser *parser) {
                     parser->current_token ? parser->current_token->column : 0);
             return NULL;
         }
-        use_stmt->data.use_stmt.alias = arena_strdup(parser->arena, parser->current_token->value);
+        use_stmt->data.use_stmt.alias = parser->current_token->value;
         if (use_stmt->data.use_stmt.alias == NULL) {
             return NULL;
         }
@@ -2596,7 +2595,7 @@ ASTNode *parser_parse_declaration(Parser *parser) {
         }
         return decl;
     } else if (parser_match(parser, TOKEN_IDENTIFIER)) {
-        const char *name = arena_strdup(parser->arena, parser->current_token->value);
+        const char *name = parser->current_token->value;
         if (!name) return NULL;
         parser_consume(parser);
         if (parser->current_token != NULL && parser_match(parser, TOKEN_LEFT_BRACE)) {
@@ -2631,7 +2630,7 @@ ASTNode *parser_parse(Parser *parser) {
     int line = parser->current_token->line;
     int column = parser->current_token->column;
     
-    ASTNode *program = ast_new_node(AST_PROGRAM, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+    ASTNode *program = parser_new_node(parser, AST_PROGRAM, line, column, parser->lexer ? parser->lexer->filename : NULL);
     if (program == NULL) {
         return NULL;
     }
@@ -2771,7 +2770,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     
     // 解析整数字面量
     if (parser->current_token->type == TOKEN_NUMBER) {
-        ASTNode *node = ast_new_node(AST_NUMBER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_NUMBER, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -2786,7 +2785,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     
     // 解析浮点字面量
     if (parser->current_token->type == TOKEN_FLOAT) {
-        ASTNode *node = ast_new_node(AST_FLOAT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_FLOAT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -2801,7 +2800,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     
     // 解析布尔字面量
     if (parser->current_token->type == TOKEN_TRUE) {
-        ASTNode *node = ast_new_node(AST_BOOL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BOOL, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -2813,7 +2812,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     }
     
     if (parser->current_token->type == TOKEN_FALSE) {
-        ASTNode *node = ast_new_node(AST_BOOL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BOOL, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -2847,7 +2846,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
         }
         
         // 创建宏插值节点
-        ASTNode *interp_node = ast_new_node(AST_MC_INTERP, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *interp_node = parser_new_node(parser, AST_MC_INTERP, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (interp_node == NULL) {
             return NULL;
         }
@@ -2919,7 +2918,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             }
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_STRING_INTERP, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_STRING_INTERP, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -2939,7 +2938,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     
     // 解析字符串字面量（无插值）
     if (parser->current_token->type == TOKEN_STRING || parser->current_token->type == TOKEN_RAW_STRING) {
-        ASTNode *node = ast_new_node(AST_STRING, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_STRING, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -2968,11 +2967,11 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
         if (parser->current_token == NULL || parser->current_token->type != TOKEN_IDENTIFIER) {
             return NULL;
         }
-        const char *err_name = arena_strdup(parser->arena, parser->current_token->value);
+        const char *err_name = parser->current_token->value;
         if (err_name == NULL) {
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_ERROR_VALUE, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_ERROR_VALUE, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -2984,7 +2983,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 解析 match 表达式：match expr { pat => expr, ... [else => expr] }
     if (parser->current_token->type == TOKEN_MATCH) {
         parser_consume(parser);
-        ASTNode *match_expr_node = ast_new_node(AST_MATCH_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *match_expr_node = parser_new_node(parser, AST_MATCH_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (match_expr_node == NULL) return NULL;
         ASTNode *expr_val = parser_parse_expression(parser);
         if (expr_val == NULL) return NULL;
@@ -3001,17 +3000,17 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 parser_consume(parser);
             } else if (parser->current_token->type == TOKEN_NUMBER) {
                 kind = MATCH_PAT_LITERAL;
-                lit_expr = ast_new_node(AST_NUMBER, parser->current_token->line, parser->current_token->column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                lit_expr = parser_new_node(parser, AST_NUMBER, parser->current_token->line, parser->current_token->column, parser->lexer ? parser->lexer->filename : NULL);
                 if (lit_expr) lit_expr->data.number.value = parse_integer_literal(parser->current_token->value, parser->arena);
                 parser_consume(parser);
             } else if (parser->current_token->type == TOKEN_TRUE) {
                 kind = MATCH_PAT_LITERAL;
-                lit_expr = ast_new_node(AST_BOOL, parser->current_token->line, parser->current_token->column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                lit_expr = parser_new_node(parser, AST_BOOL, parser->current_token->line, parser->current_token->column, parser->lexer ? parser->lexer->filename : NULL);
                 if (lit_expr) lit_expr->data.bool_literal.value = 1;
                 parser_consume(parser);
             } else if (parser->current_token->type == TOKEN_FALSE) {
                 kind = MATCH_PAT_LITERAL;
-                lit_expr = ast_new_node(AST_BOOL, parser->current_token->line, parser->current_token->column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                lit_expr = parser_new_node(parser, AST_BOOL, parser->current_token->line, parser->current_token->column, parser->lexer ? parser->lexer->filename : NULL);
                 if (lit_expr) lit_expr->data.bool_literal.value = 0;
                 parser_consume(parser);
             } else if (parser->current_token->type == TOKEN_ERROR) {
@@ -3020,21 +3019,21 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 if (!parser_match(parser, TOKEN_DOT) || parser->current_token == NULL) return NULL;
                 parser_consume(parser);
                 if (parser->current_token->type != TOKEN_IDENTIFIER) return NULL;
-                err_name = arena_strdup(parser->arena, parser->current_token->value);
+                err_name = parser->current_token->value;
                 parser_consume(parser);
             } else if (parser->current_token->type == TOKEN_DOT) {
                 kind = MATCH_PAT_UNION;
                 parser_consume(parser);
                 if (parser->current_token == NULL || parser->current_token->type != TOKEN_IDENTIFIER) return NULL;
-                variant_name = arena_strdup(parser->arena, parser->current_token->value);
+                variant_name = parser->current_token->value;
                 if (variant_name == NULL) return NULL;
                 parser_consume(parser);
                 if (!parser_expect(parser, TOKEN_LEFT_PAREN)) return NULL;
                 if (parser->current_token != NULL && parser->current_token->type == TOKEN_IDENTIFIER && parser->current_token->value != NULL && strcmp(parser->current_token->value, "_") == 0) {
-                    bind_name = arena_strdup(parser->arena, "_");
+                    bind_name = intern_cstring(parser->arena, "_");
                     parser_consume(parser);
                 } else if (parser->current_token != NULL && parser->current_token->type == TOKEN_IDENTIFIER) {
-                    bind_name = arena_strdup(parser->arena, parser->current_token->value);
+                    bind_name = parser->current_token->value;
                     if (bind_name == NULL) return NULL;
                     parser_consume(parser);
                 } else {
@@ -3049,12 +3048,12 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     enum_name = first;
                     parser_consume(parser);
                     if (parser->current_token == NULL || parser->current_token->type != TOKEN_IDENTIFIER) return NULL;
-                    variant_name = arena_strdup(parser->arena, parser->current_token->value);
+                    variant_name = parser->current_token->value;
                     if (variant_name == NULL) return NULL;
                     parser_consume(parser);
                 } else {
                     kind = MATCH_PAT_BIND;
-                    bind_name = arena_strdup(parser->arena, first);
+                    bind_name = intern_cstring(parser->arena, first);
                 }
             } else if (parser->current_token->type == TOKEN_IDENTIFIER && parser->current_token->value != NULL && strcmp(parser->current_token->value, "_") == 0) {
                 kind = MATCH_PAT_WILDCARD;
@@ -3093,13 +3092,13 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     
     // 解析 null 字面量（null 被解析为标识符节点，在代码生成阶段通过字符串比较识别）
     if (parser->current_token->type == TOKEN_NULL) {
-        ASTNode *node = ast_new_node(AST_IDENTIFIER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_IDENTIFIER, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
         
         // 复制 "null" 字符串到 Arena（代码生成器会通过字符串比较识别）
-        const char *null_name = arena_strdup(parser->arena, parser->current_token->value);
+        const char *null_name = parser->current_token->value;
         if (null_name == NULL) {
             return NULL;
         }
@@ -3112,7 +3111,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 解析 @params（函数体内参数元组），支持 @params.0、@params.1 等后缀
     if (parser->current_token->type == TOKEN_AT_IDENTIFIER && parser->current_token->value != NULL &&
         strcmp(parser->current_token->value, "params") == 0) {
-        ASTNode *node = ast_new_node(AST_PARAMS, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_PARAMS, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -3128,13 +3127,13 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 return NULL;
             }
             const char *field_name = parser->current_token->type == TOKEN_TYPE ?
-                arena_strdup(parser->arena, "type") :
-                arena_strdup(parser->arena, parser->current_token->value);
+                intern_cstring(parser->arena, "type") :
+                parser->current_token->value;
             if (field_name == NULL) return NULL;
             int field_line = parser->current_token->line;
             int field_column = parser->current_token->column;
             parser_consume(parser);
-            ASTNode *member_access = ast_new_node(AST_MEMBER_ACCESS, field_line, field_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *member_access = parser_new_node(parser, AST_MEMBER_ACCESS, field_line, field_column, parser->lexer ? parser->lexer->filename : NULL);
             if (member_access == NULL) return NULL;
             member_access->data.member_access.object = result;
             member_access->data.member_access.field_name = field_name;
@@ -3146,7 +3145,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 解析 @max/@min 整数极值字面量（类型由 Checker 从上下文推断）
     if (parser->current_token->type == TOKEN_AT_IDENTIFIER && parser->current_token->value != NULL &&
         strcmp(parser->current_token->value, "max") == 0) {
-        ASTNode *node = ast_new_node(AST_INT_LIMIT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_INT_LIMIT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -3157,7 +3156,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     }
     if (parser->current_token->type == TOKEN_AT_IDENTIFIER && parser->current_token->value != NULL &&
         strcmp(parser->current_token->value, "min") == 0) {
-        ASTNode *node = ast_new_node(AST_INT_LIMIT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_INT_LIMIT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -3170,7 +3169,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 解析 @src_name 表达式
     if (parser->current_token->type == TOKEN_AT_IDENTIFIER && parser->current_token->value != NULL &&
         strcmp(parser->current_token->value, "src_name") == 0) {
-        ASTNode *node = ast_new_node(AST_SRC_NAME, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_SRC_NAME, line, column, parser->lexer ? parser->lexer->filename : NULL);
         parser_consume(parser);
         return node;
     }
@@ -3178,7 +3177,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 解析 @src_path 表达式
     if (parser->current_token->type == TOKEN_AT_IDENTIFIER && parser->current_token->value != NULL &&
         strcmp(parser->current_token->value, "src_path") == 0) {
-        ASTNode *node = ast_new_node(AST_SRC_PATH, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_SRC_PATH, line, column, parser->lexer ? parser->lexer->filename : NULL);
         parser_consume(parser);
         return node;
     }
@@ -3186,7 +3185,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 解析 @src_line 表达式
     if (parser->current_token->type == TOKEN_AT_IDENTIFIER && parser->current_token->value != NULL &&
         strcmp(parser->current_token->value, "src_line") == 0) {
-        ASTNode *node = ast_new_node(AST_SRC_LINE, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_SRC_LINE, line, column, parser->lexer ? parser->lexer->filename : NULL);
         parser_consume(parser);
         return node;
     }
@@ -3194,7 +3193,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 解析 @src_col 表达式
     if (parser->current_token->type == TOKEN_AT_IDENTIFIER && parser->current_token->value != NULL &&
         strcmp(parser->current_token->value, "src_col") == 0) {
-        ASTNode *node = ast_new_node(AST_SRC_COL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_SRC_COL, line, column, parser->lexer ? parser->lexer->filename : NULL);
         parser_consume(parser);
         return node;
     }
@@ -3202,7 +3201,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 解析 @func_name 表达式
     if (parser->current_token->type == TOKEN_AT_IDENTIFIER && parser->current_token->value != NULL &&
         strcmp(parser->current_token->value, "func_name") == 0) {
-        ASTNode *node = ast_new_node(AST_FUNC_NAME, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_FUNC_NAME, line, column, parser->lexer ? parser->lexer->filename : NULL);
         parser_consume(parser);
         return node;
     }
@@ -3217,7 +3216,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *syscall_node = ast_new_node(AST_SYSCALL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *syscall_node = parser_new_node(parser, AST_SYSCALL, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (syscall_node == NULL) {
             return NULL;
         }
@@ -3283,7 +3282,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *sizeof_node = ast_new_node(AST_SIZEOF, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *sizeof_node = parser_new_node(parser, AST_SIZEOF, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (sizeof_node == NULL) {
             return NULL;
         }
@@ -3353,7 +3352,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *alignof_node = ast_new_node(AST_ALIGNOF, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *alignof_node = parser_new_node(parser, AST_ALIGNOF, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (alignof_node == NULL) {
             return NULL;
         }
@@ -3423,7 +3422,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *len_node = ast_new_node(AST_LEN, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *len_node = parser_new_node(parser, AST_LEN, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (len_node == NULL) {
             return NULL;
         }
@@ -3454,7 +3453,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *mc_code_node = ast_new_node(AST_MC_CODE, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *mc_code_node = parser_new_node(parser, AST_MC_CODE, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (mc_code_node == NULL) {
             return NULL;
         }
@@ -3486,7 +3485,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *mc_ast_node = ast_new_node(AST_MC_AST, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *mc_ast_node = parser_new_node(parser, AST_MC_AST, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (mc_ast_node == NULL) {
             return NULL;
         }
@@ -3536,7 +3535,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *mc_eval_node = ast_new_node(AST_MC_EVAL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *mc_eval_node = parser_new_node(parser, AST_MC_EVAL, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (mc_eval_node == NULL) {
             return NULL;
         }
@@ -3567,7 +3566,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *mc_error_node = ast_new_node(AST_MC_ERROR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *mc_error_node = parser_new_node(parser, AST_MC_ERROR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (mc_error_node == NULL) {
             return NULL;
         }
@@ -3598,7 +3597,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return NULL;
         }
         
-        ASTNode *mc_type_node = ast_new_node(AST_MC_TYPE, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *mc_type_node = parser_new_node(parser, AST_MC_TYPE, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (mc_type_node == NULL) {
             return NULL;
         }
@@ -3642,13 +3641,13 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
         }
         
         // 创建一个调用节点来表示 @mc_get_env 调用
-        ASTNode *callee = ast_new_node(AST_IDENTIFIER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *callee = parser_new_node(parser, AST_IDENTIFIER, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (callee == NULL) {
             return NULL;
         }
         callee->data.identifier.name = "mc_get_env";
         
-        ASTNode *call_node = ast_new_node(AST_CALL_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *call_node = parser_new_node(parser, AST_CALL_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (call_node == NULL) {
             return NULL;
         }
@@ -3683,7 +3682,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
         strcmp(parser->current_token->value, "await") == 0) {
         parser_consume(parser);  // 消费 'await'
         
-        ASTNode *await_node = ast_new_node(AST_AWAIT_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *await_node = parser_new_node(parser, AST_AWAIT_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (await_node == NULL) {
             return NULL;
         }
@@ -3702,7 +3701,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     // 忽略占位 _：仅允许在赋值左侧、解构中使用，生成 AST_UNDERSCORE
     if (parser->current_token->type == TOKEN_IDENTIFIER) {
         if (parser->current_token->value != NULL && strcmp(parser->current_token->value, "_") == 0) {
-            ASTNode *node = ast_new_node(AST_UNDERSCORE, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *node = parser_new_node(parser, AST_UNDERSCORE, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (node == NULL) {
                 return NULL;
             }
@@ -3716,9 +3715,9 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
     if (parser->current_token->type == TOKEN_IDENTIFIER || parser->current_token->type == TOKEN_TYPE) {
         const char *name = NULL;
         if (parser->current_token->type == TOKEN_TYPE) {
-            name = arena_strdup(parser->arena, "type");
+            name = intern_cstring(parser->arena, "type");
         } else {
-            name = arena_strdup(parser->arena, parser->current_token->value);
+            name = parser->current_token->value;
         }
         if (name == NULL) {
             return NULL;
@@ -3733,13 +3732,8 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
         if (parser->current_token != NULL && parser->current_token->type == TOKEN_LESS) {
             // 需要区分泛型参数 ID<Type> 和比较运算符 ID < expr
             // 策略：peek '<' 后面的 token，判断是类型还是表达式
-            Lexer *lexer = parser->lexer;
-            size_t saved_position = lexer->position;
-            int saved_line = lexer->line;
-            int saved_column = lexer->column;
-            
             // Peek '<' 后面的 token
-            Token *after_less = lexer_next_token(lexer, parser->arena);
+            Token *after_less = parser_peek(parser, 1);
             
             // 如果 '<' 后面是表达式的开始（数字、浮点、字符串、负号等），则 '<' 是比较运算符
             int is_comparison = 0;
@@ -3755,7 +3749,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     // 如果是标识符，需要进一步判断：
                     // - 如果标识符后面是 '>'、','、'*'、'['、'<'（嵌套泛型），则可能是泛型参数（类型）
                     // - 如果标识符后面是运算符、'{'、'.'、'['（成员访问/索引），则是比较运算符（变量）
-                    Token *after_id = lexer_next_token(lexer, parser->arena);
+                    Token *after_id = parser_peek(parser, 2);
                     if (after_id != NULL) {
                         TokenType t2 = after_id->type;
                         // 如果标识符后面是这些 token，则 '<' 是比较运算符
@@ -3776,14 +3770,9 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 }
             }
             
-            // 恢复 lexer 状态
-            lexer->position = saved_position;
-            lexer->line = saved_line;
-            lexer->column = saved_column;
-            
             if (is_comparison) {
                 // '<' 是比较运算符，不解析泛型参数，直接返回标识符
-                ASTNode *node = ast_new_node(AST_IDENTIFIER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                ASTNode *node = parser_new_node(parser, AST_IDENTIFIER, line, column, parser->lexer ? parser->lexer->filename : NULL);
                 if (node == NULL) {
                     return NULL;
                 }
@@ -3866,13 +3855,13 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
         // 检查下一个 token 类型
         if (parser->current_token != NULL && parser->current_token->type == TOKEN_LEFT_PAREN) {
             // 函数调用：ID ['<' type_list '>'] '(' [ arg_list ] ')'
-            ASTNode *call = ast_new_node(AST_CALL_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *call = parser_new_node(parser, AST_CALL_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (call == NULL) {
                 return NULL;
             }
             
             // 创建标识符节点作为被调用的函数
-            ASTNode *callee = ast_new_node(AST_IDENTIFIER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *callee = parser_new_node(parser, AST_IDENTIFIER, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (callee == NULL) {
                 return NULL;
             }
@@ -3966,8 +3955,8 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     }
                     
                     const char *field_name = parser->current_token->type == TOKEN_TYPE ?
-                        arena_strdup(parser->arena, "type") :
-                        arena_strdup(parser->arena, parser->current_token->value);
+                        intern_cstring(parser->arena, "type") :
+                        parser->current_token->value;
                     if (field_name == NULL) {
                         return NULL;
                     }
@@ -3977,7 +3966,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     parser_consume(parser);  // 消费字段名称
                     
                     // 创建字段访问节点
-                    ASTNode *member_access = ast_new_node(AST_MEMBER_ACCESS, field_line, field_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *member_access = parser_new_node(parser, AST_MEMBER_ACCESS, field_line, field_column, parser->lexer ? parser->lexer->filename : NULL);
                     if (member_access == NULL) {
                         return NULL;
                     }
@@ -3989,7 +3978,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 } else if (parser_match(parser, TOKEN_LEFT_PAREN)) {
                     // 方法调用：obj.method(args)
                     parser_consume(parser);
-                    ASTNode *call = ast_new_node(AST_CALL_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *call = parser_new_node(parser, AST_CALL_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
                     if (call == NULL) return NULL;
                     call->data.call_expr.callee = result;
                     call->data.call_expr.has_ellipsis_forward = 0;
@@ -4033,7 +4022,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                         ASTNode *len_expr = parser_parse_expression(parser);
                         if (len_expr == NULL) return NULL;
                         if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) return NULL;
-                        ASTNode *slice_expr = ast_new_node(AST_SLICE_EXPR, bracket_line, bracket_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                        ASTNode *slice_expr = parser_new_node(parser, AST_SLICE_EXPR, bracket_line, bracket_column, parser->lexer ? parser->lexer->filename : NULL);
                         if (slice_expr == NULL) return NULL;
                         slice_expr->data.slice_expr.base = result;
                         slice_expr->data.slice_expr.start_expr = first_expr;
@@ -4041,7 +4030,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                         result = slice_expr;
                     } else {
                         if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) return NULL;
-                        ASTNode *array_access = ast_new_node(AST_ARRAY_ACCESS, bracket_line, bracket_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                        ASTNode *array_access = parser_new_node(parser, AST_ARRAY_ACCESS, bracket_line, bracket_column, parser->lexer ? parser->lexer->filename : NULL);
                         if (array_access == NULL) return NULL;
                         array_access->data.array_access.array = result;
                         array_access->data.array_access.index = first_expr;
@@ -4088,7 +4077,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             if (!is_struct_init) {
                 // 不是结构体字面量，创建普通标识符（后面的'{'是代码块的开始，不是表达式的一部分）
                 // 这种情况不应该出现在表达式解析中，但为了健壮性，我们处理它
-                ASTNode *node = ast_new_node(AST_IDENTIFIER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                ASTNode *node = parser_new_node(parser, AST_IDENTIFIER, line, column, parser->lexer ? parser->lexer->filename : NULL);
                 if (node == NULL) {
                     return NULL;
                 }
@@ -4111,8 +4100,8 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     }
                     
                     const char *field_name = parser->current_token->type == TOKEN_TYPE ?
-                        arena_strdup(parser->arena, "type") :
-                        arena_strdup(parser->arena, parser->current_token->value);
+                        intern_cstring(parser->arena, "type") :
+                        parser->current_token->value;
                     if (field_name == NULL) {
                         return NULL;
                     }
@@ -4122,7 +4111,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     parser_consume(parser);  // 消费字段名称
                     
                     // 创建字段访问节点
-                    ASTNode *member_access = ast_new_node(AST_MEMBER_ACCESS, field_line, field_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *member_access = parser_new_node(parser, AST_MEMBER_ACCESS, field_line, field_column, parser->lexer ? parser->lexer->filename : NULL);
                     if (member_access == NULL) {
                         return NULL;
                     }
@@ -4136,7 +4125,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 // 方法调用：obj.method(args) 或 obj.field 后的 (args)
                 while (parser->current_token != NULL && parser_match(parser, TOKEN_LEFT_PAREN)) {
                     parser_consume(parser);
-                    ASTNode *call = ast_new_node(AST_CALL_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *call = parser_new_node(parser, AST_CALL_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
                     if (call == NULL) return NULL;
                     call->data.call_expr.callee = result;
                     call->data.call_expr.has_ellipsis_forward = 0;
@@ -4190,25 +4179,14 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             // 但是，如果 '{' 后面是 '}'（空块），我们需要检查这是否是在比较表达式之后
             // 如果是，我们不应该解析结构体字面量，而应该返回标识符
             // 为了检查，我们 peek 一下 '{' 后面的内容
-            Lexer *lexer = parser->lexer;
-            size_t saved_position = lexer->position;
-            int saved_line = lexer->line;
-            int saved_column = lexer->column;
-            
-            // Peek '{' 后面的 token
-            Token *after_brace = lexer_next_token(lexer, parser->arena);
+            Token *after_brace = parser_peek(parser, 1);
             if (after_brace && after_brace->type == TOKEN_RIGHT_BRACE) {
                 // '{' 后面是 '}'（空块）
-                // 恢复 lexer 状态
-                lexer->position = saved_position;
-                lexer->line = saved_line;
-                lexer->column = saved_column;
-                
                 // 根据上下文判断
                 if (parser->context == PARSER_CONTEXT_CONDITION) {
                     // 在条件表达式上下文中，`{}` 应该是代码块的开始
                     // 返回标识符，让调用者处理 '{' 作为代码块
-                    ASTNode *node = ast_new_node(AST_IDENTIFIER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *node = parser_new_node(parser, AST_IDENTIFIER, line, column, parser->lexer ? parser->lexer->filename : NULL);
                     if (node == NULL) {
                         return NULL;
                     }
@@ -4220,13 +4198,8 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 // 继续解析结构体字面量
             }
             
-            // 恢复 lexer 状态
-            lexer->position = saved_position;
-            lexer->line = saved_line;
-            lexer->column = saved_column;
-            
             // 继续解析结构体字面量
-            ASTNode *struct_init = ast_new_node(AST_STRUCT_INIT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *struct_init = parser_new_node(parser, AST_STRUCT_INIT, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (struct_init == NULL) {
                 return NULL;
             }
@@ -4253,9 +4226,9 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     // 解析字段名称，允许 'type' 关键字作为字段名
                     const char *field_name = NULL;
                     if (parser_match(parser, TOKEN_IDENTIFIER)) {
-                        field_name = arena_strdup(parser->arena, parser->current_token->value);
+                        field_name = parser->current_token->value;
                     } else if (parser_match(parser, TOKEN_TYPE)) {
-                        field_name = arena_strdup(parser->arena, "type");
+                        field_name = intern_cstring(parser->arena, "type");
                     } else {
                         return NULL;
                     }
@@ -4337,8 +4310,8 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 }
                 
                 const char *field_name = parser->current_token->type == TOKEN_TYPE ?
-                    arena_strdup(parser->arena, "type") :
-                    arena_strdup(parser->arena, parser->current_token->value);
+                    intern_cstring(parser->arena, "type") :
+                    parser->current_token->value;
                 if (field_name == NULL) {
                     return NULL;
                 }
@@ -4348,7 +4321,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 parser_consume(parser);  // 消费字段名称
                 
                 // 创建字段访问节点
-                ASTNode *member_access = ast_new_node(AST_MEMBER_ACCESS, field_line, field_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                ASTNode *member_access = parser_new_node(parser, AST_MEMBER_ACCESS, field_line, field_column, parser->lexer ? parser->lexer->filename : NULL);
                 if (member_access == NULL) {
                     return NULL;
                 }
@@ -4362,7 +4335,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
             return result;
         } else {
             // 普通标识符
-            ASTNode *node = ast_new_node(AST_IDENTIFIER, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *node = parser_new_node(parser, AST_IDENTIFIER, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (node == NULL) {
                 return NULL;
             }
@@ -4387,8 +4360,8 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     }
                     
                     const char *field_name = parser->current_token->type == TOKEN_TYPE ?
-                        arena_strdup(parser->arena, "type") :
-                        arena_strdup(parser->arena, parser->current_token->value);
+                        intern_cstring(parser->arena, "type") :
+                        parser->current_token->value;
                     if (field_name == NULL) {
                         return NULL;
                     }
@@ -4398,7 +4371,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     parser_consume(parser);  // 消费字段名称
                     
                     // 创建字段访问节点
-                    ASTNode *member_access = ast_new_node(AST_MEMBER_ACCESS, field_line, field_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *member_access = parser_new_node(parser, AST_MEMBER_ACCESS, field_line, field_column, parser->lexer ? parser->lexer->filename : NULL);
                     if (member_access == NULL) {
                         return NULL;
                     }
@@ -4409,7 +4382,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     result = member_access;
                 } else if (parser_match(parser, TOKEN_LEFT_PAREN)) {
                     parser_consume(parser);
-                    ASTNode *call = ast_new_node(AST_CALL_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *call = parser_new_node(parser, AST_CALL_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
                     if (call == NULL) return NULL;
                     call->data.call_expr.callee = result;
                     call->data.call_expr.has_ellipsis_forward = 0;
@@ -4453,7 +4426,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                         ASTNode *len_expr = parser_parse_expression(parser);
                         if (len_expr == NULL) return NULL;
                         if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) return NULL;
-                        ASTNode *slice_expr = ast_new_node(AST_SLICE_EXPR, bracket_line, bracket_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                        ASTNode *slice_expr = parser_new_node(parser, AST_SLICE_EXPR, bracket_line, bracket_column, parser->lexer ? parser->lexer->filename : NULL);
                         if (slice_expr == NULL) return NULL;
                         slice_expr->data.slice_expr.base = result;
                         slice_expr->data.slice_expr.start_expr = first_expr;
@@ -4461,7 +4434,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                         result = slice_expr;
                     } else {
                         if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) return NULL;
-                        ASTNode *array_access = ast_new_node(AST_ARRAY_ACCESS, bracket_line, bracket_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                        ASTNode *array_access = parser_new_node(parser, AST_ARRAY_ACCESS, bracket_line, bracket_column, parser->lexer ? parser->lexer->filename : NULL);
                         if (array_access == NULL) return NULL;
                         array_access->data.array_access.array = result;
                         array_access->data.array_access.index = first_expr;
@@ -4483,7 +4456,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
         parser_consume(parser);  // 消费 '['
         
         // 创建数组字面量节点
-        ASTNode *array_literal = ast_new_node(AST_ARRAY_LITERAL, array_line, array_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *array_literal = parser_new_node(parser, AST_ARRAY_LITERAL, array_line, array_column, parser->lexer ? parser->lexer->filename : NULL);
         if (array_literal == NULL) {
             return NULL;
         }
@@ -4589,7 +4562,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     return NULL;
                 }
                 
-                const char *field_name = arena_strdup(parser->arena, parser->current_token->value);
+                const char *field_name = parser->current_token->value;
                 if (field_name == NULL) {
                     return NULL;
                 }
@@ -4599,7 +4572,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 parser_consume(parser);  // 消费字段名称或元组下标
                 
                 // 创建字段访问节点
-                ASTNode *member_access = ast_new_node(AST_MEMBER_ACCESS, field_line, field_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                ASTNode *member_access = parser_new_node(parser, AST_MEMBER_ACCESS, field_line, field_column, parser->lexer ? parser->lexer->filename : NULL);
                 if (member_access == NULL) {
                     return NULL;
                 }
@@ -4619,7 +4592,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     ASTNode *len_expr = parser_parse_expression(parser);
                     if (len_expr == NULL) return NULL;
                     if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) return NULL;
-                    ASTNode *slice_expr = ast_new_node(AST_SLICE_EXPR, bracket_line, bracket_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *slice_expr = parser_new_node(parser, AST_SLICE_EXPR, bracket_line, bracket_column, parser->lexer ? parser->lexer->filename : NULL);
                     if (slice_expr == NULL) return NULL;
                     slice_expr->data.slice_expr.base = result;
                     slice_expr->data.slice_expr.start_expr = first_expr;
@@ -4627,7 +4600,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                     result = slice_expr;
                 } else {
                     if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) return NULL;
-                    ASTNode *array_access = ast_new_node(AST_ARRAY_ACCESS, bracket_line, bracket_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *array_access = parser_new_node(parser, AST_ARRAY_ACCESS, bracket_line, bracket_column, parser->lexer ? parser->lexer->filename : NULL);
                     if (array_access == NULL) return NULL;
                     array_access->data.array_access.array = result;
                     array_access->data.array_access.index = first_expr;
@@ -4688,7 +4661,7 @@ static ASTNode *parser_parse_primary_expr(Parser *parser) {
                 return NULL;
             }
             
-            ASTNode *tuple_lit = ast_new_node(AST_TUPLE_LITERAL, paren_line, paren_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *tuple_lit = parser_new_node(parser, AST_TUPLE_LITERAL, paren_line, paren_column, parser->lexer ? parser->lexer->filename : NULL);
             if (tuple_lit == NULL) {
                 return NULL;
             }
@@ -4718,7 +4691,7 @@ post_paren_suffix:
                     return NULL;
                 }
                 
-                const char *field_name = arena_strdup(parser->arena, parser->current_token->value);
+                const char *field_name = parser->current_token->value;
                 if (field_name == NULL) {
                     return NULL;
                 }
@@ -4728,7 +4701,7 @@ post_paren_suffix:
                 parser_consume(parser);  // 消费字段名称或元组下标
                 
                 // 创建字段访问节点
-                ASTNode *member_access = ast_new_node(AST_MEMBER_ACCESS, field_line, field_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                ASTNode *member_access = parser_new_node(parser, AST_MEMBER_ACCESS, field_line, field_column, parser->lexer ? parser->lexer->filename : NULL);
                 if (member_access == NULL) {
                     return NULL;
                 }
@@ -4748,7 +4721,7 @@ post_paren_suffix:
                     ASTNode *len_expr = parser_parse_expression(parser);
                     if (len_expr == NULL) return NULL;
                     if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) return NULL;
-                    ASTNode *slice_expr = ast_new_node(AST_SLICE_EXPR, bracket_line, bracket_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *slice_expr = parser_new_node(parser, AST_SLICE_EXPR, bracket_line, bracket_column, parser->lexer ? parser->lexer->filename : NULL);
                     if (slice_expr == NULL) return NULL;
                     slice_expr->data.slice_expr.base = result;
                     slice_expr->data.slice_expr.start_expr = first_expr;
@@ -4756,7 +4729,7 @@ post_paren_suffix:
                     result = slice_expr;
                 } else {
                     if (!parser_expect(parser, TOKEN_RIGHT_BRACKET)) return NULL;
-                    ASTNode *array_access = ast_new_node(AST_ARRAY_ACCESS, bracket_line, bracket_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                    ASTNode *array_access = parser_new_node(parser, AST_ARRAY_ACCESS, bracket_line, bracket_column, parser->lexer ? parser->lexer->filename : NULL);
                     if (array_access == NULL) return NULL;
                     array_access->data.array_access.array = result;
                     array_access->data.array_access.index = first_expr;
@@ -4792,7 +4765,7 @@ static ASTNode *parser_parse_unary_expr(Parser *parser) {
         if (operand == NULL) {
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_TRY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_TRY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -4816,7 +4789,7 @@ static ASTNode *parser_parse_unary_expr(Parser *parser) {
         }
         
         // 创建一元表达式节点
-        ASTNode *node = ast_new_node(AST_UNARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_UNARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -4858,7 +4831,7 @@ static ASTNode *parser_parse_cast_expr(Parser *parser) {
         }
         
         // 创建类型转换节点
-        ASTNode *node = ast_new_node(AST_CAST_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_CAST_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -4881,7 +4854,7 @@ static ASTNode *parser_parse_cast_expr(Parser *parser) {
             if (parser->current_token == NULL || parser->current_token->type != TOKEN_IDENTIFIER) {
                 return NULL;
             }
-            err_name = arena_strdup(parser->arena, parser->current_token->value);
+            err_name = parser->current_token->value;
             if (err_name == NULL) {
                 return NULL;
             }
@@ -4895,7 +4868,7 @@ static ASTNode *parser_parse_cast_expr(Parser *parser) {
         if (catch_block == NULL) {
             return NULL;
         }
-        ASTNode *catch_node = ast_new_node(AST_CATCH_EXPR, catch_line, catch_column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *catch_node = parser_new_node(parser, AST_CATCH_EXPR, catch_line, catch_column, parser->lexer ? parser->lexer->filename : NULL);
         if (catch_node == NULL) {
             return NULL;
         }
@@ -4941,7 +4914,7 @@ static ASTNode *parser_parse_mul_expr(Parser *parser) {
         }
         
         // 创建二元表达式节点
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -4990,7 +4963,7 @@ static ASTNode *parser_parse_add_expr(Parser *parser) {
         }
         
         // 创建二元表达式节点
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5032,7 +5005,7 @@ static ASTNode *parser_parse_shift_expr(Parser *parser) {
         if (right == NULL) {
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5079,7 +5052,7 @@ static ASTNode *parser_parse_rel_expr(Parser *parser) {
         // 这用于处理 if/while 条件表达式后的代码块
         if (parser->current_token != NULL && parser->current_token->type == TOKEN_LEFT_BRACE) {
             // 创建二元表达式节点并返回，'{' 由调用者处理
-            ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (node == NULL) {
                 return NULL;
             }
@@ -5090,7 +5063,7 @@ static ASTNode *parser_parse_rel_expr(Parser *parser) {
         }
         
         // 创建二元表达式节点
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5130,7 +5103,7 @@ static ASTNode *parser_parse_bitand_expr(Parser *parser) {
         if (right == NULL) {
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5178,21 +5151,10 @@ static ASTNode *parser_parse_eq_expr(Parser *parser) {
         // 在这种情况下，我们需要回退：如果 right 是结构体初始化，我们需要将其替换为标识符
         if (parser->current_token != NULL && 
             parser->current_token->type == TOKEN_LEFT_BRACE) {
-            // 保存 lexer 状态
-            Lexer *lexer = parser->lexer;
-            size_t saved_position = lexer->position;
-            int saved_line = lexer->line;
-            int saved_column = lexer->column;
-            
             // Peek '{' 后面的 token
-            Token *after_brace = lexer_next_token(lexer, parser->arena);
+            Token *after_brace = parser_peek(parser, 1);
             if (after_brace && after_brace->type == TOKEN_RIGHT_BRACE) {
                 // '{' 后面是 '}'（空块），这可能是代码块的开始
-                // 恢复 lexer 状态
-                lexer->position = saved_position;
-                lexer->line = saved_line;
-                lexer->column = saved_column;
-                
                 // 如果 right 是结构体初始化，我们需要将其替换为标识符
                 // 因为 '{' 应该是代码块的开始，而不是结构体字面量的一部分
                 if (right->type == AST_STRUCT_INIT) {
@@ -5200,7 +5162,7 @@ static ASTNode *parser_parse_eq_expr(Parser *parser) {
                     const char *struct_name = right->data.struct_init.struct_name;
                     if (struct_name) {
                         // 创建标识符节点
-                        ASTNode *identifier = ast_new_node(AST_IDENTIFIER, right->line, right->column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                        ASTNode *identifier = parser_new_node(parser, AST_IDENTIFIER, right->line, right->column, parser->lexer ? parser->lexer->filename : NULL);
                         if (identifier != NULL) {
                             identifier->data.identifier.name = struct_name;
                             right = identifier;
@@ -5210,7 +5172,7 @@ static ASTNode *parser_parse_eq_expr(Parser *parser) {
                 
                 // 停止表达式解析，返回完整的比较表达式（不包含 '{'）
                 // 调用者（如 if 语句解析）会处理 '{' 作为代码块
-                ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
                 if (node == NULL) {
                     return NULL;
                 }
@@ -5221,15 +5183,10 @@ static ASTNode *parser_parse_eq_expr(Parser *parser) {
                 
                 return node;
             }
-            
-            // 恢复 lexer 状态
-            lexer->position = saved_position;
-            lexer->line = saved_line;
-            lexer->column = saved_column;
         }
         
         // 创建二元表达式节点
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5263,7 +5220,7 @@ static ASTNode *parser_parse_xor_expr(Parser *parser) {
         if (right == NULL) {
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5294,7 +5251,7 @@ static ASTNode *parser_parse_bitor_expr(Parser *parser) {
         if (right == NULL) {
             return NULL;
         }
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5336,7 +5293,7 @@ static ASTNode *parser_parse_and_expr(Parser *parser) {
         // 这用于处理 if/while 条件表达式后的代码块
         if (parser->current_token != NULL && parser->current_token->type == TOKEN_LEFT_BRACE) {
             // 创建二元表达式节点并返回，'{' 由调用者处理
-            ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (node == NULL) {
                 return NULL;
             }
@@ -5347,7 +5304,7 @@ static ASTNode *parser_parse_and_expr(Parser *parser) {
         }
         
         // 创建二元表达式节点
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5389,7 +5346,7 @@ static ASTNode *parser_parse_or_expr(Parser *parser) {
         }
         
         // 创建二元表达式节点
-        ASTNode *node = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5461,7 +5418,7 @@ static ASTNode *parser_parse_assign_expr(Parser *parser) {
                 bin_op = TOKEN_PLUS;  // 默认
             }
             
-            ASTNode *bin_expr = ast_new_node(AST_BINARY_EXPR, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *bin_expr = parser_new_node(parser, AST_BINARY_EXPR, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (bin_expr == NULL) {
                 return NULL;
             }
@@ -5472,7 +5429,7 @@ static ASTNode *parser_parse_assign_expr(Parser *parser) {
         }
         
         // 创建赋值节点
-        ASTNode *node = ast_new_node(AST_ASSIGN, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *node = parser_new_node(parser, AST_ASSIGN, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (node == NULL) {
             return NULL;
         }
@@ -5509,7 +5466,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
     
     if (parser_match(parser, TOKEN_DEFER)) {
         parser_consume(parser);
-        ASTNode *stmt = ast_new_node(AST_DEFER_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_DEFER_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) return NULL;
         if (parser_match(parser, TOKEN_LEFT_BRACE)) {
             stmt->data.defer_stmt.body = parser_parse_block(parser);
@@ -5522,7 +5479,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
     
     if (parser_match(parser, TOKEN_ERRDEFER)) {
         parser_consume(parser);
-        ASTNode *stmt = ast_new_node(AST_ERRDEFER_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_ERRDEFER_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) return NULL;
         if (parser_match(parser, TOKEN_LEFT_BRACE)) {
             stmt->data.errdefer_stmt.body = parser_parse_block(parser);
@@ -5536,7 +5493,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
     if (parser_match(parser, TOKEN_TEST)) {
         parser_consume(parser);  // 消费 'test'
         
-        ASTNode *stmt = ast_new_node(AST_TEST_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_TEST_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) return NULL;
         
         // 解析测试说明字符串
@@ -5562,7 +5519,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
         // 解析 return 语句
         parser_consume(parser);  // 消费 'return'
         
-        ASTNode *stmt = ast_new_node(AST_RETURN_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_RETURN_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) {
             return NULL;
         }
@@ -5590,7 +5547,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
         // 解析 break 语句
         parser_consume(parser);  // 消费 'break'
         
-        ASTNode *stmt = ast_new_node(AST_BREAK_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_BREAK_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) {
             return NULL;
         }
@@ -5607,7 +5564,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
         // 解析 continue 语句
         parser_consume(parser);  // 消费 'continue'
         
-        ASTNode *stmt = ast_new_node(AST_CONTINUE_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_CONTINUE_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) {
             return NULL;
         }
@@ -5624,7 +5581,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
         // 解析 if 语句
         parser_consume(parser);  // 消费 'if'
         
-        ASTNode *stmt = ast_new_node(AST_IF_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_IF_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) {
             return NULL;
         }
@@ -5650,7 +5607,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
                 return NULL;
             }
             // 包装单条语句为块节点
-            ASTNode *block = ast_new_node(AST_BLOCK, single->line, single->column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *block = parser_new_node(parser, AST_BLOCK, single->line, single->column, parser->lexer ? parser->lexer->filename : NULL);
             if (block == NULL) {
                 return NULL;
             }
@@ -5696,7 +5653,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
                 if (single == NULL) {
                     return NULL;
                 }
-                ASTNode *block = ast_new_node(AST_BLOCK, single->line, single->column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+                ASTNode *block = parser_new_node(parser, AST_BLOCK, single->line, single->column, parser->lexer ? parser->lexer->filename : NULL);
                 if (block == NULL) {
                     return NULL;
                 }
@@ -5720,7 +5677,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
         // 解析 while 语句
         parser_consume(parser);  // 消费 'while'
         
-        ASTNode *stmt = ast_new_node(AST_WHILE_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_WHILE_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) {
             return NULL;
         }
@@ -5750,7 +5707,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
         // 解析 for 语句：数组遍历 或 整数范围（for start..end |v| / for start..end { }）
         parser_consume(parser);  // 消费 'for'
         
-        ASTNode *stmt = ast_new_node(AST_FOR_STMT, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_FOR_STMT, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) {
             return NULL;
         }
@@ -5786,7 +5743,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
                 if (!parser_match(parser, TOKEN_IDENTIFIER)) {
                     return NULL;
                 }
-                stmt->data.for_stmt.var_name = arena_strdup(parser->arena, parser->current_token->value);
+                stmt->data.for_stmt.var_name = parser->current_token->value;
                 parser_consume(parser);
                 if (!parser_expect(parser, TOKEN_PIPE)) {
                     return NULL;
@@ -5811,7 +5768,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
             if (!parser_match(parser, TOKEN_IDENTIFIER)) {
                 return NULL;
             }
-            stmt->data.for_stmt.var_name = arena_strdup(parser->arena, parser->current_token->value);
+            stmt->data.for_stmt.var_name = parser->current_token->value;
             parser_consume(parser);
             if (!parser_expect(parser, TOKEN_PIPE)) {
                 return NULL;
@@ -5856,7 +5813,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
                         parser->current_token ? parser->current_token->column : column);
                     return NULL;
                 }
-                const char *name = arena_strdup(parser->arena, parser->current_token->value);
+                const char *name = parser->current_token->value;
                 if (name == NULL) {
                     return NULL;
                 }
@@ -5897,7 +5854,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
                 return NULL;
             }
             
-            ASTNode *stmt = ast_new_node(AST_DESTRUCTURE_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+            ASTNode *stmt = parser_new_node(parser, AST_DESTRUCTURE_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
             if (stmt == NULL) {
                 return NULL;
             }
@@ -5911,9 +5868,9 @@ ASTNode *parser_parse_statement(Parser *parser) {
         // 普通变量声明，允许 'type' 关键字作为变量名
         const char *var_name = NULL;
         if (parser_match(parser, TOKEN_IDENTIFIER)) {
-            var_name = arena_strdup(parser->arena, parser->current_token->value);
+            var_name = parser->current_token->value;
         } else if (parser_match(parser, TOKEN_TYPE)) {
-            var_name = arena_strdup(parser->arena, "type");
+            var_name = intern_cstring(parser->arena, "type");
         } else {
             return NULL;
         }
@@ -5923,7 +5880,7 @@ ASTNode *parser_parse_statement(Parser *parser) {
         
         parser_consume(parser);  // 消费变量名称
         
-        ASTNode *stmt = ast_new_node(AST_VAR_DECL, line, column, parser->arena, parser->lexer ? parser->lexer->filename : NULL);
+        ASTNode *stmt = parser_new_node(parser, AST_VAR_DECL, line, column, parser->lexer ? parser->lexer->filename : NULL);
         if (stmt == NULL) {
             return NULL;
         }
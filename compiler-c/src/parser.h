@@ -12,14 +12,31 @@ typedef enum {
     PARSER_CONTEXT_CONDITION        // 条件表达式上下文（if/while 后面的表达式）
 } ParserContext;
 
+// 前瞻环形缓冲区容量（2的幂，需大于解析器最大前瞻距离）
+#define PARSER_LOOKAHEAD_SIZE 4
+
+// 前瞻缓冲区中的 Token
+typedef struct ParserLookahead {
+    Token *token;           // 已从 Lexer 读出、尚未成为当前 Token 的 Token
+    int in_string;          // 读出该 Token 后 Lexer 是否处于字符串/插值内部
+} ParserLookahead;
+
 // 语法分析器结构体
 // 使用 Lexer 读取 Token，构建 AST
+// 前瞻时 Token 只从 Lexer 读取一次并暂存在环形缓冲区中，消费时优先从缓冲区取出，
+// 不需要保存/恢复 Lexer 位置重新扫描
 typedef struct Parser {
     Lexer *lexer;           // 词法分析器指针（由调用者提供，不分配）
     Token *current_token;   // 当前 Token（从 Arena 分配）
+    int current_in_string;  // 读出当前 Token 后 Lexer 是否处于字符串/插值内部
     Arena *arena;           // Arena 分配器（用于分配 Token 和 AST 节点）
     ParserContext context;  // 当前解析上下文
     Token *pending_greater_token;  // 待处理的 > token（用于嵌套泛型 >> 拆分）
+    ParserLookahead lookahead[PARSER_LOOKAHEAD_SIZE];  // 前瞻环形缓冲区
+    int lookahead_head;     // 缓冲区中最早 Token 的下标
+    int lookahead_count;    // 缓冲区中的 Token 数量
+    int token_count;        // 已从 Lexer 读取的 Token 数量（统计用）
+    int node_count;         // 已创建的 AST 节点数量（统计用）
 } Parser;
 
 // 初始化 Parser
@@ -0,0 +1,92 @@
+#include "thread_pool.h"
+#include <pthread.h>
+#include <stddef.h>
+
+// 线程池共享状态（调用 thread_pool_run 期间存在于调用者栈上）
+typedef struct ThreadPool {
+    pthread_mutex_t lock;       // 保护 next_task
+    int next_task;              // 下一个待领取的任务下标
+    int task_count;             // 任务总数
+    ThreadPoolTaskFn fn;        // 任务函数
+    void *ctx;                  // 任务上下文
+} ThreadPool;
+
+// 工作线程参数
+typedef struct ThreadPoolWorker {
+    ThreadPool *pool;
+    int index;                  // 工作线程编号
+    pthread_t thread;
+} ThreadPoolWorker;
+
+// 领取下一个任务
+// 返回：任务下标，没有剩余任务时返回 -1
+static int thread_pool_take(ThreadPool *pool) {
+    int task = -1;
+    pthread_mutex_lock(&pool->lock);
+    if (pool->next_task < pool->task_count) {
+        task = pool->next_task++;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return task;
+}
+
+// 工作线程主循环：不断领取任务直到全部领完
+static void *thread_pool_worker_main(void *arg) {
+    ThreadPoolWorker *worker = (ThreadPoolWorker *)arg;
+    ThreadPool *pool = worker->pool;
+    int task;
+    while ((task = thread_pool_take(pool)) >= 0) {
+        pool->fn(pool->ctx, worker->index, task);
+    }
+    return NULL;
+}
+
+// 并行执行 task_count 个任务
+int thread_pool_run(int worker_count, int task_count, ThreadPoolTaskFn fn, void *ctx) {
+    if (fn == NULL || task_count <= 0) {
+        return 0;
+    }
+    if (worker_count > task_count) {
+        worker_count = task_count;
+    }
+    if (worker_count > THREAD_POOL_MAX_WORKERS) {
+        worker_count = THREAD_POOL_MAX_WORKERS;
+    }
+
+    // 串行执行
+    if (worker_count <= 1) {
+        for (int i = 0; i < task_count; i++) {
+            fn(ctx, 0, i);
+        }
+        return 1;
+    }
+
+    ThreadPool pool;
+    pthread_mutex_init(&pool.lock, NULL);
+    pool.next_task = 0;
+    pool.task_count = task_count;
+    pool.fn = fn;
+    pool.ctx = ctx;
+
+    // 启动 1 ~ worker_count-1 号线程（0 号由调用线程担任）
+    ThreadPoolWorker workers[THREAD_POOL_MAX_WORKERS];
+    int started = 1;
+    for (int i = 1; i < worker_count; i++) {
+        workers[started].pool = &pool;
+        workers[started].index = started;
+        if (pthread_create(&workers[started].thread, NULL, thread_pool_worker_main, &workers[started]) != 0) {
+            break;  // 创建失败：已启动的线程完成剩余任务
+        }
+        started++;
+    }
+
+    workers[0].pool = &pool;
+    workers[0].index = 0;
+    thread_pool_worker_main(&workers[0]);
+
+    for (int i = 1; i < started; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+    pthread_mutex_destroy(&pool.lock);
+    return started;
+}
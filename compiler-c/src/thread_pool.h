@@ -0,0 +1,23 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+// 并行任务执行（-jN）
+// 固定数量的工作线程从共享的任务计数器中依次领取任务下标，先完成的线程继续领取剩余任务，
+// 负载不均时不会有线程空等。调用线程本身作为 0 号工作线程参与执行。
+// 任务结果由调用者按任务下标保存，汇总顺序与线程调度无关，保证输出确定。
+
+// 最大工作线程数量
+#define THREAD_POOL_MAX_WORKERS 64
+
+// 任务函数
+// 参数：ctx - 调用者上下文，worker - 工作线程编号（0 ~ worker_count-1，可用于选择线程私有的 Arena），
+//       task - 任务下标（0 ~ task_count-1）
+typedef void (*ThreadPoolTaskFn)(void *ctx, int worker, int task);
+
+// 并行执行 task_count 个任务，全部完成后返回
+// 参数：worker_count - 工作线程数量（含调用线程，超过 task_count 或上限时自动截断；<= 1 时串行执行）
+//       task_count - 任务数量，fn - 任务函数，ctx - 传给任务函数的上下文
+// 返回：实际使用的工作线程数量（线程创建失败时由已有线程完成剩余任务）
+int thread_pool_run(int worker_count, int task_count, ThreadPoolTaskFn fn, void *ctx);
+
+#endif // THREAD_POOL_H
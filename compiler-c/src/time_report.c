@@ -0,0 +1,92 @@
+#define _POSIX_C_SOURCE 199309L  // 用于 clock_gettime
+#include "time_report.h"
+#include <string.h>
+#include <time.h>
+
+// 读取时钟（毫秒）
+static double clock_ms(clockid_t clock) {
+    struct timespec ts;
+    if (clock_gettime(clock, &ts) != 0) {
+        return 0.0;
+    }
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+// 读取 Arena 已用字节（arena 为 NULL 时为 0）
+static size_t arena_used_bytes(const Arena *arena) {
+    if (arena == NULL) {
+        return 0;
+    }
+    ArenaStats stats;
+    arena_get_stats(arena, &stats);
+    return stats.bytes_used;
+}
+
+void time_report_init(TimeReport *report) {
+    memset(report, 0, sizeof(TimeReport));
+    report->start_wall_ms = clock_ms(CLOCK_MONOTONIC);
+    report->start_cpu_ms = clock_ms(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+void time_report_start(const TimeReport *report, TimeReportTimer *timer, const Arena *arena) {
+    if (report == NULL) {
+        return;
+    }
+    timer->wall_ms = clock_ms(CLOCK_MONOTONIC);
+    timer->cpu_ms = clock_ms(CLOCK_PROCESS_CPUTIME_ID);
+    timer->arena = arena;
+    timer->arena_used = arena_used_bytes(arena);
+}
+
+TimeReportPhase *time_report_stop(TimeReport *report, const char *name, const TimeReportTimer *timer) {
+    if (report == NULL) {
+        return NULL;
+    }
+    double wall_ms = clock_ms(CLOCK_MONOTONIC) - timer->wall_ms;
+    double cpu_ms = clock_ms(CLOCK_PROCESS_CPUTIME_ID) - timer->cpu_ms;
+    size_t used = arena_used_bytes(timer->arena);
+
+    TimeReportPhase *phase = NULL;
+    for (int i = 0; i < report->phase_count; i++) {
+        if (strcmp(report->phases[i].name, name) == 0) {
+            phase = &report->phases[i];
+            break;
+        }
+    }
+    if (phase == NULL) {
+        if (report->phase_count >= TIME_REPORT_MAX_PHASES) {
+            return NULL;
+        }
+        phase = &report->phases[report->phase_count++];
+        memset(phase, 0, sizeof(TimeReportPhase));
+        phase->name = name;
+    }
+    phase->wall_ms += wall_ms;
+    phase->cpu_ms += cpu_ms;
+    // Arena 回退（如 Token Arena）时已用字节可能减少，不计负增量
+    if (used > timer->arena_used) {
+        phase->arena_bytes += used - timer->arena_used;
+    }
+    phase->count++;
+    return phase;
+}
+
+int time_report_write_json(const TimeReport *report, FILE *out) {
+    double total_wall_ms = clock_ms(CLOCK_MONOTONIC) - report->start_wall_ms;
+    double total_cpu_ms = clock_ms(CLOCK_PROCESS_CPUTIME_ID) - report->start_cpu_ms;
+
+    // 阶段名均为编译器内的标识符常量，不含需要转义的字符
+    fprintf(out, "{\n  \"phases\": [");
+    for (int i = 0; i < report->phase_count; i++) {
+        const TimeReportPhase *phase = &report->phases[i];
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"arena_bytes\": %zu, \"count\": %d}",
+                i > 0 ? "," : "", phase->name, phase->wall_ms, phase->cpu_ms, phase->arena_bytes, phase->count);
+    }
+    fprintf(out, "%s],\n", report->phase_count > 0 ? "\n  " : "");
+    fprintf(out, "  \"total\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f},\n", total_wall_ms, total_cpu_ms);
+    fprintf(out, "  \"counters\": {\"files\": %zu, \"tokens\": %zu, \"ast_nodes\": %zu, \"symbols\": %zu, "
+                 "\"mono_instances\": %zu, \"string_constants\": %zu, \"macro_expansions\": %zu}\n}\n",
+            report->file_count, report->token_count, report->ast_node_count, report->symbol_count,
+            report->mono_instance_count, report->string_constant_count, report->macro_expansion_count);
+    return ferror(out) ? -1 : 0;
+}
@@ -0,0 +1,65 @@
+#ifndef TIME_REPORT_H
+#define TIME_REPORT_H
+
+#include "arena.h"
+#include <stddef.h>
+#include <stdio.h>
+
+// 编译阶段计时与统计（--time-report[=FILE]）
+// 每个阶段记录墙钟时间、进程 CPU 时间（含所有线程）与阶段内 Arena 已用字节的增量，
+// 同名阶段多次计时时累加（如宏展开在类型检查中多次发生）。
+// 阶段名中的 "." 表示子阶段：check.macro_expand 包含在 check 中，codegen.* 包含在 codegen 中。
+// 编译结束后以 JSON 输出，便于 CI 跟踪编译耗时的回归。
+
+// 最大阶段数量
+#define TIME_REPORT_MAX_PHASES 32
+
+// 单个阶段的统计
+typedef struct TimeReportPhase {
+    const char *name;           // 阶段名称（字符串常量，不复制）
+    double wall_ms;             // 墙钟时间（毫秒）
+    double cpu_ms;              // 进程 CPU 时间（毫秒，并行阶段为所有线程之和）
+    size_t arena_bytes;         // 阶段内 Arena 已用字节的增量
+    int count;                  // 计时次数
+} TimeReportPhase;
+
+// 编译统计
+typedef struct TimeReport {
+    TimeReportPhase phases[TIME_REPORT_MAX_PHASES];  // 按首次计时的顺序排列
+    int phase_count;
+    double start_wall_ms;       // time_report_init 时的墙钟时间
+    double start_cpu_ms;        // time_report_init 时的 CPU 时间
+
+    // 计数
+    size_t file_count;          // 源文件数量
+    size_t token_count;         // Token 数量
+    size_t ast_node_count;      // 解析得到的 AST 节点数量（不含宏展开与单态化产生的节点）
+    size_t symbol_count;        // 类型检查声明的符号数量（全局与局部变量、常量、参数与函数签名）
+    size_t mono_instance_count; // 泛型单态化实例数量
+    size_t string_constant_count;   // 字符串常量数量
+    size_t macro_expansion_count;   // 宏展开次数
+} TimeReport;
+
+// 阶段计时器（由调用者在栈上分配，start/stop 之间可以嵌套其他计时器）
+typedef struct TimeReportTimer {
+    double wall_ms;             // 开始时的墙钟时间
+    double cpu_ms;              // 开始时的 CPU 时间
+    const Arena *arena;         // 统计已用字节的 Arena（可为 NULL）
+    size_t arena_used;          // 开始时 arena 的已用字节
+} TimeReportTimer;
+
+// 初始化统计（记录总时间的起点）
+void time_report_init(TimeReport *report);
+
+// 开始计时：report 为 NULL 时不做任何事（未启用 --time-report）
+void time_report_start(const TimeReport *report, TimeReportTimer *timer, const Arena *arena);
+
+// 结束计时：把本次耗时与 Arena 增量累加到名为 name 的阶段（不存在时追加）
+// 返回：该阶段（调用者可补充其他 Arena 的字节数），report 为 NULL 或阶段数已满时返回 NULL
+TimeReportPhase *time_report_stop(TimeReport *report, const char *name, const TimeReportTimer *timer);
+
+// 以 JSON 输出统计（阶段、总时间与计数）
+// 返回：成功返回0，写入失败返回-1
+int time_report_write_json(const TimeReport *report, FILE *out);
+
+#endif // TIME_REPORT_H
@@ -0,0 +1,82 @@
+#!/bin/bash
+# 宏展开基准：生成含大量宏调用的程序，用 --time-report 统计宏展开耗时
+# 用法: ./tests/bench_macro_expand.sh [展开次数（默认 16384）] [重复次数（默认 5）]
+# 输出每次运行的宏展开次数、check.macro_expand 与整个 check 阶段的墙钟时间，以及宏展开的最短时间
+# 调用按 16 组不同实参循环（缓存命中为主），覆盖 ${} 插值、宏体局部常量与多次引用参数（洞较多）的宏
+
+set -e
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+REPO_ROOT="$(cd "$SCRIPT_DIR/.." && pwd)"
+cd "$REPO_ROOT"
+
+C_COMPILER="$REPO_ROOT/bin/uya-c"
+EXPANSIONS="${1:-16384}"
+RUNS="${2:-5}"
+TMP_DIR="${TMPDIR:-/tmp}/uya_bench_macro_$$"
+mkdir -p "$TMP_DIR"
+trap "rm -rf '$TMP_DIR'" EXIT
+export UYA_ROOT="${UYA_ROOT:-$REPO_ROOT/lib/}"
+
+if [ ! -x "$C_COMPILER" ]; then
+    echo "错误: 未找到 $C_COMPILER，请先运行 make -C compiler-c build" >&2
+    exit 1
+fi
+
+# 生成基准程序：每个函数 64 次宏调用
+SRC="$TMP_DIR/bench_macro.uya"
+{
+    echo 'mc add_twice(x: expr, k: expr) expr {'
+    echo '    @mc_code(@mc_ast(${x} + ${k} + ${k}));'
+    echo '}'
+    echo 'mc scaled(n: expr) expr {'
+    echo '    const s: i32 = @mc_eval(n * 10 + 1);'
+    echo '    @mc_code(@mc_ast(s + n));'
+    echo '}'
+    echo 'mc clamp_add(v: expr, lo: expr, hi: expr) expr {'
+    echo '    @mc_code(@mc_ast(if v + lo > hi { hi } else { v + lo }));'
+    echo '}'
+    echo 'mc poly(x: expr, c: expr) expr {'
+    echo '    @mc_code(@mc_ast(x * c + x * c * 2 + x * c * 3 + x * c * 4 + x * c * 5 + x * c * 6 + x * c * 7 + x * c * 8));'
+    echo '}'
+    fn=0
+    i=0
+    while [ $i -lt "$EXPANSIONS" ]; do
+        if [ $((i % 64)) -eq 0 ]; then
+            [ $i -gt 0 ] && echo '    return t;' && echo '}'
+            echo "fn f$fn(a: i32) i32 {"
+            echo '    var t: i32 = 0;'
+            fn=$((fn + 1))
+        fi
+        k=$((i % 16))
+        case $((i % 4)) in
+            0) echo "    t = t + add_twice(a, $k);" ;;
+            1) echo "    t = t + scaled($k);" ;;
+            2) echo "    t = t + clamp_add(a, $k, 100);" ;;
+            3) echo "    t = t +% poly(a, $k);" ;;
+        esac
+        i=$((i + 1))
+    done
+    echo '    return t;'
+    echo '}'
+    echo 'fn main() i32 {'
+    echo '    return f0(1) - f0(1);'
+    echo '}'
+} > "$SRC"
+
+best=""
+for r in $(seq 1 "$RUNS"); do
+    REPORT="$TMP_DIR/report_$r.json"
+    if ! "$C_COMPILER" "$SRC" -o "$TMP_DIR/bench_macro.c" --c99 --time-report="$REPORT" >"$TMP_DIR/compile.log" 2>&1; then
+        echo "错误: 基准程序编译失败" >&2
+        tail -20 "$TMP_DIR/compile.log" >&2
+        exit 1
+    fi
+    ms=$(grep -o '"check.macro_expand", "wall_ms": [0-9.]*' "$REPORT" | awk '{print $NF}')
+    check_ms=$(grep -o '"name": "check", "wall_ms": [0-9.]*' "$REPORT" | awk '{print $NF}')
+    count=$(grep -o '"macro_expansions": [0-9]*' "$REPORT" | awk '{print $NF}')
+    echo "运行 $r: 宏展开 $count 次，耗时 ${ms} ms（check 阶段 ${check_ms} ms）"
+    if [ -z "$best" ] || awk "BEGIN { exit !($ms < $best) }"; then
+        best="$ms"
+    fi
+done
+echo "最短耗时: ${best} ms"
@@ -0,0 +1,262 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+struct Point;
+struct Mixed;
+
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+struct Point {
+    int32_t x;
+    int32_t y;
+};
+
+struct Mixed {
+    int32_t a;
+    bool b;
+    int32_t c;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+int32_t uya_main(void);
+
+int32_t uya_main(void) {
+const int32_t i32_size = sizeof(int32_t);
+if ((i32_size != 4)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t bool_size = sizeof(bool);
+if ((bool_size != 1)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t byte_size = sizeof(uint8_t);
+if ((byte_size != 1)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t ptr_i32_size = sizeof(int32_t *);
+if (((ptr_i32_size != 4) && (ptr_i32_size != 8))) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t ptr_bool_size = sizeof(bool *);
+if ((ptr_bool_size != ptr_i32_size)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t platform_word_size = ptr_i32_size;
+int32_t x = 42;
+const int32_t x_size = sizeof(x);
+if ((x_size != 4)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+bool b = true;
+const int32_t b_size = sizeof(b);
+if ((b_size != 1)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+uint8_t byte_val = 0;
+const int32_t byte_val_size = sizeof(byte_val);
+if ((byte_val_size != 1)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t point_type_size = sizeof(struct Point);
+if ((point_type_size != 8)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t mixed_type_size = sizeof(struct Mixed);
+if (((mixed_type_size < 9) || (mixed_type_size > 12))) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+struct Point point = (struct Point){.x = 10, .y = 20};
+const int32_t point_size = sizeof(point);
+if ((point_size != 8)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+struct Mixed mixed = (struct Mixed){.a = 1, .b = true, .c = 2};
+const int32_t mixed_size = sizeof(mixed);
+if ((mixed_size != mixed_type_size)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t point_ptr_size = sizeof(struct Point *);
+if ((point_ptr_size != platform_word_size)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t mixed_ptr_size = sizeof(struct Mixed *);
+if ((mixed_ptr_size != platform_word_size)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t array_i32_size = sizeof(int32_t[10]);
+if ((array_i32_size != 40)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t array_bool_size = sizeof(bool[5]);
+if ((array_bool_size != 5)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t array_point_size = sizeof(struct Point[3]);
+if ((array_point_size != 24)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+int32_t nums[5] = {1, 2, 3, 4, 5};
+const int32_t nums_size = sizeof(nums);
+if ((nums_size != 20)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+bool bools[10] = {true, false, true, false, true, false, true, false, true, false};
+const int32_t bools_size = sizeof(bools);
+if ((bools_size != 10)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+struct Point points[2] = {(struct Point){.x = 1, .y = 2}, (struct Point){.x = 3, .y = 4}};
+const int32_t points_size = sizeof(points);
+if ((points_size != 16)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+int32_t * ptr = NULL;
+const int32_t ptr_var_size = sizeof(ptr);
+if ((ptr_var_size != platform_word_size)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+struct Point * point_ptr = NULL;
+const int32_t point_ptr_var_size = sizeof(point_ptr);
+if ((point_ptr_var_size != platform_word_size)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t calculated_size = (sizeof(int32_t) * 10);
+if ((calculated_size != 40)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const int32_t ptr_array_size = (sizeof(struct Point *) * 5);
+const int32_t expected_ptr_array_size = (platform_word_size * 5);
+if ((ptr_array_size != expected_ptr_array_size)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
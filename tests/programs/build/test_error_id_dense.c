@@ -0,0 +1,193 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+/* 错误码表：error.<name> 的 error_id = 4096 + 下标（小于 4096 的 error_id 为 errno） */
+static const char *const uya_error_names[4] __attribute__((unused)) = {
+    "AAb",  /* 4096 */
+    "ABA",  /* 4097 */
+    "Late",  /* 4098 */
+    "Zeta",  /* 4099 */
+};
+
+struct TypeInfo;
+
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+struct err_union_int32_t { uint32_t error_id; int32_t value; };
+struct err_union_int32_t fail(int32_t k);
+int32_t code_of(int32_t k);
+int32_t uya_main(void);
+
+struct err_union_int32_t fail(int32_t k) {
+    if ((k == 0)) {
+        return (struct err_union_int32_t){ .error_id = 4096U };
+    }
+    if ((k == 1)) {
+        return (struct err_union_int32_t){ .error_id = 4097U };
+    }
+    if ((k == 2)) {
+        return (struct err_union_int32_t){ .error_id = 4099U };
+    }
+    return (struct err_union_int32_t){ .error_id = 4098U };
+}
+
+int32_t code_of(int32_t k) {
+    struct err_union_int32_t r = fail(k);
+    int32_t _uya_ret = ({ struct err_union_int32_t _uya_m = r; int32_t _uya_r; switch (_uya_m.error_id) { case 4096: _uya_r = 1; break; case 4097: _uya_r = 2; break; case 4099: _uya_r = 3; break; default: { _uya_r = 4; } break; } _uya_r; });
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+if ((code_of(0) != 1)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+if ((code_of(1) != 2)) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+if ((code_of(2) != 3)) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+if ((code_of(3) != 4)) {
+    int32_t _uya_ret = 4;
+    return _uya_ret;
+}
+const int32_t a = ({ int32_t _uya_catch_result; struct err_union_int32_t _uya_catch_tmp = fail(0); if (_uya_catch_tmp.error_id != 0) {
+    struct err_union_int32_t e = _uya_catch_tmp;
+    if ((e.error_id == 4097U)) {
+        int32_t _uya_ret = 5;
+        return _uya_ret;
+    }
+    _uya_catch_result = (10);
+} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+if ((a != 10)) {
+    int32_t _uya_ret = 6;
+    return _uya_ret;
+}
+const int64_t SYS_close = 3;
+const int64_t bad_fd = (-1);
+const int64_t c = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = ({ long _uya_syscall_ret = uya_syscall1(SYS_close, bad_fd); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; }); if (_uya_catch_tmp.error_id != 0) {
+    struct err_union_int64_t e = _uya_catch_tmp;
+    if ((e.error_id == 4096U)) {
+        int32_t _uya_ret = 7;
+        return _uya_ret;
+    }
+    if ((e.error_id == 4097U)) {
+        int32_t _uya_ret = 8;
+        return _uya_ret;
+    }
+    _uya_catch_result = (bad_fd);
+} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+if ((c != bad_fd)) {
+    int32_t _uya_ret = 9;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
@@ -0,0 +1,262 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+struct Node;
+struct Point;
+
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+struct Node {
+    int32_t value;
+    struct Node * next;
+};
+
+struct Point {
+    int32_t x;
+    int32_t y;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+int32_t * return_null_i32();
+void * return_null_void();
+struct Node * return_null_node();
+struct Point * return_null_point();
+size_t * return_null_usize();
+bool * return_null_bool();
+uint8_t * return_null_byte();
+int32_t * conditional_return_null(bool condition);
+struct Node * multiple_return_null(int32_t flag);
+int32_t uya_main(void);
+
+int32_t global_x = 42;
+
+int32_t * return_null_i32() {
+    int32_t * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+void * return_null_void() {
+    void * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+struct Node * return_null_node() {
+    struct Node * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+struct Point * return_null_point() {
+    struct Point * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+size_t * return_null_usize() {
+    size_t * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+bool * return_null_bool() {
+    bool * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+uint8_t * return_null_byte() {
+    uint8_t * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+int32_t * conditional_return_null(bool condition) {
+    if (condition) {
+        int32_t * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    global_x = 42;
+    int32_t * _uya_ret = (&global_x);
+    return _uya_ret;
+}
+
+struct Node * multiple_return_null(int32_t flag) {
+    if ((flag == 0)) {
+        struct Node * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    if ((flag == 1)) {
+        struct Node * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    struct Node * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+int32_t * ptr1 = return_null_i32();
+if ((ptr1 != NULL)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+void * void_ptr = return_null_void();
+if ((void_ptr != NULL)) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+struct Node * node_ptr = return_null_node();
+if ((node_ptr != NULL)) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+struct Point * point_ptr = return_null_point();
+if ((point_ptr != NULL)) {
+    int32_t _uya_ret = 4;
+    return _uya_ret;
+}
+size_t * usize_ptr = return_null_usize();
+if ((usize_ptr != NULL)) {
+    int32_t _uya_ret = 5;
+    return _uya_ret;
+}
+bool * bool_ptr = return_null_bool();
+if ((bool_ptr != NULL)) {
+    int32_t _uya_ret = 6;
+    return _uya_ret;
+}
+uint8_t * byte_ptr = return_null_byte();
+if ((byte_ptr != NULL)) {
+    int32_t _uya_ret = 7;
+    return _uya_ret;
+}
+int32_t * ptr2 = conditional_return_null(true);
+if ((ptr2 != NULL)) {
+    int32_t _uya_ret = 8;
+    return _uya_ret;
+}
+int32_t * ptr3 = conditional_return_null(false);
+if ((ptr3 == NULL)) {
+    int32_t _uya_ret = 9;
+    return _uya_ret;
+}
+if (((*ptr3) != 42)) {
+    int32_t _uya_ret = 10;
+    return _uya_ret;
+}
+struct Node * node_ptr2 = multiple_return_null(0);
+if ((node_ptr2 != NULL)) {
+    int32_t _uya_ret = 11;
+    return _uya_ret;
+}
+struct Node * node_ptr3 = multiple_return_null(1);
+if ((node_ptr3 != NULL)) {
+    int32_t _uya_ret = 12;
+    return _uya_ret;
+}
+struct Node * node_ptr4 = multiple_return_null(2);
+if ((node_ptr4 != NULL)) {
+    int32_t _uya_ret = 13;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
@@ -0,0 +1,328 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+
+
+struct uya_slice_int32_t { int32_t *ptr; size_t len; };
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+int32_t sum_array(int32_t a_param[8]);
+int32_t sum_prefix(int32_t a_param[8], int32_t n);
+int32_t pick(int32_t a_param[8], int32_t idx);
+int32_t before(int32_t a_param[8], int32_t idx);
+int32_t ratio(int32_t a, int32_t b);
+int32_t scaled(int32_t a_param[8], int32_t k, int32_t d);
+int32_t uya_main(void);
+
+const int32_t N = 8;
+
+int32_t sum_array(int32_t a_param[8]) {
+    // 数组参数按值传递：创建局部副本
+    int32_t a[8];
+        __uya_memcpy(a, a_param, sizeof(a));
+    int32_t total = 0;
+    {
+        // for range
+        int32_t i = 0        ;
+        int32_t _uya_end = N        ;
+        for (; i < _uya_end; i++) {
+            total = (total + a[i]);
+        }
+    }
+    int32_t j = 0;
+    while ((j < N)) {
+        total = (total + a[j]);
+        j = (j + 1);
+    }
+    int32_t _uya_ret = total;
+    return _uya_ret;
+}
+
+int32_t sum_prefix(int32_t a_param[8], int32_t n) {
+    // 数组参数按值传递：创建局部副本
+    int32_t a[8];
+        __uya_memcpy(a, a_param, sizeof(a));
+    int32_t total = 0;
+    int32_t i = 1;
+    while ((i < n)) {
+        total = ((total + a[i]) - a[(i - 1)]);
+        i = (i + 1);
+    }
+    {
+        // for range
+        int32_t k = 0        ;
+        int32_t _uya_end = n        ;
+        for (; k < _uya_end; k++) {
+            total = (total + a[k]);
+        }
+    }
+    int32_t _uya_ret = total;
+    return _uya_ret;
+}
+
+int32_t pick(int32_t a_param[8], int32_t idx) {
+    // 数组参数按值传递：创建局部副本
+    int32_t a[8];
+        __uya_memcpy(a, a_param, sizeof(a));
+    if (((idx >= 0) && (idx < 8))) {
+        int32_t _uya_ret = a[idx];
+        return _uya_ret;
+    }
+    if ((idx == 8)) {
+        int32_t _uya_ret = (a[(idx - 1)] + a[((idx - 8) * 2)]);
+        return _uya_ret;
+    }
+    int32_t _uya_ret = (-1);
+    return _uya_ret;
+}
+
+int32_t before(int32_t a_param[8], int32_t idx) {
+    // 数组参数按值传递：创建局部副本
+    int32_t a[8];
+        __uya_memcpy(a, a_param, sizeof(a));
+    if ((idx > 0)) {
+        int32_t _uya_ret = a[(idx - 1)];
+        return _uya_ret;
+    }
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+int32_t ratio(int32_t a, int32_t b) {
+    if ((b > 0)) {
+        int32_t _uya_ret = ((a / b) + (a % b));
+        return _uya_ret;
+    }
+    int32_t _uya_ret = ((a / 4) + (a / (b - 1)));
+    return _uya_ret;
+}
+
+int32_t scaled(int32_t a_param[8], int32_t k, int32_t d) {
+    // 数组参数按值传递：创建局部副本
+    int32_t a[8];
+        __uya_memcpy(a, a_param, sizeof(a));
+    int32_t total = 0;
+    {
+        // for range
+        int32_t i = 0        ;
+        int32_t _uya_end = 8        ;
+        for (; i < _uya_end; i++) {
+            total = (((total + (a[i] * k)) + (i * 2)) + 1);
+        }
+    }
+    uint8_t b = 250;
+    b = (b + 5);
+    total = (total + (int32_t)b);
+    if ((d != 0)) {
+        int32_t _uya_ret = (total / d);
+        return _uya_ret;
+    }
+    int32_t _uya_ret = total;
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+int32_t arr[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+if ((sum_array(arr) != 72)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+if ((sum_prefix(arr, 8) != 43)) {
+    int32_t _uya_ret = 4;
+    return _uya_ret;
+}
+if ((sum_prefix(arr, 0) != 0)) {
+    int32_t _uya_ret = 5;
+    return _uya_ret;
+}
+if ((pick(arr, 3) != 4)) {
+    int32_t _uya_ret = 6;
+    return _uya_ret;
+}
+if ((pick(arr, 8) != 9)) {
+    int32_t _uya_ret = 7;
+    return _uya_ret;
+}
+if ((pick(arr, (-2)) != (-1))) {
+    int32_t _uya_ret = 8;
+    return _uya_ret;
+}
+if ((before(arr, 3) != 3)) {
+    int32_t _uya_ret = 12;
+    return _uya_ret;
+}
+struct uya_slice_int32_t s = (struct uya_slice_int32_t){ .ptr = arr + 2, .len = 3};
+int32_t total = 0;
+{
+    // for range
+    int32_t i = 0    ;
+    int32_t _uya_end = s.len    ;
+    for (; i < _uya_end; i++) {
+        total = (total + (s).ptr[i]);
+    }
+}
+size_t k = 0;
+while ((k < s.len)) {
+    total = (total + (s).ptr[k]);
+    k = (k + 1);
+}
+if ((total != 24)) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+size_t q = 1;
+while ((q < 3)) {
+    total = (total + (s).ptr[q]);
+    q = (q + 1);
+}
+if ((total != 33)) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+if ((ratio(17, 5) != 5)) {
+    int32_t _uya_ret = 9;
+    return _uya_ret;
+}
+if ((ratio(17, 0) != (-13))) {
+    int32_t _uya_ret = 10;
+    return _uya_ret;
+}
+if ((scaled(arr, 2, (-1)) != (-391))) {
+    int32_t _uya_ret = 13;
+    return _uya_ret;
+}
+if ((scaled(arr, 1, 0) != 355)) {
+    int32_t _uya_ret = 14;
+    return _uya_ret;
+}
+int32_t grid[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+int32_t r = 0;
+while ((r < 4)) {
+    int32_t c = 0;
+    while ((c < 4)) {
+        grid[((r * 4) + c)] = (r + c);
+        c = (c + 1);
+    }
+    r = (r + 1);
+}
+int32_t diag = 0;
+{
+    // for range
+    int32_t d = 0    ;
+    int32_t _uya_end = 4    ;
+    for (; d < _uya_end; d++) {
+        diag = (diag + grid[(d * 5)]);
+    }
+}
+if ((diag != 12)) {
+    int32_t _uya_ret = 11;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
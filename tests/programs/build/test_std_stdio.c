@@ -0,0 +1,1274 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+int32_t test_i32_to_str();
+int32_t test_put_char();
+int32_t test_write_bytes();
+int32_t uya_main(void);
+int32_t put_char(int32_t c);
+int32_t put_char_fd(int32_t c, int64_t fd);
+int64_t write_bytes(uint8_t * buf, size_t n);
+int64_t write_bytes_fd(uint8_t * buf, size_t n, int64_t fd);
+int32_t put_str_len(uint8_t * s, size_t len);
+int32_t get_char();
+int64_t read_bytes(uint8_t * buf, size_t n);
+int64_t read_bytes_fd(uint8_t * buf, size_t n, int64_t fd);
+size_t i32_to_str(int32_t value, uint8_t * buf);
+size_t i64_to_str(int64_t value, uint8_t * buf);
+size_t print_i32(int32_t value);
+size_t print_i64(int64_t value);
+void * fopen(const uint8_t * filename, const uint8_t * mode);
+int32_t fclose(void * stream);
+size_t fread(const uint8_t * ptr, size_t size, size_t nmemb, void * stream);
+int32_t fgetc(void * stream);
+int32_t fprintf(void * stream, const uint8_t * format, ...);
+size_t fwrite(uint8_t * ptr, size_t size, size_t nmemb, void * stream);
+int32_t fputc(int32_t c, void * stream);
+int32_t fputs(uint8_t * s, void * stream);
+int32_t sprintf(uint8_t * buf, const uint8_t * format, ...);
+int32_t snprintf(uint8_t * buf, size_t n, const uint8_t * format, ...);
+struct err_union_int64_t sys_write(int64_t fd, int64_t buf, int64_t count);
+struct err_union_int64_t sys_read(int64_t fd, int64_t buf, int64_t count);
+struct err_union_int64_t sys_open(int64_t path, int64_t flags, int64_t mode);
+struct err_union_int64_t sys_close(int64_t fd);
+void sys_exit(int64_t status);
+int64_t sys_getpid();
+struct err_union_int64_t sys_lseek(int64_t fd, int64_t offset, int64_t whence);
+struct err_union_int64_t sys_access(int64_t path, int64_t mode);
+struct err_union_int64_t sys_unlink(int64_t path);
+struct err_union_int64_t sys_mkdir(int64_t path, int64_t mode);
+struct err_union_int64_t sys_rmdir(int64_t path);
+struct err_union_int64_t sys_chdir(int64_t path);
+struct err_union_int64_t sys_getcwd(int64_t buf, int64_t size);
+void * memcpy(void * dest, void * src, size_t n);
+void * memmove(void * dest, void * src, size_t n);
+void * memset(void * s, int32_t c, size_t n);
+int32_t memcmp(void * s1, void * s2, size_t n);
+void * memchr(void * s, int32_t c, size_t n);
+size_t strlen(const uint8_t * s);
+int32_t strcmp(uint8_t * s1, uint8_t * s2);
+int32_t strncmp(uint8_t * s1, uint8_t * s2, size_t n);
+uint8_t * strcpy(uint8_t * dest, uint8_t * src);
+uint8_t * strncpy(uint8_t * dest, uint8_t * src, size_t n);
+uint8_t * strcat(uint8_t * dest, uint8_t * src);
+const uint8_t * strchr(const uint8_t * s, int32_t c);
+const uint8_t * strrchr(const uint8_t * s, int32_t c);
+uint8_t * strstr(uint8_t * haystack, uint8_t * needle);
+
+const int64_t STDIN = 0;
+
+const int64_t STDOUT = 1;
+
+const int64_t STDERR = 2;
+
+const int64_t SYS_read = 0;
+
+const int64_t SYS_write = 1;
+
+const int64_t SYS_open = 2;
+
+const int64_t SYS_close = 3;
+
+const int64_t SYS_stat = 4;
+
+const int64_t SYS_fstat = 5;
+
+const int64_t SYS_lseek = 8;
+
+const int64_t SYS_mmap = 9;
+
+const int64_t SYS_munmap = 11;
+
+const int64_t SYS_brk = 12;
+
+const int64_t SYS_ioctl = 16;
+
+const int64_t SYS_access = 21;
+
+const int64_t SYS_dup = 32;
+
+const int64_t SYS_dup2 = 33;
+
+const int64_t SYS_getpid = 39;
+
+const int64_t SYS_fork = 57;
+
+const int64_t SYS_execve = 59;
+
+const int64_t SYS_exit = 60;
+
+const int64_t SYS_kill = 62;
+
+const int64_t SYS_getcwd = 79;
+
+const int64_t SYS_chdir = 80;
+
+const int64_t SYS_mkdir = 83;
+
+const int64_t SYS_rmdir = 84;
+
+const int64_t SYS_unlink = 87;
+
+const int64_t SYS_readlink = 89;
+
+const int64_t SYS_getdents64 = 217;
+
+const int64_t O_RDONLY = 0;
+
+const int64_t O_WRONLY = 1;
+
+const int64_t O_RDWR = 2;
+
+const int64_t O_CREAT = 64;
+
+const int64_t O_EXCL = 128;
+
+const int64_t O_TRUNC = 512;
+
+const int64_t O_APPEND = 1024;
+
+const int64_t S_IRWXU = 448;
+
+const int64_t S_IRUSR = 256;
+
+const int64_t S_IWUSR = 128;
+
+const int64_t S_IXUSR = 64;
+
+const int64_t S_IRWXG = 56;
+
+const int64_t S_IRGRP = 32;
+
+const int64_t S_IWGRP = 16;
+
+const int64_t S_IXGRP = 8;
+
+const int64_t S_IRWXO = 7;
+
+const int64_t S_IROTH = 4;
+
+const int64_t S_IWOTH = 2;
+
+const int64_t S_IXOTH = 1;
+
+const int64_t UYA_SEEK_SET = 0;
+
+const int64_t UYA_SEEK_CUR = 1;
+
+const int64_t UYA_SEEK_END = 2;
+
+const int64_t STDIN_FILENO = 0;
+
+const int64_t STDOUT_FILENO = 1;
+
+const int64_t STDERR_FILENO = 2;
+
+const int32_t EPERM = 1;
+
+const int32_t ENOENT = 2;
+
+const int32_t ESRCH = 3;
+
+const int32_t EINTR = 4;
+
+const int32_t EIO = 5;
+
+const int32_t ENXIO = 6;
+
+const int32_t E2BIG = 7;
+
+const int32_t ENOEXEC = 8;
+
+const int32_t EBADF = 9;
+
+const int32_t ECHILD = 10;
+
+const int32_t EAGAIN = 11;
+
+const int32_t ENOMEM = 12;
+
+const int32_t EACCES = 13;
+
+const int32_t EFAULT = 14;
+
+const int32_t ENOTBLK = 15;
+
+const int32_t EBUSY = 16;
+
+const int32_t EEXIST = 17;
+
+const int32_t EXDEV = 18;
+
+const int32_t ENODEV = 19;
+
+const int32_t ENOTDIR = 20;
+
+const int32_t EISDIR = 21;
+
+const int32_t EINVAL = 22;
+
+int32_t test_i32_to_str() {
+uint8_t buf[16] = {0};
+    const size_t len1 = i32_to_str(42, (uint8_t *)(&buf[0]));
+    if ((len1 != 2)) {
+        int32_t _uya_ret = 1;
+        return _uya_ret;
+    }
+    if ((buf[0] != (uint8_t)52)) {
+        int32_t _uya_ret = 2;
+        return _uya_ret;
+    }
+    if ((buf[1] != (uint8_t)50)) {
+        int32_t _uya_ret = 3;
+        return _uya_ret;
+    }
+    const size_t len2 = i32_to_str(0, (uint8_t *)(&buf[0]));
+    if ((len2 != 1)) {
+        int32_t _uya_ret = 4;
+        return _uya_ret;
+    }
+    if ((buf[0] != (uint8_t)48)) {
+        int32_t _uya_ret = 5;
+        return _uya_ret;
+    }
+    const size_t len3 = i32_to_str((0 - 123), (uint8_t *)(&buf[0]));
+    if ((len3 != 4)) {
+        int32_t _uya_ret = 6;
+        return _uya_ret;
+    }
+    if ((buf[0] != (uint8_t)45)) {
+        int32_t _uya_ret = 7;
+        return _uya_ret;
+    }
+    if ((buf[1] != (uint8_t)49)) {
+        int32_t _uya_ret = 8;
+        return _uya_ret;
+    }
+    if ((buf[2] != (uint8_t)50)) {
+        int32_t _uya_ret = 9;
+        return _uya_ret;
+    }
+    if ((buf[3] != (uint8_t)51)) {
+        int32_t _uya_ret = 10;
+        return _uya_ret;
+    }
+    const size_t len4 = i32_to_str(12345, (uint8_t *)(&buf[0]));
+    if ((len4 != 5)) {
+        int32_t _uya_ret = 11;
+        return _uya_ret;
+    }
+    if ((buf[0] != (uint8_t)49)) {
+        int32_t _uya_ret = 12;
+        return _uya_ret;
+    }
+    if ((buf[4] != (uint8_t)53)) {
+        int32_t _uya_ret = 13;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+int32_t test_put_char() {
+    const int32_t result = put_char(65);
+    if ((result != 65)) {
+        int32_t _uya_ret = 1;
+        return _uya_ret;
+    }
+    const int32_t result2 = put_char(10);
+    if ((result2 != 10)) {
+        int32_t _uya_ret = 2;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+int32_t test_write_bytes() {
+uint8_t msg[4] = {0};
+    msg[0] = (uint8_t)79;
+    msg[1] = (uint8_t)75;
+    msg[2] = (uint8_t)10;
+    const int64_t written = write_bytes((uint8_t *)(&msg[0]), 3);
+    if ((written != 3)) {
+        int32_t _uya_ret = 1;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+int32_t put_char(int32_t c) {
+    uint8_t ch = (uint8_t)c;
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_write, STDOUT, (int64_t)(&ch), 1); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t written = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((written == 1)) {
+        int32_t _uya_ret = c;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = (0 - 1);
+    return _uya_ret;
+}
+
+int32_t put_char_fd(int32_t c, int64_t fd) {
+    uint8_t ch = (uint8_t)c;
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_write, fd, (int64_t)(&ch), 1); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t written = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((written == 1)) {
+        int32_t _uya_ret = c;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = (0 - 1);
+    return _uya_ret;
+}
+
+int64_t write_bytes(uint8_t * buf, size_t n) {
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_write, STDOUT, (int64_t)buf, (int64_t)n); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t written = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int64_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    int64_t _uya_ret = written;
+    return _uya_ret;
+}
+
+int64_t write_bytes_fd(uint8_t * buf, size_t n, int64_t fd) {
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_write, fd, (int64_t)buf, (int64_t)n); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t written = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int64_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    int64_t _uya_ret = written;
+    return _uya_ret;
+}
+
+int32_t put_str_len(uint8_t * s, size_t len) {
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_write, STDOUT, (int64_t)s, (int64_t)len); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    (void)(({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; }));
+    uint8_t newline = (uint8_t)10;
+    struct err_union_int64_t nl_result = ({ long _uya_syscall_ret = uya_syscall3(SYS_write, STDOUT, (int64_t)(&newline), 1); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    (void)(({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = nl_result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; }));
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+int32_t get_char() {
+    uint8_t ch = (uint8_t)0;
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_read, STDIN, (int64_t)(&ch), 1); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t bytes_read = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((bytes_read == 1)) {
+        int32_t _uya_ret = (int32_t)ch;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = (0 - 1);
+    return _uya_ret;
+}
+
+int64_t read_bytes(uint8_t * buf, size_t n) {
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_read, STDIN, (int64_t)buf, (int64_t)n); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t bytes_read = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int64_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    int64_t _uya_ret = bytes_read;
+    return _uya_ret;
+}
+
+int64_t read_bytes_fd(uint8_t * buf, size_t n, int64_t fd) {
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_read, fd, (int64_t)buf, (int64_t)n); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t bytes_read = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int64_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    int64_t _uya_ret = bytes_read;
+    return _uya_ret;
+}
+
+size_t i32_to_str(int32_t value, uint8_t * buf) {
+    int32_t v = value;
+    size_t len = 0;
+    bool is_neg = false;
+    if ((v < 0)) {
+        is_neg = true;
+        v = (0 - v);
+    }
+    if ((v == 0)) {
+        buf[0] = (uint8_t)48;
+        size_t _uya_ret = 1;
+        return _uya_ret;
+    }
+    while ((v > 0)) {
+        buf[len] = (uint8_t)((v % 10) + 48);
+        v = (v / 10);
+        len = (len + 1);
+    }
+    if (is_neg) {
+        buf[len] = (uint8_t)45;
+        len = (len + 1);
+    }
+    size_t left = 0;
+    size_t right = (len - 1);
+    while ((left < right)) {
+        const uint8_t tmp = buf[left];
+        buf[left] = buf[right];
+        buf[right] = tmp;
+        left = (left + 1);
+        right = (right - 1);
+    }
+    size_t _uya_ret = len;
+    return _uya_ret;
+}
+
+size_t i64_to_str(int64_t value, uint8_t * buf) {
+    int64_t v = value;
+    size_t len = 0;
+    bool is_neg = false;
+    if ((v < 0)) {
+        is_neg = true;
+        v = (0 - v);
+    }
+    if ((v == 0)) {
+        buf[0] = (uint8_t)48;
+        size_t _uya_ret = 1;
+        return _uya_ret;
+    }
+    while ((v > 0)) {
+        buf[len] = (uint8_t)((v % 10) + 48);
+        v = (v / 10);
+        len = (len + 1);
+    }
+    if (is_neg) {
+        buf[len] = (uint8_t)45;
+        len = (len + 1);
+    }
+    size_t left = 0;
+    size_t right = (len - 1);
+    while ((left < right)) {
+        const uint8_t tmp = buf[left];
+        buf[left] = buf[right];
+        buf[right] = tmp;
+        left = (left + 1);
+        right = (right - 1);
+    }
+    size_t _uya_ret = len;
+    return _uya_ret;
+}
+
+size_t print_i32(int32_t value) {
+uint8_t buf[12] = {0};
+    const size_t len = i32_to_str(value, (uint8_t *)(&buf[0]));
+    (void)(write_bytes((uint8_t *)(&buf[0]), len));
+    size_t _uya_ret = len;
+    return _uya_ret;
+}
+
+size_t print_i64(int64_t value) {
+uint8_t buf[21] = {0};
+    const size_t len = i64_to_str(value, (uint8_t *)(&buf[0]));
+    (void)(write_bytes((uint8_t *)(&buf[0]), len));
+    size_t _uya_ret = len;
+    return _uya_ret;
+}
+
+int64_t fopen_fd_storage[64] = {0};
+
+void * fopen(const uint8_t * filename, const uint8_t * mode) {
+    if (((filename == NULL) || (mode == NULL))) {
+        void * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    int64_t flags = 0;
+    int64_t create_mode = 0;
+    size_t i = 0;
+    const size_t mode_len = strlen(mode);
+    while ((i < mode_len)) {
+        const uint8_t c = mode[i];
+        if ((c == 114)) {
+            flags = O_RDONLY;
+        } else {
+            if ((c == 119)) {
+                flags = ((O_WRONLY | O_CREAT) | O_TRUNC);
+                create_mode = S_IRWXU;
+            } else {
+                if ((c == 97)) {
+                    flags = ((O_WRONLY | O_CREAT) | O_APPEND);
+                    create_mode = S_IRWXU;
+                } else {
+                    if ((c == 43)) {
+                        if ((flags == O_RDONLY)) {
+                            flags = O_RDWR;
+                        } else {
+                            flags = (flags | O_RDWR);
+                        }
+                    } else {
+                        if ((c == 98)) {
+                        }
+                    }
+                }
+            }
+        }
+        i = (i + 1);
+    }
+    struct err_union_int64_t result = sys_open((int64_t)filename, flags, create_mode);
+    const int64_t fd = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        void * _uya_ret = NULL;
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    size_t j = 0;
+    while ((j < 64)) {
+        if ((fopen_fd_storage[j] <= 0)) {
+            fopen_fd_storage[j] = fd;
+            void * _uya_ret = (void *)(&fopen_fd_storage[j]);
+            return _uya_ret;
+        }
+        j = (j + 1);
+    }
+    (void)(sys_close(fd));
+    void * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+int32_t fclose(void * stream) {
+    if ((stream == NULL)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    int64_t * const fd_ptr = (int64_t *)stream;
+    const int64_t fd = fd_ptr[0];
+    if ((fd < 0)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    struct err_union_int64_t result = sys_close(fd);
+    (void)(({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; }));
+    fd_ptr[0] = (0 - 1);
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+size_t fread(const uint8_t * ptr, size_t size, size_t nmemb, void * stream) {
+    if (((((ptr == NULL) || (stream == NULL)) || (size == 0)) || (nmemb == 0))) {
+        size_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    int64_t * const fd_ptr = (int64_t *)stream;
+    const int64_t fd = fd_ptr[0];
+    if ((fd < 0)) {
+        size_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    const size_t total_size = (size * nmemb);
+    struct err_union_int64_t result = sys_read(fd, (int64_t)ptr, (int64_t)total_size);
+    const int64_t bytes_read = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        size_t _uya_ret = 0;
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((bytes_read < 0)) {
+        size_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    size_t _uya_ret = ((size_t)bytes_read / size);
+    return _uya_ret;
+}
+
+int32_t fgetc(void * stream) {
+    if ((stream == NULL)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    int64_t * const fd_ptr = (int64_t *)stream;
+    const int64_t fd = fd_ptr[0];
+    if ((fd < 0)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    uint8_t ch = (uint8_t)0;
+    struct err_union_int64_t result = sys_read(fd, (int64_t)(&ch), 1);
+    const int64_t bytes_read = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((bytes_read == 1)) {
+        int32_t _uya_ret = (int32_t)ch;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = (0 - 1);
+    return _uya_ret;
+}
+
+int32_t fprintf(void * stream, const uint8_t * format, ...) {
+    if (((stream == NULL) || (format == NULL))) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    int64_t * const fd_ptr = (int64_t *)stream;
+    const int64_t fd = fd_ptr[0];
+    if ((fd < 0)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+uint8_t buf[4096] = {0};
+    size_t buf_pos = 0;
+    size_t format_pos = 0;
+    const size_t format_len = strlen(format);
+    while (((format_pos < format_len) && (buf_pos < 4095))) {
+        const uint8_t c = format[format_pos];
+        if ((c == 37)) {
+            format_pos = (format_pos + 1);
+            if ((format_pos < format_len)) {
+                const uint8_t spec = format[format_pos];
+                if ((spec == 115)) {
+                    buf[buf_pos] = (uint8_t)63;
+                    buf_pos = (buf_pos + 1);
+                } else {
+                    if ((spec == 100)) {
+                        buf[buf_pos] = (uint8_t)48;
+                        buf_pos = (buf_pos + 1);
+                    } else {
+                        if ((spec == 37)) {
+                            buf[buf_pos] = (uint8_t)37;
+                            buf_pos = (buf_pos + 1);
+                        } else {
+                            buf[buf_pos] = (uint8_t)37;
+                            buf_pos = (buf_pos + 1);
+                            if ((buf_pos < 4095)) {
+                                buf[buf_pos] = spec;
+                                buf_pos = (buf_pos + 1);
+                            }
+                        }
+                    }
+                }
+            }
+        } else {
+            buf[buf_pos] = c;
+            buf_pos = (buf_pos + 1);
+        }
+        format_pos = (format_pos + 1);
+    }
+    buf[buf_pos] = (uint8_t)0;
+    struct err_union_int64_t result = sys_write(fd, (int64_t)(&buf[0]), (int64_t)buf_pos);
+    const int64_t written = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    int32_t _uya_ret = (int32_t)written;
+    return _uya_ret;
+}
+
+size_t fwrite(uint8_t * ptr, size_t size, size_t nmemb, void * stream) {
+    if (((((ptr == NULL) || (stream == NULL)) || (size == 0)) || (nmemb == 0))) {
+        size_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    int64_t * const fd_ptr = (int64_t *)stream;
+    const int64_t fd = fd_ptr[0];
+    if ((fd < 0)) {
+        size_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    const size_t total_size = (size * nmemb);
+    struct err_union_int64_t result = sys_write(fd, (int64_t)ptr, (int64_t)total_size);
+    const int64_t bytes_written = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        size_t _uya_ret = 0;
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((bytes_written < 0)) {
+        size_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    size_t _uya_ret = ((size_t)bytes_written / size);
+    return _uya_ret;
+}
+
+int32_t fputc(int32_t c, void * stream) {
+    if ((stream == NULL)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    int64_t * const fd_ptr = (int64_t *)stream;
+    const int64_t fd = fd_ptr[0];
+    if ((fd < 0)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    uint8_t ch = (uint8_t)c;
+    struct err_union_int64_t result = sys_write(fd, (int64_t)(&ch), 1);
+    const int64_t bytes_written = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((bytes_written == 1)) {
+        int32_t _uya_ret = c;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = (0 - 1);
+    return _uya_ret;
+}
+
+int32_t fputs(uint8_t * s, void * stream) {
+    if (((s == NULL) || (stream == NULL))) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    const size_t len = strlen((uint8_t *)s);
+    if ((len == 0)) {
+        int32_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    const size_t written = fwrite((uint8_t *)s, 1, len, stream);
+    if ((written == len)) {
+        int32_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = (0 - 1);
+    return _uya_ret;
+}
+
+int32_t sprintf(uint8_t * buf, const uint8_t * format, ...) {
+    if (((buf == NULL) || (format == NULL))) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    size_t buf_pos = 0;
+    size_t format_pos = 0;
+    const size_t format_len = strlen(format);
+    const size_t max_buf = 4096;
+    while (((format_pos < format_len) && (buf_pos < (max_buf - 1)))) {
+        const uint8_t c = format[format_pos];
+        if ((c == 37)) {
+            format_pos = (format_pos + 1);
+            if ((format_pos < format_len)) {
+                const uint8_t spec = format[format_pos];
+                if ((spec == 115)) {
+                    buf[buf_pos] = (uint8_t)63;
+                    buf_pos = (buf_pos + 1);
+                } else {
+                    if ((spec == 100)) {
+                        buf[buf_pos] = (uint8_t)48;
+                        buf_pos = (buf_pos + 1);
+                    } else {
+                        if ((spec == 37)) {
+                            buf[buf_pos] = (uint8_t)37;
+                            buf_pos = (buf_pos + 1);
+                        } else {
+                            buf[buf_pos] = (uint8_t)37;
+                            buf_pos = (buf_pos + 1);
+                            if ((buf_pos < (max_buf - 1))) {
+                                buf[buf_pos] = spec;
+                                buf_pos = (buf_pos + 1);
+                            }
+                        }
+                    }
+                }
+            }
+        } else {
+            buf[buf_pos] = c;
+            buf_pos = (buf_pos + 1);
+        }
+        format_pos = (format_pos + 1);
+    }
+    buf[buf_pos] = (uint8_t)0;
+    int32_t _uya_ret = (int32_t)buf_pos;
+    return _uya_ret;
+}
+
+int32_t snprintf(uint8_t * buf, size_t n, const uint8_t * format, ...) {
+    if ((((buf == NULL) || (format == NULL)) || (n == 0))) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    size_t buf_pos = 0;
+    size_t format_pos = 0;
+    const size_t format_len = strlen(format);
+    size_t max_buf = (n - 1);
+    if ((max_buf > 4096)) {
+        max_buf = 4096;
+    }
+    while (((format_pos < format_len) && (buf_pos < max_buf))) {
+        const uint8_t c = format[format_pos];
+        if ((c == 37)) {
+            format_pos = (format_pos + 1);
+            if ((format_pos < format_len)) {
+                const uint8_t spec = format[format_pos];
+                if ((spec == 115)) {
+                    if ((buf_pos < max_buf)) {
+                        buf[buf_pos] = (uint8_t)63;
+                        buf_pos = (buf_pos + 1);
+                    }
+                } else {
+                    if ((spec == 100)) {
+                        if ((buf_pos < max_buf)) {
+                            buf[buf_pos] = (uint8_t)48;
+                            buf_pos = (buf_pos + 1);
+                        }
+                    } else {
+                        if ((spec == 37)) {
+                            if ((buf_pos < max_buf)) {
+                                buf[buf_pos] = (uint8_t)37;
+                                buf_pos = (buf_pos + 1);
+                            }
+                        } else {
+                            if ((buf_pos < max_buf)) {
+                                buf[buf_pos] = (uint8_t)37;
+                                buf_pos = (buf_pos + 1);
+                            }
+                            if ((buf_pos < max_buf)) {
+                                buf[buf_pos] = spec;
+                                buf_pos = (buf_pos + 1);
+                            }
+                        }
+                    }
+                }
+            }
+        } else {
+            if ((buf_pos < max_buf)) {
+                buf[buf_pos] = c;
+                buf_pos = (buf_pos + 1);
+            }
+        }
+        format_pos = (format_pos + 1);
+    }
+    if ((buf_pos < n)) {
+        buf[buf_pos] = (uint8_t)0;
+    } else {
+        if ((n > 0)) {
+            buf[(n - 1)] = (uint8_t)0;
+        }
+    }
+    int32_t _uya_ret = (int32_t)buf_pos;
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_write(int64_t fd, int64_t buf, int64_t count) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall3(SYS_write, fd, buf, count); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_read(int64_t fd, int64_t buf, int64_t count) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall3(SYS_read, fd, buf, count); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_open(int64_t path, int64_t flags, int64_t mode) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall3(SYS_open, path, flags, mode); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_close(int64_t fd) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall1(SYS_close, fd); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+void sys_exit(int64_t status) {
+    (void)(({ long _uya_syscall_ret = uya_syscall1(SYS_exit, status); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; }));
+}
+
+int64_t sys_getpid() {
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall0(SYS_getpid); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t pid = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int64_t _uya_ret = 0;
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    int64_t _uya_ret = pid;
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_lseek(int64_t fd, int64_t offset, int64_t whence) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall3(SYS_lseek, fd, offset, whence); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_access(int64_t path, int64_t mode) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall2(SYS_access, path, mode); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_unlink(int64_t path) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall1(SYS_unlink, path); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_mkdir(int64_t path, int64_t mode) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall2(SYS_mkdir, path, mode); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_rmdir(int64_t path) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall1(SYS_rmdir, path); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_chdir(int64_t path) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall1(SYS_chdir, path); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_getcwd(int64_t buf, int64_t size) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall2(SYS_getcwd, buf, size); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+void * memcpy(void * dest, void * src, size_t n) {
+    uint8_t * dest_bytes = (uint8_t *)dest;
+    uint8_t * src_bytes = (uint8_t *)src;
+    size_t i = 0;
+    while ((i < n)) {
+        dest_bytes[i] = src_bytes[i];
+        i = (i + 1);
+    }
+    void * _uya_ret = dest;
+    return _uya_ret;
+}
+
+void * memmove(void * dest, void * src, size_t n) {
+    uint8_t * dest_bytes = (uint8_t *)dest;
+    uint8_t * src_bytes = (uint8_t *)src;
+    if (((int64_t)dest_bytes <= (int64_t)src_bytes)) {
+        size_t i = 0;
+        while ((i < n)) {
+            dest_bytes[i] = src_bytes[i];
+            i = (i + 1);
+        }
+    } else {
+        size_t i = n;
+        while ((i > 0)) {
+            i = (i - 1);
+            dest_bytes[i] = src_bytes[i];
+        }
+    }
+    void * _uya_ret = dest;
+    return _uya_ret;
+}
+
+void * memset(void * s, int32_t c, size_t n) {
+    uint8_t * s_bytes = (uint8_t *)s;
+    uint8_t c_byte = (uint8_t)c;
+    size_t i = 0;
+    while ((i < n)) {
+        s_bytes[i] = c_byte;
+        i = (i + 1);
+    }
+    void * _uya_ret = s;
+    return _uya_ret;
+}
+
+int32_t memcmp(void * s1, void * s2, size_t n) {
+    uint8_t * s1_bytes = (uint8_t *)s1;
+    uint8_t * s2_bytes = (uint8_t *)s2;
+    size_t i = 0;
+    while ((i < n)) {
+        if ((s1_bytes[i] != s2_bytes[i])) {
+            int32_t _uya_ret = ((int32_t)s1_bytes[i] - (int32_t)s2_bytes[i]);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+void * memchr(void * s, int32_t c, size_t n) {
+    uint8_t * s_bytes = (uint8_t *)s;
+    uint8_t c_byte = (uint8_t)c;
+    size_t i = 0;
+    while ((i < n)) {
+        if ((s_bytes[i] == c_byte)) {
+            void * _uya_ret = (void *)(s_bytes + i);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    void * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+size_t strlen(const uint8_t * s) {
+    size_t len = 0;
+    while ((s[len] != (uint8_t)0)) {
+        len = (len + 1);
+    }
+    size_t _uya_ret = len;
+    return _uya_ret;
+}
+
+int32_t strcmp(uint8_t * s1, uint8_t * s2) {
+    size_t i = 0;
+    while (((s1[i] != (uint8_t)0) && (s2[i] != (uint8_t)0))) {
+        if ((s1[i] != s2[i])) {
+            int32_t _uya_ret = ((int32_t)s1[i] - (int32_t)s2[i]);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    int32_t _uya_ret = ((int32_t)s1[i] - (int32_t)s2[i]);
+    return _uya_ret;
+}
+
+int32_t strncmp(uint8_t * s1, uint8_t * s2, size_t n) {
+    size_t i = 0;
+    while ((((i < n) && (s1[i] != (uint8_t)0)) && (s2[i] != (uint8_t)0))) {
+        if ((s1[i] != s2[i])) {
+            int32_t _uya_ret = ((int32_t)s1[i] - (int32_t)s2[i]);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    if ((i >= n)) {
+        int32_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = ((int32_t)s1[i] - (int32_t)s2[i]);
+    return _uya_ret;
+}
+
+uint8_t * strcpy(uint8_t * dest, uint8_t * src) {
+    size_t i = 0;
+    while ((src[i] != (uint8_t)0)) {
+        dest[i] = src[i];
+        i = (i + 1);
+    }
+    dest[i] = (uint8_t)0;
+    uint8_t * _uya_ret = dest;
+    return _uya_ret;
+}
+
+uint8_t * strncpy(uint8_t * dest, uint8_t * src, size_t n) {
+    size_t i = 0;
+    while (((i < n) && (src[i] != (uint8_t)0))) {
+        dest[i] = src[i];
+        i = (i + 1);
+    }
+    while ((i < n)) {
+        dest[i] = (uint8_t)0;
+        i = (i + 1);
+    }
+    uint8_t * _uya_ret = dest;
+    return _uya_ret;
+}
+
+uint8_t * strcat(uint8_t * dest, uint8_t * src) {
+    size_t dest_len = strlen((uint8_t *)dest);
+    size_t i = 0;
+    while ((src[i] != (uint8_t)0)) {
+        dest[(dest_len + i)] = src[i];
+        i = (i + 1);
+    }
+    dest[(dest_len + i)] = (uint8_t)0;
+    uint8_t * _uya_ret = dest;
+    return _uya_ret;
+}
+
+const uint8_t * strchr(const uint8_t * s, int32_t c) {
+    uint8_t * s_bytes = (uint8_t *)s;
+    uint8_t c_byte = (uint8_t)c;
+    size_t i = 0;
+    while ((s_bytes[i] != (uint8_t)0)) {
+        if ((s_bytes[i] == c_byte)) {
+            const uint8_t * _uya_ret = (const uint8_t *)(s_bytes + i);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    if ((c_byte == (uint8_t)0)) {
+        const uint8_t * _uya_ret = (const uint8_t *)(s_bytes + i);
+        return _uya_ret;
+    }
+    const uint8_t * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+const uint8_t * strrchr(const uint8_t * s, int32_t c) {
+    uint8_t * s_bytes = (uint8_t *)s;
+    uint8_t c_byte = (uint8_t)c;
+    const uint8_t * last = NULL;
+    size_t i = 0;
+    while ((s_bytes[i] != (uint8_t)0)) {
+        if ((s_bytes[i] == c_byte)) {
+            last = (const uint8_t *)(s_bytes + i);
+        }
+        i = (i + 1);
+    }
+    if ((c_byte == (uint8_t)0)) {
+        const uint8_t * _uya_ret = (const uint8_t *)(s_bytes + i);
+        return _uya_ret;
+    }
+    const uint8_t * _uya_ret = last;
+    return _uya_ret;
+}
+
+uint8_t * strstr(uint8_t * haystack, uint8_t * needle) {
+    if (((haystack == NULL) || (needle == NULL))) {
+        uint8_t * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    const size_t needle_len = strlen((uint8_t *)needle);
+    if ((needle_len == 0)) {
+        uint8_t * _uya_ret = haystack;
+        return _uya_ret;
+    }
+    size_t i = 0;
+    while ((haystack[i] != (uint8_t)0)) {
+        size_t j = 0;
+        bool is_match = true;
+        while ((j < needle_len)) {
+            if (((haystack[(i + j)] == (uint8_t)0) || (haystack[(i + j)] != needle[j]))) {
+                is_match = false;
+                break;
+            }
+            j = (j + 1);
+        }
+        if (is_match) {
+            uint8_t * _uya_ret = (uint8_t *)((int64_t)haystack + (int64_t)i);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    uint8_t * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+int32_t result = 0;
+result = test_i32_to_str();
+if ((result != 0)) {
+    int32_t _uya_ret = result;
+    return _uya_ret;
+}
+result = test_put_char();
+if ((result != 0)) {
+    int32_t _uya_ret = (result + 20);
+    return _uya_ret;
+}
+result = test_write_bytes();
+if ((result != 0)) {
+    int32_t _uya_ret = (result + 30);
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
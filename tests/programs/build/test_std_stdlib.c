@@ -0,0 +1,1155 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+int32_t uya_main(void);
+void * malloc(size_t size);
+void free(void * ptr);
+void * calloc(size_t nmemb, size_t size);
+void * realloc(void * ptr, size_t size);
+void exit(int32_t status);
+void abort();
+int32_t atoi(uint8_t * s);
+int64_t atol(uint8_t * s);
+double atof(uint8_t * s);
+double strtod(const uint8_t * nptr, const uint8_t * * endptr);
+int64_t strtol(const uint8_t * nptr, const uint8_t * * endptr, int32_t base);
+int32_t stat(const uint8_t * path, Stat * buf);
+int32_t readlink(const uint8_t * path, const uint8_t * buf, size_t bufsiz);
+const uint8_t * getenv(const uint8_t * name);
+DIR * opendir(const uint8_t * name);
+Dirent * readdir(DIR * dirp);
+int32_t closedir(DIR * dirp);
+struct err_union_int64_t sys_write(int64_t fd, int64_t buf, int64_t count);
+struct err_union_int64_t sys_read(int64_t fd, int64_t buf, int64_t count);
+struct err_union_int64_t sys_open(int64_t path, int64_t flags, int64_t mode);
+struct err_union_int64_t sys_close(int64_t fd);
+void sys_exit(int64_t status);
+int64_t sys_getpid();
+struct err_union_int64_t sys_lseek(int64_t fd, int64_t offset, int64_t whence);
+struct err_union_int64_t sys_access(int64_t path, int64_t mode);
+struct err_union_int64_t sys_unlink(int64_t path);
+struct err_union_int64_t sys_mkdir(int64_t path, int64_t mode);
+struct err_union_int64_t sys_rmdir(int64_t path);
+struct err_union_int64_t sys_chdir(int64_t path);
+struct err_union_int64_t sys_getcwd(int64_t buf, int64_t size);
+void * memcpy(void * dest, void * src, size_t n);
+void * memmove(void * dest, void * src, size_t n);
+void * memset(void * s, int32_t c, size_t n);
+int32_t memcmp(void * s1, void * s2, size_t n);
+void * memchr(void * s, int32_t c, size_t n);
+size_t strlen(const uint8_t * s);
+int32_t strcmp(uint8_t * s1, uint8_t * s2);
+int32_t strncmp(uint8_t * s1, uint8_t * s2, size_t n);
+uint8_t * strcpy(uint8_t * dest, uint8_t * src);
+uint8_t * strncpy(uint8_t * dest, uint8_t * src, size_t n);
+uint8_t * strcat(uint8_t * dest, uint8_t * src);
+const uint8_t * strchr(const uint8_t * s, int32_t c);
+const uint8_t * strrchr(const uint8_t * s, int32_t c);
+uint8_t * strstr(uint8_t * haystack, uint8_t * needle);
+
+const int64_t MAP_PRIVATE = 2;
+
+const int64_t MAP_ANONYMOUS = 32;
+
+const int64_t PROT_READ = 1;
+
+const int64_t PROT_WRITE = 2;
+
+const int64_t SYS_read = 0;
+
+const int64_t SYS_write = 1;
+
+const int64_t SYS_open = 2;
+
+const int64_t SYS_close = 3;
+
+const int64_t SYS_stat = 4;
+
+const int64_t SYS_fstat = 5;
+
+const int64_t SYS_lseek = 8;
+
+const int64_t SYS_mmap = 9;
+
+const int64_t SYS_munmap = 11;
+
+const int64_t SYS_brk = 12;
+
+const int64_t SYS_ioctl = 16;
+
+const int64_t SYS_access = 21;
+
+const int64_t SYS_dup = 32;
+
+const int64_t SYS_dup2 = 33;
+
+const int64_t SYS_getpid = 39;
+
+const int64_t SYS_fork = 57;
+
+const int64_t SYS_execve = 59;
+
+const int64_t SYS_exit = 60;
+
+const int64_t SYS_kill = 62;
+
+const int64_t SYS_getcwd = 79;
+
+const int64_t SYS_chdir = 80;
+
+const int64_t SYS_mkdir = 83;
+
+const int64_t SYS_rmdir = 84;
+
+const int64_t SYS_unlink = 87;
+
+const int64_t SYS_readlink = 89;
+
+const int64_t SYS_getdents64 = 217;
+
+const int64_t O_RDONLY = 0;
+
+const int64_t O_WRONLY = 1;
+
+const int64_t O_RDWR = 2;
+
+const int64_t O_CREAT = 64;
+
+const int64_t O_EXCL = 128;
+
+const int64_t O_TRUNC = 512;
+
+const int64_t O_APPEND = 1024;
+
+const int64_t S_IRWXU = 448;
+
+const int64_t S_IRUSR = 256;
+
+const int64_t S_IWUSR = 128;
+
+const int64_t S_IXUSR = 64;
+
+const int64_t S_IRWXG = 56;
+
+const int64_t S_IRGRP = 32;
+
+const int64_t S_IWGRP = 16;
+
+const int64_t S_IXGRP = 8;
+
+const int64_t S_IRWXO = 7;
+
+const int64_t S_IROTH = 4;
+
+const int64_t S_IWOTH = 2;
+
+const int64_t S_IXOTH = 1;
+
+const int64_t UYA_SEEK_SET = 0;
+
+const int64_t UYA_SEEK_CUR = 1;
+
+const int64_t UYA_SEEK_END = 2;
+
+const int64_t STDIN_FILENO = 0;
+
+const int64_t STDOUT_FILENO = 1;
+
+const int64_t STDERR_FILENO = 2;
+
+const int32_t EPERM = 1;
+
+const int32_t ENOENT = 2;
+
+const int32_t ESRCH = 3;
+
+const int32_t EINTR = 4;
+
+const int32_t EIO = 5;
+
+const int32_t ENXIO = 6;
+
+const int32_t E2BIG = 7;
+
+const int32_t ENOEXEC = 8;
+
+const int32_t EBADF = 9;
+
+const int32_t ECHILD = 10;
+
+const int32_t EAGAIN = 11;
+
+const int32_t ENOMEM = 12;
+
+const int32_t EACCES = 13;
+
+const int32_t EFAULT = 14;
+
+const int32_t ENOTBLK = 15;
+
+const int32_t EBUSY = 16;
+
+const int32_t EEXIST = 17;
+
+const int32_t EXDEV = 18;
+
+const int32_t ENODEV = 19;
+
+const int32_t ENOTDIR = 20;
+
+const int32_t EISDIR = 21;
+
+const int32_t EINVAL = 22;
+
+void * malloc(size_t size) {
+    if ((size == 0)) {
+        void * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall6(9, 0, (int64_t)size, (PROT_READ | PROT_WRITE), (MAP_PRIVATE | MAP_ANONYMOUS), (0 - 1), 0); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t ptr = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        void * _uya_ret = NULL;
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((ptr < 0)) {
+        void * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    void * _uya_ret = (void *)ptr;
+    return _uya_ret;
+}
+
+void free(void * ptr) {
+    if ((ptr == NULL)) {
+        return;
+    }
+    (void)(({ long _uya_syscall_ret = uya_syscall2(11, (int64_t)ptr, 4096); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; }));
+}
+
+void * calloc(size_t nmemb, size_t size) {
+    const size_t total_size = (nmemb * size);
+    void * const ptr = malloc(total_size);
+    if ((ptr == NULL)) {
+        void * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    (void)(memset((void *)ptr, 0, total_size));
+    void * _uya_ret = ptr;
+    return _uya_ret;
+}
+
+void * realloc(void * ptr, size_t size) {
+    if ((ptr == NULL)) {
+        void * _uya_ret = malloc(size);
+        return _uya_ret;
+    }
+    if ((size == 0)) {
+        free(ptr);
+        void * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    void * const new_ptr = malloc(size);
+    if ((new_ptr == NULL)) {
+        void * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    void * _uya_ret = new_ptr;
+    return _uya_ret;
+}
+
+void exit(int32_t status) {
+    sys_exit((int64_t)status);
+}
+
+void abort() {
+    const int64_t pid = sys_getpid();
+    (void)(({ long _uya_syscall_ret = uya_syscall2(62, pid, 6); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; }));
+    sys_exit(1);
+}
+
+int32_t atoi(uint8_t * s) {
+    if ((s == NULL)) {
+        int32_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    int32_t result = 0;
+    size_t i = 0;
+    bool is_neg = false;
+    while (((((s[i] == (uint8_t)32) || (s[i] == (uint8_t)9)) || (s[i] == (uint8_t)10)) || (s[i] == (uint8_t)13))) {
+        i = (i + 1);
+    }
+    if ((s[i] == (uint8_t)45)) {
+        is_neg = true;
+        i = (i + 1);
+    } else {
+        if ((s[i] == (uint8_t)43)) {
+            i = (i + 1);
+        }
+    }
+    while (((s[i] >= (uint8_t)48) && (s[i] <= (uint8_t)57))) {
+        const int32_t digit = ((int32_t)s[i] - 48);
+        result = ((result * 10) + digit);
+        i = (i + 1);
+    }
+    if (is_neg) {
+        result = (0 - result);
+    }
+    int32_t _uya_ret = result;
+    return _uya_ret;
+}
+
+int64_t atol(uint8_t * s) {
+    if ((s == NULL)) {
+        int64_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    int64_t result = 0;
+    size_t i = 0;
+    bool is_neg = false;
+    while (((((s[i] == (uint8_t)32) || (s[i] == (uint8_t)9)) || (s[i] == (uint8_t)10)) || (s[i] == (uint8_t)13))) {
+        i = (i + 1);
+    }
+    if ((s[i] == (uint8_t)45)) {
+        is_neg = true;
+        i = (i + 1);
+    } else {
+        if ((s[i] == (uint8_t)43)) {
+            i = (i + 1);
+        }
+    }
+    while (((s[i] >= (uint8_t)48) && (s[i] <= (uint8_t)57))) {
+        const int64_t digit = ((int64_t)s[i] - 48);
+        result = ((result * 10) + digit);
+        i = (i + 1);
+    }
+    if (is_neg) {
+        result = (0 - result);
+    }
+    int64_t _uya_ret = result;
+    return _uya_ret;
+}
+
+double atof(uint8_t * s) {
+    if ((s == NULL)) {
+        double _uya_ret = 0;
+        return _uya_ret;
+    }
+    size_t i = 0;
+    bool is_neg = false;
+    double result = 0;
+    while (((((s[i] == (uint8_t)32) || (s[i] == (uint8_t)9)) || (s[i] == (uint8_t)10)) || (s[i] == (uint8_t)13))) {
+        i = (i + 1);
+    }
+    if ((s[i] == (uint8_t)45)) {
+        is_neg = true;
+        i = (i + 1);
+    } else {
+        if ((s[i] == (uint8_t)43)) {
+            i = (i + 1);
+        }
+    }
+    while (((s[i] >= (uint8_t)48) && (s[i] <= (uint8_t)57))) {
+        const double digit = ((double)s[i] - 48);
+        result = ((result * 10) + digit);
+        i = (i + 1);
+    }
+    if ((s[i] == (uint8_t)46)) {
+        i = (i + 1);
+        double frac = 0;
+        double frac_div = 10;
+        while (((s[i] >= (uint8_t)48) && (s[i] <= (uint8_t)57))) {
+            const double digit = ((double)s[i] - 48);
+            frac = (frac + (digit / frac_div));
+            frac_div = (frac_div * 10);
+            i = (i + 1);
+        }
+        result = (result + frac);
+    }
+    if (is_neg) {
+        result = (0 - result);
+    }
+    double _uya_ret = result;
+    return _uya_ret;
+}
+
+double strtod(const uint8_t * nptr, const uint8_t * * endptr) {
+    if ((nptr == NULL)) {
+        if ((endptr != NULL)) {
+            endptr[0] = NULL;
+        }
+        double _uya_ret = 0;
+        return _uya_ret;
+    }
+    size_t i = 0;
+    bool is_neg = false;
+    double result = 0;
+    while (((((nptr[i] == (uint8_t)32) || (nptr[i] == (uint8_t)9)) || (nptr[i] == (uint8_t)10)) || (nptr[i] == (uint8_t)13))) {
+        i = (i + 1);
+    }
+    if ((nptr[i] == (uint8_t)45)) {
+        is_neg = true;
+        i = (i + 1);
+    } else {
+        if ((nptr[i] == (uint8_t)43)) {
+            i = (i + 1);
+        }
+    }
+    while (((nptr[i] >= (uint8_t)48) && (nptr[i] <= (uint8_t)57))) {
+        const double digit = ((double)nptr[i] - 48);
+        result = ((result * 10) + digit);
+        i = (i + 1);
+    }
+    if ((nptr[i] == (uint8_t)46)) {
+        i = (i + 1);
+        double frac = 0;
+        double frac_div = 10;
+        while (((nptr[i] >= (uint8_t)48) && (nptr[i] <= (uint8_t)57))) {
+            const double digit = ((double)nptr[i] - 48);
+            frac = (frac + (digit / frac_div));
+            frac_div = (frac_div * 10);
+            i = (i + 1);
+        }
+        result = (result + frac);
+    }
+    if (is_neg) {
+        result = (0 - result);
+    }
+    if ((endptr != NULL)) {
+        endptr[0] = (const uint8_t *)((int64_t)nptr + (int64_t)i);
+    }
+    double _uya_ret = result;
+    return _uya_ret;
+}
+
+int64_t strtol(const uint8_t * nptr, const uint8_t * * endptr, int32_t base) {
+    if ((nptr == NULL)) {
+        if ((endptr != NULL)) {
+            endptr[0] = NULL;
+        }
+        int64_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    int64_t result = 0;
+    size_t i = 0;
+    bool is_neg = false;
+    int32_t radix = base;
+    if ((radix == 0)) {
+        while (((((nptr[i] == (uint8_t)32) || (nptr[i] == (uint8_t)9)) || (nptr[i] == (uint8_t)10)) || (nptr[i] == (uint8_t)13))) {
+            i = (i + 1);
+        }
+        if ((nptr[i] == (uint8_t)48)) {
+            i = (i + 1);
+            if (((nptr[i] == (uint8_t)120) || (nptr[i] == (uint8_t)88))) {
+                radix = 16;
+                i = (i + 1);
+            } else {
+                radix = 8;
+            }
+        } else {
+            radix = 10;
+        }
+    } else {
+        while (((((nptr[i] == (uint8_t)32) || (nptr[i] == (uint8_t)9)) || (nptr[i] == (uint8_t)10)) || (nptr[i] == (uint8_t)13))) {
+            i = (i + 1);
+        }
+    }
+    if ((nptr[i] == (uint8_t)45)) {
+        is_neg = true;
+        i = (i + 1);
+    } else {
+        if ((nptr[i] == (uint8_t)43)) {
+            i = (i + 1);
+        }
+    }
+    while ((i < 4096)) {
+        const uint8_t c = nptr[i];
+        int64_t digit = (0 - 1);
+        if (((c >= (uint8_t)48) && (c <= (uint8_t)57))) {
+            digit = ((int64_t)c - 48);
+        } else {
+            if (((c >= (uint8_t)97) && (c <= (uint8_t)122))) {
+                digit = (((int64_t)c - 97) + 10);
+            } else {
+                if (((c >= (uint8_t)65) && (c <= (uint8_t)90))) {
+                    digit = (((int64_t)c - 65) + 10);
+                } else {
+                    break;
+                }
+            }
+        }
+        if (((digit < 0) || (digit >= (int64_t)radix))) {
+            break;
+        }
+        result = ((result * (int64_t)radix) + digit);
+        i = (i + 1);
+    }
+    if (is_neg) {
+        result = (0 - result);
+    }
+    if ((endptr != NULL)) {
+        endptr[0] = (const uint8_t *)((int64_t)nptr + (int64_t)i);
+    }
+    int64_t _uya_ret = result;
+    return _uya_ret;
+}
+
+int32_t stat(const uint8_t * path, Stat * buf) {
+    if (((path == NULL) || (buf == NULL))) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall2(SYS_stat, (int64_t)path, (int64_t)buf); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t ret = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((ret < 0)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+int32_t readlink(const uint8_t * path, const uint8_t * buf, size_t bufsiz) {
+    if ((((path == NULL) || (buf == NULL)) || (bufsiz == 0))) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall3(SYS_readlink, (int64_t)path, (int64_t)buf, (int64_t)bufsiz); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t ret = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((ret < 0)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    int32_t _uya_ret = (int32_t)ret;
+    return _uya_ret;
+}
+
+const uint8_t * getenv(const uint8_t * name) {
+    if ((name == NULL)) {
+        const uint8_t * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    const uint8_t * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+int64_t opendir_fd_storage[64] = {0};
+
+DIR * opendir(const uint8_t * name) {
+    if ((name == NULL)) {
+        DIR * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    struct err_union_int64_t result = sys_open((int64_t)name, O_RDONLY, 0);
+    const int64_t fd = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        DIR * _uya_ret = NULL;
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((fd < 0)) {
+        DIR * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    size_t j = 0;
+    while ((j < 64)) {
+        if ((opendir_fd_storage[j] <= 0)) {
+            opendir_fd_storage[j] = fd;
+            DIR * _uya_ret = (DIR *)(&opendir_fd_storage[j]);
+            return _uya_ret;
+        }
+        j = (j + 1);
+    }
+    (void)(sys_close(fd));
+    DIR * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+Dirent * readdir(DIR * dirp) {
+    if ((dirp == NULL)) {
+        Dirent * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    int64_t * const fd_ptr = (int64_t *)dirp;
+    const int64_t fd = fd_ptr[0];
+    if ((fd < 0)) {
+        Dirent * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    Dirent * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+int32_t closedir(DIR * dirp) {
+    if ((dirp == NULL)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    int64_t * const fd_ptr = (int64_t *)dirp;
+    const int64_t fd = fd_ptr[0];
+    if ((fd < 0)) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    }
+    struct err_union_int64_t result = sys_close(fd);
+    (void)(({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int32_t _uya_ret = (0 - 1);
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; }));
+    fd_ptr[0] = (0 - 1);
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_write(int64_t fd, int64_t buf, int64_t count) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall3(SYS_write, fd, buf, count); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_read(int64_t fd, int64_t buf, int64_t count) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall3(SYS_read, fd, buf, count); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_open(int64_t path, int64_t flags, int64_t mode) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall3(SYS_open, path, flags, mode); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_close(int64_t fd) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall1(SYS_close, fd); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+void sys_exit(int64_t status) {
+    (void)(({ long _uya_syscall_ret = uya_syscall1(SYS_exit, status); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; }));
+}
+
+int64_t sys_getpid() {
+    struct err_union_int64_t result = ({ long _uya_syscall_ret = uya_syscall0(SYS_getpid); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    const int64_t pid = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = result; if (_uya_catch_tmp.error_id != 0) {
+        int64_t _uya_ret = 0;
+        return _uya_ret;
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    int64_t _uya_ret = pid;
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_lseek(int64_t fd, int64_t offset, int64_t whence) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall3(SYS_lseek, fd, offset, whence); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_access(int64_t path, int64_t mode) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall2(SYS_access, path, mode); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_unlink(int64_t path) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall1(SYS_unlink, path); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_mkdir(int64_t path, int64_t mode) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall2(SYS_mkdir, path, mode); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_rmdir(int64_t path) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall1(SYS_rmdir, path); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_chdir(int64_t path) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall1(SYS_chdir, path); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+struct err_union_int64_t sys_getcwd(int64_t buf, int64_t size) {
+    struct err_union_int64_t _uya_ret = ({ long _uya_syscall_ret = uya_syscall2(SYS_getcwd, buf, size); struct err_union_int64_t _uya_result; if (_uya_syscall_ret < 0) { _uya_result.error_id = (int)(-_uya_syscall_ret); } else { _uya_result.error_id = 0; _uya_result.value = _uya_syscall_ret; } _uya_result; });
+    return _uya_ret;
+}
+
+void * memcpy(void * dest, void * src, size_t n) {
+    uint8_t * dest_bytes = (uint8_t *)dest;
+    uint8_t * src_bytes = (uint8_t *)src;
+    size_t i = 0;
+    while ((i < n)) {
+        dest_bytes[i] = src_bytes[i];
+        i = (i + 1);
+    }
+    void * _uya_ret = dest;
+    return _uya_ret;
+}
+
+void * memmove(void * dest, void * src, size_t n) {
+    uint8_t * dest_bytes = (uint8_t *)dest;
+    uint8_t * src_bytes = (uint8_t *)src;
+    if (((int64_t)dest_bytes <= (int64_t)src_bytes)) {
+        size_t i = 0;
+        while ((i < n)) {
+            dest_bytes[i] = src_bytes[i];
+            i = (i + 1);
+        }
+    } else {
+        size_t i = n;
+        while ((i > 0)) {
+            i = (i - 1);
+            dest_bytes[i] = src_bytes[i];
+        }
+    }
+    void * _uya_ret = dest;
+    return _uya_ret;
+}
+
+void * memset(void * s, int32_t c, size_t n) {
+    uint8_t * s_bytes = (uint8_t *)s;
+    uint8_t c_byte = (uint8_t)c;
+    size_t i = 0;
+    while ((i < n)) {
+        s_bytes[i] = c_byte;
+        i = (i + 1);
+    }
+    void * _uya_ret = s;
+    return _uya_ret;
+}
+
+int32_t memcmp(void * s1, void * s2, size_t n) {
+    uint8_t * s1_bytes = (uint8_t *)s1;
+    uint8_t * s2_bytes = (uint8_t *)s2;
+    size_t i = 0;
+    while ((i < n)) {
+        if ((s1_bytes[i] != s2_bytes[i])) {
+            int32_t _uya_ret = ((int32_t)s1_bytes[i] - (int32_t)s2_bytes[i]);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+
+void * memchr(void * s, int32_t c, size_t n) {
+    uint8_t * s_bytes = (uint8_t *)s;
+    uint8_t c_byte = (uint8_t)c;
+    size_t i = 0;
+    while ((i < n)) {
+        if ((s_bytes[i] == c_byte)) {
+            void * _uya_ret = (void *)(s_bytes + i);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    void * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+size_t strlen(const uint8_t * s) {
+    size_t len = 0;
+    while ((s[len] != (uint8_t)0)) {
+        len = (len + 1);
+    }
+    size_t _uya_ret = len;
+    return _uya_ret;
+}
+
+int32_t strcmp(uint8_t * s1, uint8_t * s2) {
+    size_t i = 0;
+    while (((s1[i] != (uint8_t)0) && (s2[i] != (uint8_t)0))) {
+        if ((s1[i] != s2[i])) {
+            int32_t _uya_ret = ((int32_t)s1[i] - (int32_t)s2[i]);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    int32_t _uya_ret = ((int32_t)s1[i] - (int32_t)s2[i]);
+    return _uya_ret;
+}
+
+int32_t strncmp(uint8_t * s1, uint8_t * s2, size_t n) {
+    size_t i = 0;
+    while ((((i < n) && (s1[i] != (uint8_t)0)) && (s2[i] != (uint8_t)0))) {
+        if ((s1[i] != s2[i])) {
+            int32_t _uya_ret = ((int32_t)s1[i] - (int32_t)s2[i]);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    if ((i >= n)) {
+        int32_t _uya_ret = 0;
+        return _uya_ret;
+    }
+    int32_t _uya_ret = ((int32_t)s1[i] - (int32_t)s2[i]);
+    return _uya_ret;
+}
+
+uint8_t * strcpy(uint8_t * dest, uint8_t * src) {
+    size_t i = 0;
+    while ((src[i] != (uint8_t)0)) {
+        dest[i] = src[i];
+        i = (i + 1);
+    }
+    dest[i] = (uint8_t)0;
+    uint8_t * _uya_ret = dest;
+    return _uya_ret;
+}
+
+uint8_t * strncpy(uint8_t * dest, uint8_t * src, size_t n) {
+    size_t i = 0;
+    while (((i < n) && (src[i] != (uint8_t)0))) {
+        dest[i] = src[i];
+        i = (i + 1);
+    }
+    while ((i < n)) {
+        dest[i] = (uint8_t)0;
+        i = (i + 1);
+    }
+    uint8_t * _uya_ret = dest;
+    return _uya_ret;
+}
+
+uint8_t * strcat(uint8_t * dest, uint8_t * src) {
+    size_t dest_len = strlen((uint8_t *)dest);
+    size_t i = 0;
+    while ((src[i] != (uint8_t)0)) {
+        dest[(dest_len + i)] = src[i];
+        i = (i + 1);
+    }
+    dest[(dest_len + i)] = (uint8_t)0;
+    uint8_t * _uya_ret = dest;
+    return _uya_ret;
+}
+
+const uint8_t * strchr(const uint8_t * s, int32_t c) {
+    uint8_t * s_bytes = (uint8_t *)s;
+    uint8_t c_byte = (uint8_t)c;
+    size_t i = 0;
+    while ((s_bytes[i] != (uint8_t)0)) {
+        if ((s_bytes[i] == c_byte)) {
+            const uint8_t * _uya_ret = (const uint8_t *)(s_bytes + i);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    if ((c_byte == (uint8_t)0)) {
+        const uint8_t * _uya_ret = (const uint8_t *)(s_bytes + i);
+        return _uya_ret;
+    }
+    const uint8_t * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+const uint8_t * strrchr(const uint8_t * s, int32_t c) {
+    uint8_t * s_bytes = (uint8_t *)s;
+    uint8_t c_byte = (uint8_t)c;
+    const uint8_t * last = NULL;
+    size_t i = 0;
+    while ((s_bytes[i] != (uint8_t)0)) {
+        if ((s_bytes[i] == c_byte)) {
+            last = (const uint8_t *)(s_bytes + i);
+        }
+        i = (i + 1);
+    }
+    if ((c_byte == (uint8_t)0)) {
+        const uint8_t * _uya_ret = (const uint8_t *)(s_bytes + i);
+        return _uya_ret;
+    }
+    const uint8_t * _uya_ret = last;
+    return _uya_ret;
+}
+
+uint8_t * strstr(uint8_t * haystack, uint8_t * needle) {
+    if (((haystack == NULL) || (needle == NULL))) {
+        uint8_t * _uya_ret = NULL;
+        return _uya_ret;
+    }
+    const size_t needle_len = strlen((uint8_t *)needle);
+    if ((needle_len == 0)) {
+        uint8_t * _uya_ret = haystack;
+        return _uya_ret;
+    }
+    size_t i = 0;
+    while ((haystack[i] != (uint8_t)0)) {
+        size_t j = 0;
+        bool is_match = true;
+        while ((j < needle_len)) {
+            if (((haystack[(i + j)] == (uint8_t)0) || (haystack[(i + j)] != needle[j]))) {
+                is_match = false;
+                break;
+            }
+            j = (j + 1);
+        }
+        if (is_match) {
+            uint8_t * _uya_ret = (uint8_t *)((int64_t)haystack + (int64_t)i);
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    uint8_t * _uya_ret = NULL;
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+void * const ptr1 = malloc(100);
+if ((ptr1 == NULL)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+uint8_t * bytes1 = (uint8_t *)ptr1;
+bytes1[0] = (uint8_t)65;
+bytes1[1] = (uint8_t)66;
+bytes1[2] = (uint8_t)67;
+if ((((bytes1[0] != (uint8_t)65) || (bytes1[1] != (uint8_t)66)) || (bytes1[2] != (uint8_t)67))) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+void * const ptr2 = calloc(10, 4);
+if ((ptr2 == NULL)) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+uint8_t * bytes2 = (uint8_t *)ptr2;
+size_t i = 0;
+while ((i < 40)) {
+    if ((bytes2[i] != (uint8_t)0)) {
+        int32_t _uya_ret = 4;
+        return _uya_ret;
+    }
+    i = (i + 1);
+}
+void * const ptr3 = malloc(10);
+if ((ptr3 == NULL)) {
+    int32_t _uya_ret = 5;
+    return _uya_ret;
+}
+void * const ptr4 = realloc(ptr3, 20);
+if ((ptr4 == NULL)) {
+    int32_t _uya_ret = 6;
+    return _uya_ret;
+}
+uint8_t str1[10] = {0};
+str1[0] = (uint8_t)49;
+str1[1] = (uint8_t)50;
+str1[2] = (uint8_t)51;
+str1[3] = (uint8_t)0;
+const int32_t n1 = atoi((uint8_t *)(&str1[0]));
+if ((n1 != 123)) {
+    int32_t _uya_ret = 7;
+    return _uya_ret;
+}
+uint8_t str2[10] = {0};
+str2[0] = (uint8_t)45;
+str2[1] = (uint8_t)52;
+str2[2] = (uint8_t)53;
+str2[3] = (uint8_t)54;
+str2[4] = (uint8_t)0;
+const int32_t n2 = atoi((uint8_t *)(&str2[0]));
+if ((n2 != (0 - 456))) {
+    int32_t _uya_ret = 8;
+    return _uya_ret;
+}
+uint8_t str3[10] = {0};
+str3[0] = (uint8_t)48;
+str3[1] = (uint8_t)0;
+const int32_t n3 = atoi((uint8_t *)(&str3[0]));
+if ((n3 != 0)) {
+    int32_t _uya_ret = 9;
+    return _uya_ret;
+}
+uint8_t str4[10] = {0};
+str4[0] = (uint8_t)32;
+str4[1] = (uint8_t)32;
+str4[2] = (uint8_t)52;
+str4[3] = (uint8_t)50;
+str4[4] = (uint8_t)0;
+const int32_t n4 = atoi((uint8_t *)(&str4[0]));
+if ((n4 != 42)) {
+    int32_t _uya_ret = 10;
+    return _uya_ret;
+}
+uint8_t str5[20] = {0};
+str5[0] = (uint8_t)49;
+str5[1] = (uint8_t)50;
+str5[2] = (uint8_t)51;
+str5[3] = (uint8_t)52;
+str5[4] = (uint8_t)53;
+str5[5] = (uint8_t)54;
+str5[6] = (uint8_t)55;
+str5[7] = (uint8_t)56;
+str5[8] = (uint8_t)57;
+str5[9] = (uint8_t)48;
+str5[10] = (uint8_t)0;
+const int64_t n5 = atol((uint8_t *)(&str5[0]));
+if ((n5 != 1234567890)) {
+    int32_t _uya_ret = 11;
+    return _uya_ret;
+}
+uint8_t str6[20] = {0};
+str6[0] = (uint8_t)45;
+str6[1] = (uint8_t)50;
+str6[2] = (uint8_t)49;
+str6[3] = (uint8_t)52;
+str6[4] = (uint8_t)55;
+str6[5] = (uint8_t)52;
+str6[6] = (uint8_t)56;
+str6[7] = (uint8_t)51;
+str6[8] = (uint8_t)54;
+str6[9] = (uint8_t)52;
+str6[10] = (uint8_t)55;
+str6[11] = (uint8_t)0;
+const int64_t n6 = atol((uint8_t *)(&str6[0]));
+if ((n6 != (0 - 2147483647))) {
+    int32_t _uya_ret = 12;
+    return _uya_ret;
+}
+uint8_t str7[20] = {0};
+str7[0] = (uint8_t)51;
+str7[1] = (uint8_t)46;
+str7[2] = (uint8_t)49;
+str7[3] = (uint8_t)52;
+str7[4] = (uint8_t)0;
+const double f1 = atof((uint8_t *)(&str7[0]));
+if (((f1 < 3.1299999999999999) || (f1 > 3.1499999999999999))) {
+    int32_t _uya_ret = 13;
+    return _uya_ret;
+}
+uint8_t str8[20] = {0};
+str8[0] = (uint8_t)45;
+str8[1] = (uint8_t)50;
+str8[2] = (uint8_t)46;
+str8[3] = (uint8_t)53;
+str8[4] = (uint8_t)0;
+const double f2 = atof((uint8_t *)(&str8[0]));
+if (((f2 < (-2.5099999999999998)) || (f2 > (-2.4900000000000002)))) {
+    int32_t _uya_ret = 14;
+    return _uya_ret;
+}
+uint8_t str9[20] = {0};
+str9[0] = (uint8_t)49;
+str9[1] = (uint8_t)50;
+str9[2] = (uint8_t)51;
+str9[3] = (uint8_t)0;
+const double f3 = atof((uint8_t *)(&str9[0]));
+if (((f3 < 122.90000000000001) || (f3 > 123.09999999999999))) {
+    int32_t _uya_ret = 15;
+    return _uya_ret;
+}
+void * const ptr_zero = malloc(0);
+if ((ptr_zero != NULL)) {
+    int32_t _uya_ret = 16;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
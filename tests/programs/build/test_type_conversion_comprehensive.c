@@ -0,0 +1,244 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+int32_t uya_main(void);
+
+int32_t uya_main(void) {
+int32_t i32_val = 256;
+uint8_t byte_val = (uint8_t)i32_val;
+if ((byte_val != 0)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+int32_t i32_val2 = 42;
+uint8_t byte_val2 = (uint8_t)i32_val2;
+if ((byte_val2 != 42)) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+int32_t i32_val3 = 300;
+uint8_t byte_val3 = (uint8_t)i32_val3;
+if ((byte_val3 != 44)) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+uint8_t byte_val4 = 200;
+int32_t i32_val4 = (int32_t)byte_val4;
+if ((i32_val4 != 200)) {
+    int32_t _uya_ret = 4;
+    return _uya_ret;
+}
+uint8_t byte_val5 = 0;
+int32_t i32_val5 = (int32_t)byte_val5;
+if ((i32_val5 != 0)) {
+    int32_t _uya_ret = 5;
+    return _uya_ret;
+}
+int32_t i32_val6 = 42;
+bool bool_val1 = (bool)i32_val6;
+if ((bool_val1 != true)) {
+    int32_t _uya_ret = 6;
+    return _uya_ret;
+}
+int32_t i32_val7 = 0;
+bool bool_val2 = (bool)i32_val7;
+if ((bool_val2 != false)) {
+    int32_t _uya_ret = 7;
+    return _uya_ret;
+}
+int32_t i32_val8 = (-1);
+bool bool_val3 = (bool)i32_val8;
+if ((bool_val3 != true)) {
+    int32_t _uya_ret = 8;
+    return _uya_ret;
+}
+bool bool_val4 = true;
+int32_t i32_val9 = (int32_t)bool_val4;
+if ((i32_val9 != 1)) {
+    int32_t _uya_ret = 9;
+    return _uya_ret;
+}
+bool bool_val5 = false;
+int32_t i32_val10 = (int32_t)bool_val5;
+if ((i32_val10 != 0)) {
+    int32_t _uya_ret = 10;
+    return _uya_ret;
+}
+int32_t i32_val11 = 123;
+size_t usize_val1 = (size_t)i32_val11;
+if ((usize_val1 != (size_t)123)) {
+    int32_t _uya_ret = 11;
+    return _uya_ret;
+}
+int32_t i32_val12 = 0;
+size_t usize_val2 = (size_t)i32_val12;
+if ((usize_val2 != (size_t)0)) {
+    int32_t _uya_ret = 12;
+    return _uya_ret;
+}
+size_t usize_val3 = (size_t)456;
+int32_t i32_val13 = (int32_t)usize_val3;
+if ((i32_val13 != 456)) {
+    int32_t _uya_ret = 13;
+    return _uya_ret;
+}
+size_t usize_val4 = (size_t)0;
+int32_t i32_val14 = (int32_t)usize_val4;
+if ((i32_val14 != 0)) {
+    int32_t _uya_ret = 14;
+    return _uya_ret;
+}
+int32_t x = 42;
+int32_t * i32_ptr = (&x);
+void * void_ptr = (void *)i32_ptr;
+if ((void_ptr == NULL)) {
+    int32_t _uya_ret = 15;
+    return _uya_ret;
+}
+int32_t * recovered_i32_ptr = (int32_t *)void_ptr;
+if ((recovered_i32_ptr == NULL)) {
+    int32_t _uya_ret = 16;
+    return _uya_ret;
+}
+if (((*recovered_i32_ptr) != 42)) {
+    int32_t _uya_ret = 17;
+    return _uya_ret;
+}
+int32_t y = 100;
+int32_t * normal_ptr = (&y);
+uint8_t byte_val6 = 42;
+if (((int32_t)byte_val6 != 42)) {
+    int32_t _uya_ret = 18;
+    return _uya_ret;
+}
+uint8_t byte_val7 = 10;
+int32_t i32_val15 = 20;
+int32_t result = ((int32_t)byte_val7 + i32_val15);
+if ((result != 30)) {
+    int32_t _uya_ret = 19;
+    return _uya_ret;
+}
+int32_t i32_val16 = 42;
+bool bool_val6 = (bool)i32_val16;
+if ((bool_val6 != true)) {
+    int32_t _uya_ret = 20;
+    return _uya_ret;
+}
+int32_t i32_val17 = 10;
+uint8_t byte_val8 = 2;
+int32_t result2 = ((int32_t)(uint8_t)i32_val17 * (int32_t)byte_val8);
+if ((result2 != 20)) {
+    int32_t _uya_ret = 21;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
@@ -0,0 +1,157 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+
+
+
+union IntOrFloat {
+    int32_t i;
+    double f;
+};
+struct uya_tagged_IntOrFloat { int _tag; union IntOrFloat u; };
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+double uya_IntOrFloat_as_f64(const struct uya_tagged_IntOrFloat * self);
+bool uya_IntOrFloat_is_int(const struct uya_tagged_IntOrFloat * self);
+int32_t uya_main(void);
+
+double uya_IntOrFloat_as_f64(const struct uya_tagged_IntOrFloat * self) {
+    double _uya_ret = ({ const struct uya_tagged_IntOrFloat _uya_m = (*self); double _uya_r; switch (_uya_m._tag) { case 0: { int32_t x = _uya_m.u.i; _uya_r = (double)x; } break; case 1: { double x = _uya_m.u.f; _uya_r = x; } break; } _uya_r; });
+    return _uya_ret;
+}
+
+bool uya_IntOrFloat_is_int(const struct uya_tagged_IntOrFloat * self) {
+    bool _uya_ret = ({ const struct uya_tagged_IntOrFloat _uya_m = (*self); bool _uya_r; switch (_uya_m._tag) { case 0: _uya_r = true; break; case 1: _uya_r = false; break; } _uya_r; });
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+struct uya_tagged_IntOrFloat vi = ((struct uya_tagged_IntOrFloat){ ._tag = 0, .u = (union IntOrFloat){ .i = (42) } });
+struct uya_tagged_IntOrFloat vf = ((struct uya_tagged_IntOrFloat){ ._tag = 1, .u = (union IntOrFloat){ .f = (3.1400000000000001) } });
+const double as_float = uya_IntOrFloat_as_f64(&(vi));
+if (((as_float < 41.899999999999999) || (as_float > 42.100000000000001))) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+const bool is_int_val = uya_IntOrFloat_is_int(&(vi));
+if ((!is_int_val)) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+const double as_float2 = uya_IntOrFloat_as_f64(&(vf));
+if (((as_float2 < 3.1299999999999999) || (as_float2 > 3.1499999999999999))) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+const bool is_int2 = uya_IntOrFloat_is_int(&(vf));
+if (is_int2) {
+    int32_t _uya_ret = 4;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
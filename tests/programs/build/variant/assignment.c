@@ -0,0 +1,161 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint32_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+// 安全检查辅助函数（--safety-checks）
+static void uya_safety_fail(const char *msg, const char *loc) __attribute__((noreturn, cold, noinline));
+static void uya_safety_fail(const char *msg, const char *loc) {
+#ifdef __x86_64__
+    const char *parts[4] = { loc, ": ", msg, "\n" };
+    for (int i = 0; i < 4; i++) {
+        long n = 0;
+        while (parts[i][n]) n++;
+        uya_syscall3(1, 2, (long)parts[i], n);
+    }
+#else
+    (void)msg; (void)loc;
+#endif
+    __builtin_trap();
+}
+
+static inline size_t uya_bounds_check(size_t i, size_t len, const char *loc) {
+    if (__builtin_expect(i >= len, 0)) uya_safety_fail("下标越界", loc);
+    return i;
+}
+
+// 循环 first..end（inclusive 为 0 时不含 end）中访问的下标为 i + lo_off .. i + hi_off
+static inline void uya_bounds_hoist(int64_t first, int64_t end, int inclusive, int64_t lo_off, int64_t hi_off, size_t len, const char *loc) {
+    if (inclusive ? end < first : end <= first) return;
+    uint64_t last = (uint64_t)end - (inclusive ? 0 : 1);
+    if (first < -lo_off || last + (uint64_t)hi_off >= (uint64_t)len) uya_safety_fail("下标越界", loc);
+}
+
+// 无符号归纳变量：first 与 end 按 uint64_t 比较，下标计算不回绕
+static inline void uya_bounds_hoist_u(uint64_t first, uint64_t end, int inclusive, int64_t lo_off, int64_t hi_off, size_t len, const char *loc) {
+    if (inclusive ? end < first : end <= first) return;
+    uint64_t last = end - (inclusive ? 0 : 1);
+    if ((lo_off < 0 && first < (uint64_t)-lo_off) ||
+        (hi_off >= 0 ? last >= (uint64_t)len || (uint64_t)hi_off >= (uint64_t)len - last
+                     : last - (uint64_t)-hi_off >= (uint64_t)len)) uya_safety_fail("下标越界", loc);
+}
+
+int32_t uya_main(void);
+
+int32_t uya_main(void) {
+int32_t x = 10;
+x = 20;
+x = (x + 5);
+if ((x == 25)) {
+    int32_t _uya_ret = 0;
+    return _uya_ret;
+}
+int32_t _uya_ret = 1;
+return _uya_ret;
+}
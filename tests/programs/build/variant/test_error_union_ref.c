@@ -0,0 +1,241 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint16_t error_id; int64_t value; };
+
+
+/* 错误码表：error.<name> 的 error_id = 4096 + 下标（小于 4096 的 error_id 为 errno） */
+static const char *const uya_error_names[2] __attribute__((unused)) = {
+    "Empty",  /* 4096 */
+    "NotFound",  /* 4097 */
+};
+
+struct TypeInfo;
+struct Slot;
+struct Table;
+
+
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+struct Slot {
+    int32_t key;
+    int64_t val;
+};
+
+struct Table {
+    struct Slot slots[4];
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+struct err_union_nz_structSlot { union { uintptr_t error_id; struct Slot * value; }; };
+struct err_union_nz_structSlot find(struct Table * t, int32_t key);
+struct err_union_int64_t find_val(struct Table * t, int32_t key);
+struct err_union_nz_structSlot first(struct Table * t);
+struct err_union_nz_structSlot pick(struct Table * t, int32_t a, int32_t b);
+int32_t uya_main(void);
+
+struct err_union_nz_structSlot find(struct Table * t, int32_t key) {
+    int32_t i = 0;
+    while ((i < 4)) {
+        if ((t->slots[i].key == key)) {
+            struct err_union_nz_structSlot _uya_ret = (struct err_union_nz_structSlot){ .value = (&t->slots[i]) };
+            return _uya_ret;
+        }
+        i = (i + 1);
+    }
+    return (struct err_union_nz_structSlot){ .error_id = 4097U };
+}
+
+struct err_union_int64_t find_val(struct Table * t, int32_t key) {
+    struct Slot * const s = ({ struct Slot * _uya_catch_result; struct err_union_nz_structSlot _uya_catch_tmp = find(t, key); if (_uya_catch_tmp.error_id - 1 < 65535U) {
+        struct err_union_nz_structSlot e = _uya_catch_tmp;
+        return (struct err_union_int64_t){ .error_id = 4097U };
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    struct err_union_int64_t _uya_ret = (struct err_union_int64_t){ .error_id = 0, .value = s->val };
+    return _uya_ret;
+}
+
+struct err_union_nz_structSlot first(struct Table * t) {
+    struct Slot * const s = ({ struct err_union_nz_structSlot _uya_try_tmp = find(t, 1); if (_uya_try_tmp.error_id - 1 < 65535U) return (struct err_union_nz_structSlot){ .error_id = _uya_try_tmp.error_id }; _uya_try_tmp.value; });
+    struct err_union_nz_structSlot _uya_ret = (struct err_union_nz_structSlot){ .value = s };
+    return _uya_ret;
+}
+
+struct err_union_nz_structSlot pick(struct Table * t, int32_t a, int32_t b) {
+    struct Slot * const x = ({ struct Slot * _uya_catch_result; struct err_union_nz_structSlot _uya_catch_tmp = find(t, a); if (_uya_catch_tmp.error_id - 1 < 65535U) {
+        struct err_union_nz_structSlot e = _uya_catch_tmp;
+        return (struct err_union_nz_structSlot){ .error_id = 4096U };
+    } else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+    if ((x->val > 15)) {
+        struct err_union_nz_structSlot _uya_ret = (struct err_union_nz_structSlot){ .value = x };
+        return _uya_ret;
+    }
+    struct err_union_nz_structSlot _uya_ret = (struct err_union_nz_structSlot){ .value = ({ struct err_union_nz_structSlot _uya_try_tmp = find(t, b); if (_uya_try_tmp.error_id - 1 < 65535U) return (struct err_union_nz_structSlot){ .error_id = _uya_try_tmp.error_id }; _uya_try_tmp.value; }) };
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+struct Table t = (struct Table){.slots = {(struct Slot){.key = 1, .val = 10}, (struct Slot){.key = 2, .val = 20}, (struct Slot){.key = 3, .val = 30}, (struct Slot){.key = 4, .val = 40}}};
+const int64_t v = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = find_val((&t), 3); if (_uya_catch_tmp.error_id != 0) {
+    struct err_union_int64_t e = _uya_catch_tmp;
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+if ((v != 30)) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+const int64_t none = (-1);
+int32_t nf = 0;
+const int64_t w = ({ int64_t _uya_catch_result; struct err_union_int64_t _uya_catch_tmp = find_val((&t), 9); if (_uya_catch_tmp.error_id != 0) {
+    struct err_union_int64_t e = _uya_catch_tmp;
+    if ((e.error_id == 4097U)) {
+        nf = 1;
+    }
+    _uya_catch_result = (none);
+} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+if (((w != (-1)) || (nf != 1))) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+struct Slot * const p = ({ struct Slot * _uya_catch_result; struct err_union_nz_structSlot _uya_catch_tmp = first((&t)); if (_uya_catch_tmp.error_id - 1 < 65535U) {
+    struct err_union_nz_structSlot e = _uya_catch_tmp;
+    int32_t _uya_ret = 4;
+    return _uya_ret;
+} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+if ((p->val != 10)) {
+    int32_t _uya_ret = 5;
+    return _uya_ret;
+}
+struct Slot * const q = ({ struct Slot * _uya_catch_result; struct err_union_nz_structSlot _uya_catch_tmp = pick((&t), 2, 3); if (_uya_catch_tmp.error_id - 1 < 65535U) {
+    struct err_union_nz_structSlot e = _uya_catch_tmp;
+    int32_t _uya_ret = 6;
+    return _uya_ret;
+} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+if ((q->key != 2)) {
+    int32_t _uya_ret = 7;
+    return _uya_ret;
+}
+struct Slot * const r = ({ struct Slot * _uya_catch_result; struct err_union_nz_structSlot _uya_catch_tmp = pick((&t), 1, 4); if (_uya_catch_tmp.error_id - 1 < 65535U) {
+    struct err_union_nz_structSlot e = _uya_catch_tmp;
+    int32_t _uya_ret = 8;
+    return _uya_ret;
+} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+if ((r->key != 4)) {
+    int32_t _uya_ret = 9;
+    return _uya_ret;
+}
+int32_t empty = 0;
+struct Slot * const z = ({ struct Slot * _uya_catch_result; struct err_union_nz_structSlot _uya_catch_tmp = pick((&t), 7, 4); if (_uya_catch_tmp.error_id - 1 < 65535U) {
+    struct err_union_nz_structSlot e = _uya_catch_tmp;
+    if ((e.error_id == 4096U)) {
+        empty = 1;
+    }
+    _uya_catch_result = (p);
+} else _uya_catch_result = _uya_catch_tmp.value; _uya_catch_result; });
+if (((empty != 1) || (z->key != 1))) {
+    int32_t _uya_ret = 10;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
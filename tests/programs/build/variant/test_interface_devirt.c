@@ -0,0 +1,224 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint16_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+struct Square;
+struct Rect;
+
+
+struct uya_interface_IShape { void *vtable; void *data; };
+struct uya_vtable_IShape {
+    int32_t (*area)(void *self);
+    int32_t (*scale)(void *self, int32_t);
+};
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+struct Square {
+    int32_t side;
+};
+
+struct Rect {
+    int32_t w;
+    int32_t h;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+int32_t uya_Square_area(const struct Square * self);
+int32_t uya_Square_scale(const struct Square * self, int32_t k);
+int32_t uya_Rect_area(const struct Rect * self);
+int32_t uya_Rect_scale(const struct Rect * self, int32_t k);
+int32_t square_area(struct uya_interface_IShape s);
+int32_t square_twice(struct uya_interface_IShape s);
+int32_t any_area(struct uya_interface_IShape s);
+int32_t pair_area(struct uya_interface_IShape a, struct uya_interface_IShape b);
+int32_t uya_main(void);
+static const struct uya_vtable_IShape uya_vtable_IShape_Square = { (int32_t (*)(void *self))&uya_Square_area, (int32_t (*)(void *self, int32_t))&uya_Square_scale };
+static const struct uya_vtable_IShape uya_vtable_IShape_Rect = { (int32_t (*)(void *self))&uya_Rect_area, (int32_t (*)(void *self, int32_t))&uya_Rect_scale };
+
+int32_t uya_Square_area(const struct Square * self) {
+    int32_t _uya_ret = (self->side * self->side);
+    return _uya_ret;
+}
+
+int32_t uya_Square_scale(const struct Square * self, int32_t k) {
+    int32_t _uya_ret = (((self->side * self->side) * k) * k);
+    return _uya_ret;
+}
+
+int32_t uya_Rect_area(const struct Rect * self) {
+    int32_t _uya_ret = (self->w * self->h);
+    return _uya_ret;
+}
+
+int32_t uya_Rect_scale(const struct Rect * self, int32_t k) {
+    int32_t _uya_ret = (((self->w * self->h) * k) * k);
+    return _uya_ret;
+}
+
+int32_t square_area(struct uya_interface_IShape s) {
+    int32_t _uya_ret = uya_Square_area((struct Square *)(s).data);
+    return _uya_ret;
+}
+
+int32_t square_twice(struct uya_interface_IShape s) {
+    int32_t _uya_ret = (square_area(s) + uya_Square_scale((struct Square *)(s).data, 2));
+    return _uya_ret;
+}
+
+int32_t any_area(struct uya_interface_IShape s) {
+    int32_t _uya_ret = ((struct uya_vtable_IShape *)(s).vtable)->area((s).data);
+    return _uya_ret;
+}
+
+int32_t pair_area(struct uya_interface_IShape a, struct uya_interface_IShape b) {
+    int32_t _uya_ret = (uya_Rect_area((struct Rect *)(a).data) + ((struct uya_vtable_IShape *)(b).vtable)->area((b).data));
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+struct Square sq = (struct Square){.side = 3};
+struct Rect r = (struct Rect){.w = 2, .h = 5};
+if ((square_area((struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Square, .data = (void*)&(sq) }) != 9)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+if ((square_area((struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Square, .data = (void*)&((struct Square){.side = 4}) }) != 16)) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+if ((square_twice((struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Square, .data = (void*)&(sq) }) != 45)) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+if ((any_area((struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Square, .data = (void*)&(sq) }) != 9)) {
+    int32_t _uya_ret = 4;
+    return _uya_ret;
+}
+if ((any_area((struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Rect, .data = (void*)&(r) }) != 10)) {
+    int32_t _uya_ret = 5;
+    return _uya_ret;
+}
+if ((pair_area((struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Rect, .data = (void*)&(r) }, (struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Square, .data = (void*)&(sq) }) != 19)) {
+    int32_t _uya_ret = 6;
+    return _uya_ret;
+}
+if ((pair_area((struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Rect, .data = (void*)&((struct Rect){.w = 1, .h = 1}) }, (struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Rect, .data = (void*)&(r) }) != 11)) {
+    int32_t _uya_ret = 7;
+    return _uya_ret;
+}
+int32_t total = 0;
+int32_t i = 1;
+while ((i <= 3)) {
+    struct Square s = (struct Square){.side = i};
+    total = (total + square_area((struct uya_interface_IShape){ .vtable = (void*)&uya_vtable_IShape_Square, .data = (void*)&(s) }));
+    i = (i + 1);
+}
+if ((total != 14)) {
+    int32_t _uya_ret = 8;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
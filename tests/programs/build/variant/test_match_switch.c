@@ -0,0 +1,296 @@
+// C99 代码由 Uya Mini 编译器生成
+// 使用 -std=c99 编译
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// C99 兼容的 alignof 实现
+#define uya_alignof(type) offsetof(struct { char c; type t; }, t)
+
+static inline void *__uya_memcpy(void *dest, const void *src, size_t n) {
+    char *d = (char *)dest; const char *s = (const char *)src;
+    for (size_t i = 0; i < n; i++) d[i] = s[i]; return dest;
+}
+static inline int __uya_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = (const unsigned char *)s1, *b = (const unsigned char *)s2;
+    for (size_t i = 0; i < n; i++) { if (a[i] != b[i]) return a[i] - b[i]; } return 0;
+}
+
+// 错误联合类型（用于 !i64 等）
+struct err_union_int64_t { uint16_t error_id; int64_t value; };
+
+
+struct TypeInfo;
+
+enum Op {
+    Nop = 0,
+    Load,
+    Store,
+    Add,
+    Sub,
+    Halt
+};
+
+
+
+union Token {
+    int32_t num;
+    enum Op op;
+    int32_t eof;
+};
+struct uya_tagged_Token { int _tag; union Token u; };
+
+// 内置 TypeInfo 结构体（由 @mc_type 使用）
+struct TypeInfo {
+    int8_t * name;
+    int32_t size;
+    int32_t align;
+    int32_t kind;
+    bool is_integer;
+    bool is_float;
+    bool is_bool;
+    bool is_pointer;
+    bool is_array;
+    bool is_void;
+};
+
+// 系统调用辅助函数（Linux x86-64）
+#ifdef __x86_64__
+static inline long uya_syscall0(long nr) {
+    register long rax __asm__("rax") = nr;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall1(long nr, long a1) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall2(long nr, long a1, long a2) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall3(long nr, long a1, long a2, long a3) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall4(long nr, long a1, long a2, long a3, long a4) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall5(long nr, long a1, long a2, long a3, long a4, long a5) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8) : "rcx", "r11", "memory");
+    return rax;
+}
+
+static inline long uya_syscall6(long nr, long a1, long a2, long a3, long a4, long a5, long a6) {
+    register long rax __asm__("rax") = nr;
+    register long rdi __asm__("rdi") = a1;
+    register long rsi __asm__("rsi") = a2;
+    register long rdx __asm__("rdx") = a3;
+    register long r10 __asm__("r10") = a4;
+    register long r8 __asm__("r8") = a5;
+    register long r9 __asm__("r9") = a6;
+    __asm__ volatile("syscall" : "=r"(rax) : "r"(rax), "r"(rdi), "r"(rsi), "r"(rdx), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return rax;
+}
+#else
+#error "@syscall currently only supports Linux x86-64"
+#endif
+
+int32_t classify(int32_t c);
+int32_t first_wins(int32_t c);
+int32_t cost(enum Op op);
+int32_t token_value(struct uya_tagged_Token t);
+int32_t uya_main(void);
+
+int32_t classify(int32_t c) {
+    int32_t _uya_ret = ({ int32_t _uya_m = c; int32_t _uya_r; switch (_uya_m) { case 0: _uya_r = 0; break; case 1 ... 3: _uya_r = 1; break; case 4 ... 5: _uya_r = 2; break; case 9: _uya_r = 3; break; default: { _uya_r = 4; } break; } _uya_r; });
+    return _uya_ret;
+}
+
+int32_t first_wins(int32_t c) {
+    int32_t _uya_ret = ({ int32_t _uya_m = c; int32_t _uya_r; switch (_uya_m) { case 1: _uya_r = 10; break; case 2: _uya_r = 20; break; default: { _uya_r = 0; } break; } _uya_r; });
+    return _uya_ret;
+}
+
+int32_t cost(enum Op op) {
+    int32_t _uya_ret = ({ enum Op _uya_m = op; int32_t _uya_r; switch (_uya_m) { case 0: _uya_r = 0; break; case 1 ... 2: _uya_r = 3; break; case 3 ... 4: _uya_r = 1; break; default: { _uya_r = 100; } break; } _uya_r; });
+    return _uya_ret;
+}
+
+int32_t token_value(struct uya_tagged_Token t) {
+    int32_t _uya_ret = ({ struct uya_tagged_Token _uya_m = t; int32_t _uya_r; switch (_uya_m._tag) { case 0: { int32_t n = _uya_m.u.num; _uya_r = n; } break; case 1: { enum Op o = _uya_m.u.op; _uya_r = cost(o); } break; case 2: _uya_r = (-1); break; } _uya_r; });
+    return _uya_ret;
+}
+
+int32_t uya_main(void) {
+if ((classify(0) != 0)) {
+    int32_t _uya_ret = 1;
+    return _uya_ret;
+}
+if ((classify(2) != 1)) {
+    int32_t _uya_ret = 2;
+    return _uya_ret;
+}
+if ((classify(3) != 1)) {
+    int32_t _uya_ret = 3;
+    return _uya_ret;
+}
+if ((classify(5) != 2)) {
+    int32_t _uya_ret = 4;
+    return _uya_ret;
+}
+if ((classify(9) != 3)) {
+    int32_t _uya_ret = 5;
+    return _uya_ret;
+}
+if ((classify(7) != 4)) {
+    int32_t _uya_ret = 6;
+    return _uya_ret;
+}
+if ((first_wins(1) != 10)) {
+    int32_t _uya_ret = 7;
+    return _uya_ret;
+}
+if ((first_wins(2) != 20)) {
+    int32_t _uya_ret = 8;
+    return _uya_ret;
+}
+if ((first_wins(3) != 0)) {
+    int32_t _uya_ret = 9;
+    return _uya_ret;
+}
+if ((cost(Store) != 3)) {
+    int32_t _uya_ret = 10;
+    return _uya_ret;
+}
+if ((cost(Halt) != 100)) {
+    int32_t _uya_ret = 11;
+    return _uya_ret;
+}
+if ((token_value(((struct uya_tagged_Token){ ._tag = 0, .u = (union Token){ .num = (7) } })) != 7)) {
+    int32_t _uya_ret = 12;
+    return _uya_ret;
+}
+if ((token_value(((struct uya_tagged_Token){ ._tag = 1, .u = (union Token){ .op = (Load) } })) != 3)) {
+    int32_t _uya_ret = 13;
+    return _uya_ret;
+}
+if ((token_value(((struct uya_tagged_Token){ ._tag = 2, .u = (union Token){ .eof = (0) } })) != (-1))) {
+    int32_t _uya_ret = 14;
+    return _uya_ret;
+}
+int32_t sum = 0;
+int32_t i = 0;
+while ((i < 10)) {
+    const int32_t k = i;
+    i = (i + 1);
+    {
+        int32_t _uya_m = k;
+        switch (_uya_m) {
+            case 1: {
+                continue;
+            }
+            break;
+            case 3: {
+                continue;
+            }
+            break;
+            case 5: {
+                sum = (sum + 100);
+            }
+            break;
+            default: {
+                sum = (sum + k);
+            }
+            break;
+        }
+    }
+}
+if ((sum != 136)) {
+    int32_t _uya_ret = 15;
+    return _uya_ret;
+}
+int32_t steps = 0;
+int32_t pc = 0;
+const int32_t program[6] = {1, 2, 3, 5, 1, 2};
+while ((pc < 6)) {
+    const int32_t op = program[pc];
+    pc = (pc + 1);
+    {
+        int32_t _uya_m = op;
+        if (_uya_m == 5) {
+            break;
+        }
+        else if (_uya_m == 1) {
+            steps = (steps + 1);
+        }
+        else {
+            steps = (steps + 10);
+        }
+    }
+}
+if ((steps != 21)) {
+    int32_t _uya_ret = 16;
+    return _uya_ret;
+}
+if ((pc != 4)) {
+    int32_t _uya_ret = 17;
+    return _uya_ret;
+}
+int32_t inner = 0;
+{
+    int32_t _uya_m = steps;
+    switch (_uya_m) {
+        case 21: {
+            int32_t j = 0;
+            while ((j < 100)) {
+                if ((j == 5)) {
+                    break;
+                }
+                j = (j + 1);
+            }
+            inner = j;
+        }
+        break;
+        default: {
+            inner = (-1);
+        }
+        break;
+    }
+}
+if ((inner != 5)) {
+    int32_t _uya_ret = 18;
+    return _uya_ret;
+}
+int32_t _uya_ret = 0;
+return _uya_ret;
+}
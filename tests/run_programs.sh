@@ -13,6 +13,13 @@
 #   ./tests/run_programs.sh --uya -e test_global_var.uya
 #   ./tests/run_programs.sh --uya tests/programs/test_global_var.uya
 #   仅传文件名时会在 tests/programs/ 下查找，例如 test_global_var.uya
+#
+# 对比构建（C 版本编译器）:
+#   ./tests/run_programs.sh -e --error-abi=compact
+#   使用错误联合的程序另外以 --error-abi=compact 编译运行，退出码必须与默认布局相同
+#   ./tests/run_programs.sh -e --safety-checks
+#   所有程序另外以 --safety-checks 编译运行，退出码必须与默认构建相同；
+#   programs/safety_traps/ 下的程序必须在运行时检查处终止（见 process_trap_test）
 
 # 获取脚本所在目录的绝对路径，然后推导各路径
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
@@ -26,6 +33,13 @@ FAILED=0
 ERRORS_ONLY=false
 USE_C99=true
 USE_UYA=false
+# 对比构建：额外的编译选项（空表示不做对比构建）与参与对比的程序筛选（grep -E 模式，空表示全部）
+VARIANT_FLAGS=()
+VARIANT_FILTER=""
+# 运行时检查必然失败的程序（只在 --safety-checks 时运行）及其预期退出码（__builtin_trap 产生 SIGILL）
+TRAP_DIR="$TEST_DIR/safety_traps"
+TRAP_EXIT=132
+RUN_TRAPS=false
 
 # 设置 UYA_ROOT 指向标准库目录（lib/）
 export UYA_ROOT="${REPO_ROOT}/lib/"
@@ -39,6 +53,9 @@ show_usage() {
     echo "  -e, --errors-only   只显示失败的测试"
     echo "  --c99               使用 C99 后端（默认，保留以兼容旧脚本）"
     echo "  --uya               使用 src 编译的编译器（默认使用 C 版本编译器）"
+    echo "  --error-abi=compact 使用错误联合的程序另外以紧凑错误布局编译运行，结果须与默认布局相同"
+    echo "  --safety-checks     所有程序另外以运行时安全检查编译运行，结果须与默认构建相同；"
+    echo "                      并运行 programs/safety_traps/ 下必须在检查处终止的程序"
     echo ""
     echo "参数:"
     echo "  无参数              运行所有测试"
@@ -89,6 +106,18 @@ while [ $# -gt 0 ]; do
             USE_UYA=true
             shift
             ;;
+        --error-abi=compact)
+            VARIANT_FLAGS=(--error-abi=compact)
+            # 声明或传播错误联合：try、catch、error.X、返回/声明类型 !T
+            VARIANT_FILTER='(^|[^A-Za-z_])(try|catch)([^A-Za-z_]|$)|error\.[A-Za-z_]|\)[[:space:]]*!|:[[:space:]]*!'
+            shift
+            ;;
+        --safety-checks)
+            VARIANT_FLAGS=(--safety-checks)
+            VARIANT_FILTER=""
+            RUN_TRAPS=true
+            shift
+            ;;
         -*)
             echo "错误: 未知选项 '$1'"
             echo "使用 '$0 --help' 查看帮助信息"
@@ -107,6 +136,10 @@ if [ "$USE_UYA" = true ]; then
     # 自举编译器总是使用 C99 后端
     USE_C99=true
     COMPILER="$REPO_ROOT/bin/uya"
+    if [ ${#VARIANT_FLAGS[@]} -gt 0 ]; then
+        echo "错误: ${VARIANT_FLAGS[*]} 只支持 C 版本编译器"
+        exit 1
+    fi
 fi
 
 # 检查编译器是否存在
@@ -132,9 +165,16 @@ if [ "$ERRORS_ONLY" = false ]; then
     if [ -n "$TARGET_PATH" ]; then
         echo "目标: $TARGET_PATH"
     fi
+    if [ ${#VARIANT_FLAGS[@]} -gt 0 ]; then
+        echo "对比构建: ${VARIANT_FLAGS[*]}"
+    fi
     echo ""
 fi
 
+if [ ${#VARIANT_FLAGS[@]} -gt 0 ]; then
+    mkdir -p "$BUILD_DIR/variant"
+fi
+
 # 处理多文件编译测试的函数
 process_multifile_test() {
     local test_dir="$1"
@@ -373,6 +413,147 @@ _collect_module_files_recursive() {
     done <<< "$use_modules"
 }
 
+# 链接单个测试程序：编译生成的 .c 文件，按测试名链接所需的外部函数实现与 bridge.c
+# 参数：测试名、生成的 .c 文件、可执行文件路径；成功返回 0
+link_test_program() {
+    local base_name="$1"
+    local output_file="$2"
+    local exe_file="$3"
+    local -a extra_srcs=()
+    if [ "$base_name" = "extern_function" ]; then
+        # 外部函数实现
+        extra_srcs+=("$SCRIPT_DIR/programs/extern_function_impl.c")
+    elif [ "$base_name" = "test_comprehensive_cast" ] || [ "$base_name" = "test_ffi_cast" ] || [ "$base_name" = "test_pointer_cast" ] || [ "$base_name" = "test_simple_cast" ] || [ "$base_name" = "test_extern_union" ]; then
+        # 通用外部函数实现
+        extra_srcs+=("$SCRIPT_DIR/external_functions.c")
+    elif [ "$base_name" = "test_abi_calling_convention" ]; then
+        # ABI 辅助函数
+        extra_srcs+=("$SCRIPT_DIR/programs/test_abi_helpers.c")
+    fi
+    # bridge.c 提供运行时支持
+    local bridge_c="$SCRIPT_DIR/bridge.c"
+    if [ -f "$bridge_c" ]; then
+        extra_srcs+=("$bridge_c")
+    fi
+    gcc -std=c99 -fno-builtin -o "$exe_file" "$output_file" "${extra_srcs[@]}"
+}
+
+# 对比构建：以 VARIANT_FLAGS 重新编译并运行，退出码必须与默认构建相同
+# 参数：测试名、默认构建的退出码、参与编译的文件列表
+process_variant_test() {
+    local base_name="$1"
+    local expected_exit="$2"
+    shift 2
+    local label="$base_name [${VARIANT_FLAGS[*]}]"
+    local output_file="$BUILD_DIR/variant/${base_name}.c"
+    local exe_file="$BUILD_DIR/variant/${base_name}"
+    
+    if [ "$ERRORS_ONLY" = false ]; then
+        echo "测试: $label"
+    fi
+    local variant_output
+    variant_output=$("$COMPILER" --c99 "${VARIANT_FLAGS[@]}" "$@" -o "$output_file" 2>&1)
+    local variant_exit=$?
+    local failure=""
+    if [ $variant_exit -ne 0 ]; then
+        echo "$variant_output" | grep -v "^调试:" | grep -E "(错误|错误:|失败)" | head -5 || true
+        failure="编译失败（退出码: $variant_exit）"
+    elif ! link_test_program "$base_name" "$output_file" "$exe_file"; then
+        failure="链接失败"
+    else
+        if [ "$ERRORS_ONLY" = true ]; then
+            "$exe_file" > /dev/null 2>&1
+        else
+            "$exe_file"
+        fi
+        local exit_code=$?
+        if [ $exit_code -ne $expected_exit ]; then
+            failure="结果与默认构建不同（退出码: $exit_code，默认构建: $expected_exit）"
+        fi
+    fi
+    
+    if [ -z "$failure" ]; then
+        if [ "$ERRORS_ONLY" = false ]; then
+            echo "  ✓ 测试通过（与默认构建相同）"
+        fi
+        PASSED=$((PASSED + 1))
+    else
+        if [ "$ERRORS_ONLY" = true ]; then
+            echo "测试: $label"
+        fi
+        echo "  ❌ $failure"
+        FAILED=$((FAILED + 1))
+        if [ "$ERRORS_ONLY" = true ]; then
+            echo ""
+        fi
+    fi
+}
+
+# 运行时检查必然失败的程序：以 VARIANT_FLAGS 编译，运行时必须以 TRAP_EXIT 终止，
+# 且标准错误包含文件中 "// 期望检查失败：<消息>" 注释给出的消息
+process_trap_test() {
+    local uya_file="$1"
+    local base_name=$(basename "$uya_file" .uya)
+    local label="$base_name [${VARIANT_FLAGS[*]}]"
+    local output_file="$BUILD_DIR/variant/${base_name}.c"
+    local exe_file="$BUILD_DIR/variant/${base_name}"
+    local expected_msg
+    expected_msg=$(sed -n 's|^// 期望检查失败：||p' "$uya_file" | head -1)
+    
+    if [ "$ERRORS_ONLY" = false ]; then
+        echo "测试: $label"
+    fi
+    local trap_output
+    trap_output=$("$COMPILER" --c99 "${VARIANT_FLAGS[@]}" "$uya_file" -o "$output_file" 2>&1)
+    local trap_exit=$?
+    local failure=""
+    if [ $trap_exit -ne 0 ]; then
+        echo "$trap_output" | grep -v "^调试:" | grep -E "(错误|错误:|失败)" | head -5 || true
+        failure="编译失败（退出码: $trap_exit）"
+    elif [ -z "$expected_msg" ]; then
+        failure="缺少 \"// 期望检查失败：<消息>\" 注释"
+    elif ! link_test_program "$base_name" "$output_file" "$exe_file"; then
+        failure="链接失败"
+    else
+        local stderr_output
+        stderr_output=$("$exe_file" 2>&1 >/dev/null)
+        local exit_code=$?
+        if [ $exit_code -ne $TRAP_EXIT ]; then
+            failure="未在运行时检查处终止（退出码: $exit_code，预期: $TRAP_EXIT）"
+        elif [[ "$stderr_output" != *"$expected_msg"* ]]; then
+            failure="检查失败消息不符（输出: ${stderr_output:-无}，预期包含: $expected_msg）"
+        fi
+    fi
+    
+    if [ -z "$failure" ]; then
+        if [ "$ERRORS_ONLY" = false ]; then
+            echo "  ✓ 测试通过（检查失败: $expected_msg）"
+        fi
+        PASSED=$((PASSED + 1))
+    else
+        if [ "$ERRORS_ONLY" = true ]; then
+            echo "测试: $label"
+        fi
+        echo "  ❌ $failure"
+        FAILED=$((FAILED + 1))
+        if [ "$ERRORS_ONLY" = true ]; then
+            echo ""
+        fi
+    fi
+}
+
+process_trap_dir() {
+    local dir="$1"
+    if [ "$RUN_TRAPS" = false ]; then
+        return
+    fi
+    for uya_file in "$dir"/*.uya; do
+        if [ -f "$uya_file" ]; then
+            process_trap_test "$uya_file"
+        fi
+    done
+}
+
 # 处理单个测试文件的函数
 process_single_test() {
     local uya_file="$1"
@@ -453,52 +634,9 @@ process_single_test() {
     
     # 链接：编译 .c 文件为可执行文件（对于需要外部函数的测试，需链接实现）
     link_succeeded=false
-    BRIDGE_C="$SCRIPT_DIR/bridge.c"
-    if [ "$base_name" = "extern_function" ]; then
-            # 编译主程序和外部函数实现（需要链接 bridge.c）
-            if [ -f "$BRIDGE_C" ]; then
-                if gcc -std=c99 -fno-builtin -o "$BUILD_DIR/$base_name" "$output_file" tests/programs/extern_function_impl.c "$BRIDGE_C"; then
-                    link_succeeded=true
-                fi
-            else
-                if gcc -std=c99 -fno-builtin -o "$BUILD_DIR/$base_name" "$output_file" tests/programs/extern_function_impl.c; then
-                    link_succeeded=true
-                fi
-            fi
-    elif [ "$base_name" = "test_comprehensive_cast" ] || [ "$base_name" = "test_ffi_cast" ] || [ "$base_name" = "test_pointer_cast" ] || [ "$base_name" = "test_simple_cast" ] || [ "$base_name" = "test_extern_union" ]; then
-            # 编译主程序和通用外部函数实现（需要链接 bridge.c）
-            if [ -f "$BRIDGE_C" ]; then
-                if gcc -std=c99 -fno-builtin -o "$BUILD_DIR/$base_name" "$output_file" tests/external_functions.c "$BRIDGE_C"; then
-                    link_succeeded=true
-                fi
-            else
-                if gcc -std=c99 -fno-builtin -o "$BUILD_DIR/$base_name" "$output_file" tests/external_functions.c; then
-                    link_succeeded=true
-                fi
-            fi
-    elif [ "$base_name" = "test_abi_calling_convention" ]; then
-            # 编译主程序和 ABI 辅助函数（需要链接 bridge.c）
-            if [ -f "$BRIDGE_C" ]; then
-                if gcc -std=c99 -fno-builtin -o "$BUILD_DIR/$base_name" "$output_file" tests/programs/test_abi_helpers.c "$BRIDGE_C"; then
-                    link_succeeded=true
-                fi
-            else
-                if gcc -std=c99 -fno-builtin -o "$BUILD_DIR/$base_name" "$output_file" tests/programs/test_abi_helpers.c; then
-                    link_succeeded=true
-                fi
-            fi
-    else
-            # 普通 C99 编译（需要链接 bridge.c 提供运行时支持）
-            if [ -f "$BRIDGE_C" ]; then
-                if gcc -std=c99 -fno-builtin -o "$BUILD_DIR/$base_name" "$output_file" "$BRIDGE_C"; then
-                    link_succeeded=true
-                fi
-            else
-                if gcc -std=c99 -fno-builtin -o "$BUILD_DIR/$base_name" "$output_file"; then
-                    link_succeeded=true
-                fi
-            fi
-        fi
+    if link_test_program "$base_name" "$output_file" "$BUILD_DIR/$base_name"; then
+        link_succeeded=true
+    fi
     
     if [ "$link_succeeded" = false ]; then
         if [ "$ERRORS_ONLY" = true ]; then
@@ -535,6 +673,13 @@ process_single_test() {
             echo ""
         fi
     fi
+    
+    # 对比构建（只对筛选出的程序）
+    if [ ${#VARIANT_FLAGS[@]} -gt 0 ]; then
+        if [ -z "$VARIANT_FILTER" ] || grep -qE "$VARIANT_FILTER" "${file_list[@]}" 2>/dev/null; then
+            process_variant_test "$base_name" "$exit_code" "${file_list[@]}"
+        fi
+    fi
 }
 
 # 处理目录或文件的函数
@@ -544,7 +689,13 @@ process_path() {
     # 如果是文件
     if [ -f "$path" ]; then
         # 检查是否是 .uya 文件
-        if [[ "$path" == *.uya ]]; then
+        if [[ "$path" == *.uya ]] && [ "$(dirname "$path")" = "$TRAP_DIR" ]; then
+            if [ "$RUN_TRAPS" = true ]; then
+                process_trap_test "$path"
+            else
+                echo "警告: 跳过 $path（只在 --safety-checks 时运行）"
+            fi
+        elif [[ "$path" == *.uya ]]; then
             process_single_test "$path"
         else
             echo "警告: 跳过非 .uya 文件: $path"
@@ -563,6 +714,12 @@ process_path() {
             return
         fi
         
+        # 运行时检查必然失败的程序不按普通测试运行
+        if [ "$path" = "$TRAP_DIR" ]; then
+            process_trap_dir "$path"
+            return
+        fi
+        
         # 处理目录下的所有 .uya 文件
         for uya_file in "$path"/*.uya; do
             if [ -f "$uya_file" ]; then
@@ -611,6 +768,8 @@ else
             process_single_test "$uya_file"
         fi
     done
+    
+    process_trap_dir "$TRAP_DIR"
 fi
 
 if [ "$ERRORS_ONLY" = false ] || [ $FAILED -gt 0 ]; then
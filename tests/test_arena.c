@@ -89,20 +89,80 @@ void test_alignment(void) {
     printf("  ✓ 内存对齐测试通过\n");
 }
 
-// 测试分配失败情况（空间不足）
-void test_alloc_failure(void) {
-    printf("测试分配失败情况...\n");
+// 测试空间不足时自动追加新块
+void test_grow(void) {
+    printf("测试自动扩容...\n");
     
     // 使用小缓冲区测试
     uint8_t small_buffer[100];
     Arena arena;
     arena_init(&arena, small_buffer, sizeof(small_buffer));
     
-    // 分配超过缓冲区大小的内存，应该返回 NULL
-    void *p = arena_alloc(&arena, sizeof(small_buffer) + 1);
-    assert(p == NULL);
+    // 分配超过缓冲区大小的内存，应该从新映射的块中分配
+    char *p = (char *)arena_alloc(&arena, sizeof(small_buffer) + 1);
+    assert(p != NULL);
+    assert((uint8_t *)p < small_buffer || (uint8_t *)p >= small_buffer + sizeof(small_buffer));
+    memset(p, 0x5a, sizeof(small_buffer) + 1);
+    assert(arena.chunk_count == 1);
     
-    printf("  ✓ 分配失败测试通过\n");
+    // 超过默认块大小的大分配也能满足
+    char *big = (char *)arena_alloc(&arena, 32 * 1024 * 1024);
+    assert(big != NULL);
+    big[32 * 1024 * 1024 - 1] = 1;
+    assert(arena.chunk_count == 2);
+    
+    // 重置后归还所有映射块
+    arena_reset(&arena);
+    assert(arena.chunk_count == 0);
+    assert(arena.offset == 0);
+    
+    // 无初始缓冲区的 Arena 同样可用
+    Arena empty;
+    arena_init(&empty, NULL, 0);
+    int *q = (int *)arena_alloc(&empty, sizeof(int));
+    assert(q != NULL);
+    *q = 7;
+    arena_reset(&empty);
+    
+    printf("  ✓ 自动扩容测试通过\n");
+}
+
+// 测试回退点与统计
+void test_mark_rewind(void) {
+    printf("测试回退点与统计...\n");
+    
+    uint8_t small_buffer[256];
+    Arena arena;
+    arena_init(&arena, small_buffer, sizeof(small_buffer));
+    
+    int *p1 = (int *)arena_alloc(&arena, sizeof(int));
+    *p1 = 42;
+    ArenaMark mark = arena_mark(&arena);
+    size_t offset_at_mark = arena.offset;
+    
+    // 标记之后的分配跨越多个块
+    for (int i = 0; i < 4; i++) {
+        assert(arena_alloc(&arena, 200) != NULL);
+    }
+    assert(arena.chunk_count > 0);
+    
+    ArenaStats stats;
+    arena_get_stats(&arena, &stats);
+    assert(stats.alloc_count == 5);
+    assert(stats.bytes_used >= 4 * 200);
+    assert(stats.peak_bytes == stats.bytes_used);
+    
+    // 回退后块被归还，标记前的数据保持不变
+    arena_rewind(&arena, mark);
+    assert(arena.chunk_count == 0);
+    assert(arena.offset == offset_at_mark);
+    assert(*p1 == 42);
+    
+    arena_get_stats(&arena, &stats);
+    assert(stats.bytes_used == offset_at_mark);
+    assert(stats.peak_bytes >= 4 * 200);
+    
+    printf("  ✓ 回退点与统计测试通过\n");
 }
 
 // 主测试函数
@@ -112,7 +172,8 @@ int main(void) {
     test_basic_alloc();
     test_reset();
     test_alignment();
-    test_alloc_failure();
+    test_grow();
+    test_mark_rewind();
     
     printf("\n所有测试通过！\n");
     return 0;
@@ -0,0 +1,153 @@
+#define _DEFAULT_SOURCE  // 用于 mkdtemp、setenv
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "../src/arena.h"
+#include "../src/build_cache.h"
+
+// 测试用临时目录（mkdtemp 创建）
+static char test_dir[64];
+
+// 写入文件内容
+static void write_text(const char *path, const char *text) {
+    FILE *f = fopen(path, "w");
+    assert(f != NULL);
+    fputs(text, f);
+    fclose(f);
+}
+
+// 读取文件内容并与期望比较
+static int file_equals(const char *path, const char *expected) {
+    char buf[256];
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        return 0;
+    }
+    size_t n = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+    return strcmp(buf, expected) == 0;
+}
+
+// 测试哈希：相同内容哈希相同，字符串边界参与哈希
+void test_hash(void) {
+    printf("测试哈希...\n");
+
+    uint64_t a = build_cache_hash_str(build_cache_hash_str(BUILD_CACHE_HASH_INIT, "ab"), "c");
+    uint64_t b = build_cache_hash_str(build_cache_hash_str(BUILD_CACHE_HASH_INIT, "a"), "bc");
+    assert(a != b);
+    assert(build_cache_hash_str(BUILD_CACHE_HASH_INIT, NULL) == build_cache_hash_str(BUILD_CACHE_HASH_INIT, ""));
+
+    char path[128];
+    snprintf(path, sizeof(path), "%s/hash.uya", test_dir);
+    write_text(path, "fn main() i32 { return 0; }\n");
+    uint64_t file_hash = 0;
+    size_t size = 0;
+    assert(build_cache_hash_file(path, &file_hash, &size) == 0);
+    assert(size == strlen("fn main() i32 { return 0; }\n"));
+    assert(file_hash == build_cache_hash(BUILD_CACHE_HASH_INIT, "fn main() i32 { return 0; }\n", size));
+    assert(build_cache_hash_file("/nonexistent/file.uya", &file_hash, NULL) != 0);
+
+    printf("  ✓ 哈希测试通过\n");
+}
+
+// 测试保存与命中：文件内容、目录中的模块集合或输出数量变化时不命中
+void test_store_lookup(void) {
+    printf("测试保存与查找...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+
+    char main_path[128], lib_dir[128], lib_path[128], out_path[128], cache_dir[128];
+    snprintf(main_path, sizeof(main_path), "%s/main.uya", test_dir);
+    snprintf(lib_dir, sizeof(lib_dir), "%s/lib", test_dir);
+    snprintf(lib_path, sizeof(lib_path), "%s/lib/util.uya", test_dir);
+    snprintf(out_path, sizeof(out_path), "%s/out.c", test_dir);
+    snprintf(cache_dir, sizeof(cache_dir), "%s/cache/nested", test_dir);
+    assert(mkdir(lib_dir, 0755) == 0);
+    write_text(main_path, "use lib.util;\n");
+    write_text(lib_path, "export fn f() i32 { return 1; }\n");
+    write_text(out_path, "int generated;\n");
+
+    const char *files[] = { main_path, lib_path };
+    const char *outputs[] = { out_path };
+    BuildCache cache;
+    assert(build_cache_init(&cache, cache_dir, 42) == 0);
+
+    // 尚未保存：不命中
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) != 0);
+    assert(build_cache_store(&cache, files, 2, NULL, 0, outputs, 1) == 0);
+
+    // 未变化：命中并恢复输出
+    write_text(out_path, "stale\n");
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) == 0);
+    assert(file_equals(out_path, "int generated;\n"));
+
+    // 输出数量不同：不命中
+    const char *two_outputs[] = { out_path, out_path };
+    assert(build_cache_lookup(&cache, two_outputs, 2, &arena) != 0);
+
+    // 不同编译键：不命中
+    BuildCache other;
+    assert(build_cache_init(&other, cache_dir, 43) == 0);
+    assert(build_cache_lookup(&other, outputs, 1, &arena) != 0);
+
+    // 非模块文件不影响目录签名
+    char note_path[128];
+    snprintf(note_path, sizeof(note_path), "%s/lib/notes.txt", test_dir);
+    write_text(note_path, "x\n");
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) == 0);
+
+    // 同目录新增模块文件（可能改变模块查找结果）：不命中
+    char new_path[128];
+    snprintf(new_path, sizeof(new_path), "%s/lib/extra.uya", test_dir);
+    write_text(new_path, "\n");
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) != 0);
+    unlink(new_path);
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) == 0);
+
+    // 模块内容变化：不命中
+    write_text(lib_path, "export fn f() i32 { return 2; }\n");
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) != 0);
+
+    // 宏读取的环境变量：值变化时不命中，未设置与空串相同
+    const char *env_names[] = { "UYA_CACHE_TEST_ENV" };
+    setenv("UYA_CACHE_TEST_ENV", "", 1);
+    assert(build_cache_store(&cache, files, 2, env_names, 1, outputs, 1) == 0);
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) == 0);
+    unsetenv("UYA_CACHE_TEST_ENV");
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) == 0);
+    setenv("UYA_CACHE_TEST_ENV", "1", 1);
+    assert(build_cache_lookup(&cache, outputs, 1, &arena) != 0);
+    unsetenv("UYA_CACHE_TEST_ENV");
+
+    unlink(note_path);
+    unlink(lib_path);
+    unlink(main_path);
+    unlink(out_path);
+    rmdir(lib_dir);
+    arena_reset(&arena);
+    printf("  ✓ 保存与查找测试通过\n");
+}
+
+int main(void) {
+    printf("开始增量编译缓存测试...\n\n");
+
+    snprintf(test_dir, sizeof(test_dir), "/tmp/uya_cache_test_XXXXXX");
+    assert(mkdtemp(test_dir) != NULL);
+
+    test_hash();
+    test_store_lookup();
+
+    // 清理缓存目录
+    char cmd[128];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", test_dir);
+    assert(system(cmd) == 0);
+
+    printf("\n所有测试通过！\n");
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include "../src/arena.h"
+#include "../src/emitter.h"
+
+// 测试基本追加
+void test_basic_emit(void) {
+    printf("测试基本追加...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    Emitter e;
+    emitter_init(&e, &arena);
+
+    assert(emitter_size(&e) == 0);
+    assert(strcmp(emitter_to_string(&e, &arena), "") == 0);
+
+    emitter_lit(&e, "int ");
+    emitter_puts(&e, "main");
+    emitter_putc(&e, '(');
+    emitter_puts(&e, NULL);
+    emitter_lit(&e, ") { return ");
+    emitter_int(&e, -42);
+    emitter_printf(&e, "; } // %s %u", "x", 7u);
+    assert(strcmp(emitter_to_string(&e, &arena), "int main() { return -42; } // x 7") == 0);
+    assert(emitter_size(&e) == strlen("int main() { return -42; } // x 7"));
+
+    arena_reset(&arena);
+    printf("  ✓ 基本追加测试通过\n");
+}
+
+// 测试整数快速路径的边界值
+void test_integers(void) {
+    printf("测试整数输出...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    Emitter e;
+    emitter_init(&e, &arena);
+
+    emitter_int(&e, 0);
+    emitter_putc(&e, ' ');
+    emitter_int(&e, LLONG_MIN);
+    emitter_putc(&e, ' ');
+    emitter_int(&e, LLONG_MAX);
+    emitter_putc(&e, ' ');
+    emitter_uint(&e, ULLONG_MAX);
+
+    char expected[128];
+    snprintf(expected, sizeof(expected), "0 %lld %lld %llu", LLONG_MIN, LLONG_MAX, ULLONG_MAX);
+    assert(strcmp(emitter_to_string(&e, &arena), expected) == 0);
+
+    arena_reset(&arena);
+    printf("  ✓ 整数输出测试通过\n");
+}
+
+// 测试跨块写入：内容跨越多个缓冲块时顺序与长度不变
+void test_chunk_boundaries(void) {
+    printf("测试跨块写入...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    Emitter e;
+    emitter_init(&e, &arena);
+
+    // 逐字符写满若干块，再写入一段大于块大小的数据与一段长格式化输出
+    size_t small = EMITTER_CHUNK_SIZE * 2 + 17;
+    for (size_t i = 0; i < small; i++) {
+        emitter_putc(&e, (char)('a' + i % 26));
+    }
+    static char big[EMITTER_CHUNK_SIZE * 3];
+    memset(big, 'z', sizeof(big));
+    emitter_write(&e, big, sizeof(big));
+    emitter_printf(&e, "%*d", EMITTER_CHUNK_SIZE + 5, 1);
+
+    size_t total = small + sizeof(big) + EMITTER_CHUNK_SIZE + 5;
+    assert(emitter_size(&e) == total);
+    const char *s = emitter_to_string(&e, &arena);
+    assert(strlen(s) == total);
+    for (size_t i = 0; i < small; i++) {
+        assert(s[i] == (char)('a' + i % 26));
+    }
+    assert(s[small] == 'z' && s[small + sizeof(big) - 1] == 'z');
+    assert(s[total - 1] == '1' && s[total - 2] == ' ');
+
+    // 写入 FILE* 后读回，内容一致
+    FILE *f = tmpfile();
+    assert(f != NULL);
+    assert(emitter_write_file(&e, f) == 0);
+    assert((size_t)ftell(f) == total);
+    fclose(f);
+
+    arena_reset(&arena);
+    printf("  ✓ 跨块写入测试通过\n");
+}
+
+// 测试小初始块：块容量逐块翻倍，内容与追加结果不变
+void test_sized_and_append(void) {
+    printf("测试小初始块与追加...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    Emitter small;
+    emitter_init_sized(&small, &arena, 16);
+    for (int i = 0; i < 1000; i++) {
+        emitter_int(&small, i % 10);
+    }
+    assert(small.head != NULL && small.head->cap == 16);
+    assert(small.tail->cap <= EMITTER_CHUNK_SIZE);
+
+    Emitter all;
+    emitter_init(&all, &arena);
+    emitter_lit(&all, "<");
+    emitter_append(&all, &small);
+    emitter_lit(&all, ">");
+    const char *s = emitter_to_string(&all, &arena);
+    assert(strlen(s) == 1002);
+    assert(s[0] == '<' && s[1] == '0' && s[10] == '9' && s[1001] == '>');
+    assert(strcmp(emitter_to_string(&small, &arena), s + 1) != 0);  // small 内容不含 '>'
+    assert(emitter_size(&small) == 1000);
+
+    arena_reset(&arena);
+    printf("  ✓ 小初始块与追加测试通过\n");
+}
+
+int main(void) {
+    printf("开始输出缓冲区测试...\n\n");
+
+    test_basic_emit();
+    test_integers();
+    test_chunk_boundaries();
+    test_sized_and_append();
+
+    printf("\n所有测试通过！\n");
+    return 0;
+}
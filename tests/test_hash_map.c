@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include "../src/arena.h"
+#include "../src/hash_map.h"
+
+// 基准中每种规模执行的查找次数
+#define BENCH_LOOKUPS 2000000
+
+// 生成 "<prefix><n>" 形式的键（从 Arena 分配）
+static const char *make_key(Arena *arena, const char *prefix, int n) {
+    char buf[32];
+    int len = snprintf(buf, sizeof(buf), "%s%d", prefix, n);
+    char *key = (char *)arena_alloc(arena, (size_t)len + 1);
+    memcpy(key, buf, (size_t)len + 1);
+    return key;
+}
+
+// 测试插入、查找与替换
+void test_put_get(void) {
+    printf("测试插入、查找与替换...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    HashMap map;
+    hash_map_init(&map, &arena);
+
+    int a = 1, b = 2, c = 3;
+    assert(hash_map_get(&map, "a") == NULL);  // 空表查找
+    assert(hash_map_put(&map, "a", &a) == 1);
+    assert(hash_map_put(&map, "b", &b) == 1);
+    assert(hash_map_get(&map, "a") == &a);
+    assert(hash_map_get(&map, "b") == &b);
+    assert(hash_map_get(&map, "c") == NULL);
+
+    // 相同内容、不同地址的键视为同一个键
+    char key_a[2] = { 'a', '\0' };
+    assert(hash_map_put(&map, key_a, &c) == 0);
+    assert(hash_map_get(&map, "a") == &c);
+    assert(map.count == 2);
+
+    arena_reset(&arena);
+    printf("  ✓ 插入、查找与替换测试通过\n");
+}
+
+// 测试删除与墓碑
+void test_remove(void) {
+    printf("测试删除与墓碑...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    HashMap map;
+    hash_map_init(&map, &arena);
+
+    int values[1000];
+    const char *keys[1000];
+    for (int i = 0; i < 1000; i++) {
+        values[i] = i;
+        keys[i] = make_key(&arena, "k", i);
+        hash_map_put(&map, keys[i], &values[i]);
+    }
+
+    // 删除偶数键：奇数键仍可越过墓碑找到
+    for (int i = 0; i < 1000; i += 2) {
+        assert(hash_map_remove(&map, keys[i]) == &values[i]);
+    }
+    assert(hash_map_remove(&map, keys[0]) == NULL);
+    assert(map.count == 500);
+    for (int i = 0; i < 1000; i++) {
+        assert(hash_map_get(&map, keys[i]) == (i % 2 == 0 ? NULL : &values[i]));
+    }
+
+    // 反复插入删除：墓碑被复用或在重建时清除，容量不随删除次数增长
+    int capacity = map.capacity;
+    for (int round = 0; round < 20; round++) {
+        for (int i = 0; i < 1000; i += 2) {
+            hash_map_put(&map, keys[i], &values[i]);
+        }
+        for (int i = 0; i < 1000; i += 2) {
+            hash_map_remove(&map, keys[i]);
+        }
+    }
+    assert(map.capacity <= capacity * 2);
+    assert(map.count == 500);
+    for (int i = 1; i < 1000; i += 2) {
+        assert(hash_map_get(&map, keys[i]) == &values[i]);
+    }
+
+    arena_reset(&arena);
+    printf("  ✓ 删除与墓碑测试通过\n");
+}
+
+// 测试扩容与插入顺序遍历
+void test_grow_and_order(void) {
+    printf("测试扩容与插入顺序遍历...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    HashMap map;
+    hash_map_init(&map, &arena);
+
+    // 超过原固定大小表（512 槽位）的容量
+    enum { N = 10000 };
+    static int values[N];
+    for (int i = 0; i < N; i++) {
+        values[i] = i;
+        hash_map_put(&map, make_key(&arena, "fn_", i), &values[i]);
+    }
+    assert(map.count == N);
+    assert(map.capacity >= N);
+
+    // 删除部分条目后，遍历顺序仍为插入顺序
+    for (int i = 0; i < N; i += 3) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "fn_%d", i);
+        assert(hash_map_remove(&map, buf) == &values[i]);
+    }
+    int expected = 1;
+    for (int i = 0; i < map.entry_count; i++) {
+        const HashMapEntry *entry = hash_map_entry_at(&map, i);
+        if (entry == NULL) continue;
+        assert(*(int *)entry->value == expected);
+        expected++;
+        if (expected % 3 == 0) expected++;
+    }
+    assert(expected >= N);
+
+    arena_reset(&arena);
+    printf("  ✓ 扩容与插入顺序遍历测试通过\n");
+}
+
+// 微基准：不同规模下命中与未命中查找的平均开销
+// 负载因子始终不超过 3/4，未命中查找遇到空槽位即停止，两者的开销都不应随表中条目数量线性增长
+void bench_lookup(void) {
+    printf("查找开销微基准（每种规模 %d 次查找）...\n", BENCH_LOOKUPS);
+    printf("  %8s %10s %14s %14s\n", "条目数", "槽位数", "命中 ns/次", "未命中 ns/次");
+
+    static const int sizes[] = { 16, 128, 512, 4096, 32768 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        int n = sizes[s];
+        Arena arena;
+        arena_init(&arena, NULL, 0);
+        HashMap map;
+        hash_map_init(&map, &arena);
+
+        const char **hits = (const char **)arena_alloc(&arena, sizeof(const char *) * (size_t)n);
+        const char **misses = (const char **)arena_alloc(&arena, sizeof(const char *) * (size_t)n);
+        for (int i = 0; i < n; i++) {
+            hits[i] = make_key(&arena, "sym_", i);
+            misses[i] = make_key(&arena, "extern_", i);
+            hash_map_put(&map, hits[i], (void *)hits[i]);
+        }
+
+        volatile uintptr_t sink = 0;
+        clock_t start = clock();
+        for (int i = 0; i < BENCH_LOOKUPS; i++) {
+            sink += (uintptr_t)hash_map_get(&map, hits[i % n]);
+        }
+        double hit_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOKUPS;
+
+        start = clock();
+        for (int i = 0; i < BENCH_LOOKUPS; i++) {
+            sink += (uintptr_t)hash_map_get(&map, misses[i % n]);
+        }
+        double miss_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_LOOKUPS;
+        (void)sink;
+
+        printf("  %8d %10d %14.1f %14.1f\n", n, map.capacity, hit_ns, miss_ns);
+        arena_reset(&arena);
+    }
+}
+
+int main(void) {
+    printf("开始哈希表测试...\n\n");
+
+    test_put_get();
+    test_remove();
+    test_grow_and_order();
+    printf("\n");
+    bench_lookup();
+
+    printf("\n所有测试通过！\n");
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../src/arena.h"
+#include "../src/time_report.h"
+
+// 测试计时：同名阶段累加，新阶段按顺序追加，Arena 增量只计正值
+void test_phases(void) {
+    printf("测试阶段计时...\n");
+
+    Arena arena;
+    arena_init(&arena, NULL, 0);
+    TimeReport report;
+    time_report_init(&report);
+
+    TimeReportTimer timer;
+    time_report_start(&report, &timer, &arena);
+    arena_alloc(&arena, 1000);
+    TimeReportPhase *parse = time_report_stop(&report, "parse", &timer);
+    assert(parse != NULL);
+    assert(report.phase_count == 1);
+    assert(parse->count == 1);
+    assert(parse->arena_bytes >= 1000);
+    assert(parse->wall_ms >= 0.0 && parse->cpu_ms >= 0.0);
+
+    // 嵌套计时：外层计时器不受内层影响
+    TimeReportTimer outer;
+    time_report_start(&report, &outer, &arena);
+    time_report_start(&report, &timer, &arena);
+    arena_alloc(&arena, 500);
+    time_report_stop(&report, "check.macro_expand", &timer);
+    time_report_start(&report, &timer, &arena);
+    arena_alloc(&arena, 500);
+    TimeReportPhase *macro = time_report_stop(&report, "check.macro_expand", &timer);
+    TimeReportPhase *check = time_report_stop(&report, "check", &outer);
+    assert(report.phase_count == 3);
+    assert(macro == &report.phases[1] && check == &report.phases[2]);
+    assert(macro->count == 2);
+    assert(macro->arena_bytes >= 1000);
+    assert(check->arena_bytes >= macro->arena_bytes);
+
+    // Arena 回退：不计负增量
+    ArenaMark mark = arena_mark(&arena);
+    arena_alloc(&arena, 4096);
+    time_report_start(&report, &timer, &arena);
+    arena_rewind(&arena, mark);
+    TimeReportPhase *rewind = time_report_stop(&report, "rewind", &timer);
+    assert(rewind->arena_bytes == 0);
+
+    // 未启用统计：不做任何事
+    time_report_start(NULL, &timer, &arena);
+    assert(time_report_stop(NULL, "parse", &timer) == NULL);
+
+    arena_reset(&arena);
+    printf("  ✓ 阶段计时测试通过\n");
+}
+
+// 测试 JSON 输出：包含阶段、总时间与计数字段
+void test_json(void) {
+    printf("测试 JSON 输出...\n");
+
+    TimeReport report;
+    time_report_init(&report);
+    TimeReportTimer timer;
+    time_report_start(&report, &timer, NULL);
+    time_report_stop(&report, "merge", &timer);
+    report.token_count = 12;
+    report.ast_node_count = 34;
+    report.mono_instance_count = 5;
+
+    FILE *f = tmpfile();
+    assert(f != NULL);
+    assert(time_report_write_json(&report, f) == 0);
+    char buf[1024];
+    rewind(f);
+    size_t n = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+
+    assert(buf[0] == '{' && buf[n - 2] == '}');
+    assert(strstr(buf, "{\"name\": \"merge\", \"wall_ms\": ") != NULL);
+    assert(strstr(buf, "\"arena_bytes\": 0, \"count\": 1}") != NULL);
+    assert(strstr(buf, "\"total\": {\"wall_ms\": ") != NULL);
+    assert(strstr(buf, "\"tokens\": 12, \"ast_nodes\": 34") != NULL);
+    assert(strstr(buf, "\"mono_instances\": 5") != NULL);
+
+    // 没有阶段时输出空数组
+    time_report_init(&report);
+    f = tmpfile();
+    assert(f != NULL);
+    assert(time_report_write_json(&report, f) == 0);
+    rewind(f);
+    n = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+    assert(strstr(buf, "\"phases\": [],") != NULL);
+
+    printf("  ✓ JSON 输出测试通过\n");
+}
+
+int main(void) {
+    printf("开始编译统计测试...\n\n");
+
+    test_phases();
+    test_json();
+
+    printf("\n所有测试通过！\n");
+    return 0;
+}